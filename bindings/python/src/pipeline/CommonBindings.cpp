@@ -37,6 +37,7 @@
 #include "depthai/common/CameraExposureOffset.hpp"
 #include "depthai/common/CameraFeatures.hpp"
 #include "depthai/common/StereoPair.hpp"
+#include "depthai/utility/MemoryPool.hpp"
 #include "depthai/utility/ProfilingData.hpp"
 
 void CommonBindings::bind(pybind11::module& m, void* pCallstack) {
@@ -77,6 +78,7 @@ void CommonBindings::bind(pybind11::module& m, void* pCallstack) {
     py::enum_<Colormap> colormap(m, "Colormap", DOC(dai, Colormap));
     py::enum_<FrameEvent> frameEvent(m, "FrameEvent", DOC(dai, FrameEvent));
     py::class_<ProfilingData> profilingData(m, "ProfilingData", DOC(dai, ProfilingData));
+    py::class_<MemoryPool::Stats> memoryPoolStats(m, "MemoryPoolStats", DOC(dai, MemoryPool, Stats));
     py::enum_<Interpolation> interpolation(m, "Interpolation", DOC(dai, Interpolation));
 
     ///////////////////////////////////////////////////////////////////////
@@ -419,4 +421,10 @@ void CommonBindings::bind(pybind11::module& m, void* pCallstack) {
 
     profilingData.def_readwrite("numBytesWritten", &ProfilingData::numBytesWritten, DOC(dai, ProfilingData, numBytesWritten))
         .def_readwrite("numBytesRead", &ProfilingData::numBytesRead, DOC(dai, ProfilingData, numBytesRead));
+
+    memoryPoolStats.def(py::init<>())
+        .def_readwrite("capacity", &MemoryPool::Stats::capacity, DOC(dai, MemoryPool, Stats, capacity))
+        .def_readwrite("inUse", &MemoryPool::Stats::inUse, DOC(dai, MemoryPool, Stats, inUse))
+        .def_readwrite("highWaterMark", &MemoryPool::Stats::highWaterMark, DOC(dai, MemoryPool, Stats, highWaterMark))
+        .def_readwrite("overflows", &MemoryPool::Stats::overflows, DOC(dai, MemoryPool, Stats, overflows));
 }
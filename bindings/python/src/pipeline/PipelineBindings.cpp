@@ -8,6 +8,7 @@
 
 // depthai
 #include "depthai/pipeline/Pipeline.hpp"
+#include "depthai/pipeline/QueueStats.hpp"
 #include "depthai/pipeline/ThreadedHostNode.hpp"
 
 // depthai - nodes
@@ -63,6 +64,7 @@ void PipelineBindings::bind(pybind11::module& m, void* pCallstack) {
     py::class_<GlobalProperties> globalProperties(m, "GlobalProperties", DOC(dai, GlobalProperties));
     py::class_<RecordConfig> recordConfig(m, "RecordConfig", DOC(dai, RecordConfig));
     py::class_<RecordConfig::VideoEncoding> recordVideoConfig(recordConfig, "VideoEncoding", DOC(dai, RecordConfig, VideoEncoding));
+    py::class_<QueueStats> queueStats(m, "QueueStats", DOC(dai, QueueStats));
     py::class_<Pipeline> pipeline(m, "Pipeline", DOC(dai, Pipeline, 2));
 
     ///////////////////////////////////////////////////////////////////////
@@ -101,6 +103,22 @@ void PipelineBindings::bind(pybind11::module& m, void* pCallstack) {
         .def_readwrite("videoEncoding", &RecordConfig::videoEncoding, DOC(dai, RecordConfig, videoEncoding))
         .def_readwrite("compressionLevel", &RecordConfig::compressionLevel, DOC(dai, RecordConfig, compressionLevel));
 
+    queueStats.def(py::init<>())
+        .def_readwrite("name", &QueueStats::name, DOC(dai, QueueStats, name))
+        .def_readwrite("enqueued", &QueueStats::enqueued, DOC(dai, QueueStats, enqueued))
+        .def_readwrite("dequeued", &QueueStats::dequeued, DOC(dai, QueueStats, dequeued))
+        .def_readwrite("dropped", &QueueStats::dropped, DOC(dai, QueueStats, dropped))
+        .def_readwrite("failed", &QueueStats::failed, DOC(dai, QueueStats, failed))
+        .def_readwrite("blockedTime", &QueueStats::blockedTime, DOC(dai, QueueStats, blockedTime))
+        .def_readwrite("maxBlockedTime", &QueueStats::maxBlockedTime)
+        .def_readwrite("latency", &QueueStats::latency, DOC(dai, QueueStats, latency))
+        .def_readwrite("maxLatency", &QueueStats::maxLatency)
+        .def_readwrite("callbackCalls", &QueueStats::callbackCalls, DOC(dai, QueueStats, callbackCalls))
+        .def_readwrite("callbackTime", &QueueStats::callbackTime)
+        .def_readwrite("maxCallbackTime", &QueueStats::maxCallbackTime)
+        .def_readwrite("depthHistogram", &QueueStats::depthHistogram, DOC(dai, QueueStats, depthHistogram))
+        .def("getAverageLatency", &QueueStats::getAverageLatency, DOC(dai, QueueStats, getAverageLatency));
+
     // bind pipeline
     pipeline.def(py::init<bool>(), py::arg("createImplicitDevice") = true, DOC(dai, Pipeline, Pipeline))
         .def(py::init<std::shared_ptr<Device>>(), py::arg("defaultDevice"), DOC(dai, Pipeline, Pipeline))
@@ -239,7 +257,13 @@ void PipelineBindings::bind(pybind11::module& m, void* pCallstack) {
         .def("isBuilt", &Pipeline::isBuilt)
         .def("isRunning", &Pipeline::isRunning)
         .def("processTasks", &Pipeline::processTasks, py::arg("waitForTasks") = false, py::arg("timeoutSeconds") = -1.0)
+        .def("setHostExecutorThreads", &Pipeline::setHostExecutorThreads, py::arg("numThreads"), DOC(dai, Pipeline, setHostExecutorThreads))
+        .def("getHostExecutorThreads", &Pipeline::getHostExecutorThreads, DOC(dai, Pipeline, getHostExecutorThreads))
         .def("enableHolisticRecord", &Pipeline::enableHolisticRecord, py::arg("recordConfig"), DOC(dai, Pipeline, enableHolisticRecord))
-        .def("enableHolisticReplay", &Pipeline::enableHolisticReplay, py::arg("recordingPath"), DOC(dai, Pipeline, enableHolisticReplay));
+        .def("enableHolisticReplay", &Pipeline::enableHolisticReplay, py::arg("recordingPath"), DOC(dai, Pipeline, enableHolisticReplay))
+        .def("enableQueueStats", &Pipeline::enableQueueStats, py::arg("enable") = true, DOC(dai, Pipeline, enableQueueStats))
+        .def("getQueueStats", &Pipeline::getQueueStats, DOC(dai, Pipeline, getQueueStats))
+        .def("getQueueTrace", &Pipeline::getQueueTrace, DOC(dai, Pipeline, getQueueTrace))
+        .def("exportQueueTrace", &Pipeline::exportQueueTrace, py::arg("path"), DOC(dai, Pipeline, exportQueueTrace));
     ;
 }
@@ -55,6 +55,18 @@ void bind_pointclouddata(pybind11::module& m, void* pCallstack) {
         .def("getPoints",
              [](py::object& obj) {
                  dai::PointCloudData& data = obj.cast<dai::PointCloudData&>();
+                 if(data.isPlanar()) {
+                     const float* planes = (const float*)data.getData().data();
+                     unsigned long size = data.getData().size() / (data.isColor() ? sizeof(Point3fRGBA) : sizeof(Point3f));
+                     py::array_t<float> arr({size, 3UL});
+                     auto ra = arr.mutable_unchecked();
+                     for(unsigned long i = 0; i < size; i++) {
+                         ra(i, 0) = planes[i];
+                         ra(i, 1) = planes[size + i];
+                         ra(i, 2) = planes[2 * size + i];
+                     }
+                     return arr;
+                 }
                  if(data.isColor()) {
                      Point3fRGBA* points = (Point3fRGBA*)data.getData().data();
                      unsigned long size = data.getData().size() / sizeof(Point3fRGBA);
@@ -84,6 +96,22 @@ void bind_pointclouddata(pybind11::module& m, void* pCallstack) {
                  if(!data.isColor()) {
                      throw std::runtime_error("PointCloudData does not contain color data");
                  }
+                 if(data.isPlanar()) {
+                     const float* planes = (const float*)data.getData().data();
+                     unsigned long size = data.getData().size() / sizeof(Point3fRGBA);
+                     const uint8_t* colors = data.getData().data() + 3 * size * sizeof(float);
+                     py::array_t<float> arr({size, 3UL});
+                     auto ra = arr.mutable_unchecked();
+                     py::array_t<uint8_t> arr2({size, 4UL});
+                     auto ra2 = arr2.mutable_unchecked();
+                     for(unsigned long i = 0; i < size; i++) {
+                         ra(i, 0) = planes[i];
+                         ra(i, 1) = planes[size + i];
+                         ra(i, 2) = planes[2 * size + i];
+                         for(int c = 0; c < 4; c++) ra2(i, c) = colors[4 * i + c];
+                     }
+                     return py::make_tuple(arr, arr2);
+                 }
                  Point3fRGBA* points = (Point3fRGBA*)data.getData().data();
                  unsigned long size = data.getData().size() / sizeof(Point3fRGBA);
                  py::array_t<float> arr({size, 3UL});
@@ -107,6 +135,8 @@ void bind_pointclouddata(pybind11::module& m, void* pCallstack) {
         .def("getHeight", &PointCloudData::getHeight, DOC(dai, PointCloudData, getHeight))
         .def("isSparse", &PointCloudData::isSparse, DOC(dai, PointCloudData, isSparse))
         .def("isColor", &PointCloudData::isColor, DOC(dai, PointCloudData, isColor))
+        .def("isPlanar", &PointCloudData::isPlanar, DOC(dai, PointCloudData, isPlanar))
+        .def("getInterleaved", &PointCloudData::getInterleaved, DOC(dai, PointCloudData, getInterleaved))
         .def("getMinX", &PointCloudData::getMinX, DOC(dai, PointCloudData, getMinX))
         .def("getMinY", &PointCloudData::getMinY, DOC(dai, PointCloudData, getMinY))
         .def("getMinZ", &PointCloudData::getMinZ, DOC(dai, PointCloudData, getMinZ))
@@ -115,6 +115,8 @@ void bind_hostnode(pybind11::module& m, void* pCallstack) {
         .def("runSyncingOnHost", &HostNode::runSyncingOnHost, DOC(dai, node, HostNode, runSyncingOnHost))
         .def("runSyncingOnDevice", &HostNode::runSyncingOnDevice, DOC(dai, node, HostNode, runSyncingOnDevice))
         .def("sendProcessingToPipeline", &HostNode::sendProcessingToPipeline, DOC(dai, node, HostNode, sendProcessingToPipeline))
+        .def("runOnExecutor", &HostNode::runOnExecutor, py::arg("maxInFlight") = 1, DOC(dai, node, HostNode, runOnExecutor))
+        .def("getExecutorMaxInFlight", &HostNode::getExecutorMaxInFlight, DOC(dai, node, HostNode, getExecutorMaxInFlight))
         .def("onStart", &HostNode::onStart)
         .def("onStop", &HostNode::onStop);
 
@@ -64,6 +64,9 @@ void bind_imagefilters(py::module& m, void* pCallstack) {
         .def_readonly("initialConfig", &ImageFilters::initialConfig, DOC(dai, node, ImageFilters, initialConfig))
         .def("setRunOnHost", &ImageFilters::setRunOnHost, py::arg("runOnHost"), DOC(dai, node, ImageFilters, setRunOnHost))
         .def("runOnHost", &ImageFilters::runOnHost, DOC(dai, node, ImageFilters, runOnHost))
+        .def("setNumFramesPool", &ImageFilters::setNumFramesPool, py::arg("numFramesPool"), DOC(dai, node, ImageFilters, setNumFramesPool))
+        .def("getNumFramesPool", &ImageFilters::getNumFramesPool, DOC(dai, node, ImageFilters, getNumFramesPool))
+        .def("getPoolStats", &ImageFilters::getPoolStats, DOC(dai, node, ImageFilters, getPoolStats))
         .def("build",
              py::overload_cast<Node::Output&, ImageFiltersPresetMode>(&ImageFilters::build),
              py::arg("input"),
@@ -0,0 +1,35 @@
+#include "Common.hpp"
+#include "NodeBindings.hpp"
+#include "depthai/pipeline/ThreadedHostNode.hpp"
+#include "depthai/pipeline/node/host/ImageManipBatch.hpp"
+
+void bind_imagemanipbatch(pybind11::module& m, void* pCallstack) {
+    using namespace dai;
+    using namespace dai::node;
+
+    // declare upfront
+    auto imageManipBatch = ADD_NODE_DERIVED(ImageManipBatch, ThreadedHostNode);
+
+    ///////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////
+    // Call the rest of the type defines, then perform the actual bindings
+    Callstack* callstack = (Callstack*)pCallstack;
+    auto cb = callstack->top();
+    callstack->pop();
+    cb(m, pCallstack);
+    // Actual bindings
+    ///////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////
+
+    // ImageManipBatch Node
+    imageManipBatch.def_readonly("inputConfig", &ImageManipBatch::inputConfig, DOC(dai, node, ImageManipBatch, inputConfig))
+        .def_readonly("inputImage", &ImageManipBatch::inputImage, DOC(dai, node, ImageManipBatch, inputImage))
+        .def_readonly("out", &ImageManipBatch::out, DOC(dai, node, ImageManipBatch, out))
+        .def_readonly("outTensor", &ImageManipBatch::outTensor, DOC(dai, node, ImageManipBatch, outTensor))
+        .def("setNumFramesPool", &ImageManipBatch::setNumFramesPool, py::arg("numFramesPool"), DOC(dai, node, ImageManipBatch, setNumFramesPool))
+        .def("getNumFramesPool", &ImageManipBatch::getNumFramesPool, DOC(dai, node, ImageManipBatch, getNumFramesPool))
+        .def("setNumThreads", &ImageManipBatch::setNumThreads, py::arg("numThreads"), DOC(dai, node, ImageManipBatch, setNumThreads))
+        .def("getNumThreads", &ImageManipBatch::getNumThreads, DOC(dai, node, ImageManipBatch, getNumThreads));
+}
@@ -39,6 +39,8 @@ void bind_imagemanip(pybind11::module& m, void* pCallstack) {
         .def("setRunOnHost", &ImageManip::setRunOnHost, DOC(dai, node, ImageManip, setRunOnHost))
         .def("setBackend", &ImageManip::setBackend, DOC(dai, node, ImageManip, setBackend))
         .def("setPerformanceMode", &ImageManip::setPerformanceMode, DOC(dai, node, ImageManip, setPerformanceMode))
+        .def("setNumThreads", &ImageManip::setNumThreads, py::arg("numThreads"), DOC(dai, node, ImageManip, setNumThreads))
+        .def("getNumThreads", &ImageManip::getNumThreads, DOC(dai, node, ImageManip, getNumThreads))
         .def("setNumFramesPool", &ImageManip::setNumFramesPool, DOC(dai, node, ImageManip, setNumFramesPool))
         .def("setMaxOutputFrameSize", &ImageManip::setMaxOutputFrameSize, DOC(dai, node, ImageManip, setMaxOutputFrameSize));
 }
@@ -47,5 +47,12 @@ void bind_rgbd(pybind11::module& m, void* pCallstack) {
         .def("useCPU", &RGBD::useCPU, DOC(dai, node, RGBD, useCPU))
         .def("useCPUMT", &RGBD::useCPUMT, py::arg("numThreads") = 2, DOC(dai, node, RGBD, useCPUMT))
         .def("useGPU", &RGBD::useGPU, py::arg("device") = 0, DOC(dai, node, RGBD, useGPU))
-        .def("printDevices", &RGBD::printDevices, DOC(dai, node, RGBD, printDevices));
+        .def("printDevices", &RGBD::printDevices, DOC(dai, node, RGBD, printDevices))
+        .def("setNumFramesPool", &RGBD::setNumFramesPool, py::arg("numFramesPool"), DOC(dai, node, RGBD, setNumFramesPool))
+        .def("getNumFramesPool", &RGBD::getNumFramesPool, DOC(dai, node, RGBD, getNumFramesPool))
+        .def("getPoolStats", &RGBD::getPoolStats, DOC(dai, node, RGBD, getPoolStats))
+        .def("setDropInvalidPoints", &RGBD::setDropInvalidPoints, py::arg("drop"), DOC(dai, node, RGBD, setDropInvalidPoints))
+        .def("getDropInvalidPoints", &RGBD::getDropInvalidPoints, DOC(dai, node, RGBD, getDropInvalidPoints))
+        .def("setPlanarOutput", &RGBD::setPlanarOutput, py::arg("planar"), DOC(dai, node, RGBD, setPlanarOutput))
+        .def("getPlanarOutput", &RGBD::getPlanarOutput, DOC(dai, node, RGBD, getPlanarOutput));
 }
@@ -9,6 +9,7 @@ void bind_record(pybind11::module& m, void* pCallstack) {
 
     auto recordVideo = ADD_NODE_DERIVED(RecordVideo, ThreadedHostNode);
     auto recordMessage = ADD_NODE_DERIVED(RecordMetadataOnly, ThreadedHostNode);
+    py::class_<RecordWriterStats> recordWriterStats(daiNodeModule, "RecordWriterStats", DOC(dai, node, RecordWriterStats));
 
     ///////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////
@@ -22,6 +23,14 @@ void bind_record(pybind11::module& m, void* pCallstack) {
     ///////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////
+    recordWriterStats.def(py::init<>())
+        .def_readwrite("queuedBytes", &RecordWriterStats::queuedBytes, DOC(dai, node, RecordWriterStats, queuedBytes))
+        .def_readwrite("maxQueuedBytes", &RecordWriterStats::maxQueuedBytes, DOC(dai, node, RecordWriterStats, maxQueuedBytes))
+        .def_readwrite("writtenBytes", &RecordWriterStats::writtenBytes, DOC(dai, node, RecordWriterStats, writtenBytes))
+        .def_readwrite("writtenMessages", &RecordWriterStats::writtenMessages, DOC(dai, node, RecordWriterStats, writtenMessages))
+        .def_readwrite("droppedBytes", &RecordWriterStats::droppedBytes, DOC(dai, node, RecordWriterStats, droppedBytes))
+        .def_readwrite("droppedMessages", &RecordWriterStats::droppedMessages, DOC(dai, node, RecordWriterStats, droppedMessages));
+
     // Node
     recordVideo.def_readonly("input", &RecordVideo::input, DOC(dai, node, RecordVideo, input))
         .def("setRecordMetadataFile", &RecordVideo::setRecordMetadataFile, py::arg("recordFile"), DOC(dai, node, RecordVideo, setRecordMetadataFile))
@@ -29,7 +38,15 @@ void bind_record(pybind11::module& m, void* pCallstack) {
         .def("setCompressionLevel", &RecordVideo::setCompressionLevel, py::arg("compressionLevel"), DOC(dai, node, RecordVideo, setCompressionLevel))
         .def("getRecordMetadataFile", &RecordVideo::getRecordMetadataFile, DOC(dai, node, RecordVideo, getRecordMetadataFile))
         .def("getRecordVideoFile", &RecordVideo::getRecordVideoFile, DOC(dai, node, RecordVideo, getRecordVideoFile))
-        .def("getCompressionLevel", &RecordVideo::getCompressionLevel, DOC(dai, node, RecordVideo, getCompressionLevel));
+        .def("getCompressionLevel", &RecordVideo::getCompressionLevel, DOC(dai, node, RecordVideo, getCompressionLevel))
+        .def("setAsyncWrite",
+             &RecordVideo::setAsyncWrite,
+             py::arg("maxQueuedBytes"),
+             py::arg("dropWhenFull") = false,
+             DOC(dai, node, RecordVideo, setAsyncWrite))
+        .def("getAsyncWriteQueueSize", &RecordVideo::getAsyncWriteQueueSize, DOC(dai, node, RecordVideo, getAsyncWriteQueueSize))
+        .def("getAsyncWriteDropWhenFull", &RecordVideo::getAsyncWriteDropWhenFull, DOC(dai, node, RecordVideo, getAsyncWriteDropWhenFull))
+        .def("getWriterStats", &RecordVideo::getWriterStats, DOC(dai, node, RecordVideo, getWriterStats));
 
     recordMessage.def_readonly("input", &RecordMetadataOnly::input, DOC(dai, node, RecordMetadataOnly, input))
         .def("setRecordFile", &RecordMetadataOnly::setRecordFile, py::arg("recordFile"), DOC(dai, node, RecordMetadataOnly, setRecordFile))
@@ -38,5 +55,13 @@ void bind_record(pybind11::module& m, void* pCallstack) {
              py::arg("compressionLevel"),
              DOC(dai, node, RecordMetadataOnly, setCompressionLevel))
         .def("getRecordFile", &RecordMetadataOnly::getRecordFile, DOC(dai, node, RecordMetadataOnly, getRecordFile))
-        .def("getCompressionLevel", &RecordMetadataOnly::getCompressionLevel, DOC(dai, node, RecordMetadataOnly, getCompressionLevel));
+        .def("getCompressionLevel", &RecordMetadataOnly::getCompressionLevel, DOC(dai, node, RecordMetadataOnly, getCompressionLevel))
+        .def("setAsyncWrite",
+             &RecordMetadataOnly::setAsyncWrite,
+             py::arg("maxQueuedBytes"),
+             py::arg("dropWhenFull") = false,
+             DOC(dai, node, RecordMetadataOnly, setAsyncWrite))
+        .def("getAsyncWriteQueueSize", &RecordMetadataOnly::getAsyncWriteQueueSize, DOC(dai, node, RecordMetadataOnly, getAsyncWriteQueueSize))
+        .def("getAsyncWriteDropWhenFull", &RecordMetadataOnly::getAsyncWriteDropWhenFull, DOC(dai, node, RecordMetadataOnly, getAsyncWriteDropWhenFull))
+        .def("getWriterStats", &RecordMetadataOnly::getWriterStats, DOC(dai, node, RecordMetadataOnly, getWriterStats));
 }
@@ -31,12 +31,21 @@ void bind_replay(pybind11::module& m, void* pCallstack) {
         .def("setSize", py::overload_cast<std::tuple<int, int>>(&ReplayVideo::setSize), py::arg("size"), DOC(dai, node, ReplayVideo, setSize))
         .def("setFps", &ReplayVideo::setFps, py::arg("fps"), DOC(dai, node, ReplayVideo, setFps))
         .def("setLoop", &ReplayVideo::setLoop, py::arg("loop"), DOC(dai, node, ReplayVideo, setLoop))
+        .def("setNumFramesPool", &ReplayVideo::setNumFramesPool, py::arg("numFramesPool"), DOC(dai, node, ReplayVideo, setNumFramesPool))
+        .def("getNumFramesPool", &ReplayVideo::getNumFramesPool, DOC(dai, node, ReplayVideo, getNumFramesPool))
+        .def("getPoolStats", &ReplayVideo::getPoolStats, DOC(dai, node, ReplayVideo, getPoolStats))
         .def("getReplayMetadataFile", &ReplayVideo::getReplayMetadataFile, DOC(dai, node, ReplayVideo, getReplayMetadataFile))
         .def("getReplayVideoFile", &ReplayVideo::getReplayVideoFile, DOC(dai, node, ReplayVideo, getReplayVideoFile))
         .def("getOutFrameType", &ReplayVideo::getOutFrameType, DOC(dai, node, ReplayVideo, getOutFrameType))
         .def("getSize", &ReplayVideo::getSize, DOC(dai, node, ReplayVideo, getSize))
         .def("getFps", &ReplayVideo::getFps, DOC(dai, node, ReplayVideo, getFps))
-        .def("getLoop", &ReplayVideo::getLoop, DOC(dai, node, ReplayVideo, getLoop));
+        .def("getLoop", &ReplayVideo::getLoop, DOC(dai, node, ReplayVideo, getLoop))
+        .def("seek", &ReplayVideo::seek, py::arg("timestamp"), DOC(dai, node, ReplayVideo, seek))
+        .def("seekToSequenceNum", &ReplayVideo::seekToSequenceNum, py::arg("sequenceNum"), DOC(dai, node, ReplayVideo, seekToSequenceNum))
+        .def("setMaxSpeed", &ReplayVideo::setMaxSpeed, py::arg("maxSpeed"), DOC(dai, node, ReplayVideo, setMaxSpeed))
+        .def("getMaxSpeed", &ReplayVideo::getMaxSpeed, DOC(dai, node, ReplayVideo, getMaxSpeed))
+        .def("setPrefetchSize", &ReplayVideo::setPrefetchSize, py::arg("prefetchSize"), DOC(dai, node, ReplayVideo, setPrefetchSize))
+        .def("getPrefetchSize", &ReplayVideo::getPrefetchSize, DOC(dai, node, ReplayVideo, getPrefetchSize));
 
     replayMessage.def_readonly("out", &ReplayMetadataOnly::out, DOC(dai, node, ReplayMetadataOnly, out))
         .def("setReplayFile", &ReplayMetadataOnly::setReplayFile, py::arg("replayFile"), DOC(dai, node, ReplayMetadataOnly, setReplayFile))
@@ -44,5 +53,11 @@ void bind_replay(pybind11::module& m, void* pCallstack) {
         .def("setLoop", &ReplayMetadataOnly::setLoop, py::arg("loop"), DOC(dai, node, ReplayMetadataOnly, setLoop))
         .def("getReplayFile", &ReplayMetadataOnly::getReplayFile, DOC(dai, node, ReplayMetadataOnly, getReplayFile))
         .def("getFps", &ReplayMetadataOnly::getFps, DOC(dai, node, ReplayMetadataOnly, getFps))
-        .def("getLoop", &ReplayMetadataOnly::getLoop, DOC(dai, node, ReplayMetadataOnly, getLoop));
+        .def("getLoop", &ReplayMetadataOnly::getLoop, DOC(dai, node, ReplayMetadataOnly, getLoop))
+        .def("seek", &ReplayMetadataOnly::seek, py::arg("timestamp"), DOC(dai, node, ReplayMetadataOnly, seek))
+        .def("seekToSequenceNum", &ReplayMetadataOnly::seekToSequenceNum, py::arg("sequenceNum"), DOC(dai, node, ReplayMetadataOnly, seekToSequenceNum))
+        .def("setMaxSpeed", &ReplayMetadataOnly::setMaxSpeed, py::arg("maxSpeed"), DOC(dai, node, ReplayMetadataOnly, setMaxSpeed))
+        .def("getMaxSpeed", &ReplayMetadataOnly::getMaxSpeed, DOC(dai, node, ReplayMetadataOnly, getMaxSpeed))
+        .def("setPrefetchSize", &ReplayMetadataOnly::setPrefetchSize, py::arg("prefetchSize"), DOC(dai, node, ReplayMetadataOnly, setPrefetchSize))
+        .def("getPrefetchSize", &ReplayMetadataOnly::getPrefetchSize, DOC(dai, node, ReplayMetadataOnly, getPrefetchSize));
 }
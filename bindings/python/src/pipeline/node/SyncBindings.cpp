@@ -12,6 +12,7 @@ void bind_sync(pybind11::module& m, void* pCallstack) {
     // Node and Properties declare upfront
     py::class_<SyncProperties> syncProperties(m, "SyncProperties", DOC(dai, SyncProperties));
     auto sync = ADD_NODE(Sync);
+    py::class_<Sync::SyncStats> syncStats(sync, "SyncStats", DOC(dai, node, Sync, SyncStats));
 
     ///////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////
@@ -29,6 +30,12 @@ void bind_sync(pybind11::module& m, void* pCallstack) {
     // Properties
     syncProperties.def_readwrite("syncThresholdNs", &SyncProperties::syncThresholdNs).def_readwrite("syncAttempts", &SyncProperties::syncAttempts);
 
+    syncStats.def(py::init<>())
+        .def_readwrite("groups", &Sync::SyncStats::groups, DOC(dai, node, Sync, SyncStats, groups))
+        .def_readwrite("matched", &Sync::SyncStats::matched, DOC(dai, node, Sync, SyncStats, matched))
+        .def_readwrite("dropped", &Sync::SyncStats::dropped, DOC(dai, node, Sync, SyncStats, dropped))
+        .def_readwrite("late", &Sync::SyncStats::late, DOC(dai, node, Sync, SyncStats, late));
+
     // Node
     sync.def_readonly("out", &Sync::out, DOC(dai, node, Sync, out))
         .def_readonly("inputs", &Sync::inputs, DOC(dai, node, Sync, inputs))
@@ -37,6 +44,7 @@ void bind_sync(pybind11::module& m, void* pCallstack) {
         .def("getSyncThreshold", &Sync::getSyncThreshold, DOC(dai, node, Sync, getSyncThreshold))
         .def("getSyncAttempts", &Sync::getSyncAttempts, DOC(dai, node, Sync, getSyncAttempts))
         .def("setRunOnHost", &Sync::setRunOnHost, py::arg("runOnHost"), DOC(dai, node, Sync, setRunOnHost))
-        .def("runOnHost", &Sync::runOnHost, DOC(dai, node, Sync, runOnHost));
+        .def("runOnHost", &Sync::runOnHost, DOC(dai, node, Sync, runOnHost))
+        .def("getStats", &Sync::getStats, DOC(dai, node, Sync, getStats));
     daiNodeModule.attr("Sync").attr("Properties") = syncProperties;
 }
@@ -23,7 +23,21 @@ void RemoteConnectionBindings::bind(pybind11::module& m, void* pCallstack) {
     ///////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////
 #ifdef DEPTHAI_ENABLE_REMOTE_CONNECTION
-    py::class_<RemoteConnection>(m, "RemoteConnection")
+    py::class_<RemoteConnection> remoteConnection(m, "RemoteConnection");
+    py::class_<RemoteConnection::TopicStats>(remoteConnection, "TopicStats", DOC(dai, RemoteConnection, TopicStats))
+        .def(py::init<>())
+        .def_readwrite("receivedMessages", &RemoteConnection::TopicStats::receivedMessages, DOC(dai, RemoteConnection, TopicStats, receivedMessages))
+        .def_readwrite("publishedMessages", &RemoteConnection::TopicStats::publishedMessages, DOC(dai, RemoteConnection, TopicStats, publishedMessages))
+        .def_readwrite("skippedMessages", &RemoteConnection::TopicStats::skippedMessages, DOC(dai, RemoteConnection, TopicStats, skippedMessages))
+        .def_readwrite("publishedBytes", &RemoteConnection::TopicStats::publishedBytes, DOC(dai, RemoteConnection, TopicStats, publishedBytes));
+    py::class_<RemoteConnection::PreviewConfig>(remoteConnection, "PreviewConfig", DOC(dai, RemoteConnection, PreviewConfig))
+        .def(py::init<>())
+        .def_readwrite("maxWidth", &RemoteConnection::PreviewConfig::maxWidth, DOC(dai, RemoteConnection, PreviewConfig, maxWidth))
+        .def_readwrite("maxHeight", &RemoteConnection::PreviewConfig::maxHeight, DOC(dai, RemoteConnection, PreviewConfig, maxHeight))
+        .def_readwrite("encodeJpeg", &RemoteConnection::PreviewConfig::encodeJpeg, DOC(dai, RemoteConnection, PreviewConfig, encodeJpeg))
+        .def_readwrite("jpegQuality", &RemoteConnection::PreviewConfig::jpegQuality, DOC(dai, RemoteConnection, PreviewConfig, jpegQuality));
+
+    remoteConnection
         .def(py::init<const std::string&, uint16_t, bool, uint16_t>(),
              py::arg("address") = RemoteConnection::DEFAULT_ADDRESS,
              py::arg("webSocketPort") = RemoteConnection::DEFAULT_WEBSOCKET_PORT,
@@ -51,6 +65,23 @@ void RemoteConnectionBindings::bind(pybind11::module& m, void* pCallstack) {
              py::arg("topicName"),
              py::call_guard<py::gil_scoped_release>(),
              DOC(dai, RemoteConnection, removeTopic))
+        .def("setTopicMaxRate",
+             &RemoteConnection::setTopicMaxRate,
+             py::arg("topicName"),
+             py::arg("maxRate"),
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(dai, RemoteConnection, setTopicMaxRate))
+        .def("setTopicPreview",
+             &RemoteConnection::setTopicPreview,
+             py::arg("topicName"),
+             py::arg("config"),
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(dai, RemoteConnection, setTopicPreview))
+        .def("getTopicStats",
+             &RemoteConnection::getTopicStats,
+             py::arg("topicName"),
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(dai, RemoteConnection, getTopicStats))
         .def("registerPipeline", &RemoteConnection::registerPipeline, py::arg("pipeline"), DOC(dai, RemoteConnection, registerPipeline))
         .def("registerService", &RemoteConnection::registerService, py::arg("serviceName"), py::arg("callback"), DOC(dai, RemoteConnection, registerService))
         .def("waitKey", &RemoteConnection::waitKey, py::arg("delay"), py::call_guard<py::gil_scoped_release>(), DOC(dai, RemoteConnection, waitKey));
@@ -3,6 +3,7 @@
 #include <depthai/common/ModelType.hpp>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include "depthai/device/Device.hpp"  // For platform enum
@@ -34,6 +35,10 @@ class NNArchive {
     /**
      * @brief Construct a new NNArchive object - a container holding a model and its configuration
      *
+     * The archive is unpacked once into a subfolder of extractFolder (by default in the user's cache folder) named by the archive's hash,
+     * later loads of the same archive (also from other processes) reuse the unpacked files.
+     * Blobs and superblobs are loaded from the unpacked files on first use.
+     *
      * @param archivePath: Path to the archive file
      * @param options: Archive options such as compression, number of shaves, etc. See NNArchiveOptions.
      */
@@ -114,23 +119,26 @@ class NNArchive {
     model::ModelType getModelType() const;
 
    private:
-    // Read model from archive
-    std::vector<uint8_t> readModelFromArchive(const std::filesystem::path& archivePath, const std::string& modelPathInArchive) const;
-
-    // Unpack archive to tmp directory
+    // Unpack archive to tmp directory, unless it was already unpacked there
     void unpackArchiveInDirectory(const std::filesystem::path& archivePath, const std::filesystem::path& directory) const;
 
+    // Load the unpacked blob on first use
+    const OpenVINO::Blob& loadBlob() const;
+
     model::ModelType modelType;
     NNArchiveOptions archiveOptions;
 
     // Archive config
     std::shared_ptr<NNArchiveVersionedConfig> archiveVersionedConfigPtr;
 
-    // Blob related stuff
-    std::shared_ptr<OpenVINO::Blob> blobPtr;
+    // Blob related stuff, loaded on first use
+    mutable std::shared_ptr<OpenVINO::Blob> blobPtr;
+
+    // Superblob related stuff, loaded on first use. The superblob file is memory mapped
+    mutable std::shared_ptr<OpenVINO::SuperBlob> superblobPtr;
 
-    // Superblob related stuff
-    std::shared_ptr<OpenVINO::SuperBlob> superblobPtr;
+    // Guards the loads on first use
+    std::shared_ptr<std::mutex> modelMtx = std::make_shared<std::mutex>();
 
     // Other formats - return path to the unpacked archive
     std::filesystem::path unpackedModelPath;
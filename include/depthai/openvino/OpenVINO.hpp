@@ -4,12 +4,14 @@
 #include <exception>
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "depthai/common/TensorInfo.hpp"
+#include "depthai/utility/Memory.hpp"
 
 namespace dai {
 
@@ -70,7 +72,7 @@ class OpenVINO {
         SuperBlob(std::vector<uint8_t> data);
 
         /**
-         * @brief Construct a new SuperBlob object
+         * @brief Construct a new SuperBlob object. The file is memory mapped, only the base blob and the requested patch are read from it
          *
          * @param pathToSuperBlobFile: Path to the superblob file (.superblob suffix)
          */
@@ -89,14 +91,14 @@ class OpenVINO {
         struct SuperBlobHeader {
             static constexpr size_t HEADER_SIZE = 1 * sizeof(uint64_t) + NUMBER_OF_PATCHES * sizeof(uint64_t);
 
-            static SuperBlobHeader fromData(const std::vector<uint8_t>& data);
+            static SuperBlobHeader fromData(span<const uint8_t> data);
 
             int64_t blobSize;
             std::vector<int64_t> patchSizes;
         };
 
-        // Read the SuperBlob file into memory
-        std::vector<uint8_t> readSuperBlobFile(const std::filesystem::path& path);
+        // Map the SuperBlob file into memory
+        std::shared_ptr<Memory> mapSuperBlobFile(const std::filesystem::path& path);
 
         // Get a pointer to the first byte of the blob data
         const uint8_t* getBlobDataPointer();
@@ -117,7 +119,8 @@ class OpenVINO {
         void validateSuperblob();
 
         SuperBlobHeader header;
-        std::vector<uint8_t> data;
+        // Shared between copies, mapped when loaded from a file
+        std::shared_ptr<const Memory> data;
     };
 
     /// Main OpenVINO version
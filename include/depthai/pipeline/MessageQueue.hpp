@@ -5,12 +5,17 @@
 #include <vector>
 
 // project
+#include "depthai/pipeline/QueueStats.hpp"
+#include "depthai/pipeline/TraceEvent.hpp"
 #include "depthai/pipeline/datatype/ADatatype.hpp"
+#include "depthai/utility/LockFreeQueue.hpp"
 #include "depthai/utility/LockingQueue.hpp"
 
 // shared
 namespace dai {
 
+class QueueInstrumentation;
+
 /**
  * Thread safe queue to send messages between nodes
  */
@@ -24,10 +29,26 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
         explicit QueueException(const std::string& message) : std::runtime_error(message) {}
     };
 
+    /**
+     * Underlying queue implementation
+     */
+    enum class QueueType {
+        /// Mutex and condition variable based, any number of producers and consumers
+        LOCKING,
+        /// Bounded lock-free ring buffer, best suited for single producer links
+        LOCK_FREE
+    };
+
    private:
     static constexpr auto CLOSED_QUEUE_MESSAGE = "MessageQueue was closed";
     LockingQueue<std::shared_ptr<ADatatype>> queue;
+    // Takes precedence over 'queue' when set
+    std::unique_ptr<LockFreeQueue<std::shared_ptr<ADatatype>>> lockFreeQueue;
     std::string name;
+    // Only set while instrumentation is enabled
+    std::shared_ptr<QueueInstrumentation> instrumentation;
+    // Called after a message was pushed, see setPushListener
+    std::function<void()> pushListener;
 
    public:
     std::mutex callbacksMtx;                                                                                 // Only public for the Python bindings
@@ -35,7 +56,25 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
     CallbackId uniqueCallbackId{0};
 
    private:
-    void callCallbacks(std::shared_ptr<ADatatype> msg);
+    // Returns true if any callback was called
+    bool callCallbacks(std::shared_ptr<ADatatype> msg);
+
+    // Instrumented send and dequeue bookkeeping, only used while instrumentation is enabled
+    template <typename F>
+    bool instrumentedSend(const std::shared_ptr<ADatatype>& msg, F&& push);
+    void onDequeue(const ADatatype* msg);
+    void onDequeue(const std::vector<const ADatatype*>& msgs);
+
+    template <typename F>
+    decltype(auto) visitQueue(F&& func) {
+        if(lockFreeQueue) return func(*lockFreeQueue);
+        return func(queue);
+    }
+    template <typename F>
+    decltype(auto) visitQueue(F&& func) const {
+        if(lockFreeQueue) return func(static_cast<const LockFreeQueue<std::shared_ptr<ADatatype>>&>(*lockFreeQueue));
+        return func(queue);
+    }
 
    public:
     // DataOutputQueue constructor
@@ -43,16 +82,25 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
     explicit MessageQueue(std::string name, unsigned int maxSize = 16, bool blocking = true);
 
     MessageQueue(const MessageQueue& c)
-        : enable_shared_from_this(c), queue(c.queue), name(c.name), callbacks(c.callbacks), uniqueCallbackId(c.uniqueCallbackId){};
+        : enable_shared_from_this(c),
+          queue(c.queue),
+          lockFreeQueue(c.lockFreeQueue ? std::make_unique<LockFreeQueue<std::shared_ptr<ADatatype>>>(*c.lockFreeQueue) : nullptr),
+          name(c.name),
+          callbacks(c.callbacks),
+          uniqueCallbackId(c.uniqueCallbackId){};
     MessageQueue(MessageQueue&& m) noexcept
         : enable_shared_from_this(m),
           queue(std::move(m.queue)),
+          lockFreeQueue(std::move(m.lockFreeQueue)),
           name(std::move(m.name)),
+          instrumentation(std::move(m.instrumentation)),
+          pushListener(std::move(m.pushListener)),
           callbacks(std::move(m.callbacks)),
           uniqueCallbackId(m.uniqueCallbackId){};
 
     MessageQueue& operator=(const MessageQueue& c) {
         queue = c.queue;
+        lockFreeQueue = c.lockFreeQueue ? std::make_unique<LockFreeQueue<std::shared_ptr<ADatatype>>>(*c.lockFreeQueue) : nullptr;
         name = c.name;
         callbacks = c.callbacks;
         uniqueCallbackId = c.uniqueCallbackId;
@@ -61,7 +109,10 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
 
     MessageQueue& operator=(MessageQueue&& m) noexcept {
         queue = std::move(m.queue);
+        lockFreeQueue = std::move(m.lockFreeQueue);
         name = std::move(m.name);
+        instrumentation = std::move(m.instrumentation);
+        pushListener = std::move(m.pushListener);
         callbacks = std::move(m.callbacks);
         uniqueCallbackId = m.uniqueCallbackId;
         return *this;
@@ -132,6 +183,60 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
      */
     unsigned int isFull() const;
 
+    /**
+     * Sets underlying queue implementation. Pending messages are carried over.
+     * Lock-free queue is only used for maxSize up to LockFreeQueue::MAX_CAPACITY, locking one otherwise
+     *
+     * @param type Queue implementation to use
+     * @note Not thread safe, should only be changed while the queue isn't in use (eg. before the pipeline is started)
+     */
+    void setQueueType(QueueType type);
+
+    /**
+     * Gets underlying queue implementation
+     *
+     * @returns Queue implementation in use
+     */
+    QueueType getQueueType() const;
+
+    /**
+     * Enables collection of queue statistics and trace events.
+     * While disabled (default) the only cost is a pointer check per operation. Enabling again resets collected data
+     *
+     * @param enable Whether to collect statistics and trace events
+     * @note Not thread safe, should only be changed while the queue isn't in use (eg. before the pipeline is started)
+     */
+    void setInstrumentation(bool enable);
+
+    /**
+     * Gets whether queue statistics and trace events are collected
+     */
+    bool getInstrumentation() const;
+
+    /**
+     * Gets statistics collected while instrumentation is enabled
+     *
+     * @returns Queue statistics, all zero if instrumentation is disabled
+     */
+    QueueStats getStats() const;
+
+    /**
+     * Gets most recent trace events collected while instrumentation is enabled, oldest first.
+     * Message ids (srcId) are assigned in send order, dstId holds the queue depth after the event
+     *
+     * @returns Trace events, empty if instrumentation is disabled
+     */
+    std::vector<TraceEvent> getTraceEvents() const;
+
+    /**
+     * Sets a function called on the sending thread after each message pushed into the queue.
+     * Unlike callbacks, which run before the push, the message can already be taken out of the queue at that point
+     *
+     * @param listener Function to call, empty to remove it
+     * @note Not thread safe, should only be changed while the queue isn't in use (eg. before the pipeline is started)
+     */
+    void setPushListener(std::function<void()> listener);
+
     /**
      * Adds a callback on message received
      *
@@ -170,11 +275,11 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
      */
     template <class T>
     bool has() {
-        if(queue.isDestroyed()) {
+        if(isClosed()) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
         std::shared_ptr<ADatatype> val = nullptr;
-        return queue.front(val) && dynamic_cast<T*>(val.get());
+        return visitQueue([&](auto& q) { return q.front(val); }) && dynamic_cast<T*>(val.get());
     }
 
     /**
@@ -182,10 +287,10 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
      * @returns True if queue isn't empty, false otherwise
      */
     bool has() {
-        if(queue.isDestroyed()) {
+        if(isClosed()) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
-        return !queue.empty();
+        return !visitQueue([&](auto& q) { return q.empty(); });
     }
 
     /**
@@ -195,11 +300,12 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
      */
     template <class T>
     std::shared_ptr<T> tryGet() {
-        if(queue.isDestroyed()) {
+        if(isClosed()) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
         std::shared_ptr<ADatatype> val = nullptr;
-        if(!queue.tryPop(val)) return nullptr;
+        if(!visitQueue([&](auto& q) { return q.tryPop(val); })) return nullptr;
+        if(instrumentation) onDequeue(val.get());
         return std::dynamic_pointer_cast<T>(val);
     }
 
@@ -220,9 +326,10 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
     template <class T>
     std::shared_ptr<T> get() {
         std::shared_ptr<ADatatype> val = nullptr;
-        if(!queue.waitAndPop(val)) {
+        if(!visitQueue([&](auto& q) { return q.waitAndPop(val); })) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
+        if(instrumentation) onDequeue(val.get());
         return std::dynamic_pointer_cast<T>(val);
     }
 
@@ -242,11 +349,11 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
      */
     template <class T>
     std::shared_ptr<T> front() {
-        if(queue.isDestroyed()) {
+        if(isClosed()) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
         std::shared_ptr<ADatatype> val = nullptr;
-        if(!queue.front(val)) return nullptr;
+        if(!visitQueue([&](auto& q) { return q.front(val); })) return nullptr;
         return std::dynamic_pointer_cast<T>(val);
     }
 
@@ -268,19 +375,20 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
      */
     template <class T, typename Rep, typename Period>
     std::shared_ptr<T> get(std::chrono::duration<Rep, Period> timeout, bool& hasTimedout) {
-        if(queue.isDestroyed()) {
+        if(isClosed()) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
         std::shared_ptr<ADatatype> val = nullptr;
-        if(!queue.tryWaitAndPop(val, timeout)) {
+        if(!visitQueue([&](auto& q) { return q.tryWaitAndPop(val, timeout); })) {
             hasTimedout = true;
             // Check again after the timeout
-            if(queue.isDestroyed()) {
+            if(isClosed()) {
                 throw QueueException(CLOSED_QUEUE_MESSAGE);
             }
             return nullptr;
         }
         hasTimedout = false;
+        if(instrumentation) onDequeue(val.get());
         return std::dynamic_pointer_cast<T>(val);
     }
 
@@ -303,15 +411,19 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
      */
     template <class T>
     std::vector<std::shared_ptr<T>> tryGetAll() {
-        if(queue.isDestroyed()) {
+        if(isClosed()) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
         std::vector<std::shared_ptr<T>> messages;
-        queue.consumeAll([&messages](std::shared_ptr<ADatatype>& msg) {
+        std::vector<const ADatatype*> dequeued;
+        auto callback = [this, &messages, &dequeued](std::shared_ptr<ADatatype>& msg) {
+            if(instrumentation) dequeued.push_back(msg.get());
             // dynamic pointer cast may return nullptr
             // in which case that message in vector will be nullptr
             messages.push_back(std::dynamic_pointer_cast<T>(std::move(msg)));
-        });
+        };
+        visitQueue([&](auto& q) { return q.consumeAll(callback); });
+        if(!dequeued.empty()) onDequeue(dequeued);
         return messages;
     }
 
@@ -333,14 +445,18 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
     template <class T>
     std::vector<std::shared_ptr<T>> getAll() {
         std::vector<std::shared_ptr<T>> messages;
-        bool notDestructed = queue.waitAndConsumeAll([&messages](std::shared_ptr<ADatatype>& msg) {
+        std::vector<const ADatatype*> dequeued;
+        auto callback = [this, &messages, &dequeued](std::shared_ptr<ADatatype>& msg) {
+            if(instrumentation) dequeued.push_back(msg.get());
             // dynamic pointer cast may return nullptr
             // in which case that message in vector will be nullptr
             messages.push_back(std::dynamic_pointer_cast<T>(std::move(msg)));
-        });
+        };
+        bool notDestructed = visitQueue([&](auto& q) { return q.waitAndConsumeAll(callback); });
         if(!notDestructed) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
+        if(!dequeued.empty()) onDequeue(dequeued);
         return messages;
     }
 
@@ -363,17 +479,19 @@ class MessageQueue : public std::enable_shared_from_this<MessageQueue> {
      */
     template <class T, typename Rep, typename Period>
     std::vector<std::shared_ptr<T>> getAll(std::chrono::duration<Rep, Period> timeout, bool& hasTimedout) {
-        if(queue.isDestroyed()) {
+        if(isClosed()) {
             throw QueueException(CLOSED_QUEUE_MESSAGE);
         }
         std::vector<std::shared_ptr<T>> messages;
-        hasTimedout = !queue.waitAndConsumeAll(
-            [&messages](std::shared_ptr<ADatatype>& msg) {
-                // dynamic pointer cast may return nullptr
-                // in which case that message in vector will be nullptr
-                messages.push_back(std::dynamic_pointer_cast<T>(std::move(msg)));
-            },
-            timeout);
+        std::vector<const ADatatype*> dequeued;
+        auto callback = [this, &messages, &dequeued](std::shared_ptr<ADatatype>& msg) {
+            if(instrumentation) dequeued.push_back(msg.get());
+            // dynamic pointer cast may return nullptr
+            // in which case that message in vector will be nullptr
+            messages.push_back(std::dynamic_pointer_cast<T>(std::move(msg)));
+        };
+        hasTimedout = !visitQueue([&](auto& q) { return q.waitAndConsumeAll(callback, timeout); });
+        if(!dequeued.empty()) onDequeue(dequeued);
 
         return messages;
     }
@@ -20,6 +20,7 @@
 // shared
 #include "depthai/device/BoardConfig.hpp"
 #include "depthai/pipeline/PipelineSchema.hpp"
+#include "depthai/pipeline/QueueStats.hpp"
 #include "depthai/properties/GlobalProperties.hpp"
 #include "depthai/utility/RecordReplay.hpp"
 
@@ -27,6 +28,10 @@ namespace dai {
 
 namespace fs = std::filesystem;
 
+namespace utility {
+class WorkStealingExecutor;
+}  // namespace utility
+
 class PipelineImpl : public std::enable_shared_from_this<PipelineImpl> {
     friend class Pipeline;
     friend class Node;
@@ -45,6 +50,9 @@ class PipelineImpl : public std::enable_shared_from_this<PipelineImpl> {
     PipelineImpl& operator=(PipelineImpl&&) = delete;
     ~PipelineImpl();
 
+    // Executor shared by host nodes (and other host side work), created on first use
+    std::shared_ptr<utility::WorkStealingExecutor> getHostExecutor();
+
    private:
     // static functions
     static bool isSamePipeline(const Node::Output& out, const Node::Input& in);
@@ -84,6 +92,9 @@ class PipelineImpl : public std::enable_shared_from_this<PipelineImpl> {
     uint32_t getEepromId() const;
     bool isHostOnly() const;
     bool isDeviceOnly() const;
+    void enableQueueStats(bool enable);
+    std::vector<QueueStats> getQueueStats() const;
+    nlohmann::json getQueueTrace() const;
 
     // Must be incremented and unique for each node
     Node::Id latestId = 0;
@@ -118,6 +129,9 @@ class PipelineImpl : public std::enable_shared_from_this<PipelineImpl> {
     // Output queues
     std::vector<std::shared_ptr<MessageQueue>> outputQueues;
 
+    // Queue instrumentation
+    bool queueStatsEnabled = false;
+
     // parent
     Pipeline& parent;
 
@@ -139,6 +153,11 @@ class PipelineImpl : public std::enable_shared_from_this<PipelineImpl> {
     // Queue for tasks
     LockingQueue<std::function<void()>> tasks;
 
+    // Executor shared by host nodes not running on their own thread, created on first use
+    size_t hostExecutorThreads = 0;
+    std::shared_ptr<utility::WorkStealingExecutor> hostExecutor;
+    std::mutex hostExecutorMtx;
+
     void addTask(std::function<void()> task) {
         tasks.push(std::move(task));
     }
@@ -229,6 +248,9 @@ class PipelineImpl : public std::enable_shared_from_this<PipelineImpl> {
     void disconnectXLinkHosts();
 
    private:
+    // Host side queues (node inputs and output queues) with their qualified names
+    std::vector<std::pair<std::string, MessageQueue*>> getHostQueues() const;
+
     // Resource
     std::vector<uint8_t> loadResource(fs::path uri);
     std::vector<uint8_t> loadResourceCwd(fs::path uri, fs::path cwd, bool moveAsset = false);
@@ -503,9 +525,53 @@ class Pipeline {
         impl()->addTask(std::move(task));
     }
 
+    /**
+     * Set the number of threads of the executor shared by host nodes set to run on it (HostNode::runOnExecutor).
+     * Defaults to the number of hardware threads. Must be set before the pipeline is started
+     * @param numThreads Number of threads, 0 for the default
+     */
+    void setHostExecutorThreads(size_t numThreads);
+
+    /**
+     * Get the number of threads of the shared host executor, 0 meaning the number of hardware threads
+     */
+    size_t getHostExecutorThreads() const {
+        return impl()->hostExecutorThreads;
+    }
+
     /// Record and Replay
     void enableHolisticRecord(const RecordConfig& config);
     void enableHolisticReplay(const std::string& pathToRecording);
+
+    /**
+     * Enable collection of statistics and trace events on host side queues (inputs of host nodes and output queues):
+     * send to dequeue latency, queue depth, drops, blocked producer time and callback execution time.
+     * Costs close to nothing while disabled (default). Must be set before the pipeline is started.
+     * Disabling also removes the instrumentation (and statistics) of a previous run
+     */
+    void enableQueueStats(bool enable = true) {
+        impl()->enableQueueStats(enable);
+    }
+
+    /**
+     * Get statistics of all host side queues, named "<node name>(<node id>).<input or output name>"
+     */
+    std::vector<QueueStats> getQueueStats() const {
+        return impl()->getQueueStats();
+    }
+
+    /**
+     * Get recent queue trace events in Chrome trace event format, viewable in chrome://tracing or Perfetto
+     */
+    nlohmann::json getQueueTrace() const {
+        return impl()->getQueueTrace();
+    }
+
+    /**
+     * Write recent queue trace events to a Chrome trace event JSON file
+     * @param path Path of the file
+     */
+    void exportQueueTrace(const fs::path& path) const;
 };
 
 }  // namespace dai
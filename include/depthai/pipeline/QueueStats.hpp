@@ -0,0 +1,49 @@
+#pragma once
+
+// std
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace dai {
+
+/**
+ * Statistics of a single message queue, collected while queue instrumentation is enabled
+ */
+struct QueueStats {
+    /// Number of depth histogram buckets
+    static constexpr std::size_t DEPTH_HISTOGRAM_SIZE = 18;
+
+    /// Name of the queue. For pipeline queues "<node name>(<node id>).<input name>" or "<node name>(<node id>).<output name>.queue"
+    std::string name;
+    /// Messages pushed into the queue
+    std::uint64_t enqueued = 0;
+    /// Messages taken out of the queue
+    std::uint64_t dequeued = 0;
+    /// Messages overwritten by newer ones in non-blocking mode
+    std::uint64_t dropped = 0;
+    /// Sends that timed out or hit a closed queue
+    std::uint64_t failed = 0;
+    /// Total and longest time producers spent in send, including waiting on a full blocking queue
+    std::chrono::nanoseconds blockedTime{0};
+    std::chrono::nanoseconds maxBlockedTime{0};
+    /// Total and longest time between the start of send and the message being taken out of the queue
+    std::chrono::nanoseconds latency{0};
+    std::chrono::nanoseconds maxLatency{0};
+    /// Number of callback invocations (all callbacks of a message count as one) and their execution time
+    std::uint64_t callbackCalls = 0;
+    std::chrono::nanoseconds callbackTime{0};
+    std::chrono::nanoseconds maxCallbackTime{0};
+    /// Queue depth after each enqueue. Bucket 0 counts an empty queue, bucket i depths in [2^(i-1), 2^i), the last one everything above
+    std::array<std::uint64_t, DEPTH_HISTOGRAM_SIZE> depthHistogram{};
+
+    /**
+     * Average time between the start of send and the message being taken out of the queue
+     */
+    std::chrono::nanoseconds getAverageLatency() const {
+        return dequeued ? latency / static_cast<std::int64_t>(dequeued) : std::chrono::nanoseconds(0);
+    }
+};
+
+}  // namespace dai
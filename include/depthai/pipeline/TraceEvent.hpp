@@ -9,6 +9,8 @@ struct TraceEvent {
         SEND,
         RECEIVE,
         // PULL,
+        CALLBACK,
+        DROP,
     };
     enum class Status : std::uint8_t {
         START,
@@ -17,7 +19,9 @@ struct TraceEvent {
     };
     Event event;
     Status status;
+    // For queue instrumentation events srcId is the id of the message within the queue
     uint32_t srcId;
+    // For queue instrumentation events dstId is the queue depth after the event
     uint32_t dstId;
     Timestamp timestamp;
 };
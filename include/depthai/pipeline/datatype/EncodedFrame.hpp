@@ -187,6 +187,13 @@ class EncodedFrame : public Buffer, public ProtoSerializable {
      */
     std::vector<std::uint8_t> serializeProto(bool metadataOnly = false) const override;
 
+    /**
+     * Serialize message to proto buffer, without copying the encoded data
+     *
+     * @returns serialized metadata and the encoded data
+     */
+    ProtoSerializable::SerializedProto serializeProtoParts() const override;
+
     /**
      * Serialize schema to proto buffer
      *
@@ -2,6 +2,7 @@
 
 #include <nop/structure.h>
 
+#include <algorithm>
 #include <array>
 #include <locale>
 #include <nlohmann/json.hpp>
@@ -40,6 +41,13 @@ struct Translate : OpBase {
         return ss.str();
     }
 
+    bool operator==(const Translate& other) const {
+        return offsetX == other.offsetX && offsetY == other.offsetY && normalized == other.normalized;
+    }
+    bool operator!=(const Translate& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(Translate, offsetX, offsetY, normalized);
 };
 
@@ -61,6 +69,13 @@ struct Rotate : OpBase {
         return ss.str();
     }
 
+    bool operator==(const Rotate& other) const {
+        return angle == other.angle && center == other.center && offsetX == other.offsetX && offsetY == other.offsetY && normalized == other.normalized;
+    }
+    bool operator!=(const Rotate& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(Rotate, angle, center, offsetX, offsetY, normalized);
 };
 
@@ -93,6 +108,13 @@ struct Resize : OpBase {
         return ss.str();
     }
 
+    bool operator==(const Resize& other) const {
+        return width == other.width && height == other.height && normalized == other.normalized && mode == other.mode;
+    }
+    bool operator!=(const Resize& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(Resize, width, height, normalized, mode);
 };
 
@@ -111,6 +133,13 @@ struct Flip : OpBase {
         return ss.str();
     }
 
+    bool operator==(const Flip& other) const {
+        return direction == other.direction && center == other.center;
+    }
+    bool operator!=(const Flip& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(Flip, direction, center);
 };
 
@@ -127,6 +156,13 @@ struct Affine : OpBase {
         return ss.str();
     }
 
+    bool operator==(const Affine& other) const {
+        return matrix == other.matrix;
+    }
+    bool operator!=(const Affine& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(Affine, matrix);
 };
 
@@ -144,6 +180,13 @@ struct Perspective : OpBase {
         return ss.str();
     }
 
+    bool operator==(const Perspective& other) const {
+        return matrix == other.matrix;
+    }
+    bool operator!=(const Perspective& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(Perspective, matrix);
 };
 
@@ -164,6 +207,19 @@ struct FourPoints : OpBase {
         return ss.str();
     }
 
+    bool operator==(const FourPoints& other) const {
+        const auto equal = [](const std::array<dai::Point2f, 4>& a, const std::array<dai::Point2f, 4>& b) {
+            for(size_t i = 0; i < a.size(); i++) {
+                if(a[i].x != b[i].x || a[i].y != b[i].y) return false;
+            }
+            return true;
+        };
+        return equal(src, other.src) && equal(dst, other.dst) && normalized == other.normalized;
+    }
+    bool operator!=(const FourPoints& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(FourPoints, src, dst, normalized);
 };
 
@@ -187,6 +243,13 @@ struct Crop : OpBase {
         return ss.str();
     }
 
+    bool operator==(const Crop& other) const {
+        return width == other.width && height == other.height && normalized == other.normalized && center == other.center;
+    }
+    bool operator!=(const Crop& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(Crop, width, height, normalized, center);
 };
 
@@ -203,6 +266,13 @@ struct ManipOp {
     ManipOp(FourPoints op) : op(op) {}   // NOLINT
     ManipOp(Crop op) : op(op) {}         // NOLINT
 
+    bool operator==(const ManipOp& other) const {
+        return op == other.op;
+    }
+    bool operator!=(const ManipOp& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(ManipOp, op);
 };
 
@@ -389,6 +459,19 @@ class ImageManipOpsBase : public ImageManipOpsEnums {
         return *this;
     }
 
+    /**
+     * Structural comparison of two configs. Cheap and allocation free, unlike comparing their string representations
+     */
+    bool operator==(const ImageManipOpsBase& other) const {
+        return outputWidth == other.outputWidth && outputHeight == other.outputHeight && center == other.center && resizeMode == other.resizeMode
+               && background == other.background && backgroundR == other.backgroundR && backgroundG == other.backgroundG && backgroundB == other.backgroundB
+               && colormap == other.colormap && undistort == other.undistort && operations.size() == other.operations.size()
+               && std::equal(operations.begin(), operations.end(), other.operations.begin());
+    }
+    bool operator!=(const ImageManipOpsBase& other) const {
+        return !(*this == other);
+    }
+
     DEPTHAI_SERIALIZE(
         ImageManipOpsBase, operations, outputWidth, outputHeight, center, resizeMode, background, backgroundR, backgroundG, backgroundB, colormap, undistort);
 };
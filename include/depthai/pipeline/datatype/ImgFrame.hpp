@@ -90,6 +90,13 @@ class ImgFrame : public Buffer, public ProtoSerializable {
      */
     std::vector<std::uint8_t> serializeProto(bool metadataOnly = false) const override;
 
+    /**
+     * Serialize message to proto buffer, without copying the frame data
+     *
+     * @returns serialized metadata and the frame data
+     */
+    ProtoSerializable::SerializedProto serializeProtoParts() const override;
+
     /**
      * Serialize schema to proto buffer
      *
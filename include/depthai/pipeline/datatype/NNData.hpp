@@ -2,10 +2,13 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <iterator>
 #include <limits>
 #include <optional>
+#include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -61,6 +64,11 @@ class NNData : public Buffer {
     static float fp16_to_fp32(uint16_t);
 
    public:
+    // Bulk conversions, vectorized with F16C/AVX2 or NEON when the CPU supports it
+    static void fp16_to_fp32(const uint16_t* src, float* dst, size_t count);
+    static void dequantize(const uint8_t* src, float* dst, size_t count, float scale, float zeroPoint);
+    static void dequantize(const int8_t* src, float* dst, size_t count, float scale, float zeroPoint);
+
     std::vector<TensorInfo> tensors;
     unsigned int batchSize;
     std::optional<ImgTransformation> transformation;
@@ -133,6 +141,50 @@ class NNData : public Buffer {
      */
     span<std::uint8_t> emplaceTensor(TensorInfo& tensor);
 
+    /**
+     * Typed view over the data of a tensor, without copying or converting it.
+     * The element type has to match the data type of the tensor: uint8_t for U8F, int8_t for I8, int32_t for INT,
+     * uint16_t for FP16 (raw half floats), float for FP32 and double for FP64.
+     * Use getTensorInfo for the dimensions, strides and quantization parameters.
+     * @param name Name of the tensor
+     * @returns Span over all elements of the tensor, valid while this message and its data are unchanged
+     */
+    template <typename _Ty>
+    span<const _Ty> getTensorView(const std::string& name) const {
+        const auto it = std::find_if(tensors.begin(), tensors.end(), [&name](const TensorInfo& ti) { return ti.name == name; });
+        if(it == tensors.end()) throw std::runtime_error("Tensor does not exist");
+
+        bool matches = false;
+        switch(it->dataType) {
+            case TensorInfo::DataType::U8F:
+                matches = std::is_same_v<_Ty, uint8_t>;
+                break;
+            case TensorInfo::DataType::I8:
+                matches = std::is_same_v<_Ty, int8_t>;
+                break;
+            case TensorInfo::DataType::INT:
+                matches = std::is_same_v<_Ty, int32_t>;
+                break;
+            case TensorInfo::DataType::FP16:
+                matches = std::is_same_v<_Ty, uint16_t>;
+                break;
+            case TensorInfo::DataType::FP32:
+                matches = std::is_same_v<_Ty, float>;
+                break;
+            case TensorInfo::DataType::FP64:
+                matches = std::is_same_v<_Ty, double>;
+                break;
+        }
+        if(!matches) throw std::runtime_error("Tensor view type doesn't match the tensor data type, use getTensor to convert it");
+
+        size_t count = 1;
+        for(const auto dim : it->dims) count *= dim;
+        const auto bytes = data->getData();
+        if(it->offset + count * sizeof(_Ty) > bytes.size()) throw std::runtime_error("Tensor data is out of bounds");
+        if(reinterpret_cast<std::uintptr_t>(bytes.data() + it->offset) % alignof(_Ty) != 0) throw std::runtime_error("Tensor data is not aligned");
+        return {reinterpret_cast<const _Ty*>(bytes.data() + it->offset), count};
+    }
+
 #ifdef DEPTHAI_XTENSOR_SUPPORT
     /**
      * @brief Add a tensor to this NNData object.
@@ -414,37 +466,47 @@ class NNData : public Buffer {
         }
 
         xt::xarray<_Ty, xt::layout_type::row_major> tensor(dims);
+        const uint8_t* raw = data->getData().data() + it->offset;
+        const size_t count = tensor.size();
+
+        if constexpr(std::is_same_v<_Ty, float>) {
+            // Dequantize 8 bit tensors in a single pass
+            if(dequantize && it->quantization) {
+                if(it->dataType == TensorInfo::DataType::U8F) {
+                    NNData::dequantize(raw, tensor.data(), count, it->qpScale, it->qpZp);
+                    return tensor;
+                }
+                if(it->dataType == TensorInfo::DataType::I8) {
+                    NNData::dequantize(reinterpret_cast<const int8_t*>(raw), tensor.data(), count, it->qpScale, it->qpZp);
+                    return tensor;
+                }
+            }
+        }
 
         switch(it->dataType) {
             case TensorInfo::DataType::U8F:
-                for(uint32_t i = 0; i < tensor.size(); i++) {
-                    tensor.data()[i] = data->getData().data()[it->offset + i];
-                }
+                std::copy_n(raw, count, tensor.data());
                 break;
             case TensorInfo::DataType::I8:
-                for(uint32_t i = 0; i < tensor.size(); i++) {
-                    tensor.data()[i] = reinterpret_cast<int8_t*>(data->getData().data())[it->offset + i];
-                }
+                std::copy_n(reinterpret_cast<const int8_t*>(raw), count, tensor.data());
                 break;
             case TensorInfo::DataType::INT:
-                for(uint32_t i = 0; i < tensor.size(); i++) {
-                    tensor.data()[i] = reinterpret_cast<int32_t*>(data->getData().data())[it->offset / sizeof(int32_t) + i];
-                }
+                std::copy_n(reinterpret_cast<const int32_t*>(raw), count, tensor.data());
                 break;
             case TensorInfo::DataType::FP16:
-                for(uint32_t i = 0; i < tensor.size(); i++) {
-                    tensor.data()[i] = fp16_to_fp32(reinterpret_cast<uint16_t*>(data->getData().data())[it->offset / sizeof(uint16_t) + i]);
+                if constexpr(std::is_same_v<_Ty, float>) {
+                    fp16_to_fp32(reinterpret_cast<const uint16_t*>(raw), tensor.data(), count);
+                } else {
+                    for(size_t i = 0; i < count; i++) {
+                        tensor.data()[i] = fp16_to_fp32(reinterpret_cast<const uint16_t*>(raw)[i]);
+                    }
                 }
                 break;
             case TensorInfo::DataType::FP32:
-                for(uint32_t i = 0; i < tensor.size(); i++) {
-                    tensor.data()[i] = reinterpret_cast<float_t*>(data->getData().data())[it->offset / sizeof(float_t) + i];
-                }
+                std::copy_n(reinterpret_cast<const float*>(raw), count, tensor.data());
                 break;
             case TensorInfo::DataType::FP64:
-                for(uint32_t i = 0; i < tensor.size(); i++) {
-                    tensor.data()[i] = reinterpret_cast<double_t*>(data->getData().data())[it->offset / sizeof(double_t) + i];
-                }
+                std::copy_n(reinterpret_cast<const double*>(raw), count, tensor.data());
                 break;
         }
         if(dequantize) {
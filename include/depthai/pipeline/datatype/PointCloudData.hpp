@@ -27,6 +27,7 @@ class PointCloudData : public Buffer, public ProtoSerializable {
     float maxx, maxy, maxz;
     bool sparse = false;
     bool color = false;
+    bool planar = false;
 
    public:
     using Buffer::getSequenceNum;
@@ -99,6 +100,19 @@ class PointCloudData : public Buffer, public ProtoSerializable {
      */
     bool isColor() const;
 
+    /**
+     * Retrieves whether points are stored as separate planes instead of interleaved Point3f / Point3fRGBA.
+     * A planar cloud of N points holds N x, then N y, then N z coordinates (floats) and, if color, N RGBA values (4 bytes each).
+     * getPoints() and getPointsRGB() return interleaved points for either layout.
+     * Host only, like color - planar clouds are interleaved when sent to the device or recorded
+     */
+    bool isPlanar() const;
+
+    /**
+     * Retrieves a copy of the point cloud with interleaved points, sharing the data if the points already are
+     */
+    std::shared_ptr<PointCloudData> getInterleaved() const;
+
     /**
      * Specifies frame width
      *
@@ -184,6 +198,13 @@ class PointCloudData : public Buffer, public ProtoSerializable {
      */
     PointCloudData& setColor(bool val);
 
+    /**
+     * Specifies whether points are stored as separate planes, see isPlanar()
+     *
+     * @param val whether points are stored as separate planes
+     */
+    PointCloudData& setPlanar(bool val);
+
     /**
      * Specifies instance number
      *
@@ -199,6 +220,13 @@ class PointCloudData : public Buffer, public ProtoSerializable {
      */
     std::vector<std::uint8_t> serializeProto(bool metadataOnly = false) const override;
 
+    /**
+     * Serialize message to proto buffer, without copying the point data
+     *
+     * @returns serialized metadata and the point data
+     */
+    ProtoSerializable::SerializedProto serializeProtoParts() const override;
+
     /**
      * Serialize schema to proto buffer
      *
@@ -1,26 +1,61 @@
 #pragma once
 
 // standard
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 // libraries
 #include <XLink/XLinkPublicDefines.h>
 
 // project
 #include "depthai/pipeline/datatype/ADatatype.hpp"
+#include "depthai/utility/span.hpp"
 #include "depthai/xlink/XLinkStream.hpp"
 
 // StreamPacket structure ->  || imgframepixels... , serialized_object, object_type, serialized_object_size ||
 // object_type -> DataType(int), serialized_object_size -> int
+//
+// Framed MessageGroup packet -> || member payloads... , group_metadata, member_metadata..., member_table, group_metadata_size, member_count,
+//                                   object_type, descriptor_size ||
+// terminated with its own marker, so it is told apart from a group followed by one packet per member
 
 namespace dai {
+class MessageGroup;
+
 class StreamMessageParser {
    public:
+    /**
+     * MessageGroup serialized into a single packet, to be sent with one gather write.
+     * The largest member payload is referenced instead of copied and goes first, the rest follows it
+     */
+    struct FramedGroup {
+        span<const std::uint8_t> largestPayload;
+        std::vector<std::uint8_t> rest;
+
+        std::size_t size() const {
+            return largestPayload.size() + rest.size();
+        }
+    };
+
+    /**
+     * Parses an owned packet without copying its payload.
+     * Resulting message data references the packet buffer, which is released once the last reference to it drops
+     */
     static std::shared_ptr<ADatatype> parseMessage(StreamPacketDesc packet);
+    /**
+     * Parses a borrowed packet. Payload is copied, so the packet may be released right after
+     */
     static std::shared_ptr<ADatatype> parseMessage(streamPacketDesc_t* const packet);
     // static std::vector<std::uint8_t> serializeMessage(const std::shared_ptr<const ADatatype>& data);
     // static std::vector<std::uint8_t> serializeMessage(const ADatatype& data);
     static std::vector<std::uint8_t> serializeMetadata(const std::shared_ptr<const ADatatype>& data);
     static std::vector<std::uint8_t> serializeMetadata(const ADatatype& data);
+    /**
+     * Serializes a group together with all its members into a single packet.
+     * Parsing the packet returns the group with its members already filled in.
+     * The group and its members must stay alive until the packet is written
+     */
+    static FramedGroup serializeFramedGroup(const MessageGroup& group);
 };
 }  // namespace dai
@@ -2,6 +2,7 @@
 #include <depthai/pipeline/DeviceNode.hpp>
 #include <depthai/pipeline/datatype/ImageFiltersConfig.hpp>
 #include <depthai/properties/ImageFiltersProperties.hpp>
+#include <depthai/utility/MemoryPool.hpp>
 #include <memory>
 #include <vector>
 
@@ -81,8 +82,26 @@ class ImageFilters : public DeviceNodeCRTP<DeviceNode, ImageFilters, ImageFilter
      */
     void setDefaultProfilePreset(ImageFiltersPresetMode mode);
 
+    /**
+     * Reuse output frame buffers from a pool instead of copying into a new allocation for each frame.
+     * Only applies when running on host and must be set before the pipeline is started.
+     * @param numFramesPool Number of buffers retained by the pool, 0 disables pooling (default)
+     */
+    void setNumFramesPool(int numFramesPool);
+
+    /**
+     * Get number of buffers retained by the output pool
+     */
+    int getNumFramesPool() const;
+
+    /**
+     * Get output pool usage statistics
+     */
+    MemoryPool::Stats getPoolStats() const;
+
    private:
     bool runOnHostVar = true;
+    std::shared_ptr<MemoryPool> framePool;
 };
 
 /**
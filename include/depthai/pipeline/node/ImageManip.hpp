@@ -16,6 +16,7 @@ namespace node {
 class ImageManip : public DeviceNodeCRTP<DeviceNode, ImageManip, ImageManipProperties>, public HostRunnable {
    private:
     bool runOnHostVar = false;
+    int numThreads = 1;
 
    protected:
     Properties& getProperties() override;
@@ -83,6 +84,18 @@ class ImageManip : public DeviceNodeCRTP<DeviceNode, ImageManip, ImageManipPrope
      */
     ImageManip& setPerformanceMode(PerformanceMode performanceMode);
 
+    /**
+     * Specify number of threads used to warp frames when running on host.
+     * The output is split into row bands, each warped in parallel with the same transform, so the result is identical for any thread count.
+     * @param numThreads Number of threads, 0 uses all hardware threads
+     */
+    ImageManip& setNumThreads(int numThreads);
+
+    /**
+     * Get number of threads used to warp frames when running on host
+     */
+    int getNumThreads() const;
+
     /**
      * Check if the node is set to run on host
      */
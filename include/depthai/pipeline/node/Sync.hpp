@@ -3,7 +3,10 @@
 #include <depthai/pipeline/DeviceNode.hpp>
 
 // standard
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
+#include <mutex>
 
 // shared
 #include <depthai/properties/SyncProperties.hpp>
@@ -15,8 +18,29 @@ namespace node {
  * @brief Sync node. Performs syncing between image frames
  */
 class Sync : public DeviceNodeCRTP<DeviceNode, Sync, SyncProperties>, public HostRunnable {
+   public:
+    /**
+     * Statistics of a Sync node running on host
+     */
+    struct SyncStats {
+        /// Groups sent out
+        std::uint64_t groups = 0;
+        /// Messages sent out as part of a group
+        std::uint64_t matched = 0;
+        /// Messages discarded as no group within the threshold could be formed with them
+        std::uint64_t dropped = 0;
+        /// Messages discarded as a newer message of the same input was already sent out
+        std::uint64_t late = 0;
+    };
+
    private:
     bool runOnHostVar = false;
+    mutable std::mutex statsMtx;
+    SyncStats stats;
+    // Counts messages pushed to any input, the host loop waits on it
+    std::mutex arrivalMtx;
+    std::condition_variable arrivalCv;
+    std::uint64_t arrivals = 0;
 
    public:
     constexpr static const char* NAME = "Sync";
@@ -69,6 +93,13 @@ class Sync : public DeviceNodeCRTP<DeviceNode, Sync, SyncProperties>, public Hos
      */
     bool runOnHost() const override;
 
+    /**
+     * Get statistics of the node, only collected when running on host
+     */
+    SyncStats getStats() const;
+
+    void buildStage1() override;
+
     void run() override;
 };
 
@@ -6,6 +6,10 @@
 #include <depthai/pipeline/datatype/MessageGroup.hpp>
 #include <depthai/pipeline/node/Sync.hpp>
 
+// std
+#include <cstdint>
+#include <memory>
+
 #include "depthai/pipeline/Node.hpp"
 #include "depthai/pipeline/datatype/Buffer.hpp"
 
@@ -15,10 +19,18 @@ class HostNode : public ThreadedHostNode {
    private:
     std::optional<bool> syncOnHost;
     bool sendProcessToPipeline = false;
+    // Groups processed at once on the pipeline's host executor, 0 to process on the node's own thread
+    unsigned executorMaxInFlight = 0;
+    struct ExecutorState;
+    std::shared_ptr<ExecutorState> executorState;
     Subnode<dai::node::Sync> sync{*this, "sync"};
     // Input input{*this, "in", Input::Type::SReceiver, true, 3, {{DatatypeEnum::MessageGroup, true}}};
     Input input{*this, {"in", DEFAULT_GROUP, DEFAULT_BLOCKING, DEFAULT_QUEUE_SIZE, {{{DatatypeEnum::MessageGroup, true}}}, DEFAULT_WAIT_FOR_MESSAGE}};
 
+    void scheduleOnExecutor();
+    void processOnExecutor(std::uint64_t seq, std::shared_ptr<dai::MessageGroup> in);
+    void sendFromExecutor();
+
    protected:
     void buildStage1() override;
     void run() override;
@@ -37,6 +49,28 @@ class HostNode : public ThreadedHostNode {
         sendProcessToPipeline = send;
     }
 
+    /**
+     * @brief Process groups on the executor shared by the pipeline's host nodes (see Pipeline::setHostExecutorThreads)
+     * instead of a thread of this node. The node's thread only sends the outputs, in the order the groups were received,
+     * so a full downstream queue never blocks an executor thread.
+     * Must be set before the pipeline is started
+     * @param maxInFlight Maximum number of groups of this node processed at once, processGroup must be thread safe if above 1.
+     * 0 processes on the node's own thread (default)
+     */
+    void runOnExecutor(unsigned maxInFlight = 1) {
+        executorMaxInFlight = maxInFlight;
+    }
+
+    /**
+     * @brief Maximum number of groups processed at once on the pipeline's host executor, 0 if the node runs on its own thread
+     */
+    unsigned getExecutorMaxInFlight() const {
+        return executorMaxInFlight;
+    }
+
+    void stop() override;
+    void wait() override;
+
     void runSyncingOnHost() {
         syncOnHost = true;
     }
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "depthai/pipeline/ThreadedHostNode.hpp"
+#include "depthai/pipeline/datatype/ImageManipConfig.hpp"
+#include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "depthai/pipeline/datatype/MessageGroup.hpp"
+#include "depthai/pipeline/datatype/NNData.hpp"
+
+namespace dai {
+namespace node {
+
+/**
+ * @brief Applies many ImageManip configs (eg. crops of detections) to a single frame in one pass.
+ * The source frame is converted to a supported type once and all outputs are written into one contiguous buffer.
+ */
+class ImageManipBatch : public NodeCRTP<ThreadedHostNode, ImageManipBatch> {
+   public:
+    constexpr static const char* NAME = "ImageManipBatch";
+
+    /**
+     * MessageGroup of ImageManipConfig messages, one per output. Each group is applied to one frame from inputImage
+     */
+    Input inputConfig{*this, {"inputConfig", DEFAULT_GROUP, DEFAULT_BLOCKING, DEFAULT_QUEUE_SIZE, {{{DatatypeEnum::MessageGroup, true}}}, true}};
+
+    /**
+     * Input image to be modified
+     */
+    Input inputImage{*this, {"inputImage", DEFAULT_GROUP, DEFAULT_BLOCKING, DEFAULT_QUEUE_SIZE, {{{DatatypeEnum::ImgFrame, true}}}, true}};
+
+    /**
+     * MessageGroup of the output ImgFrames, under the same names as their configs
+     */
+    Output out{*this, {"out", DEFAULT_GROUP, {{{DatatypeEnum::MessageGroup, false}}}}};
+
+    /**
+     * Outputs stacked into a single U8F tensor named "batch", in NCHW order for planar and NHWC order for interleaved frames.
+     * Sent only when all outputs have the same size and an RGB888, BGR888 or GRAY8 type without row padding.
+     * Shares the buffer with the frames sent on out
+     */
+    Output outTensor{*this, {"outTensor", DEFAULT_GROUP, {{{DatatypeEnum::NNData, false}}}}};
+
+    /**
+     * Number of output buffers retained for reuse
+     * @param numFramesPool Number of buffers, default 4
+     */
+    ImageManipBatch& setNumFramesPool(int numFramesPool);
+    int getNumFramesPool() const;
+
+    /**
+     * Number of threads used to warp each output, 0 uses all hardware threads
+     */
+    ImageManipBatch& setNumThreads(int numThreads);
+    int getNumThreads() const;
+
+    void run() override;
+
+   private:
+    int numFramesPool = 4;
+    int numThreads = 1;
+};
+
+}  // namespace node
+}  // namespace dai
@@ -7,6 +7,7 @@
 #include "depthai/pipeline/datatype/StereoDepthConfig.hpp"
 #include "depthai/pipeline/node/StereoDepth.hpp"
 #include "depthai/pipeline/node/Sync.hpp"
+#include "depthai/utility/MemoryPool.hpp"
 #include "depthai/utility/Pimpl.hpp"
 
 namespace dai {
@@ -67,6 +68,39 @@ class RGBD : public NodeCRTP<ThreadedHostNode, RGBD> {
      * @brief Print available GPU devices
      */
     void printDevices();
+    /**
+     * @brief Reuse output point cloud buffers from a pool instead of allocating a new one for each frame.
+     * Must be set before the pipeline is started.
+     * @param numFramesPool Number of buffers retained by the pool, 0 disables pooling (default)
+     */
+    void setNumFramesPool(int numFramesPool);
+    /**
+     * @brief Get number of buffers retained by the output pool
+     */
+    int getNumFramesPool() const;
+    /**
+     * @brief Get output pool usage statistics
+     */
+    MemoryPool::Stats getPoolStats() const;
+    /**
+     * @brief Drop points without depth (depth == 0) instead of outputting them at the origin.
+     * The output cloud is then sparse and holds only the valid points, in row major order
+     * @param drop Whether to drop invalid points, default false
+     */
+    void setDropInvalidPoints(bool drop);
+    /**
+     * @brief Get whether points without depth are dropped
+     */
+    bool getDropInvalidPoints() const;
+    /**
+     * @brief Output the point cloud as separate x, y, z and RGBA planes instead of interleaved Point3fRGBA, see PointCloudData::isPlanar()
+     * @param planar Whether to output planes, default false
+     */
+    void setPlanarOutput(bool planar);
+    /**
+     * @brief Get whether the point cloud is output as separate planes
+     */
+    bool getPlanarOutput() const;
     void buildInternal() override;
 
    private:
@@ -76,6 +110,9 @@ class RGBD : public NodeCRTP<ThreadedHostNode, RGBD> {
     void initialize(std::shared_ptr<MessageGroup> frames);
     Input inSync{*this, {"inSync", DEFAULT_GROUP, false, 0, {{DatatypeEnum::MessageGroup, true}}}};
     bool initialized = false;
+    std::shared_ptr<MemoryPool> pointCloudPool;
+    bool dropInvalidPoints = false;
+    bool planarOutput = false;
 };
 
 }  // namespace node
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <depthai/pipeline/ThreadedNode.hpp>
+#include <memory>
 
 // shared
 #include <depthai/properties/internal/XLinkOutProperties.hpp>
@@ -16,8 +18,26 @@
 #endif
 
 namespace dai {
+namespace utility {
+class AsyncWriter;
+}  // namespace utility
+
 namespace node {
 
+/**
+ * Counters of the asynchronous writer of a record node
+ */
+struct RecordWriterStats {
+    /// Bytes received and not written yet, counted as converted for writing
+    std::uint64_t queuedBytes = 0;
+    /// Highest queuedBytes seen
+    std::uint64_t maxQueuedBytes = 0;
+    std::uint64_t writtenBytes = 0;
+    std::uint64_t writtenMessages = 0;
+    std::uint64_t droppedBytes = 0;
+    std::uint64_t droppedMessages = 0;
+};
+
 using XLinkOutProperties = ::dai::internal::XLinkOutProperties;
 
 /**
@@ -48,11 +68,30 @@ class RecordVideo : public NodeCRTP<ThreadedHostNode, RecordVideo> {
     RecordVideo& setRecordVideoFile(const std::filesystem::path& recordFile);
     RecordVideo& setCompressionLevel(CompressionLevel compressionLevel);
 
+    /**
+     * Write the recording on a dedicated thread, so stalls of the storage don't block the input.
+     * Messages are converted and serialized on the pipeline's host executor and written in order. Must be set before the pipeline starts
+     * @param maxQueuedBytes Limit for the data waiting to be written, counted as converted for writing (eg. BGR frames), 0 writes on the node thread (default)
+     * @param dropWhenFull Drop messages when the limit is reached, instead of waiting for space.
+     * Dropped encoded frames corrupt the video until the next keyframe
+     */
+    RecordVideo& setAsyncWrite(size_t maxQueuedBytes, bool dropWhenFull = false);
+    size_t getAsyncWriteQueueSize() const;
+    bool getAsyncWriteDropWhenFull() const;
+
+    /**
+     * Counters of the asynchronous writer, all zero when writing on the node thread
+     */
+    RecordWriterStats getWriterStats() const;
+
    private:
     std::filesystem::path recordMetadataFile;
     std::filesystem::path recordVideoFile;
     unsigned int fpsInitLength = 10;
     CompressionLevel compressionLevel = CompressionLevel::DEFAULT;
+    size_t asyncWriteQueueSize = 0;
+    bool asyncWriteDropWhenFull = false;
+    std::shared_ptr<utility::AsyncWriter> writer;
 };
 
 /**
@@ -79,9 +118,27 @@ class RecordMetadataOnly : public NodeCRTP<ThreadedHostNode, RecordMetadataOnly>
     RecordMetadataOnly& setRecordFile(const std::filesystem::path& recordFile);
     RecordMetadataOnly& setCompressionLevel(CompressionLevel compressionLevel);
 
+    /**
+     * Write the recording on a dedicated thread, so stalls of the storage don't block the input.
+     * Messages are converted and serialized on the pipeline's host executor and written in order. Must be set before the pipeline starts
+     * @param maxQueuedBytes Limit for the data waiting to be written, counted as converted for writing (eg. BGR frames), 0 writes on the node thread (default)
+     * @param dropWhenFull Drop messages when the limit is reached, instead of waiting for space
+     */
+    RecordMetadataOnly& setAsyncWrite(size_t maxQueuedBytes, bool dropWhenFull = false);
+    size_t getAsyncWriteQueueSize() const;
+    bool getAsyncWriteDropWhenFull() const;
+
+    /**
+     * Counters of the asynchronous writer, all zero when writing on the node thread
+     */
+    RecordWriterStats getWriterStats() const;
+
    private:
     std::filesystem::path recordFile;
     CompressionLevel compressionLevel = CompressionLevel::DEFAULT;
+    size_t asyncWriteQueueSize = 0;
+    bool asyncWriteDropWhenFull = false;
+    std::shared_ptr<utility::AsyncWriter> writer;
 };
 
 }  // namespace node
@@ -1,14 +1,18 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <depthai/pipeline/ThreadedNode.hpp>
 #include <memory>
+#include <mutex>
+#include <optional>
 
 // shared
 #include <depthai/properties/internal/XLinkOutProperties.hpp>
 
 // project
 #include <depthai/pipeline/datatype/Buffer.hpp>
+#include <depthai/utility/MemoryPool.hpp>
 #include <depthai/utility/RecordReplay.hpp>
 
 #include "depthai/pipeline/ThreadedHostNode.hpp"
@@ -29,9 +33,18 @@ class ReplayVideo : public NodeCRTP<ThreadedHostNode, ReplayVideo> {
     std::filesystem::path replayVideo;
     std::filesystem::path replayFile;
     ImgFrame::Type outFrameType = ImgFrame::Type::YUV420p;
+    std::shared_ptr<MemoryPool> framePool;
 
     bool loop = true;
 
+    bool maxSpeed = false;
+    int prefetchSize = 0;
+
+    // Seek requested while running, picked up by the node thread
+    std::mutex seekMtx;
+    std::optional<std::chrono::nanoseconds> seekTimestamp;
+    std::optional<std::int64_t> seekSequenceNum;
+
    public:
     constexpr static const char* NAME = "ReplayVideo";
 
@@ -50,6 +63,11 @@ class ReplayVideo : public NodeCRTP<ThreadedHostNode, ReplayVideo> {
     std::tuple<int, int> getSize() const;
     float getFps() const;
     bool getLoop() const;
+    int getNumFramesPool() const;
+    /**
+     * Get output pool usage statistics
+     */
+    MemoryPool::Stats getPoolStats() const;
 
     ReplayVideo& setReplayMetadataFile(const std::filesystem::path& replayFile);
     ReplayVideo& setReplayVideoFile(const std::filesystem::path& replayVideo);
@@ -58,6 +76,34 @@ class ReplayVideo : public NodeCRTP<ThreadedHostNode, ReplayVideo> {
     ReplayVideo& setSize(int width, int height);
     ReplayVideo& setFps(float fps);
     ReplayVideo& setLoop(bool loop);
+    /**
+     * Reuse output frame buffers from a pool instead of allocating a new one for each frame.
+     * Must be set before the pipeline is started.
+     * @param numFramesPool Number of buffers retained by the pool, 0 disables pooling (default)
+     */
+    ReplayVideo& setNumFramesPool(int numFramesPool);
+
+    /**
+     * Continue the replay from the given time since the start of the recording.
+     * Only the part of the files around the target is read. Can be called while the pipeline is running
+     */
+    void seek(std::chrono::nanoseconds timestamp);
+    /**
+     * Continue the replay from the first message with a sequence number at or after the given one.
+     * Can be called while the pipeline is running
+     */
+    void seekToSequenceNum(std::int64_t sequenceNum);
+
+    bool getMaxSpeed() const;
+    int getPrefetchSize() const;
+    /**
+     * Replay as fast as the frames can be read and decoded, ignoring the recorded timestamps and the fps setting
+     */
+    ReplayVideo& setMaxSpeed(bool maxSpeed);
+    /**
+     * Read up to this many messages ahead on a separate thread, 0 reads them on the node thread (default)
+     */
+    ReplayVideo& setPrefetchSize(int prefetchSize);
 };
 
 /**
@@ -70,6 +116,14 @@ class ReplayMetadataOnly : public NodeCRTP<ThreadedHostNode, ReplayMetadataOnly>
     std::optional<float> fps;
     bool loop = true;
 
+    bool maxSpeed = false;
+    int prefetchSize = 0;
+
+    // Seek requested while running, picked up by the node thread
+    std::mutex seekMtx;
+    std::optional<std::chrono::nanoseconds> seekTimestamp;
+    std::optional<std::int64_t> seekSequenceNum;
+
    public:
     constexpr static const char* NAME = "ReplayMetadataOnly";
 
@@ -89,6 +143,28 @@ class ReplayMetadataOnly : public NodeCRTP<ThreadedHostNode, ReplayMetadataOnly>
     ReplayMetadataOnly& setReplayFile(const std::filesystem::path& replayFile);
     ReplayMetadataOnly& setFps(float fps);
     ReplayMetadataOnly& setLoop(bool loop);
+
+    /**
+     * Continue the replay from the given time since the start of the recording.
+     * Only the part of the file around the target is read. Can be called while the pipeline is running
+     */
+    void seek(std::chrono::nanoseconds timestamp);
+    /**
+     * Continue the replay from the first message with a sequence number at or after the given one.
+     * Can be called while the pipeline is running
+     */
+    void seekToSequenceNum(std::int64_t sequenceNum);
+
+    bool getMaxSpeed() const;
+    int getPrefetchSize() const;
+    /**
+     * Replay as fast as the messages can be read, ignoring the recorded timestamps and the fps setting
+     */
+    ReplayMetadataOnly& setMaxSpeed(bool maxSpeed);
+    /**
+     * Read up to this many messages ahead on a separate thread, 0 reads them on the node thread (default)
+     */
+    ReplayMetadataOnly& setPrefetchSize(int prefetchSize);
 };
 
 }  // namespace node
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -22,6 +23,32 @@ class RemoteConnection {
     static constexpr auto DEFAULT_HTTP_PORT = 8080;       ///< Default HTTP port.
     static constexpr auto DEFAULT_ADDRESS = "0.0.0.0";    ///< Default address to bind.
 
+    /**
+     * @brief Publishing statistics of a topic.
+     *
+     * Topics are published from a single thread which only sends the newest message of each topic,
+     * so a slow client never blocks the senders. Messages replaced by a newer one before they were sent are skipped.
+     */
+    struct TopicStats {
+        uint64_t receivedMessages = 0;   ///< Messages taken from the topic queue.
+        uint64_t publishedMessages = 0;  ///< Messages serialized and sent to the subscribed clients.
+        uint64_t skippedMessages = 0;    ///< Messages not sent: replaced by a newer one, held back by the rate limit or without subscribers.
+        uint64_t publishedBytes = 0;     ///< Serialized size of the published messages.
+    };
+
+    /**
+     * @brief Preview of the frames of a topic, created on the host before they are serialized.
+     *
+     * Only applies to raw 8 bit frames, other messages are sent as they are. Requires OpenCV support.
+     * The frame rate of a preview is limited with setTopicMaxRate.
+     */
+    struct PreviewConfig {
+        unsigned int maxWidth = 0;      ///< Wider frames are downscaled keeping the aspect ratio, 0 for no limit.
+        unsigned int maxHeight = 0;     ///< Taller frames are downscaled keeping the aspect ratio, 0 for no limit.
+        bool encodeJpeg = false;        ///< Send the frames as JPEG encoded frames.
+        unsigned int jpegQuality = 80;  ///< JPEG quality, from 1 to 100.
+    };
+
     /**
      * @brief Constructs a RemoteConnection instance.
      *
@@ -72,6 +99,35 @@ class RemoteConnection {
      */
     bool removeTopic(const std::string& topicName);
 
+    /**
+     * @brief Limits how often messages of a topic are sent to the clients.
+     *
+     * Messages arriving faster are skipped, the newest one is sent once the interval elapses.
+     *
+     * @param topicName The name of the topic.
+     * @param maxRate Maximum number of messages per second, 0 for no limit.
+     */
+    void setTopicMaxRate(const std::string& topicName, float maxRate);
+
+    /**
+     * @brief Sends a downscaled and optionally JPEG encoded preview of the frames of a topic.
+     *
+     * Previews are only created for messages which are sent to a client.
+     * Switching JPEG encoding on or off re-advertises the topic, since its message type changes.
+     *
+     * @param topicName The name of the topic.
+     * @param config Preview to create, a default constructed config sends the frames as they are.
+     */
+    void setTopicPreview(const std::string& topicName, const PreviewConfig& config);
+
+    /**
+     * @brief Gets the publishing statistics of a topic.
+     *
+     * @param topicName The name of the topic.
+     * @return Statistics since the topic was added.
+     */
+    TopicStats getTopicStats(const std::string& topicName);
+
     /**
      * @brief Registers a pipeline with the remote connection.
      *
@@ -6,6 +6,7 @@
 #include <stdint.h>
 
 #include <cmath>
+#include <optional>
 #include <depthai/pipeline/datatype/ImageManipConfig.hpp>
 #include <depthai/pipeline/datatype/ImgFrame.hpp>
 #include <depthai/properties/ImageManipProperties.hpp>
@@ -59,6 +60,23 @@ void loop(N& node,
 
     std::shared_ptr<ImgFrame> inImage;
 
+    // Output buffers are reused once all frames referencing them are released downstream
+    std::vector<std::shared_ptr<ImageManipData>> outPool;
+    const size_t numFramesPool = std::max(node.properties.numFramesPool, 0);
+    auto getOutputData = [&]() {
+        for(const auto& data : outPool) {
+            if(data.use_count() == 1) {
+                data->setSize(node.properties.outputFrameSize);
+                return data;
+            }
+        }
+        auto data = std::make_shared<ImageManipData>(node.properties.outputFrameSize);
+        if(outPool.size() < numFramesPool) {
+            outPool.push_back(data);
+        }
+        return data;
+    };
+
     while(node.isRunning()) {
         std::shared_ptr<ImageManipConfig> pConfig;
         bool hasConfig = false;
@@ -115,7 +133,7 @@ void loop(N& node,
             node.out.send(inImage);
         } else if((long)outputSize <= (long)node.properties.outputFrameSize) {
             auto outImage = std::make_shared<ImgFrame>();
-            auto outImageData = std::make_shared<ImageManipData>(node.properties.outputFrameSize);
+            auto outImageData = getOutputData();
             outImage->data = outImageData;
 
             bool success = true;
@@ -152,6 +170,8 @@ void loop(N& node,
 
 class _ImageManipMemory : public Memory {
     std::shared_ptr<std::vector<uint8_t>> _data;
+    // Allocation a slice points into, kept separate from _data so the slice can't grow over its neighbours
+    std::shared_ptr<std::vector<uint8_t>> _owner;
     span<uint8_t> _span;
     size_t _offset = 0;
 
@@ -184,10 +204,13 @@ class _ImageManipMemory : public Memory {
         return _offset;
     }
     void setSize(size_t size) override {
-        if(size > _span.size()) {
-            auto oldData = _data;
+        if(_data && _span.data() == _data->data() && size <= _data->size()) {
+            // Shrunk earlier, grow back within the owned allocation
+            _span = span(_data->data(), size);
+        } else if(size > _span.size()) {
+            auto oldSpan = _span;
             _data = std::make_shared<std::vector<uint8_t>>(size);
-            std::copy(oldData->begin(), oldData->end(), _data->begin());
+            std::copy(oldSpan.begin(), oldSpan.end(), _data->begin());
             _span = span(*_data);
         } else {
             _span = _span.subspan(0, size);
@@ -200,6 +223,7 @@ class _ImageManipMemory : public Memory {
         if(_data) {
             _data = other._data;
         }
+        _owner = other._owner;
         _span = other._span;
         _offset = other._offset;
     }
@@ -209,6 +233,17 @@ class _ImageManipMemory : public Memory {
         mem->setOffset(offset);
         return mem;
     }
+    // View of size bytes at offset, keeps the underlying allocation alive
+    std::shared_ptr<_ImageManipMemory> slice(size_t offset, size_t size) {
+        if(offset + size > this->size()) throw std::out_of_range("Slice out of the memory bounds");
+        auto mem = std::make_shared<_ImageManipMemory>(span<uint8_t>(data() + offset, size));
+        mem->_owner = _data;
+        return mem;
+    }
+    // Whether slices of this memory are still referenced
+    bool hasSlices() const {
+        return _data && _data.use_count() > 1;
+    }
 };
 
 template <typename T>
@@ -307,6 +342,8 @@ class Warp {
     uint32_t backgroundColor[3] = {0, 0, 0};
     bool enableUndistort = false;
     bool undistortOneShot = false;
+    /// Threads used by backends that can split the warp (0 uses all hardware threads)
+    uint32_t numThreads = 1;
 
     ImgFrame::Type type;
     FrameSpecs srcSpecs;
@@ -357,7 +394,8 @@ class WarpH : public Warp<ImageManipBuffer, ImageManipData> {
     std::unique_ptr<void> dummyUndistortImpl;
 #endif
 
-    void transform(const std::shared_ptr<ImageManipData> srcData,
+   protected:
+    virtual void transform(const std::shared_ptr<ImageManipData> srcData,
                    std::shared_ptr<ImageManipData> dstData,
                    const size_t srcWidth,
                    const size_t srcHeight,
@@ -389,6 +427,28 @@ class WarpH : public Warp<ImageManipBuffer, ImageManipData> {
     void apply(const std::shared_ptr<ImageManipData> src, std::shared_ptr<ImageManipData> dst) override;
 };
 
+/**
+ * Host warp backend which splits the output into row bands and warps them on a shared worker pool.
+ * With a single thread it is the same as WarpH. With more threads, sampling coordinates only depend on the absolute
+ * output pixel, so the output is the same for any number of threads larger than one.
+ */
+template <template <typename T> typename ImageManipBuffer, typename ImageManipData>
+class WarpTiled : public WarpH<ImageManipBuffer, ImageManipData> {
+   protected:
+    void transform(const std::shared_ptr<ImageManipData> srcData,
+                   std::shared_ptr<ImageManipData> dstData,
+                   const size_t srcWidth,
+                   const size_t srcHeight,
+                   const size_t srcStride,
+                   const size_t dstWidth,
+                   const size_t dstHeight,
+                   const size_t dstStride,
+                   const uint16_t numChannels,
+                   const uint16_t bpp,
+                   const std::array<std::array<float, 3>, 3> matrix,
+                   const std::vector<uint32_t>& backgroundColor) override;
+};
+
 template <template <typename T> typename ImageManipBuffer, typename ImageManipData>
 class ColorChange {
     std::shared_ptr<spdlog::async_logger> logger;
@@ -471,7 +531,8 @@ class ImageManipOperations {
     ImageManipProperties properties;
 
     uint8_t mode = 0;
-    std::string prevConfig;
+    // Config of the last build, base is adjusted while building
+    std::optional<ImageManipOpsBase<Container>> prevConfig;
 
     std::vector<ManipOp> outputOps;
 
@@ -519,6 +580,14 @@ class ImageManipOperations {
 
     bool apply(const std::shared_ptr<ImageManipData> src, std::shared_ptr<ImageManipData> dst);
 
+    /**
+     * Number of threads the warp backend may use, 0 uses all hardware threads. Ignored by single threaded backends.
+     */
+    ImageManipOperations& setNumThreads(uint32_t numThreads) {
+        warpEngine.numThreads = numThreads;
+        return *this;
+    }
+
     size_t getOutputPlaneSize(uint8_t plane = 0) const;
     size_t getOutputSize() const;
     size_t getOutputWidth() const;
@@ -540,6 +609,40 @@ class ImageManipOperations {
 FrameSpecs getSrcFrameSpecs(dai::ImgFrame::Specs srcSpecs);
 size_t getAlignedOutputFrameSize(ImgFrame::Type type, size_t width, size_t height);
 
+/**
+ * Copies the metadata of srcFrame to dstFrame and sets its specs, type and transformation to the output of manip
+ */
+template <typename Operations>
+void setOutputFrameInfo(const Operations& manip, const ImgFrame& srcFrame, ImgFrame& dstFrame) {
+    auto outType = manip.getOutputFrameType();
+    auto dstSpecs = manip.getOutputFrameSpecs(outType);
+    dstFrame.sourceFb = srcFrame.sourceFb;
+    dstFrame.cam = srcFrame.cam;
+    dstFrame.instanceNum = srcFrame.instanceNum;
+    dstFrame.sequenceNum = srcFrame.sequenceNum;
+    dstFrame.tsDevice = srcFrame.tsDevice;
+    dstFrame.ts = srcFrame.ts;
+    dstFrame.category = srcFrame.category;
+    dstFrame.event = srcFrame.event;
+    dstFrame.fb.height = dstSpecs.height;
+    dstFrame.fb.width = dstSpecs.width;
+    dstFrame.fb.stride = dstSpecs.p1Stride;
+    dstFrame.fb.p1Offset = dstSpecs.p1Offset;
+    dstFrame.fb.p2Offset = dstSpecs.p2Offset;
+    dstFrame.fb.p3Offset = dstSpecs.p3Offset;
+    dstFrame.setType(outType);
+
+    // Transformations
+    dstFrame.transformation = srcFrame.transformation;
+    if(manip.undistortEnabled()) {
+        dstFrame.transformation.setDistortionCoefficients({});
+    }
+    auto srcCrops = manip.getSrcCrops();
+    dstFrame.transformation.addSrcCrops(srcCrops);
+    dstFrame.transformation.addTransformation(manip.getMatrix());
+    dstFrame.transformation.setSize(dstSpecs.width, dstSpecs.height);
+}
+
 }  // namespace impl
 }  // namespace dai
 
@@ -577,6 +680,29 @@ void transformOpenCV(const uint8_t* src,
                      const size_t sourceMinY,
                      const size_t sourceMaxX,
                      const size_t sourceMaxY);
+/**
+ * Same as transformOpenCV, but splits the destination into row bands processed on a shared worker pool.
+ * Each band runs the same OpenCV warp on its rows, so the output is identical to transformOpenCV for any
+ * numThreads (0 uses all hardware threads).
+ */
+void transformOpenCVTiled(const uint8_t* src,
+                          uint8_t* dst,
+                          const size_t srcWidth,
+                          const size_t srcHeight,
+                          const size_t srcStride,
+                          const size_t dstWidth,
+                          const size_t dstHeight,
+                          const size_t dstStride,
+                          const uint16_t numChannels,
+                          const uint16_t bpp,
+                          const std::array<std::array<float, 3>, 3> matrix,
+                          const std::vector<uint32_t>& background,
+                          const FrameSpecs& srcImgSpecs,
+                          const size_t sourceMinX,
+                          const size_t sourceMinY,
+                          const size_t sourceMaxX,
+                          const size_t sourceMaxY,
+                          const size_t numThreads);
 void transformFastCV(const uint8_t* src,
                      uint8_t* dst,
                      const size_t srcWidth,
@@ -627,6 +753,28 @@ static inline void RGBfromYUV(float& R, float& G, float& B, float Y, float U, fl
     B = 1.164f * Y + 2.017f * U;
 }
 
+/// Instruction set used by colorConvertFixedPoint
+enum class ColorConvertIsa { SCALAR, SSE41, AVX2, NEON };
+
+/**
+ * Best instruction set for color conversion supported by the CPU
+ */
+ColorConvertIsa getColorConvertIsa();
+
+/**
+ * Fixed-point (Q16) variant of YUVfromRGB / RGBfromYUV for whole frames.
+ * Handles NV12 and YUV420p to RGB888p, BGR888p, RGB888i, BGR888i and GRAY8, and the reverse from RGB/BGR to NV12, YUV420p and GRAY8.
+ * Output of all instruction sets is bit-exact with the scalar implementation.
+ * @returns false if the conversion is not handled
+ */
+bool colorConvertFixedPoint(const uint8_t* src,
+                            const FrameSpecs& srcSpecs,
+                            ImgFrame::Type from,
+                            uint8_t* dst,
+                            const FrameSpecs& dstSpecs,
+                            ImgFrame::Type to,
+                            ColorConvertIsa isa = getColorConvertIsa());
+
 template <template <typename T> typename ImageManipBuffer, typename ImageManipData>
 bool ColorChange<ImageManipBuffer, ImageManipData>::colorConvertToRGB888p(const std::shared_ptr<ImageManipData> inputFrame,
                                                                           std::shared_ptr<ImageManipData> outputFrame,
@@ -2454,56 +2602,62 @@ void ColorChange<ImageManipBuffer, ImageManipData>::apply(const std::shared_ptr<
 
     bool done = false;
     auto start = std::chrono::steady_clock::now();
-    switch(to) {
-        case dai::ImgFrame::Type::RGB888p:
-            done = colorConvertToRGB888p(src, dst, srcSpecs, dstSpecs, from);
-            break;
-        case dai::ImgFrame::Type::BGR888p:
-            done = colorConvertToBGR888p(src, dst, srcSpecs, dstSpecs, from);
-            break;
-        case dai::ImgFrame::Type::RGB888i:
-            done = colorConvertToRGB888i(src, dst, srcSpecs, dstSpecs, from);
-            break;
-        case dai::ImgFrame::Type::BGR888i:
-            done = colorConvertToBGR888i(src, dst, srcSpecs, dstSpecs, from);
-            break;
-        case dai::ImgFrame::Type::NV12:
-            done = colorConvertToNV12(src, dst, srcSpecs, dstSpecs, from);
-            break;
-        case dai::ImgFrame::Type::YUV420p:
-            done = colorConvertToYUV420p(src, dst, srcSpecs, dstSpecs, from);
-            break;
-        case dai::ImgFrame::Type::GRAY8:
-        case dai::ImgFrame::Type::RAW8:
-            done = colorConvertToGRAY8(src, dst, srcSpecs, dstSpecs, from);
-            break;
-        case ImgFrame::Type::YUV422i:
-        case ImgFrame::Type::YUV444p:
-        case ImgFrame::Type::YUV422p:
-        case ImgFrame::Type::YUV400p:
-        case ImgFrame::Type::RGBA8888:
-        case ImgFrame::Type::RGB161616:
-        case ImgFrame::Type::LUT2:
-        case ImgFrame::Type::LUT4:
-        case ImgFrame::Type::LUT16:
-        case ImgFrame::Type::RAW16:
-        case ImgFrame::Type::RAW14:
-        case ImgFrame::Type::RAW12:
-        case ImgFrame::Type::RAW10:
-        case ImgFrame::Type::PACK10:
-        case ImgFrame::Type::PACK12:
-        case ImgFrame::Type::YUV444i:
-        case ImgFrame::Type::NV21:
-        case ImgFrame::Type::BITSTREAM:
-        case ImgFrame::Type::HDR:
-        case ImgFrame::Type::RGBF16F16F16p:
-        case ImgFrame::Type::BGRF16F16F16p:
-        case ImgFrame::Type::RGBF16F16F16i:
-        case ImgFrame::Type::BGRF16F16F16i:
-        case ImgFrame::Type::GRAYF16:
-        case ImgFrame::Type::RAW32:
-        case ImgFrame::Type::NONE:
-            break;
+#if !defined(DEPTHAI_HAVE_FASTCV_SUPPORT)
+    // Common YUV <-> RGB conversions go through the vectorized fixed-point kernels
+    done = colorConvertFixedPoint(src->getData().data(), srcSpecs, from, dst->data(), dstSpecs, to);
+#endif
+    if(!done) {
+        switch(to) {
+            case dai::ImgFrame::Type::RGB888p:
+                done = colorConvertToRGB888p(src, dst, srcSpecs, dstSpecs, from);
+                break;
+            case dai::ImgFrame::Type::BGR888p:
+                done = colorConvertToBGR888p(src, dst, srcSpecs, dstSpecs, from);
+                break;
+            case dai::ImgFrame::Type::RGB888i:
+                done = colorConvertToRGB888i(src, dst, srcSpecs, dstSpecs, from);
+                break;
+            case dai::ImgFrame::Type::BGR888i:
+                done = colorConvertToBGR888i(src, dst, srcSpecs, dstSpecs, from);
+                break;
+            case dai::ImgFrame::Type::NV12:
+                done = colorConvertToNV12(src, dst, srcSpecs, dstSpecs, from);
+                break;
+            case dai::ImgFrame::Type::YUV420p:
+                done = colorConvertToYUV420p(src, dst, srcSpecs, dstSpecs, from);
+                break;
+            case dai::ImgFrame::Type::GRAY8:
+            case dai::ImgFrame::Type::RAW8:
+                done = colorConvertToGRAY8(src, dst, srcSpecs, dstSpecs, from);
+                break;
+            case ImgFrame::Type::YUV422i:
+            case ImgFrame::Type::YUV444p:
+            case ImgFrame::Type::YUV422p:
+            case ImgFrame::Type::YUV400p:
+            case ImgFrame::Type::RGBA8888:
+            case ImgFrame::Type::RGB161616:
+            case ImgFrame::Type::LUT2:
+            case ImgFrame::Type::LUT4:
+            case ImgFrame::Type::LUT16:
+            case ImgFrame::Type::RAW16:
+            case ImgFrame::Type::RAW14:
+            case ImgFrame::Type::RAW12:
+            case ImgFrame::Type::RAW10:
+            case ImgFrame::Type::PACK10:
+            case ImgFrame::Type::PACK12:
+            case ImgFrame::Type::YUV444i:
+            case ImgFrame::Type::NV21:
+            case ImgFrame::Type::BITSTREAM:
+            case ImgFrame::Type::HDR:
+            case ImgFrame::Type::RGBF16F16F16p:
+            case ImgFrame::Type::BGRF16F16F16p:
+            case ImgFrame::Type::RGBF16F16F16i:
+            case ImgFrame::Type::BGRF16F16F16i:
+            case ImgFrame::Type::GRAYF16:
+            case ImgFrame::Type::RAW32:
+            case ImgFrame::Type::NONE:
+                break;
+        }
     }
     auto diff = std::chrono::steady_clock::now() - start;
     if(logger) logger->trace("ImageManip | colorConvert took {}ns", std::chrono::duration_cast<std::chrono::nanoseconds>(diff).count());
@@ -2701,18 +2855,20 @@ template <template <typename T> typename ImageManipBuffer,
           typename WarpBackend>
 ImageManipOperations<ImageManipBuffer, ImageManipData, WarpBackend>& ImageManipOperations<ImageManipBuffer, ImageManipData, WarpBackend>::build(
     const ImageManipOpsBase<Container>& newBase, ImgFrame::Type outType, FrameSpecs srcFrameSpecs, ImgFrame::Type inFrameType) {
-    const auto newCfgStr = newBase.str();
     if(outType == ImgFrame::Type::NONE) {
         if(base.colormap != Colormap::NONE)
             outType = VALID_TYPE_COLOR;
         else
             outType = inFrameType;
     }
-    if(newCfgStr == prevConfig && outType == outputFrameType && srcFrameSpecs.width == srcSpecs.width && srcFrameSpecs.height == srcSpecs.height
-       && inFrameType == inType)
+    if(prevConfig && outType == outputFrameType && srcFrameSpecs.width == srcSpecs.width && srcFrameSpecs.height == srcSpecs.height && inFrameType == inType
+       && newBase == *prevConfig)
         return *this;
-    prevConfig = newCfgStr;
+    prevConfig = newBase;
     outputOps.clear();
+    // Modes of the previous config must not leak into the new one
+    mode = 0;
+    convertInput = false;
 
     if(srcFrameSpecs.width <= 1 || srcFrameSpecs.height <= 1) {
         throw std::runtime_error("Input image is one dimensional");
@@ -3221,6 +3377,44 @@ void WarpH<ImageManipBuffer, ImageManipData>::transform(const std::shared_ptr<Im
     }
 }
 
+template <template <typename T> typename ImageManipBuffer, typename ImageManipData>
+void WarpTiled<ImageManipBuffer, ImageManipData>::transform(const std::shared_ptr<ImageManipData> src,
+                                                            std::shared_ptr<ImageManipData> dst,
+                                                            const size_t srcWidth,
+                                                            const size_t srcHeight,
+                                                            const size_t srcStride,
+                                                            const size_t dstWidth,
+                                                            const size_t dstHeight,
+                                                            const size_t dstStride,
+                                                            const uint16_t numChannels,
+                                                            const uint16_t bpp,
+                                                            const std::array<std::array<float, 3>, 3> matrix,
+                                                            const std::vector<uint32_t>& background) {
+#if defined(DEPTHAI_HAVE_OPENCV_SUPPORT) && DEPTHAI_IMAGEMANIPV2_OPENCV
+    transformOpenCVTiled(src->data(),
+                         dst->data(),
+                         srcWidth,
+                         srcHeight,
+                         srcStride,
+                         dstWidth,
+                         dstHeight,
+                         dstStride,
+                         numChannels,
+                         bpp,
+                         matrix,
+                         background,
+                         this->srcSpecs,
+                         this->sourceMinX,
+                         this->sourceMinY,
+                         this->sourceMaxX,
+                         this->sourceMaxY,
+                         this->numThreads);
+#else
+    WarpH<ImageManipBuffer, ImageManipData>::transform(
+        src, dst, srcWidth, srcHeight, srcStride, dstWidth, dstHeight, dstStride, numChannels, bpp, matrix, background);
+#endif
+}
+
 void printSpecs(spdlog::async_logger& logger, FrameSpecs specs);
 
 template <template <typename T> typename ImageManipBuffer, typename ImageManipData>
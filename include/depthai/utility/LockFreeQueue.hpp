@@ -0,0 +1,408 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace dai {
+
+/**
+ * Bounded lock-free ring buffer queue, a drop-in alternative to LockingQueue with the same
+ * blocking/non-blocking, maxSize and destruct() semantics.
+ *
+ * Each slot carries a sequence counter (Vyukov bounded queue), so producers and consumers only
+ * synchronize on atomics. Threads park on a condition variable only when they actually have to block,
+ * and notifications are skipped when nobody is parked.
+ *
+ * Safe for any number of producers and consumers, but intended for single-producer links.
+ * Producers reserve their element against maxSize before claiming a slot, so concurrent pushes never exceed it.
+ *
+ * @note Changing maxSize within the current capacity is thread safe, pushes that reserved their element before
+ * a shrink still complete. Growing maxSize past the current capacity, copying and moving are not thread safe and
+ * should only be done while the queue isn't in use (eg. before the pipeline is started)
+ */
+template <typename T>
+class LockFreeQueue {
+   public:
+    /// Largest supported maxSize, larger queues should use LockingQueue
+    static constexpr unsigned MAX_CAPACITY = 1u << 16;
+
+    explicit LockFreeQueue(unsigned maxSize, bool blocking = true) : maxSize(maxSize), blocking(blocking) {
+        allocate(maxSize);
+    }
+    LockFreeQueue(const LockFreeQueue& obj) : maxSize(obj.getMaxSize()), blocking(obj.getBlocking()), destructed(obj.isDestroyed()) {
+        allocate(obj.capacity());
+        obj.forEach([this](const T& value) { tryEnqueue(value); });
+    }
+    LockFreeQueue(LockFreeQueue&& obj) noexcept
+        : maxSize(obj.getMaxSize()), blocking(obj.getBlocking()), destructed(obj.isDestroyed()), cells(std::move(obj.cells)), mask(obj.mask) {
+        enqueuePos.store(obj.enqueuePos.load());
+        dequeuePos.store(obj.dequeuePos.load());
+        count.store(obj.count.load());
+    }
+    LockFreeQueue& operator=(const LockFreeQueue& obj) {
+        if(this != &obj) {
+            maxSize = obj.getMaxSize();
+            blocking = obj.getBlocking();
+            destructed = obj.isDestroyed();
+            allocate(obj.capacity());
+            obj.forEach([this](const T& value) { tryEnqueue(value); });
+        }
+        return *this;
+    }
+    LockFreeQueue& operator=(LockFreeQueue&& obj) noexcept {
+        if(this != &obj) {
+            maxSize = obj.getMaxSize();
+            blocking = obj.getBlocking();
+            destructed = obj.isDestroyed();
+            cells = std::move(obj.cells);
+            mask = obj.mask;
+            enqueuePos.store(obj.enqueuePos.load());
+            dequeuePos.store(obj.dequeuePos.load());
+            count.store(obj.count.load());
+        }
+        return *this;
+    }
+
+    ~LockFreeQueue() = default;
+
+    void setMaxSize(unsigned sz) {
+        if(sz > capacity()) {
+            // Not thread safe - regrow the ring and carry over pending elements
+            auto prev = std::move(*this);
+            allocate(sz);
+            T value;
+            while(prev.tryDequeue(value)) tryEnqueue(std::move(value));
+        }
+        maxSize = sz;
+    }
+
+    void setBlocking(bool bl) {
+        blocking = bl;
+    }
+
+    unsigned getMaxSize() const {
+        return maxSize;
+    }
+
+    unsigned getSize() const {
+        return static_cast<unsigned>(size());
+    }
+
+    unsigned isFull() const {
+        return size() >= maxSize;
+    }
+
+    bool getBlocking() const {
+        return blocking;
+    }
+
+    /**
+     * Number of elements overwritten (non-blocking mode) or discarded (maxSize 0) by pushes so far
+     */
+    std::uint64_t getNumDropped() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    void destruct() {
+        if(!destructed.exchange(true)) {
+            std::unique_lock<std::mutex> lock(waitMtx);
+            signalPop.notify_all();
+            signalPush.notify_all();
+        }
+    }
+
+    bool isDestroyed() const {
+        return destructed;
+    }
+
+    template <typename Rep, typename Period>
+    bool waitAndConsumeAll(std::function<void(T&)> callback, std::chrono::duration<Rep, Period> timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        bool pred = park(signalPush, waitingConsumers, [this]() { return size() > 0 || destructed; }, &deadline);
+        if(!pred) return false;
+        if(destructed) return false;
+
+        drain(callback);
+        return true;
+    }
+
+    bool waitAndConsumeAll(std::function<void(T&)> callback) {
+        park(signalPush, waitingConsumers, [this]() { return size() > 0 || destructed; });
+        if(size() == 0) return false;
+        if(destructed) return false;
+
+        drain(callback);
+        return true;
+    }
+
+    bool consumeAll(std::function<void(T&)> callback) {
+        if(size() == 0) return false;
+
+        drain(callback);
+        return true;
+    }
+
+    bool push(T const& data) {
+        return pushImpl(data, nullptr);
+    }
+
+    bool push(T&& data) {
+        return pushImpl(std::move(data), nullptr);
+    }
+
+    template <typename Rep, typename Period>
+    bool tryWaitAndPush(T const& data, std::chrono::duration<Rep, Period> timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        return pushImpl(data, &deadline);
+    }
+
+    template <typename Rep, typename Period>
+    bool tryWaitAndPush(T&& data, std::chrono::duration<Rep, Period> timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        return pushImpl(std::move(data), &deadline);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    bool front(T& value) {
+        const std::size_t pos = dequeuePos.load(std::memory_order_acquire);
+        Cell& cell = cells[pos & mask];
+        // Claim the head slot, so no consumer takes it while it's being copied
+        std::size_t expected = pos + 1;
+        if(!cell.sequence.compare_exchange_strong(expected, pos, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return false;
+        }
+        value = cell.data;
+        cell.sequence.store(pos + 1, std::memory_order_release);
+        // Consumers might have observed the slot as claimed in the meantime
+        notify(signalPush, waitingConsumers);
+        return true;
+    }
+
+    bool tryPop(T& value) {
+        if(!tryDequeue(value)) return false;
+        notify(signalPop, waitingProducers);
+        return true;
+    }
+
+    bool waitAndPop(T& value) {
+        return popImpl(value, nullptr);
+    }
+
+    template <typename Rep, typename Period>
+    bool tryWaitAndPop(T& value, std::chrono::duration<Rep, Period> timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        return popImpl(value, &deadline);
+    }
+
+    void waitEmpty() {
+        park(signalPop, waitingProducers, [this]() { return size() == 0 || destructed; });
+    }
+
+   private:
+    using Deadline = std::chrono::steady_clock::time_point;
+    static constexpr int SPIN_COUNT = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T data{};
+    };
+
+    std::atomic<unsigned> maxSize;
+    std::atomic<bool> blocking;
+    std::atomic<bool> destructed{false};
+    std::atomic<std::uint64_t> dropped{0};
+
+    std::unique_ptr<Cell[]> cells;
+    std::size_t mask = 0;
+    // Producer and consumer indices on separate cache lines
+    alignas(64) std::atomic<std::size_t> enqueuePos{0};
+    alignas(64) std::atomic<std::size_t> dequeuePos{0};
+    // Elements in the queue, including ones reserved by producers but not yet published. maxSize is enforced on it
+    alignas(64) std::atomic<std::size_t> count{0};
+
+    // Parking, only used when a thread has to block
+    alignas(64) std::atomic<int> waitingConsumers{0};
+    std::atomic<int> waitingProducers{0};
+    std::mutex waitMtx;
+    std::condition_variable signalPop;
+    std::condition_variable signalPush;
+
+    std::size_t capacity() const {
+        return mask + 1;
+    }
+
+    std::size_t size() const {
+        return count.load(std::memory_order_acquire);
+    }
+
+    void allocate(std::size_t sz) {
+        std::size_t cap = 1;
+        while(cap < sz) cap <<= 1;
+        cells.reset(new Cell[cap]);
+        for(std::size_t i = 0; i < cap; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        mask = cap - 1;
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos.store(0, std::memory_order_relaxed);
+        count.store(0, std::memory_order_relaxed);
+    }
+
+    template <typename F>
+    void forEach(F&& func) const {
+        for(std::size_t pos = dequeuePos.load(); pos != enqueuePos.load(); pos++) {
+            func(cells[pos & mask].data);
+        }
+    }
+
+    template <typename U>
+    bool tryEnqueue(U&& value) {
+        // Reserve the element first, maxSize can be smaller than the ring capacity
+        std::size_t reserved = count.load(std::memory_order_relaxed);
+        do {
+            if(reserved >= maxSize.load()) return false;
+        } while(!count.compare_exchange_weak(reserved, reserved + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        while(true) {
+            Cell& cell = cells[pos & mask];
+            const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if(diff == 0) {
+                if(enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = std::forward<U>(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if(diff < 0) {
+                // Slot still held by a consumer that is finishing up
+                count.fetch_sub(1, std::memory_order_release);
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryDequeue(T& value) {
+        std::size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        while(true) {
+            Cell& cell = cells[pos & mask];
+            const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if(diff == 0) {
+                // Claim the slot first, only then advance - front() relies on the same claim
+                std::size_t expected = pos + 1;
+                if(cell.sequence.compare_exchange_weak(expected, pos, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    dequeuePos.store(pos + 1, std::memory_order_release);
+                    value = std::move(cell.data);
+                    cell.data = T{};
+                    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                    count.fetch_sub(1, std::memory_order_release);
+                    return true;
+                }
+            } else if(diff < 0) {
+                // Empty or slot claimed by another consumer
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void drain(const std::function<void(T&)>& callback) {
+        T value;
+        while(tryDequeue(value)) {
+            callback(value);
+        }
+        notify(signalPop, waitingProducers);
+    }
+
+    void notify(std::condition_variable& cv, std::atomic<int>& waiters) {
+        // Pairs with the fence in park() - either the waiter sees the change or we see the waiter
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(waiters.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(waitMtx);
+            cv.notify_all();
+        }
+    }
+
+    template <typename Predicate>
+    bool park(std::condition_variable& cv, std::atomic<int>& waiters, Predicate pred, const Deadline* deadline = nullptr) {
+        // Spinning only pays off if the other side can run meanwhile
+        static const int spinCount = std::thread::hardware_concurrency() > 1 ? SPIN_COUNT : 0;
+        for(int i = 0; i < spinCount; i++) {
+            if(pred()) return true;
+        }
+        waiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool result = true;
+        {
+            std::unique_lock<std::mutex> lock(waitMtx);
+            if(deadline) {
+                result = cv.wait_until(lock, *deadline, pred);
+            } else {
+                cv.wait(lock, pred);
+            }
+        }
+        waiters.fetch_sub(1);
+        return result;
+    }
+
+    template <typename U>
+    bool pushImpl(U&& data, const Deadline* deadline) {
+        if(maxSize == 0) {
+            // necessary if maxSize was changed
+            T discarded;
+            while(tryDequeue(discarded)) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            notify(signalPop, waitingProducers);
+            return true;
+        }
+        while(!tryEnqueue(std::forward<U>(data))) {
+            if(!blocking) {
+                // if non blocking, remove as many oldest elements as necessary, so next one will fit
+                T discarded;
+                if(tryDequeue(discarded)) {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+                continue;
+            }
+            // First checks predicate, then waits
+            bool pred = park(signalPop, waitingProducers, [this]() { return size() < maxSize || destructed; }, deadline);
+            if(!pred) return false;
+            if(destructed) return false;
+            // Slot may still be held by a consumer that is finishing up
+            if(size() < maxSize) std::this_thread::yield();
+        }
+        notify(signalPush, waitingConsumers);
+        return true;
+    }
+
+    bool popImpl(T& value, const Deadline* deadline) {
+        while(true) {
+            bool pred = park(signalPush, waitingConsumers, [this]() { return size() > 0 || destructed; }, deadline);
+            if(!pred) return false;
+            if(destructed) return false;
+            if(tryDequeue(value)) break;
+            // Element claimed, but not yet published by the producer (or taken by another consumer)
+            std::this_thread::yield();
+        }
+        notify(signalPop, waitingProducers);
+        return true;
+    }
+};
+
+}  // namespace dai
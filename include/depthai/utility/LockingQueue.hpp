@@ -1,5 +1,6 @@
 #pragma once
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <mutex>
@@ -79,6 +80,15 @@ class LockingQueue {
         return blocking;
     }
 
+    /**
+     * Number of elements overwritten (non-blocking mode) or discarded (maxSize 0) by pushes so far
+     */
+    std::uint64_t getNumDropped() const {
+        // Lock first
+        std::unique_lock<std::mutex> lock(guard);
+        return dropped;
+    }
+
     void destruct() {
         std::unique_lock<std::mutex> lock(guard);
         if(!destructed) {
@@ -154,6 +164,7 @@ class LockingQueue {
             std::unique_lock<std::mutex> lock(guard);
             if(maxSize == 0) {
                 // necessary if maxSize was changed
+                dropped += queue.size();
                 while(!queue.empty()) {
                     queue.pop();
                 }
@@ -164,6 +175,7 @@ class LockingQueue {
                 // necessary if maxSize was changed
                 while(queue.size() >= maxSize) {
                     queue.pop();
+                    dropped++;
                 }
             } else {
                 signalPop.wait(lock, [this]() { return queue.size() < maxSize || destructed; });
@@ -181,6 +193,7 @@ class LockingQueue {
             std::unique_lock<std::mutex> lock(guard);
             if(maxSize == 0) {
                 // necessary if maxSize was changed
+                dropped += queue.size();
                 while(!queue.empty()) {
                     queue.pop();
                 }
@@ -191,6 +204,7 @@ class LockingQueue {
                 // necessary if maxSize was changed
                 while(queue.size() >= maxSize) {
                     queue.pop();
+                    dropped++;
                 }
             } else {
                 signalPop.wait(lock, [this]() { return queue.size() < maxSize || destructed; });
@@ -209,6 +223,7 @@ class LockingQueue {
             std::unique_lock<std::mutex> lock(guard);
             if(maxSize == 0) {
                 // necessary if maxSize was changed
+                dropped += queue.size();
                 while(!queue.empty()) {
                     queue.pop();
                 }
@@ -219,6 +234,7 @@ class LockingQueue {
                 // necessary if maxSize was changed
                 while(queue.size() >= maxSize) {
                     queue.pop();
+                    dropped++;
                 }
             } else {
                 // First checks predicate, then waits
@@ -239,6 +255,7 @@ class LockingQueue {
             std::unique_lock<std::mutex> lock(guard);
             if(maxSize == 0) {
                 // necessary if maxSize was changed
+                dropped += queue.size();
                 while(!queue.empty()) {
                     queue.pop();
                 }
@@ -249,6 +266,7 @@ class LockingQueue {
                 // necessary if maxSize was changed
                 while(queue.size() >= maxSize) {
                     queue.pop();
+                    dropped++;
                 }
             } else {
                 // First checks predicate, then waits
@@ -335,6 +353,7 @@ class LockingQueue {
     std::queue<T> queue;
     mutable std::mutex guard;
     bool destructed{false};
+    std::uint64_t dropped = 0;
     std::condition_variable signalPop;
     std::condition_variable signalPush;
 };
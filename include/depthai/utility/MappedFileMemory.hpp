@@ -0,0 +1,45 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <filesystem>
+
+// project
+#include "depthai/utility/Memory.hpp"
+
+namespace dai {
+
+/**
+ * Memory backed by a read-only mapping of a file. Pages are loaded on first access and can be evicted by the OS,
+ * so large files (eg. models) don't count towards the resident memory until they are used.
+ * The mapping is private: writes through getData() modify only this mapping, never the file.
+ */
+class MappedFileMemory : public Memory {
+   public:
+    /**
+     * Maps the whole file
+     * @param path Path to the file
+     */
+    explicit MappedFileMemory(const std::filesystem::path& path);
+    ~MappedFileMemory() override;
+
+    MappedFileMemory(const MappedFileMemory&) = delete;
+    MappedFileMemory& operator=(const MappedFileMemory&) = delete;
+
+    span<std::uint8_t> getData() override;
+    span<const std::uint8_t> getData() const override;
+    std::size_t getMaxSize() const override;
+    std::size_t getOffset() const override;
+    /// Shrinks the visible part of the mapping, throws if larger than the file
+    void setSize(std::size_t size) override;
+
+   private:
+    std::uint8_t* mapping = nullptr;
+    std::size_t size = 0;
+    std::size_t fileSize = 0;
+#ifdef _WIN32
+    void* mappingHandle = nullptr;
+#endif
+};
+
+}  // namespace dai
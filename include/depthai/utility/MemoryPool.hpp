@@ -0,0 +1,75 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// project
+#include "depthai/utility/VectorMemory.hpp"
+
+namespace dai {
+
+/**
+ * Pool of reusable memory blocks for messages created on host.
+ *
+ * Blocks handed out by acquire() return to the pool once the last reference to them is dropped,
+ * so steady state processing does not allocate. If all blocks are in use, a new block is allocated
+ * instead of blocking the producer and the event is counted in Stats::overflows.
+ */
+class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
+   public:
+    struct Stats {
+        /// Maximum number of free blocks retained by the pool
+        std::size_t capacity = 0;
+        /// Blocks currently referenced by messages
+        std::size_t inUse = 0;
+        /// Highest number of blocks in use at the same time
+        std::size_t highWaterMark = 0;
+        /// Number of acquisitions made while more than capacity blocks were in use
+        std::size_t overflows = 0;
+    };
+
+    /**
+     * Create a memory pool
+     * @param capacity Number of blocks retained by the pool
+     * @param blockSize If non zero, preallocate all blocks with given size in bytes
+     */
+    static std::shared_ptr<MemoryPool> create(std::size_t capacity, std::size_t blockSize = 0);
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    /**
+     * Get a block of given size, reusing a free block if available.
+     * Contents of a reused block are unspecified.
+     * @param size Size of the block in bytes
+     */
+    std::shared_ptr<VectorMemory> acquire(std::size_t size);
+
+    /**
+     * Set number of blocks retained by the pool. Excess free blocks are released immediately
+     */
+    void setCapacity(std::size_t capacity);
+
+    /**
+     * Get number of blocks retained by the pool
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * Get pool usage statistics
+     */
+    Stats getStats() const;
+
+   private:
+    explicit MemoryPool(std::size_t capacity);
+    void release(VectorMemory* block);
+
+    mutable std::mutex mtx;
+    std::vector<std::unique_ptr<VectorMemory>> freeBlocks;
+    Stats stats;
+};
+
+}  // namespace dai
@@ -0,0 +1,71 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// project
+#include "depthai/common/Point3f.hpp"
+#include "depthai/pipeline/datatype/ImgDetections.hpp"
+#include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "depthai/pipeline/datatype/ObjectTrackerConfig.hpp"
+#include "depthai/pipeline/datatype/Tracklets.hpp"
+#include "depthai/properties/ObjectTrackerProperties.hpp"
+
+namespace dai {
+namespace impl {
+class OCSTracker;
+}  // namespace impl
+
+/**
+ * Host object tracker for several streams (eg. one per camera) running on a single engine.
+ *
+ * Every stream has its own, isolated tracker state (same tracker as the host ObjectTracker node),
+ * but all streams of a step are processed together on a shared thread pool instead of each one
+ * needing a dedicated thread. Detections are expected in pixel coordinates of the stream's frame.
+ */
+class MultiStreamTracker {
+   public:
+    struct StreamInput {
+        /// Frame to track on, streams without a frame are skipped in this step
+        const ImgFrame* frame = nullptr;
+        /// Detections for the frame, nullptr to only predict (track) the existing tracklets
+        const std::vector<ImgDetection>* detections = nullptr;
+        /// Spatial coordinates of the detections, optional
+        const std::vector<Point3f>* spatialData = nullptr;
+        /// Runtime config, applied before tracking, optional
+        const ObjectTrackerConfig* config = nullptr;
+    };
+
+    /**
+     * @param properties Tracker properties, shared by all streams
+     * @param numStreams Number of streams
+     */
+    MultiStreamTracker(const ObjectTrackerProperties& properties, std::size_t numStreams);
+    ~MultiStreamTracker();
+
+    MultiStreamTracker(const MultiStreamTracker&) = delete;
+    MultiStreamTracker& operator=(const MultiStreamTracker&) = delete;
+
+    /**
+     * Process one step of all streams and wait for it to finish.
+     * Inputs are only accessed during the call.
+     * @param inputs One entry per stream
+     */
+    void process(const std::vector<StreamInput>& inputs);
+
+    /**
+     * Get the current tracklets of a stream, empty until the stream saw its first detections
+     */
+    std::vector<Tracklet> getTracklets(std::size_t stream) const;
+
+    std::size_t getNumStreams() const {
+        return streams.size();
+    }
+
+   private:
+    std::vector<std::unique_ptr<impl::OCSTracker>> streams;
+};
+
+}  // namespace dai
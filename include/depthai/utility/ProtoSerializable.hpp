@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 
+#include "depthai/utility/span.hpp"
+
 namespace dai {
 
 class ProtoSerializable {
@@ -13,6 +15,20 @@ class ProtoSerializable {
         std::string schema;
     };
 
+    /**
+     * Serialized protobuf message split in two, so the payload (eg. frame data) can be written out without copying it first.
+     * The header followed by the payload is the whole serialized message
+     */
+    struct SerializedProto {
+        std::vector<std::uint8_t> header;
+        /// Points into the data of the object, valid while the object is alive and unchanged
+        span<const std::uint8_t> payload;
+
+        std::size_t size() const {
+            return header.size() + payload.size();
+        }
+    };
+
     virtual ~ProtoSerializable() = default;
 
 #ifdef DEPTHAI_ENABLE_PROTOBUF
@@ -22,6 +38,14 @@ class ProtoSerializable {
      */
     virtual std::vector<std::uint8_t> serializeProto(bool metadataOnly = false) const = 0;
 
+    /**
+     * @brief Serialize the protobuf message of this object, leaving the payload in place
+     * @return header and payload of the serialized protobuf message
+     */
+    virtual SerializedProto serializeProtoParts() const {
+        return {serializeProto(), {}};
+    }
+
     /**
      * @brief Serialize the schema of this object
      * @return schemaPair
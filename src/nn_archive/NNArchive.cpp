@@ -2,30 +2,54 @@
 
 #include <chrono>
 #include <cstdint>
+#include <fstream>
 #include <optional>
 #include <stdexcept>
 
 #include "depthai/nn_archive/NNArchiveVersionedConfig.hpp"
+#include "depthai/utility/Checksum.hpp"
+#include "depthai/utility/MappedFileMemory.hpp"
 
 // internal private
 #include "common/ModelType.hpp"
 #include "utility/ArchiveUtil.hpp"
 #include "utility/ErrorMacros.hpp"
+#include "utility/Logging.hpp"
 #include "utility/Platform.hpp"
 
 namespace dai {
 
+namespace {
+
+// Written after the archive is fully unpacked, its absence marks an interrupted unpack
+constexpr auto UNPACKED_MARKER = ".unpacked";
+
+// Name of the folder the archive is unpacked to, changes with the archive's content
+std::string getUnpackedFolderName(const std::filesystem::path& archivePath) {
+    const MappedFileMemory archive(archivePath);
+    const auto data = archive.getData();
+    return fmt::format("{}-{:x}-{:08x}", archivePath.filename().string(), data.size(), utility::checksum(data.data(), data.size()));
+}
+
+}  // namespace
+
 NNArchiveOptions::NNArchiveOptions() {
-    // Default options
-    extractFolder(platform::getTempPath());
+    // Default options, unpacked archives are shared by all processes of the user
+    extractFolder(platform::getCachePath() / "nn_archives");
 }
 
 NNArchive::NNArchive(const std::filesystem::path& archivePath, NNArchiveOptions options) : archiveOptions(options) {
     // Make sure archive exits
     if(!std::filesystem::exists(archivePath)) DAI_CHECK_V(false, "Archive file does not exist: {}", archivePath);
 
+    // Unpack archive, unless an earlier load already did
+    std::filesystem::path unpackedArchivePath = std::filesystem::path(archiveOptions.extractFolder()) / getUnpackedFolderName(archivePath);
+    unpackArchiveInDirectory(archivePath, unpackedArchivePath);
+
     // Read config
-    archiveVersionedConfigPtr.reset(new NNArchiveVersionedConfig(archivePath, archiveOptions.compression()));
+    const auto configPath = unpackedArchivePath / "config.json";
+    DAI_CHECK_V(std::filesystem::exists(configPath), "Didn't find the config.json file inside the {} archive.", archivePath);
+    archiveVersionedConfigPtr.reset(new NNArchiveVersionedConfig(configPath, NNArchiveEntry::Compression::RAW_FS));
 
     // Only V1 config is supported at the moment
     DAI_CHECK(archiveVersionedConfigPtr->getVersion() == NNArchiveConfigVersion::V1, "Only V1 config is supported at the moment");
@@ -34,18 +58,16 @@ NNArchive::NNArchive(const std::filesystem::path& archivePath, NNArchiveOptions
     // Read archive type
     modelType = model::readModelType(modelPathInArchive);
 
-    // Unpack model
-    std::filesystem::path unpackedArchivePath = std::filesystem::path(archiveOptions.extractFolder()) / std::filesystem::path(archivePath).filename();
-    unpackArchiveInDirectory(archivePath, unpackedArchivePath);
     unpackedModelPath = (unpackedArchivePath / modelPathInArchive);
 
     switch(modelType) {
         case model::ModelType::BLOB:
-            blobPtr.reset(new OpenVINO::Blob(readModelFromArchive(archivePath, modelPathInArchive)));
-            break;
         case model::ModelType::SUPERBLOB:
-            superblobPtr.reset(new OpenVINO::SuperBlob(readModelFromArchive(archivePath, modelPathInArchive)));
-            break;
+            DAI_CHECK_V(std::filesystem::exists(unpackedModelPath),
+                        "No model {} found in NNArchive {} | Please check your NNArchive.",
+                        modelPathInArchive,
+                        archivePath);
+            break;  // Loaded on first use
         case model::ModelType::DLC:
         case model::ModelType::OTHER:
             break;  // Just do nothing, model is already unpacked
@@ -61,7 +83,7 @@ NNArchive::NNArchive(const std::filesystem::path& archivePath, NNArchiveOptions
 std::optional<OpenVINO::Blob> NNArchive::getBlob() const {
     switch(modelType) {
         case model::ModelType::BLOB:
-            return *blobPtr;
+            return loadBlob();
             break;
         case model::ModelType::SUPERBLOB:
         case model::ModelType::DLC:
@@ -79,9 +101,11 @@ std::optional<OpenVINO::Blob> NNArchive::getBlob() const {
 
 std::optional<OpenVINO::SuperBlob> NNArchive::getSuperBlob() const {
     switch(modelType) {
-        case model::ModelType::SUPERBLOB:
+        case model::ModelType::SUPERBLOB: {
+            std::lock_guard<std::mutex> lock(*modelMtx);
+            if(!superblobPtr) superblobPtr = std::make_shared<OpenVINO::SuperBlob>(unpackedModelPath);
             return *superblobPtr;
-            break;
+        }
         case model::ModelType::BLOB:
         case model::ModelType::OTHER:
         case model::ModelType::DLC:
@@ -121,17 +145,26 @@ const NNArchiveVersionedConfig& NNArchive::getVersionedConfig() const {
     return *archiveVersionedConfigPtr;
 }
 
-std::vector<uint8_t> NNArchive::readModelFromArchive(const std::filesystem::path& archivePath, const std::string& modelPathInArchive) const {
-    utility::ArchiveUtil archive(archivePath, archiveOptions.compression());
-    std::vector<uint8_t> modelBytes;
-    const bool success = archive.readEntry(modelPathInArchive, modelBytes);
-    DAI_CHECK_V(success, "No model {} found in NNArchive {} | Please check your NNArchive.", modelPathInArchive, archivePath);
-    return modelBytes;
+const OpenVINO::Blob& NNArchive::loadBlob() const {
+    std::lock_guard<std::mutex> lock(*modelMtx);
+    if(!blobPtr) blobPtr = std::make_shared<OpenVINO::Blob>(unpackedModelPath);
+    return *blobPtr;
 }
 
 void NNArchive::unpackArchiveInDirectory(const std::filesystem::path& archivePath, const std::filesystem::path& directory) const {
+    const auto marker = directory / UNPACKED_MARKER;
+    if(std::filesystem::exists(marker)) return;
+
+    // Other processes may unpack the same archive concurrently
+    std::filesystem::create_directories(directory.parent_path());
+    auto lock = platform::FileLock::lock(directory.string() + ".lock", true);
+    if(std::filesystem::exists(marker)) return;
+
+    logger::debug("Unpacking NNArchive {} to {}", archivePath.string(), directory.string());
+    std::filesystem::remove_all(directory);
     utility::ArchiveUtil archive(archivePath, archiveOptions.compression());
     archive.unpackArchiveInDirectory(directory);
+    std::ofstream(marker).close();
 }
 
 std::optional<std::pair<uint32_t, uint32_t>> NNArchive::getInputSize(uint32_t index) const {
@@ -201,7 +234,7 @@ std::vector<dai::Platform> NNArchive::getSupportedPlatforms() const {
         return {Platform::RVC2};
     }
     if(endsWith(pathToModelChecked, ".blob")) {
-        auto model = OpenVINO::Blob(pathToModelChecked);
+        const auto& model = loadBlob();
         if(model.device == OpenVINO::Device::VPUX) {
             return {Platform::RVC3};
         }
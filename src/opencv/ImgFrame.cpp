@@ -1,24 +1,42 @@
 #include "depthai/pipeline/datatype/ImgFrame.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <opencv2/core/mat.hpp>
 #include <opencv2/imgproc.hpp>
 
+#include "depthai/utility/VectorMemory.hpp"
+
 // #include "spdlog/spdlog.h"
 
 namespace dai {
+
+namespace {
+
+// Buffer of given size to write the frame into, reusing the current one (eg. from a pool) if it is large enough
+uint8_t* prepareData(std::shared_ptr<Memory>& data, size_t size) {
+    if(data && data->getMaxSize() >= size) {
+        data->setSize(size);
+    } else {
+        data = std::make_shared<VectorMemory>(std::vector<uint8_t>(size));
+    }
+    return data->getData().data();
+}
+
+bool overlaps(const cv::Mat& mat, const std::shared_ptr<Memory>& data) {
+    if(!data) return false;
+    const auto buffer = data->getData();
+    return mat.datastart < buffer.data() + buffer.size() && buffer.data() < mat.dataend;
+}
+
+}  // namespace
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch-enum"
 ImgFrame& ImgFrame::setFrame(cv::Mat frame) {
-    std::vector<uint8_t> dataVec;
-    if(!frame.isContinuous()) {
-        for(int i = 0; i < frame.rows; i++) {
-            dataVec.insert(dataVec.end(), frame.ptr(i), frame.ptr(i) + frame.cols * frame.elemSize());
-        }
-    } else {
-        dataVec.insert(dataVec.begin(), frame.datastart, frame.dataend);
-    }
-    setData(dataVec);
+    if(overlaps(frame, data)) frame = frame.clone();
+    cv::Mat dst(frame.rows, frame.cols, frame.type(), prepareData(data, frame.total() * frame.elemSize()));
+    frame.copyTo(dst);
     return *this;
 }
 
@@ -215,17 +233,19 @@ cv::Mat ImgFrame::getCvFrame(cv::MatAllocator* allocator) {
 
 ImgFrame& ImgFrame::setCvFrame(cv::Mat mat, Type type) {
     cv::Mat output;
+    // Conversions write directly into the frame buffer, which must not be the source
+    if(overlaps(mat, data)) mat = mat.clone();
     setType(type);
     setSize(mat.cols, mat.rows);
     unsigned int size = mat.cols * mat.rows;
     switch(type) {
-        case Type::RGB888i:
+        case Type::RGB888i: {
             fb.width = mat.cols;
             fb.height = mat.rows;
             fb.stride = mat.cols * 3;
-            cv::cvtColor(mat, output, cv::ColorConversionCodes::COLOR_BGR2RGB);
-            setFrame(output);
-            break;
+            cv::Mat dst(mat.rows, mat.cols, CV_8UC3, prepareData(data, size * 3));
+            cv::cvtColor(mat, dst, cv::ColorConversionCodes::COLOR_BGR2RGB);
+        } break;
 
         case Type::BGR888i:
             fb.width = mat.cols;
@@ -241,17 +261,13 @@ ImgFrame& ImgFrame::setCvFrame(cv::Mat mat, Type type) {
             fb.p1Offset = 0;
             fb.p2Offset = size;
             fb.p3Offset = size * 2;
-            std::vector<uint8_t> dataVec;
-            std::vector<cv::Mat> channels;
-            cv::split(mat, channels);
-            dataVec.insert(dataVec.end(), channels[2].datastart, channels[2].dataend);
-            dataVec.insert(dataVec.end(), channels[1].datastart, channels[1].dataend);
-            dataVec.insert(dataVec.end(), channels[0].datastart, channels[0].dataend);
-            setData(dataVec);
-            size_t offset = channels[0].dataend - channels[0].datastart;
-            fb.p1Offset = 0;
-            fb.p2Offset = offset;
-            fb.p3Offset = offset * 2;
+            // Planes R, G, B from the interleaved BGR channels 2, 1, 0
+            uint8_t* dst = prepareData(data, size * 3);
+            cv::Mat planes[] = {cv::Mat(mat.rows, mat.cols, CV_8UC1, dst),
+                                cv::Mat(mat.rows, mat.cols, CV_8UC1, dst + size),
+                                cv::Mat(mat.rows, mat.cols, CV_8UC1, dst + size * 2)};
+            const int fromTo[] = {2, 0, 1, 1, 0, 2};
+            cv::mixChannels(&mat, 1, planes, 3, fromTo, 3);
         } break;
 
         case Type::BGR888p: {
@@ -261,29 +277,24 @@ ImgFrame& ImgFrame::setCvFrame(cv::Mat mat, Type type) {
             fb.p1Offset = 0;
             fb.p2Offset = size;
             fb.p3Offset = size * 2;
-            std::vector<uint8_t> dataVec;
-            std::vector<cv::Mat> channels;
-            cv::split(mat, channels);
-            dataVec.insert(dataVec.end(), channels[0].datastart, channels[0].dataend);
-            dataVec.insert(dataVec.end(), channels[1].datastart, channels[1].dataend);
-            dataVec.insert(dataVec.end(), channels[2].datastart, channels[2].dataend);
-            setData(dataVec);
-            size_t offset = channels[0].dataend - channels[0].datastart;
-            fb.p1Offset = 0;
-            fb.p2Offset = offset;
-            fb.p3Offset = offset * 2;
+            uint8_t* dst = prepareData(data, size * 3);
+            cv::Mat planes[] = {cv::Mat(mat.rows, mat.cols, CV_8UC1, dst),
+                                cv::Mat(mat.rows, mat.cols, CV_8UC1, dst + size),
+                                cv::Mat(mat.rows, mat.cols, CV_8UC1, dst + size * 2)};
+            const int fromTo[] = {0, 0, 1, 1, 2, 2};
+            cv::mixChannels(&mat, 1, planes, 3, fromTo, 3);
         } break;
 
-        case Type::YUV420p:
+        case Type::YUV420p: {
             fb.width = mat.cols;
             fb.height = mat.rows;
             fb.stride = mat.cols;
             fb.p1Offset = 0;
             fb.p2Offset = size;
             fb.p3Offset = size / 4;
-            cv::cvtColor(mat, output, cv::ColorConversionCodes::COLOR_BGR2YUV_I420);
-            setFrame(output);
-            break;
+            cv::Mat dst(mat.rows * 3 / 2, mat.cols, CV_8UC1, prepareData(data, size * 3 / 2));
+            cv::cvtColor(mat, dst, cv::ColorConversionCodes::COLOR_BGR2YUV_I420);
+        } break;
 
         case Type::NV12:
         case Type::NV21: {
@@ -297,20 +308,16 @@ ImgFrame& ImgFrame::setCvFrame(cv::Mat mat, Type type) {
             cv::cvtColor(mat, output, code);
             assert(output.isContinuous());
             assert(output.total() * output.elemSize() == mat.cols * mat.rows * 3UL / 2UL);
-            std::vector<uint8_t> dataVec;
             unsigned int ySize = mat.cols * mat.rows;
             assert(ySize % 4 == 0);
             unsigned int uvSize = ySize / 4;
             assert(ySize + 2 * uvSize == output.total());
-            dataVec.insert(dataVec.end(), output.ptr(), output.ptr() + ySize);
+            uint8_t* dst = prepareData(data, ySize + uvSize * 2);
+            std::memcpy(dst, output.ptr(), ySize);
             cv::Mat uVals(mat.rows / 2, mat.cols / 2, CV_8UC1, output.ptr() + ySize);
             cv::Mat vVals(mat.rows / 2, mat.cols / 2, CV_8UC1, output.ptr() + ySize + uvSize);
-            cv::Mat uvVals;
+            cv::Mat uvVals(mat.rows / 2, mat.cols / 2, CV_8UC2, dst + ySize);
             cv::merge(std::vector<cv::Mat>{uVals, vVals}, uvVals);
-            assert(uvVals.total() * uvVals.elemSize() == uvSize * 2);
-            assert(uvVals.isContinuous());
-            dataVec.insert(dataVec.end(), uvVals.ptr(), uvVals.ptr() + uvSize * 2);
-            setData(dataVec);
             break;
         }
         // case Type::RAW14:
@@ -226,6 +226,27 @@ void VideoPlayer::restart() {
     cvReader->set(cv::CAP_PROP_POS_FRAMES, 0);
 }
 
+void VideoPlayer::seekToFrame(uint64_t index) {
+    if(!initialized) {
+        throw std::runtime_error("VideoPlayer not initialized");
+    }
+    cvReader->set(cv::CAP_PROP_POS_FRAMES, static_cast<double>(index));
+}
+
+void VideoPlayer::seekToTime(std::chrono::nanoseconds time) {
+    if(!initialized) {
+        throw std::runtime_error("VideoPlayer not initialized");
+    }
+    cvReader->set(cv::CAP_PROP_POS_MSEC, std::chrono::duration<double, std::milli>(time).count());
+}
+
+uint64_t VideoPlayer::position() {
+    if(!initialized) {
+        throw std::runtime_error("VideoPlayer not initialized");
+    }
+    return static_cast<uint64_t>(cvReader->get(cv::CAP_PROP_POS_FRAMES));
+}
+
 void VideoPlayer::close() {
     if(cvReader && cvReader->isOpened()) {
         cvReader->release();
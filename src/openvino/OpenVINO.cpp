@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "BlobReader.hpp"
+#include "depthai/utility/MappedFileMemory.hpp"
+#include "depthai/utility/VectorMemory.hpp"
 #include "spdlog/spdlog.h"
 #include "utility/Logging.hpp"
 #include "utility/spdlog-fmt.hpp"
@@ -88,13 +90,13 @@ static uint64_t readInt64(const uint8_t* data) {
 }
 
 OpenVINO::SuperBlob::SuperBlob(const std::filesystem::path& pathToSuperBlobFile) {
-    data = readSuperBlobFile(pathToSuperBlobFile);
+    data = mapSuperBlobFile(pathToSuperBlobFile);
     loadAndCheckHeader();
     validateSuperblob();
 }
 
 OpenVINO::SuperBlob::SuperBlob(std::vector<uint8_t> data) {
-    this->data = std::move(data);
+    this->data = std::make_shared<VectorMemory>(std::move(data));
     loadAndCheckHeader();
     validateSuperblob();
 }
@@ -136,19 +138,15 @@ dai::OpenVINO::Blob OpenVINO::SuperBlob::getBlobWithNumShaves(int numShaves) {
     return patchedBlob;
 }
 
-std::vector<uint8_t> OpenVINO::SuperBlob::readSuperBlobFile(const std::filesystem::path& path) {
+std::shared_ptr<Memory> OpenVINO::SuperBlob::mapSuperBlobFile(const std::filesystem::path& path) {
     // Make sure file exists before opening it
     if(!std::filesystem::exists(path)) throw std::runtime_error("File does not exist: " + path.string());
 
-    // Open file and read bytes
-    std::ifstream file(path, std::ios::binary);
-    if(!file.is_open()) {
-        throw std::runtime_error("Cannot open file: " + path.string());
-    }
-    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    // Pages are read on access, the patches for other numbers of shaves are never loaded
+    return std::make_shared<MappedFileMemory>(path);
 }
 
-OpenVINO::SuperBlob::SuperBlobHeader OpenVINO::SuperBlob::SuperBlobHeader::fromData(const std::vector<uint8_t>& data) {
+OpenVINO::SuperBlob::SuperBlobHeader OpenVINO::SuperBlob::SuperBlobHeader::fromData(span<const uint8_t> data) {
     SuperBlobHeader header;
     const uint8_t* ptr = data.data();
     header.blobSize = readInt64(ptr);
@@ -164,7 +162,7 @@ OpenVINO::SuperBlob::SuperBlobHeader OpenVINO::SuperBlob::SuperBlobHeader::fromD
 
 const uint8_t* OpenVINO::SuperBlob::getBlobDataPointer() {
     const uint64_t offset = SuperBlobHeader::HEADER_SIZE;
-    return data.data() + offset;
+    return data->getData().data() + offset;
 }
 
 int64_t OpenVINO::SuperBlob::getBlobDataSize() {
@@ -174,7 +172,7 @@ int64_t OpenVINO::SuperBlob::getBlobDataSize() {
 const uint8_t* OpenVINO::SuperBlob::getPatchDataPointer(int numShaves) {
     const uint64_t offset =
         SuperBlobHeader::HEADER_SIZE + header.blobSize + std::accumulate(header.patchSizes.begin(), header.patchSizes.begin() + numShaves - 1, 0);
-    return data.data() + offset;
+    return data->getData().data() + offset;
 }
 
 int64_t OpenVINO::SuperBlob::getPatchDataSize(int numShaves) {
@@ -182,19 +180,19 @@ int64_t OpenVINO::SuperBlob::getPatchDataSize(int numShaves) {
 }
 
 void OpenVINO::SuperBlob::loadAndCheckHeader() {
-    if(data.size() < SuperBlobHeader::HEADER_SIZE) {
-        throw std::invalid_argument("Invalid superblob data: not enough bytes for the header: " + std::to_string(data.size()) + " Data should be at least "
-                                    + std::to_string(SuperBlobHeader::HEADER_SIZE) + " bytes long.");
+    if(data->getSize() < SuperBlobHeader::HEADER_SIZE) {
+        throw std::invalid_argument("Invalid superblob data: not enough bytes for the header: " + std::to_string(data->getSize())
+                                    + " Data should be at least " + std::to_string(SuperBlobHeader::HEADER_SIZE) + " bytes long.");
     }
-    header = SuperBlobHeader::fromData(data);
+    header = SuperBlobHeader::fromData(data->getData());
 }
 
 void OpenVINO::SuperBlob::validateSuperblob() {
     // Check that superblob is of the expected size
     size_t expectedSize = SuperBlobHeader::HEADER_SIZE + header.blobSize + std::accumulate(header.patchSizes.begin(), header.patchSizes.end(), 0);
-    if(expectedSize != data.size()) {
+    if(expectedSize != data->getSize()) {
         throw std::invalid_argument("Invalid superblob data: size mismatch. Expected " + std::to_string(expectedSize) + " bytes, got "
-                                    + std::to_string(data.size()) + " bytes.");
+                                    + std::to_string(data->getSize()) + " bytes.");
     }
 
     // Validate that there are the 'BSDIFF' bytes for each patch
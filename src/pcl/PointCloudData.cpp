@@ -8,6 +8,19 @@ pcl::PointCloud<pcl::PointXYZ>::Ptr dai::PointCloudData::getPclData() const {
     cloud->width = getWidth();
     cloud->height = getHeight();
     cloud->is_dense = isSparse();
+    if(isPlanar()) {
+        auto size = data.size() / (isColor() ? sizeof(Point3fRGBA) : sizeof(Point3f));
+        auto* planes = (const float*)data.data();
+
+        cloud->points.resize(size);
+
+        for(size_t i = 0; i < size; i++) {
+            cloud->points[i].x = planes[i];
+            cloud->points[i].y = planes[size + i];
+            cloud->points[i].z = planes[2 * size + i];
+        }
+        return cloud;
+    }
     if(isColor()) {
         auto* dataPtr = (Point3fRGBA*)data.data();
         auto size = data.size() / sizeof(Point3fRGBA);
@@ -46,6 +59,25 @@ pcl::PointCloud<pcl::PointXYZRGB>::Ptr dai::PointCloudData::getPclDataRGB() cons
     cloud->height = getHeight();
     cloud->is_dense = isSparse();
 
+    if(isPlanar()) {
+        auto size = data.size() / sizeof(Point3fRGBA);
+        auto* planes = (const float*)data.data();
+        auto* colors = data.data() + 3 * size * sizeof(float);
+
+        cloud->points.resize(size);
+
+        for(size_t i = 0; i < size; i++) {
+            auto& point = cloud->points[i];
+            point.x = planes[i];
+            point.y = planes[size + i];
+            point.z = planes[2 * size + i];
+            point.r = colors[4 * i + 0];
+            point.g = colors[4 * i + 1];
+            point.b = colors[4 * i + 2];
+        }
+        return cloud;
+    }
+
     auto* dataPtr = (Point3fRGBA*)data.data();
     auto size = data.size() / sizeof(Point3fRGBA);
 
@@ -80,6 +112,7 @@ void dai::PointCloudData::setPclData(const pcl::PointCloud<pcl::PointXYZ>::Ptr&
         size_t i = &point - &cloud->points[0];
         dataPtr[i] = Point3f{point.x, point.y, point.z};
     });
+    planar = false;
     setData(data);
 }
 
@@ -100,6 +133,7 @@ void dai::PointCloudData::setPclData(const pcl::PointCloud<pcl::PointXYZRGB>::Pt
         size_t i = &point - &cloud->points[0];
         dataPtr[i] = Point3f{point.x, point.y, point.z};
     });
+    planar = false;
     setData(data);
 }
 
@@ -121,5 +155,6 @@ void dai::PointCloudData::setPclDataRGB(const pcl::PointCloud<pcl::PointXYZRGB>:
         dataPtr[i] = Point3fRGBA{point.x, point.y, point.z, point.r, point.g, point.b};
     });
     color = true;
+    planar = false;
     setData(data);
 }
@@ -6,6 +6,7 @@
 
 // project
 #include "depthai/pipeline/datatype/ADatatype.hpp"
+#include "pipeline/QueueInstrumentation.hpp"
 #include "pipeline/datatype/StreamMessageParser.hpp"
 
 // libraries
@@ -22,12 +23,12 @@ MessageQueue::MessageQueue(std::string name, unsigned int maxSize, bool blocking
 MessageQueue::MessageQueue(unsigned int maxSize, bool blocking) : queue(maxSize, blocking) {}
 
 bool MessageQueue::isClosed() const {
-    return queue.isDestroyed();
+    return visitQueue([](const auto& q) { return q.isDestroyed(); });
 }
 
 void MessageQueue::close() {
     // Destroy queue
-    queue.destruct();
+    visitQueue([](auto& q) { q.destruct(); });
 
     // Log if name not empty
     if(!name.empty()) spdlog::debug("MessageQueue ({}) closed", name);
@@ -47,27 +48,115 @@ std::string MessageQueue::getName() const {
 }
 
 void MessageQueue::setBlocking(bool blocking) {
-    queue.setBlocking(blocking);
+    visitQueue([blocking](auto& q) { q.setBlocking(blocking); });
 }
 
 bool MessageQueue::getBlocking() const {
-    return queue.getBlocking();
+    return visitQueue([](const auto& q) { return q.getBlocking(); });
 }
 
 void MessageQueue::setMaxSize(unsigned int maxSize) {
-    queue.setMaxSize(maxSize);
+    if(lockFreeQueue && maxSize > LockFreeQueue<std::shared_ptr<ADatatype>>::MAX_CAPACITY) {
+        // Too large for the ring buffer, fall back to the locking queue
+        setQueueType(QueueType::LOCKING);
+    }
+    visitQueue([maxSize](auto& q) { q.setMaxSize(maxSize); });
 }
 
 unsigned int MessageQueue::getMaxSize() const {
-    return queue.getMaxSize();
+    return visitQueue([](const auto& q) { return q.getMaxSize(); });
 }
 
 unsigned int MessageQueue::getSize() const {
-    return queue.getSize();
+    return visitQueue([](const auto& q) { return q.getSize(); });
 }
 
 unsigned int MessageQueue::isFull() const {
-    return queue.isFull();
+    return visitQueue([](const auto& q) { return q.isFull(); });
+}
+
+void MessageQueue::setQueueType(QueueType type) {
+    if(type == getQueueType()) return;
+
+    const auto maxSize = getMaxSize();
+    const auto blocking = getBlocking();
+    const auto closed = isClosed();
+    if(type == QueueType::LOCK_FREE && maxSize > LockFreeQueue<std::shared_ptr<ADatatype>>::MAX_CAPACITY) {
+        if(!name.empty()) spdlog::debug("MessageQueue ({}) maxSize {} too large for lock-free queue, keeping locking queue", name, maxSize);
+        return;
+    }
+
+    // Carry over pending messages, without blocking on them
+    std::vector<std::shared_ptr<ADatatype>> pending;
+    visitQueue([&pending](auto& q) { return q.consumeAll([&pending](std::shared_ptr<ADatatype>& msg) { pending.push_back(std::move(msg)); }); });
+
+    if(type == QueueType::LOCK_FREE) {
+        lockFreeQueue = std::make_unique<LockFreeQueue<std::shared_ptr<ADatatype>>>(maxSize, false);
+    } else {
+        lockFreeQueue.reset();
+        queue = LockingQueue<std::shared_ptr<ADatatype>>(maxSize, false);
+    }
+    visitQueue([&](auto& q) {
+        for(auto& msg : pending) q.push(std::move(msg));
+        q.setBlocking(blocking);
+        if(closed) q.destruct();
+    });
+    // Drop counter of the new queue starts from zero
+    if(instrumentation) setInstrumentation(true);
+}
+
+MessageQueue::QueueType MessageQueue::getQueueType() const {
+    return lockFreeQueue ? QueueType::LOCK_FREE : QueueType::LOCKING;
+}
+
+void MessageQueue::setPushListener(std::function<void()> listener) {
+    pushListener = std::move(listener);
+}
+
+void MessageQueue::setInstrumentation(bool enable) {
+    if(enable) {
+        instrumentation = std::make_shared<QueueInstrumentation>(visitQueue([](const auto& q) { return q.getNumDropped(); }));
+    } else {
+        instrumentation.reset();
+    }
+}
+
+bool MessageQueue::getInstrumentation() const {
+    return instrumentation != nullptr;
+}
+
+QueueStats MessageQueue::getStats() const {
+    QueueStats stats;
+    if(instrumentation) stats = instrumentation->getStats();
+    stats.name = name;
+    return stats;
+}
+
+std::vector<TraceEvent> MessageQueue::getTraceEvents() const {
+    if(!instrumentation) return {};
+    return instrumentation->getTraceEvents();
+}
+
+template <typename F>
+bool MessageQueue::instrumentedSend(const std::shared_ptr<ADatatype>& msg, F&& push) {
+    using Clock = QueueInstrumentation::Clock;
+    auto& stats = *instrumentation;
+    const auto start = Clock::now();
+    const auto id = stats.onSendStart(msg.get(), start);
+    if(callCallbacks(msg)) stats.onCallbacks(id, start, Clock::now());
+    const auto pushStart = Clock::now();
+    const bool pushed = push();
+    stats.onSendEnd(id, pushStart, pushed, getSize(), visitQueue([](const auto& q) { return q.getNumDropped(); }));
+    return pushed;
+}
+
+void MessageQueue::onDequeue(const ADatatype* msg) {
+    instrumentation->onDequeue(msg, getSize());
+}
+
+void MessageQueue::onDequeue(const std::vector<const ADatatype*>& msgs) {
+    const auto depth = getSize();
+    for(const auto* msg : msgs) instrumentation->onDequeue(msg, depth);
 }
 
 int MessageQueue::addCallback(std::function<void(std::string, std::shared_ptr<ADatatype>)> callback) {
@@ -108,32 +197,48 @@ bool MessageQueue::removeCallback(int callbackId) {
 
 void MessageQueue::send(const std::shared_ptr<ADatatype>& msg) {
     if(!msg) throw std::invalid_argument("Message passed is not valid (nullptr)");
-    if(queue.isDestroyed()) {
+    if(isClosed()) {
         throw QueueException(CLOSED_QUEUE_MESSAGE);
     }
+    if(instrumentation) {
+        if(!instrumentedSend(msg, [&]() { return visitQueue([&msg](auto& q) { return q.push(msg); }); })) throw QueueException(CLOSED_QUEUE_MESSAGE);
+        if(pushListener) pushListener();
+        return;
+    }
     callCallbacks(msg);
-    auto queueNotClosed = queue.push(msg);
+    auto queueNotClosed = visitQueue([&msg](auto& q) { return q.push(msg); });
     if(!queueNotClosed) throw QueueException(CLOSED_QUEUE_MESSAGE);
+    if(pushListener) pushListener();
 }
 
 bool MessageQueue::send(const std::shared_ptr<ADatatype>& msg, std::chrono::milliseconds timeout) {
     if(!msg) throw std::invalid_argument("Message passed is not valid (nullptr)");
+    if(instrumentation) {
+        if(isClosed()) {
+            throw QueueException(CLOSED_QUEUE_MESSAGE);
+        }
+        const bool pushed = instrumentedSend(msg, [&]() { return visitQueue([&msg, timeout](auto& q) { return q.tryWaitAndPush(msg, timeout); }); });
+        if(pushed && pushListener) pushListener();
+        return pushed;
+    }
     callCallbacks(msg);
-    if(queue.isDestroyed()) {
+    if(isClosed()) {
         throw QueueException(CLOSED_QUEUE_MESSAGE);
     }
-    return queue.tryWaitAndPush(msg, timeout);
+    const bool pushed = visitQueue([&msg, timeout](auto& q) { return q.tryWaitAndPush(msg, timeout); });
+    if(pushed && pushListener) pushListener();
+    return pushed;
 }
 
 bool MessageQueue::trySend(const std::shared_ptr<ADatatype>& msg) {
     if(!msg) throw std::invalid_argument("Message passed is not valid (nullptr)");
-    if(queue.isDestroyed()) {
+    if(isClosed()) {
         throw QueueException(CLOSED_QUEUE_MESSAGE);
     }
     return send(msg, std::chrono::milliseconds(0));
 }
 
-void MessageQueue::callCallbacks(std::shared_ptr<ADatatype> message) {
+bool MessageQueue::callCallbacks(std::shared_ptr<ADatatype> message) {
     // Lock first
     std::lock_guard<std::mutex> lock(callbacksMtx);
 
@@ -141,6 +246,7 @@ void MessageQueue::callCallbacks(std::shared_ptr<ADatatype> message) {
     for(auto& keyValue : callbacks) {
         keyValue.second(name, message);
     }
+    return !callbacks.empty();
 }
 
 }  // namespace dai
@@ -163,6 +163,9 @@ void Node::Output::link(Input& in) {
     // Add the shared_ptr to the input directly for host side
     connectedInputs.push_back(&in);
     in.connectedOutputs.push_back(this);
+
+    // Single producer links go through the lock-free queue, otherwise fall back to the locking one
+    in.setQueueType(in.connectedOutputs.size() == 1 ? MessageQueue::QueueType::LOCK_FREE : MessageQueue::QueueType::LOCKING);
 }
 
 std::shared_ptr<dai::MessageQueue> Node::Output::createOutputQueue(unsigned int maxSize, bool blocking) {
@@ -172,6 +175,8 @@ std::shared_ptr<dai::MessageQueue> Node::Output::createOutputQueue(unsigned int
         throw std::runtime_error("Cannot create queue after pipeline is built");
     }
     auto queue = std::make_shared<MessageQueue>(maxSize, blocking);
+    // This output is the only producer of the newly created queue
+    queue->setQueueType(MessageQueue::QueueType::LOCK_FREE);
     link(queue);
 
     // No need to expose this on the public pipeline interface
@@ -222,6 +227,11 @@ void Node::Output::unlink(Input& in) {
     // Remove the shared_ptr to the input directly for host side
     connectedInputs.erase(std::remove(connectedInputs.begin(), connectedInputs.end(), &in), connectedInputs.end());
     in.connectedOutputs.erase(std::remove(in.connectedOutputs.begin(), in.connectedOutputs.end(), this), in.connectedOutputs.end());
+
+    // Back to a single producer, lock-free queue can be used again
+    if(in.connectedOutputs.size() == 1) {
+        in.setQueueType(MessageQueue::QueueType::LOCK_FREE);
+    }
 }
 
 void Node::Output::send(const std::shared_ptr<ADatatype>& msg) {
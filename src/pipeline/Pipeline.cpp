@@ -10,6 +10,7 @@
 #include "depthai/pipeline/node/internal/XLinkOutHost.hpp"
 #include "depthai/utility/Initialization.hpp"
 #include "pipeline/datatype/ImgFrame.hpp"
+#include "pipeline/QueueInstrumentation.hpp"
 #include "pipeline/node/DetectionNetwork.hpp"
 #include "utility/Compression.hpp"
 #include "utility/Environment.hpp"
@@ -18,17 +19,20 @@
 #include "utility/Logging.hpp"
 #include "utility/Platform.hpp"
 #include "utility/RecordReplayImpl.hpp"
+#include "utility/WorkStealingExecutor.hpp"
 #include "utility/spdlog-fmt.hpp"
 
 // shared
 #include "depthai/pipeline/NodeConnectionSchema.hpp"
 
 // std
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <unordered_set>
 
 // libraries
@@ -477,6 +481,68 @@ bool PipelineImpl::isDeviceOnly() const {
     return deviceOnly;
 }
 
+std::vector<std::pair<std::string, MessageQueue*>> PipelineImpl::getHostQueues() const {
+    std::vector<std::pair<std::string, MessageQueue*>> queues;
+    for(const auto& node : getAllNodes()) {
+        const auto prefix = fmt::format("{}({})", node->getName(), node->id);
+        // Inputs of device nodes are never used on host
+        if(node->runOnHost()) {
+            for(auto* input : node->getInputRefs()) {
+                queues.emplace_back(fmt::format("{}.{}", prefix, input->getName()), input);
+            }
+        }
+        // Queues created with createOutputQueue
+        for(auto* output : node->getOutputRefs()) {
+            for(const auto& connection : output->getQueueConnections()) {
+                queues.emplace_back(fmt::format("{}.{}.queue", prefix, output->getName()), connection.queue.get());
+            }
+        }
+    }
+    return queues;
+}
+
+void PipelineImpl::enableQueueStats(bool enable) {
+    std::lock_guard<std::mutex> lock(stateMtx);
+    if(running) {
+        throw std::runtime_error("Cannot change queue statistics while pipeline is running");
+    }
+    queueStatsEnabled = enable;
+    // Drop the instrumentation of a previous run, so a restarted pipeline runs without it
+    if(!enable) {
+        for(const auto& queue : getHostQueues()) {
+            queue.second->setInstrumentation(false);
+        }
+    }
+}
+
+std::vector<QueueStats> PipelineImpl::getQueueStats() const {
+    std::vector<QueueStats> stats;
+    for(const auto& queue : getHostQueues()) {
+        if(!queue.second->getInstrumentation()) continue;
+        stats.push_back(queue.second->getStats());
+        stats.back().name = queue.first;
+    }
+    return stats;
+}
+
+nlohmann::json PipelineImpl::getQueueTrace() const {
+    std::vector<std::pair<std::string, std::vector<TraceEvent>>> events;
+    for(const auto& queue : getHostQueues()) {
+        if(!queue.second->getInstrumentation()) continue;
+        events.emplace_back(queue.first, queue.second->getTraceEvents());
+    }
+    return QueueInstrumentation::toChromeTrace(events);
+}
+
+std::shared_ptr<utility::WorkStealingExecutor> PipelineImpl::getHostExecutor() {
+    std::lock_guard<std::mutex> lock(hostExecutorMtx);
+    if(!hostExecutor) {
+        const size_t numThreads = hostExecutorThreads ? hostExecutorThreads : std::max(std::thread::hardware_concurrency(), 1u);
+        hostExecutor = std::make_shared<utility::WorkStealingExecutor>(numThreads);
+    }
+    return hostExecutor;
+}
+
 void PipelineImpl::add(std::shared_ptr<Node> node) {
     if(node == nullptr) {
         throw std::invalid_argument(fmt::format("Given node pointer is null"));
@@ -795,6 +861,13 @@ void PipelineImpl::start() {
     // Implicitly build (if not already)
     build();
 
+    // Queues are all created by now, instrument them before any node starts producing
+    if(queueStatsEnabled) {
+        for(const auto& queue : getHostQueues()) {
+            queue.second->setInstrumentation(true);
+        }
+    }
+
     // Indicate that pipeline is running
     running = true;
 
@@ -1007,6 +1080,21 @@ std::vector<uint8_t> PipelineImpl::loadResourceCwd(fs::path uri, fs::path cwd, b
     throw std::invalid_argument(fmt::format("No handler specified for following ({}) URI", uri));
 }
 
+void Pipeline::setHostExecutorThreads(size_t numThreads) {
+    if(this->isRunning()) {
+        throw std::runtime_error("Cannot change host executor threads while pipeline is running");
+    }
+    impl()->hostExecutorThreads = numThreads;
+}
+
+void Pipeline::exportQueueTrace(const fs::path& path) const {
+    std::ofstream file(path);
+    if(!file) {
+        throw std::runtime_error(fmt::format("Cannot open queue trace file '{}'", path.string()));
+    }
+    file << impl()->getQueueTrace().dump();
+}
+
 // Record and Replay
 void Pipeline::enableHolisticRecord(const RecordConfig& config) {
     if(this->isRunning()) {
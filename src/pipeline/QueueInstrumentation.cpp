@@ -0,0 +1,190 @@
+#include "QueueInstrumentation.hpp"
+
+// std
+#include <algorithm>
+#include <map>
+
+namespace dai {
+
+namespace {
+
+// Upper bound on tracked in-flight messages, for queues which are fed but never read
+constexpr std::size_t MAX_PENDING = 1u << 16;
+
+Timestamp toTimestamp(QueueInstrumentation::Clock::time_point time) {
+    using namespace std::chrono;
+    const auto ns = duration_cast<nanoseconds>(time.time_since_epoch()).count();
+    return Timestamp{ns / 1000000000, ns % 1000000000};
+}
+
+double toMicroseconds(const Timestamp& ts) {
+    return static_cast<double>(ts.sec) * 1e6 + static_cast<double>(ts.nsec) / 1e3;
+}
+
+std::size_t depthBucket(unsigned depth) {
+    std::size_t bucket = 0;
+    while(depth) {
+        depth >>= 1;
+        bucket++;
+    }
+    return std::min(bucket, QueueStats::DEPTH_HISTOGRAM_SIZE - 1);
+}
+
+}  // namespace
+
+QueueInstrumentation::QueueInstrumentation(std::uint64_t droppedBaseline) : droppedSeen(droppedBaseline) {
+    trace.reserve(MAX_TRACE_EVENTS);
+}
+
+void QueueInstrumentation::addEvent(TraceEvent::Event event, TraceEvent::Status status, std::uint32_t srcId, std::uint32_t dstId, Clock::time_point time) {
+    TraceEvent traceEvent{event, status, srcId, dstId, toTimestamp(time)};
+    if(trace.size() < MAX_TRACE_EVENTS) {
+        trace.push_back(traceEvent);
+    } else {
+        trace[traceHead] = traceEvent;
+        traceHead = (traceHead + 1) % MAX_TRACE_EVENTS;
+    }
+}
+
+std::uint32_t QueueInstrumentation::onSendStart(const ADatatype* msg, Clock::time_point start) {
+    std::lock_guard<std::mutex> lock(mtx);
+    const auto id = nextId++;
+    // Recorded before the push, so a consumer can't take the message out before it's known
+    if(pending.size() >= MAX_PENDING) pending.pop_front();
+    pending.push_back({msg, id, start});
+    addEvent(TraceEvent::SEND, TraceEvent::Status::START, id, 0, start);
+    return id;
+}
+
+void QueueInstrumentation::onSendEnd(std::uint32_t id, Clock::time_point start, bool pushed, unsigned depth, std::uint64_t droppedTotal) {
+    const auto end = Clock::now();
+    const auto blocked = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+    std::lock_guard<std::mutex> lock(mtx);
+    stats.blockedTime += blocked;
+    stats.maxBlockedTime = std::max(stats.maxBlockedTime, blocked);
+    if(pushed) {
+        stats.enqueued++;
+        stats.depthHistogram[depthBucket(depth)]++;
+    } else {
+        stats.failed++;
+        auto it = std::find_if(pending.begin(), pending.end(), [id](const Pending& p) { return p.id == id; });
+        if(it != pending.end()) pending.erase(it);
+    }
+    if(droppedTotal > droppedSeen) {
+        const auto dropped = droppedTotal - droppedSeen;
+        droppedSeen = droppedTotal;
+        stats.dropped += dropped;
+        // Drops take the oldest messages
+        for(std::uint64_t i = 0; i < dropped && !pending.empty(); i++) {
+            addEvent(TraceEvent::DROP, TraceEvent::Status::END, pending.front().id, depth, end);
+            pending.pop_front();
+        }
+    }
+    addEvent(TraceEvent::SEND, pushed ? TraceEvent::Status::END : TraceEvent::Status::TIMEOUT, id, depth, end);
+}
+
+void QueueInstrumentation::onDequeue(const ADatatype* msg, unsigned depth) {
+    const auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(mtx);
+    stats.dequeued++;
+    auto it = std::find_if(pending.begin(), pending.end(), [msg](const Pending& p) { return p.msg == msg; });
+    if(it == pending.end()) return;  // Sent before instrumentation was enabled
+    const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(now - it->sent);
+    stats.latency += latency;
+    stats.maxLatency = std::max(stats.maxLatency, latency);
+    addEvent(TraceEvent::RECEIVE, TraceEvent::Status::END, it->id, depth, now);
+    // The queue is FIFO, so anything older is gone as well
+    pending.erase(pending.begin(), it + 1);
+}
+
+void QueueInstrumentation::onCallbacks(std::uint32_t id, Clock::time_point start, Clock::time_point end) {
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+    std::lock_guard<std::mutex> lock(mtx);
+    stats.callbackCalls++;
+    stats.callbackTime += duration;
+    stats.maxCallbackTime = std::max(stats.maxCallbackTime, duration);
+    addEvent(TraceEvent::CALLBACK, TraceEvent::Status::START, id, 0, start);
+    addEvent(TraceEvent::CALLBACK, TraceEvent::Status::END, id, 0, end);
+}
+
+QueueStats QueueInstrumentation::getStats() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return stats;
+}
+
+std::vector<TraceEvent> QueueInstrumentation::getTraceEvents() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<TraceEvent> events;
+    events.reserve(trace.size());
+    events.insert(events.end(), trace.begin() + traceHead, trace.end());
+    events.insert(events.end(), trace.begin(), trace.begin() + traceHead);
+    return events;
+}
+
+nlohmann::json QueueInstrumentation::toChromeTrace(const std::vector<std::pair<std::string, std::vector<TraceEvent>>>& queues) {
+    auto events = nlohmann::json::array();
+    for(std::size_t tid = 0; tid < queues.size(); tid++) {
+        const auto& [name, trace] = queues[tid];
+        events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 0}, {"tid", tid}, {"args", {{"name", name}}}});
+
+        // Start of each send, to pair with its end and the dequeue of the message
+        std::map<std::uint32_t, double> sendStart;
+        std::map<std::uint32_t, double> callbackStart;
+        for(const auto& event : trace) {
+            const double ts = toMicroseconds(event.timestamp);
+            const auto asyncId = std::to_string(tid) + ":" + std::to_string(event.srcId);
+            switch(event.event) {
+                case TraceEvent::SEND:
+                    if(event.status == TraceEvent::Status::START) {
+                        sendStart[event.srcId] = ts;
+                        events.push_back({{"name", "message"}, {"cat", "queue"}, {"ph", "b"}, {"id", asyncId}, {"ts", ts}, {"pid", 0}, {"tid", tid}});
+                        break;
+                    }
+                    if(sendStart.count(event.srcId)) {
+                        const double start = sendStart[event.srcId];
+                        events.push_back({{"name", event.status == TraceEvent::Status::TIMEOUT ? "send (failed)" : "send"},
+                                          {"cat", "queue"},
+                                          {"ph", "X"},
+                                          {"ts", start},
+                                          {"dur", ts - start},
+                                          {"pid", 0},
+                                          {"tid", tid},
+                                          {"args", {{"id", event.srcId}}}});
+                        sendStart.erase(event.srcId);
+                    }
+                    events.push_back({{"name", name + " depth"}, {"ph", "C"}, {"ts", ts}, {"pid", 0}, {"args", {{"depth", event.dstId}}}});
+                    if(event.status == TraceEvent::Status::TIMEOUT) {
+                        events.push_back({{"name", "message"}, {"cat", "queue"}, {"ph", "e"}, {"id", asyncId}, {"ts", ts}, {"pid", 0}, {"tid", tid}});
+                    }
+                    break;
+                case TraceEvent::RECEIVE:
+                    events.push_back({{"name", "message"}, {"cat", "queue"}, {"ph", "e"}, {"id", asyncId}, {"ts", ts}, {"pid", 0}, {"tid", tid}});
+                    events.push_back({{"name", name + " depth"}, {"ph", "C"}, {"ts", ts}, {"pid", 0}, {"args", {{"depth", event.dstId}}}});
+                    break;
+                case TraceEvent::CALLBACK:
+                    if(event.status == TraceEvent::Status::START) {
+                        callbackStart[event.srcId] = ts;
+                    } else if(callbackStart.count(event.srcId)) {
+                        const double start = callbackStart[event.srcId];
+                        events.push_back({{"name", "callbacks"},
+                                          {"cat", "queue"},
+                                          {"ph", "X"},
+                                          {"ts", start},
+                                          {"dur", ts - start},
+                                          {"pid", 0},
+                                          {"tid", tid},
+                                          {"args", {{"id", event.srcId}}}});
+                        callbackStart.erase(event.srcId);
+                    }
+                    break;
+                case TraceEvent::DROP:
+                    events.push_back({{"name", "drop"}, {"cat", "queue"}, {"ph", "i"}, {"s", "t"}, {"ts", ts}, {"pid", 0}, {"tid", tid}, {"args", {{"id", event.srcId}}}});
+                    events.push_back({{"name", "message"}, {"cat", "queue"}, {"ph", "e"}, {"id", asyncId}, {"ts", ts}, {"pid", 0}, {"tid", tid}});
+                    break;
+            }
+        }
+    }
+    return {{"traceEvents", events}, {"displayTimeUnit", "ms"}};
+}
+
+}  // namespace dai
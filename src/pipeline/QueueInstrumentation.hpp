@@ -0,0 +1,92 @@
+#pragma once
+
+// std
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// project
+#include "depthai/pipeline/QueueStats.hpp"
+#include "depthai/pipeline/TraceEvent.hpp"
+
+// libraries
+#include <nlohmann/json.hpp>
+
+namespace dai {
+
+class ADatatype;
+
+/**
+ * Statistics and trace events of a single MessageQueue.
+ * Only allocated while instrumentation is enabled, so a disabled queue pays a null pointer check per operation
+ */
+class QueueInstrumentation {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Number of most recent trace events kept per queue
+    static constexpr std::size_t MAX_TRACE_EVENTS = 1u << 14;
+
+    /**
+     * @param droppedBaseline Drop counter of the queue at the time instrumentation got enabled
+     */
+    explicit QueueInstrumentation(std::uint64_t droppedBaseline);
+
+    /**
+     * Called before the message is pushed, returns the id of the message within the queue
+     */
+    std::uint32_t onSendStart(const ADatatype* msg, Clock::time_point start);
+
+    /**
+     * Called after the push returned
+     * @param depth Queue depth after the push
+     * @param droppedTotal Drop counter of the queue after the push
+     */
+    void onSendEnd(std::uint32_t id, Clock::time_point start, bool pushed, unsigned depth, std::uint64_t droppedTotal);
+
+    /**
+     * Called after a message was taken out of the queue
+     */
+    void onDequeue(const ADatatype* msg, unsigned depth);
+
+    void onCallbacks(std::uint32_t id, Clock::time_point start, Clock::time_point end);
+
+    QueueStats getStats() const;
+
+    /**
+     * Most recent trace events, oldest first
+     */
+    std::vector<TraceEvent> getTraceEvents() const;
+
+    /**
+     * Convert trace events of named queues to Chrome trace event format (chrome://tracing, Perfetto).
+     * Each queue is shown as its own track with send, callback and drop events,
+     * messages as async spans from send until dequeue and the depth as a counter
+     */
+    static nlohmann::json toChromeTrace(const std::vector<std::pair<std::string, std::vector<TraceEvent>>>& queues);
+
+   private:
+    struct Pending {
+        const ADatatype* msg;
+        std::uint32_t id;
+        Clock::time_point sent;
+    };
+
+    void addEvent(TraceEvent::Event event, TraceEvent::Status status, std::uint32_t srcId, std::uint32_t dstId, Clock::time_point time);
+
+    mutable std::mutex mtx;
+    QueueStats stats;
+    // Messages in the queue, in enqueue order, to match dequeues with their send
+    std::deque<Pending> pending;
+    std::uint32_t nextId = 0;
+    std::uint64_t droppedSeen = 0;
+    // Ring buffer of trace events
+    std::vector<TraceEvent> trace;
+    std::size_t traceHead = 0;
+};
+
+}  // namespace dai
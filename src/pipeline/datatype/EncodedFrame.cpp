@@ -147,7 +147,15 @@ ProtoSerializable::SchemaPair EncodedFrame::serializeSchema() const {
 }
 
 std::vector<std::uint8_t> EncodedFrame::serializeProto(bool metadataOnly) const {
-    return utility::serializeProto(utility::getProtoMessage(this, metadataOnly));
+    if(metadataOnly) {
+        return utility::serializeProto(utility::getProtoMessage(this, true));
+    }
+    return utility::serializeProto(serializeProtoParts());
+}
+
+ProtoSerializable::SerializedProto EncodedFrame::serializeProtoParts() const {
+    return utility::serializeProtoParts(
+        utility::getProtoMessage(this, true), proto::encoded_frame::EncodedFrame::kDataFieldNumber, data->getData());
 }
 #endif
 
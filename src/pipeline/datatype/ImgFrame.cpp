@@ -315,7 +315,14 @@ ProtoSerializable::SchemaPair ImgFrame::serializeSchema() const {
 }
 
 std::vector<std::uint8_t> ImgFrame::serializeProto(bool metadataOnly) const {
-    return utility::serializeProto(utility::getProtoMessage(this, metadataOnly));
+    if(metadataOnly) {
+        return utility::serializeProto(utility::getProtoMessage(this, true));
+    }
+    return utility::serializeProto(serializeProtoParts());
+}
+
+ProtoSerializable::SerializedProto ImgFrame::serializeProtoParts() const {
+    return utility::serializeProtoParts(utility::getProtoMessage(this, true), proto::img_frame::ImgFrame::kDataFieldNumber, data->getData());
 }
 #endif
 }  // namespace dai
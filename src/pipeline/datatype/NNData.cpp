@@ -8,8 +8,147 @@
 #include "depthai/pipeline/datatype/ADatatype.hpp"
 #include "depthai/utility/VectorMemory.hpp"
 #include "fp16/fp16.h"
+#include "utility/CpuFeatures.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define DEPTHAI_NNDATA_X86
+    #include <immintrin.h>
+#elif defined(__aarch64__)
+    // float16 vector conversions are only guaranteed on AArch64
+    #define DEPTHAI_NNDATA_NEON
+    #include <arm_neon.h>
+#endif
+
+// Allows compiling functions for an instruction set not enabled for the whole translation unit
+#if defined(DEPTHAI_NNDATA_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define DEPTHAI_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define DEPTHAI_TARGET(isa)
+#endif
 
 namespace dai {
+
+namespace {
+
+using Fp16ToFp32Fn = void (*)(const uint16_t*, float*, size_t);
+template <typename T>
+using DequantizeFn = void (*)(const T*, float*, size_t, float, float);
+
+void fp16ToFp32Scalar(const uint16_t* src, float* dst, size_t count) {
+    for(size_t i = 0; i < count; i++) dst[i] = fp16_ieee_to_fp32_value(src[i]);
+}
+
+// Same operation order as (value - zeroPoint) * scale on a float tensor, so all paths give identical results
+template <typename T>
+void dequantizeScalar(const T* src, float* dst, size_t count, float scale, float zeroPoint) {
+    for(size_t i = 0; i < count; i++) dst[i] = (static_cast<float>(src[i]) - zeroPoint) * scale;
+}
+
+#if defined(DEPTHAI_NNDATA_X86)
+
+DEPTHAI_TARGET("avx,f16c")
+void fp16ToFp32F16c(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+    }
+    fp16ToFp32Scalar(src + i, dst + i, count - i);
+}
+
+DEPTHAI_TARGET("avx2")
+void dequantizeU8Avx2(const uint8_t* src, float* dst, size_t count, float scale, float zeroPoint) {
+    const __m256 vScale = _mm256_set1_ps(scale);
+    const __m256 vZeroPoint = _mm256_set1_ps(zeroPoint);
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(v), vZeroPoint), vScale));
+    }
+    dequantizeScalar(src + i, dst + i, count - i, scale, zeroPoint);
+}
+
+DEPTHAI_TARGET("avx2")
+void dequantizeI8Avx2(const int8_t* src, float* dst, size_t count, float scale, float zeroPoint) {
+    const __m256 vScale = _mm256_set1_ps(scale);
+    const __m256 vZeroPoint = _mm256_set1_ps(zeroPoint);
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256i v = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(v), vZeroPoint), vScale));
+    }
+    dequantizeScalar(src + i, dst + i, count - i, scale, zeroPoint);
+}
+
+#elif defined(DEPTHAI_NNDATA_NEON)
+
+void fp16ToFp32Neon(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const float16x8_t v = vreinterpretq_f16_u16(vld1q_u16(src + i));
+        vst1q_f32(dst + i, vcvt_f32_f16(vget_low_f16(v)));
+        vst1q_f32(dst + i + 4, vcvt_f32_f16(vget_high_f16(v)));
+    }
+    fp16ToFp32Scalar(src + i, dst + i, count - i);
+}
+
+inline void dequantizeStoreNeon(int16x8_t v, float* dst, float32x4_t scale, float32x4_t zeroPoint) {
+    const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v)));
+    const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v)));
+    vst1q_f32(dst, vmulq_f32(vsubq_f32(lo, zeroPoint), scale));
+    vst1q_f32(dst + 4, vmulq_f32(vsubq_f32(hi, zeroPoint), scale));
+}
+
+void dequantizeU8Neon(const uint8_t* src, float* dst, size_t count, float scale, float zeroPoint) {
+    const float32x4_t vScale = vdupq_n_f32(scale);
+    const float32x4_t vZeroPoint = vdupq_n_f32(zeroPoint);
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        dequantizeStoreNeon(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src + i))), dst + i, vScale, vZeroPoint);
+    }
+    dequantizeScalar(src + i, dst + i, count - i, scale, zeroPoint);
+}
+
+void dequantizeI8Neon(const int8_t* src, float* dst, size_t count, float scale, float zeroPoint) {
+    const float32x4_t vScale = vdupq_n_f32(scale);
+    const float32x4_t vZeroPoint = vdupq_n_f32(zeroPoint);
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        dequantizeStoreNeon(vmovl_s8(vld1_s8(src + i)), dst + i, vScale, vZeroPoint);
+    }
+    dequantizeScalar(src + i, dst + i, count - i, scale, zeroPoint);
+}
+
+#endif
+
+Fp16ToFp32Fn getFp16ToFp32Fn() {
+#if defined(DEPTHAI_NNDATA_X86)
+    if(utility::getCpuFeatures().f16c) return fp16ToFp32F16c;
+#elif defined(DEPTHAI_NNDATA_NEON)
+    if(utility::getCpuFeatures().neon) return fp16ToFp32Neon;
+#endif
+    return fp16ToFp32Scalar;
+}
+
+DequantizeFn<uint8_t> getDequantizeU8Fn() {
+#if defined(DEPTHAI_NNDATA_X86)
+    if(utility::getCpuFeatures().avx2) return dequantizeU8Avx2;
+#elif defined(DEPTHAI_NNDATA_NEON)
+    if(utility::getCpuFeatures().neon) return dequantizeU8Neon;
+#endif
+    return dequantizeScalar<uint8_t>;
+}
+
+DequantizeFn<int8_t> getDequantizeI8Fn() {
+#if defined(DEPTHAI_NNDATA_X86)
+    if(utility::getCpuFeatures().avx2) return dequantizeI8Avx2;
+#elif defined(DEPTHAI_NNDATA_NEON)
+    if(utility::getCpuFeatures().neon) return dequantizeI8Neon;
+#endif
+    return dequantizeScalar<int8_t>;
+}
+
+}  // namespace
+
 NNData::NNData(size_t size) : NNData() {
     auto mem = std::make_shared<VectorMemory>();
     mem->resize(size);
@@ -118,6 +257,21 @@ float NNData::fp16_to_fp32(uint16_t value) {
     return fp16_ieee_to_fp32_value(value);
 };
 
+void NNData::fp16_to_fp32(const uint16_t* src, float* dst, size_t count) {
+    static const auto convert = getFp16ToFp32Fn();
+    convert(src, dst, count);
+}
+
+void NNData::dequantize(const uint8_t* src, float* dst, size_t count, float scale, float zeroPoint) {
+    static const auto convert = getDequantizeU8Fn();
+    convert(src, dst, count, scale, zeroPoint);
+}
+
+void NNData::dequantize(const int8_t* src, float* dst, size_t count, float scale, float zeroPoint) {
+    static const auto convert = getDequantizeI8Fn();
+    convert(src, dst, count, scale, zeroPoint);
+}
+
 // // setters
 // // uint8_t
 // NNData& NNData::setLayer(const std::string& name, std::vector<std::uint8_t> data) {
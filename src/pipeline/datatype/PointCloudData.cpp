@@ -1,5 +1,7 @@
 #include "depthai/pipeline/datatype/PointCloudData.hpp"
 
+#include <cstring>
+
 #include "depthai/common/Point3f.hpp"
 #ifdef DEPTHAI_ENABLE_PROTOBUF
     #include "depthai/schemas/PointCloudData.pb.h"
@@ -8,6 +10,15 @@
 namespace dai {
 
 std::vector<Point3f> PointCloudData::getPoints() {
+    if(isPlanar()) {
+        const auto size = data->getData().size() / (isColor() ? sizeof(Point3fRGBA) : sizeof(Point3f));
+        const auto* planes = reinterpret_cast<const float*>(data->getData().data());
+        std::vector<Point3f> points(size);
+        for(size_t i = 0; i < size; i++) {
+            points[i] = {planes[i], planes[size + i], planes[2 * size + i]};
+        }
+        return points;
+    }
     if(isColor()) {
         span<const Point3fRGBA> pointData(reinterpret_cast<Point3fRGBA*>(data->getData().data()), data->getData().size() / sizeof(Point3fRGBA));
         std::vector<Point3fRGBA> points(pointData.begin(), pointData.end());
@@ -29,6 +40,17 @@ std::vector<Point3fRGBA> PointCloudData::getPointsRGB() {
     if(!isColor()) {
         throw std::runtime_error("PointCloudData does not contain color data");
     }
+    if(isPlanar()) {
+        const auto size = data->getData().size() / sizeof(Point3fRGBA);
+        const auto* planes = reinterpret_cast<const float*>(data->getData().data());
+        const auto* colors = data->getData().data() + 3 * size * sizeof(float);
+        std::vector<Point3fRGBA> points(size);
+        for(size_t i = 0; i < size; i++) {
+            const auto* c = colors + 4 * i;
+            points[i] = {planes[i], planes[size + i], planes[2 * size + i], c[0], c[1], c[2], c[3]};
+        }
+        return points;
+    }
     span<const Point3fRGBA> pointData(reinterpret_cast<Point3fRGBA*>(data->getData().data()), data->getData().size() / sizeof(Point3fRGBA));
     std::vector<Point3fRGBA> points(pointData.begin(), pointData.end());
     assert(isSparse() || points.size() == width * height);
@@ -43,6 +65,7 @@ void PointCloudData::setPoints(const std::vector<Point3f>& points) {
     std::memcpy(data.data(), points.data(), size * sizeof(Point3f));
     setData(std::move(data));
     setColor(false);
+    setPlanar(false);
 }
 
 void PointCloudData::setPointsRGB(const std::vector<Point3fRGBA>& points) {
@@ -51,6 +74,7 @@ void PointCloudData::setPointsRGB(const std::vector<Point3fRGBA>& points) {
     std::memcpy(data.data(), points.data(), size * sizeof(Point3fRGBA));
     setData(std::move(data));
     setColor(true);
+    setPlanar(false);
 }
 
 unsigned int PointCloudData::getInstanceNum() const {
@@ -88,6 +112,29 @@ bool PointCloudData::isColor() const {
     return color;
 }
 
+bool PointCloudData::isPlanar() const {
+    return planar;
+}
+
+std::shared_ptr<PointCloudData> PointCloudData::getInterleaved() const {
+    auto interleaved = std::make_shared<PointCloudData>(*this);
+    if(!isPlanar()) return interleaved;
+
+    // Colors are 4 bytes per point, the same as a coordinate
+    const auto planes = data->getData();
+    const size_t numPlanes = isColor() ? 4 : 3;
+    const size_t numPoints = planes.size() / (numPlanes * sizeof(float));
+    std::vector<uint8_t> points(numPoints * numPlanes * sizeof(float));
+    for(size_t i = 0; i < numPoints; i++) {
+        for(size_t k = 0; k < numPlanes; k++) {
+            std::memcpy(points.data() + (i * numPlanes + k) * sizeof(float), planes.data() + (k * numPoints + i) * sizeof(float), sizeof(float));
+        }
+    }
+    interleaved->setData(std::move(points));
+    interleaved->setPlanar(false);
+    return interleaved;
+}
+
 PointCloudData& PointCloudData::setInstanceNum(unsigned int instanceNum) {
     this->instanceNum = instanceNum;
     return *this;
@@ -144,9 +191,26 @@ PointCloudData& PointCloudData::setColor(bool val) {
     return *this;
 }
 
+PointCloudData& PointCloudData::setPlanar(bool val) {
+    planar = val;
+    return *this;
+}
+
 #ifdef DEPTHAI_ENABLE_PROTOBUF
 std::vector<std::uint8_t> PointCloudData::serializeProto(bool metadataOnly) const {
-    return utility::serializeProto(utility::getProtoMessage(this, metadataOnly));
+    if(metadataOnly || isPlanar()) {
+        return utility::serializeProto(utility::getProtoMessage(this, metadataOnly));
+    }
+    return utility::serializeProto(serializeProtoParts());
+}
+
+ProtoSerializable::SerializedProto PointCloudData::serializeProtoParts() const {
+    if(isPlanar()) {
+        // Points get interleaved while serializing, so there is no payload to point to
+        return {serializeProto(), {}};
+    }
+    return utility::serializeProtoParts(
+        utility::getProtoMessage(this, true), proto::point_cloud_data::PointCloudData::kDataFieldNumber, data->getData());
 }
 
 ProtoSerializable::SchemaPair PointCloudData::serializeSchema() const {
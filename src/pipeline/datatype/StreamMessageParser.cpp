@@ -1,6 +1,8 @@
 #include "depthai/pipeline/datatype/StreamMessageParser.hpp"
 
 // standard
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 
@@ -55,23 +57,63 @@
 namespace dai {
 
 static constexpr std::array<uint8_t, 16> endOfPacketMarker = {0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45, 0x67, 0x89, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0};
+static constexpr std::array<uint8_t, 16> framedGroupMarker = {0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45, 0x67, 0x89, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF1};
+
+// Framed group member table entry: type, metadata offset & size within the descriptor, payload offset & size
+static constexpr size_t framedMemberEntrySize = 5 * 4;
+// Member payloads are aligned, so tensors can be viewed in place
+static constexpr size_t framedPayloadAlignment = 16;
 
 // Reads int from little endian format
 inline int readIntLE(uint8_t* data) {
     return data[0] + data[1] * 256 + data[2] * 256 * 256 + data[3] * 256 * 256 * 256;
 }
 
+inline uint32_t readUintLE(const uint8_t* data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+inline void appendUintLE(std::vector<std::uint8_t>& out, uint32_t value) {
+    for(int i = 0; i < 4; i++) out.push_back((value >> (i * 8)) & 0xFF);
+}
+
+// Part of a packet, shared by all members of a framed group
+class PacketRegionMemory : public Memory {
+    std::shared_ptr<Memory> packet;
+    size_t offset;
+    size_t maxSize;
+    size_t size;
+
+   public:
+    PacketRegionMemory(std::shared_ptr<Memory> packet, size_t offset, size_t size)
+        : packet(std::move(packet)), offset(offset), maxSize(size), size(size) {}
+    span<std::uint8_t> getData() override {
+        return {packet->getData().data() + offset, size};
+    }
+    span<const std::uint8_t> getData() const override {
+        return {static_cast<const Memory&>(*packet).getData().data() + offset, size};
+    }
+    std::size_t getMaxSize() const override {
+        return maxSize;
+    }
+    std::size_t getOffset() const override {
+        return offset;
+    }
+    void setSize(size_t size) override {
+        if(size > maxSize) {
+            throw std::invalid_argument("Cannot set size larger than max size");
+        }
+        this->size = size;
+    }
+};
+
 template <class T>
-inline std::shared_ptr<T> parseDatatype(std::uint8_t* metadata, size_t size, std::vector<uint8_t>& data, long fd) {
+inline std::shared_ptr<T> parseDatatype(std::uint8_t* metadata, size_t size, std::shared_ptr<Memory> data) {
     auto tmp = std::make_shared<T>();
 
     // deserialize
     utility::deserialize(metadata, size, *tmp);
-    if(fd < 0) {
-        tmp->data = std::make_shared<dai::VectorMemory>(std::move(data));
-    } else {
-        tmp->data = std::make_shared<dai::SharedMemory>(fd);
-    }
+    tmp->data = std::move(data);
 
     return tmp;
 }
@@ -116,19 +158,10 @@ static std::tuple<DatatypeEnum, size_t, size_t> parseHeader(streamPacketDesc_t*
     return {objectType, serializedObjectSize, bufferLength};
 }
 
-std::shared_ptr<ADatatype> StreamMessageParser::parseMessage(streamPacketDesc_t* const packet) {
-    DatatypeEnum objectType;
-    size_t serializedObjectSize;
-    size_t bufferLength;
-    long fd;
-    std::tie(objectType, serializedObjectSize, bufferLength) = parseHeader(packet);
-    auto* const metadataStart = packet->data + bufferLength;
-
-    // copy data part
-    std::vector<uint8_t> data(packet->data, packet->data + bufferLength);
-
-    fd = packet->fd;
-
+static std::shared_ptr<ADatatype> parseMessageWithData(DatatypeEnum objectType,
+                                                       std::uint8_t* const metadataStart,
+                                                       size_t serializedObjectSize,
+                                                       const std::shared_ptr<Memory>& data) {
     // Create corresponding object
     switch(objectType) {
         // ADatatype is a special case, since no metadata is actually serialized
@@ -137,132 +170,224 @@ std::shared_ptr<ADatatype> StreamMessageParser::parseMessage(streamPacketDesc_t*
             return pBuf;
         }
         case DatatypeEnum::Buffer: {
-            return parseDatatype<Buffer>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<Buffer>(metadataStart, serializedObjectSize, data);
             break;
         }
 
         case DatatypeEnum::ImgFrame:
-            return parseDatatype<ImgFrame>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ImgFrame>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::EncodedFrame:
-            return parseDatatype<EncodedFrame>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<EncodedFrame>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::NNData:
-            return parseDatatype<NNData>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<NNData>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::ImageManipConfig:
-            return parseDatatype<ImageManipConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ImageManipConfig>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::ImageAlignConfig:
-            return parseDatatype<ImageAlignConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ImageAlignConfig>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::CameraControl:
-            return parseDatatype<CameraControl>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<CameraControl>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::ImgDetections:
-            return parseDatatype<ImgDetections>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ImgDetections>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::SpatialImgDetections:
-            return parseDatatype<SpatialImgDetections>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<SpatialImgDetections>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::SystemInformation:
-            return parseDatatype<SystemInformation>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<SystemInformation>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::SystemInformationS3:
-            return parseDatatype<SystemInformationS3>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<SystemInformationS3>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::SpatialLocationCalculatorData:
-            return parseDatatype<SpatialLocationCalculatorData>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<SpatialLocationCalculatorData>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::SpatialLocationCalculatorConfig:
-            return parseDatatype<SpatialLocationCalculatorConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<SpatialLocationCalculatorConfig>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::AprilTags:
-            return parseDatatype<AprilTags>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<AprilTags>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::AprilTagConfig:
-            return parseDatatype<AprilTagConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<AprilTagConfig>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::Tracklets:
-            return parseDatatype<Tracklets>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<Tracklets>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::IMUData:
-            return parseDatatype<IMUData>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<IMUData>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::StereoDepthConfig:
-            return parseDatatype<StereoDepthConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<StereoDepthConfig>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::EdgeDetectorConfig:
-            return parseDatatype<EdgeDetectorConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<EdgeDetectorConfig>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::TrackedFeatures:
-            return parseDatatype<TrackedFeatures>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<TrackedFeatures>(metadataStart, serializedObjectSize, data);
             break;
 
         case DatatypeEnum::FeatureTrackerConfig:
-            return parseDatatype<FeatureTrackerConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<FeatureTrackerConfig>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::BenchmarkReport:
-            return parseDatatype<BenchmarkReport>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<BenchmarkReport>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::ThermalConfig:
-            return parseDatatype<ThermalConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ThermalConfig>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::ToFConfig:
-            return parseDatatype<ToFConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ToFConfig>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::PointCloudConfig:
-            return parseDatatype<PointCloudConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<PointCloudConfig>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::PointCloudData:
-            return parseDatatype<PointCloudData>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<PointCloudData>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::MessageGroup:
-            return parseDatatype<MessageGroup>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<MessageGroup>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::TransformData:
-            return parseDatatype<TransformData>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<TransformData>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::ImgAnnotations:
-            return parseDatatype<ImgAnnotations>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ImgAnnotations>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::ImageFiltersConfig:
-            return parseDatatype<ImageFiltersConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ImageFiltersConfig>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::ToFDepthConfidenceFilterConfig:
-            return parseDatatype<ToFDepthConfidenceFilterConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ToFDepthConfidenceFilterConfig>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::RGBDData:
-            return parseDatatype<RGBDData>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<RGBDData>(metadataStart, serializedObjectSize, data);
             break;
         case DatatypeEnum::ObjectTrackerConfig: {
-            return parseDatatype<ObjectTrackerConfig>(metadataStart, serializedObjectSize, data, fd);
+            return parseDatatype<ObjectTrackerConfig>(metadataStart, serializedObjectSize, data);
         }
     }
 
     throw std::runtime_error("Bad packet, couldn't parse");
 }
 
+static bool isFramedGroup(streamPacketDesc_t* const packet) {
+    const auto* marker = packet->data + packet->length - framedGroupMarker.size();
+    return memcmp(marker, framedGroupMarker.data(), framedGroupMarker.size()) == 0;
+}
+
+// Parses the descriptor of a framed group, members reference parts of the shared payload
+static std::shared_ptr<ADatatype> parseFramedGroup(std::uint8_t* const descriptor, size_t descriptorSize, const std::shared_ptr<Memory>& payload) {
+    if(descriptorSize < 8) {
+        throw std::runtime_error(fmt::format("Bad framed group, couldn't parse (descriptor too small), descriptor size {}", descriptorSize));
+    }
+    const size_t groupMetadataSize = readUintLE(descriptor + descriptorSize - 8);
+    const size_t memberCount = readUintLE(descriptor + descriptorSize - 4);
+    const size_t tableSize = memberCount * framedMemberEntrySize;
+    if(tableSize > descriptorSize - 8 || groupMetadataSize > descriptorSize - 8 - tableSize) {
+        throw std::runtime_error(fmt::format("Bad framed group, couldn't parse (table out of bounds), descriptor size {}, members {}", descriptorSize, memberCount));
+    }
+    const size_t tableOffset = descriptorSize - 8 - tableSize;
+
+    auto group = parseDatatype<MessageGroup>(descriptor, groupMetadataSize, std::make_shared<VectorMemory>());
+    if(group->group.size() != memberCount) {
+        throw std::runtime_error(fmt::format("Bad framed group, couldn't parse (group has {} names, but {} members)", group->group.size(), memberCount));
+    }
+
+    // Members are framed in the iteration order of the group
+    const uint8_t* entry = descriptor + tableOffset;
+    for(auto& member : group->group) {
+        const auto type = static_cast<DatatypeEnum>(readUintLE(entry));
+        const size_t metadataOffset = readUintLE(entry + 4);
+        const size_t metadataSize = readUintLE(entry + 8);
+        const size_t payloadOffset = readUintLE(entry + 12);
+        const size_t payloadSize = readUintLE(entry + 16);
+        entry += framedMemberEntrySize;
+
+        if(metadataOffset > tableOffset || metadataSize > tableOffset - metadataOffset) {
+            throw std::runtime_error(fmt::format("Bad framed group, couldn't parse (metadata of '{}' out of bounds)", member.first));
+        }
+        if(payloadOffset > payload->getSize() || payloadSize > payload->getSize() - payloadOffset) {
+            throw std::runtime_error(fmt::format("Bad framed group, couldn't parse (payload of '{}' out of bounds)", member.first));
+        }
+        auto data = std::make_shared<PacketRegionMemory>(payload, payloadOffset, payloadSize);
+        member.second = parseMessageWithData(type, descriptor + metadataOffset, metadataSize, data);
+    }
+    return group;
+}
+
+std::shared_ptr<ADatatype> StreamMessageParser::parseMessage(streamPacketDesc_t* const packet) {
+    DatatypeEnum objectType;
+    size_t serializedObjectSize;
+    size_t bufferLength;
+    std::tie(objectType, serializedObjectSize, bufferLength) = parseHeader(packet);
+    auto* const metadataStart = packet->data + bufferLength;
+
+    if(packet->fd < 0 && objectType == DatatypeEnum::MessageGroup && isFramedGroup(packet)) {
+        // Copy the payloads once, members share the copy
+        auto payload = std::make_shared<VectorMemory>(std::vector<uint8_t>(packet->data, packet->data + bufferLength));
+        return parseFramedGroup(metadataStart, serializedObjectSize, payload);
+    }
+
+    // Packet is only borrowed - copy data part
+    std::shared_ptr<Memory> data;
+    if(packet->fd < 0) {
+        data = std::make_shared<VectorMemory>(std::vector<uint8_t>(packet->data, packet->data + bufferLength));
+    } else {
+        data = std::make_shared<SharedMemory>(packet->fd);
+    }
+
+    return parseMessageWithData(objectType, metadataStart, serializedObjectSize, data);
+}
+
 std::shared_ptr<ADatatype> StreamMessageParser::parseMessage(StreamPacketDesc packet) {
-    return parseMessage(&packet);
+    DatatypeEnum objectType;
+    size_t serializedObjectSize;
+    size_t bufferLength;
+    std::tie(objectType, serializedObjectSize, bufferLength) = parseHeader(&packet);
+    auto* const metadataStart = packet.data + bufferLength;
+
+    // Packet is owned - take over its buffer instead of copying the data part.
+    // The buffer is released back to XLink once the last reference to the message data drops.
+    std::shared_ptr<Memory> data;
+    if(packet.fd < 0) {
+        const bool framedGroup = objectType == DatatypeEnum::MessageGroup && isFramedGroup(&packet);
+        auto packetMemory = std::make_shared<StreamPacketMemory>(std::move(packet));
+        // Expose only the data part, metadata & trailer stay hidden past the end
+        packetMemory->setSize(bufferLength);
+        if(framedGroup) {
+            return parseFramedGroup(metadataStart, serializedObjectSize, packetMemory);
+        }
+        data = std::move(packetMemory);
+    } else {
+        data = std::make_shared<SharedMemory>(packet.fd);
+    }
+
+    // metadataStart remains valid, as moving the packet doesn't move its underlying buffer
+    return parseMessageWithData(objectType, metadataStart, serializedObjectSize, data);
 }
 
 std::vector<std::uint8_t> StreamMessageParser::serializeMetadata(const ADatatype& message) {
@@ -299,6 +424,84 @@ std::vector<std::uint8_t> StreamMessageParser::serializeMetadata(const std::shar
     return serializeMetadata(*data);
 }
 
+StreamMessageParser::FramedGroup StreamMessageParser::serializeFramedGroup(const MessageGroup& group) {
+    // Serialization:
+    // 1. largest member payload, referenced
+    // 2. remaining member payloads, each aligned
+    // 3. descriptor - group metadata, member metadata, member table, group metadata size (4B LE), member count (4B LE)
+    // 4. append datatype enum (4B LE)
+    // 5. append size (4B LE) of the descriptor
+    // 6. append 16-byte framed group marker
+
+    std::vector<const ADatatype*> members;
+    members.reserve(group.group.size());
+    for(const auto& member : group.group) {
+        if(!member.second) {
+            throw std::invalid_argument(fmt::format("Cannot frame MessageGroup, member '{}' is empty", member.first));
+        }
+        members.push_back(member.second.get());
+    }
+    const auto payloadOf = [](const ADatatype* member) { return member->data ? static_cast<const Memory&>(*member->data).getData() : span<const std::uint8_t>{}; };
+
+    FramedGroup framed;
+    std::vector<size_t> payloadOffsets(members.size(), 0);
+    size_t largest = members.size();
+    for(size_t i = 0; i < members.size(); i++) {
+        if(largest == members.size() || payloadOf(members[i]).size() > payloadOf(members[largest]).size()) largest = i;
+    }
+    if(largest != members.size()) framed.largestPayload = payloadOf(members[largest]);
+
+    // Lay out the remaining payloads after the largest one
+    size_t payloadSize = framed.largestPayload.size();
+    for(size_t i = 0; i < members.size(); i++) {
+        if(i == largest) continue;
+        payloadSize = (payloadSize + framedPayloadAlignment - 1) / framedPayloadAlignment * framedPayloadAlignment;
+        payloadOffsets[i] = payloadSize;
+        payloadSize += payloadOf(members[i]).size();
+    }
+    if(payloadSize > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("Cannot frame MessageGroup, members are too large");
+    }
+    framed.rest.resize(payloadSize - framed.largestPayload.size());
+    for(size_t i = 0; i < members.size(); i++) {
+        if(i == largest) continue;
+        const auto payload = payloadOf(members[i]);
+        if(!payload.empty()) std::memcpy(framed.rest.data() + payloadOffsets[i] - framed.largestPayload.size(), payload.data(), payload.size());
+    }
+
+    // Descriptor
+    const size_t descriptorStart = framed.rest.size();
+    DatatypeEnum datatype;
+    std::vector<std::uint8_t> metadata;
+    group.serialize(metadata, datatype);
+    const auto groupMetadataSize = static_cast<uint32_t>(metadata.size());
+    framed.rest.insert(framed.rest.end(), metadata.begin(), metadata.end());
+
+    std::vector<std::uint8_t> table;
+    table.reserve(members.size() * framedMemberEntrySize);
+    for(size_t i = 0; i < members.size(); i++) {
+        DatatypeEnum memberType;
+        members[i]->serialize(metadata, memberType);
+        appendUintLE(table, static_cast<uint32_t>(memberType));
+        appendUintLE(table, static_cast<uint32_t>(framed.rest.size() - descriptorStart));
+        appendUintLE(table, static_cast<uint32_t>(metadata.size()));
+        appendUintLE(table, static_cast<uint32_t>(payloadOffsets[i]));
+        appendUintLE(table, static_cast<uint32_t>(payloadOf(members[i]).size()));
+        framed.rest.insert(framed.rest.end(), metadata.begin(), metadata.end());
+    }
+    framed.rest.insert(framed.rest.end(), table.begin(), table.end());
+    appendUintLE(framed.rest, groupMetadataSize);
+    appendUintLE(framed.rest, static_cast<uint32_t>(members.size()));
+
+    // Trailer
+    const size_t descriptorSize = framed.rest.size() - descriptorStart;
+    appendUintLE(framed.rest, static_cast<uint32_t>(datatype));
+    appendUintLE(framed.rest, static_cast<uint32_t>(descriptorSize));
+    framed.rest.insert(framed.rest.end(), framedGroupMarker.begin(), framedGroupMarker.end());
+
+    return framed;
+}
+
 // std::vector<std::uint8_t> StreamMessageParser::serializeMessage(const ADatatype& message) {
 //     // Serialization:
 //     // 1. fill vector with bytes from data.data
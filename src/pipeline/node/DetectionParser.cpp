@@ -1,5 +1,6 @@
 #include "depthai/pipeline/node/DetectionParser.hpp"
 
+#include <chrono>
 #include <memory>
 
 #include "common/ModelType.hpp"
@@ -9,6 +10,7 @@
 #include "spdlog/fmt/fmt.h"
 
 // internal headers
+#include "utility/DetectionParserImpl.hpp"
 #include "utility/ErrorMacros.hpp"
 
 namespace dai {
@@ -175,6 +177,14 @@ DetectionNetworkType DetectionParser::getNNFamily() {
     return properties.parser.nnFamily;
 }
 
+void DetectionParser::setSubtype(const std::string& subtype) {
+    properties.parser.subtype = subtype;
+}
+
+std::string DetectionParser::getSubtype() const {
+    return properties.parser.subtype;
+}
+
 void DetectionParser::setConfidenceThreshold(float thresh) {
     properties.parser.confidenceThreshold = thresh;
 }
@@ -240,5 +250,42 @@ float DetectionParser::getIouThreshold() const {
     return properties.parser.iouThreshold;
 }
 
+void DetectionParser::setRunOnHost(bool runOnHost) {
+    runOnHostVar = runOnHost;
+}
+
+bool DetectionParser::runOnHost() const {
+    return runOnHostVar;
+}
+
+void DetectionParser::run() {
+    auto& logger = pimpl->logger;
+    impl::DetectionDecoder decoder(properties);
+
+    while(isRunning()) {
+        auto nnData = input.get<NNData>();
+        if(nnData == nullptr) continue;
+
+        auto detections = std::make_shared<ImgDetections>();
+        auto t1 = std::chrono::steady_clock::now();
+        try {
+            decoder.decode(*nnData, detections->detections);
+        } catch(const std::exception& e) {
+            logger->error("DetectionParser | {}, skipping message", e.what());
+            continue;
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        logger->trace("DetectionParser | Decoding {} detections took {}us",
+                      detections->detections.size(),
+                      std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+
+        detections->setTimestamp(nnData->getTimestamp());
+        detections->setTimestampDevice(nnData->getTimestampDevice());
+        detections->setSequenceNum(nnData->getSequenceNum());
+        detections->transformation = nnData->transformation;
+        out.send(detections);
+    }
+}
+
 }  // namespace node
 }  // namespace dai
@@ -1,15 +1,35 @@
 #include "depthai/pipeline/node/ImageFilters.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <opencv2/opencv.hpp>
+#include <type_traits>
 #include <utility/ErrorMacros.hpp>
+#include <vector>
 
 #include "depthai/depthai.hpp"
 #include "pipeline/ThreadedNodeImpl.hpp"
 #include "pipeline/datatype/ImageFiltersConfig.hpp"
+#include "utility/CpuFeatures.hpp"
+#include "utility/ThreadPool.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define DEPTHAI_IMAGE_FILTERS_X86
+    #include <immintrin.h>
+#endif
+
+// Allows compiling functions for an instruction set not enabled for the whole translation unit
+#if defined(DEPTHAI_IMAGE_FILTERS_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define DEPTHAI_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define DEPTHAI_TARGET(isa)
+#endif
 
 namespace dai {
 namespace node {
@@ -26,6 +46,505 @@ class Filter {
 
 namespace impl {
 
+/***********************************************************************************************************/
+/* Parallel and vectorized helpers                                                                         */
+/***********************************************************************************************************/
+
+// Smallest number of rows (or columns) handed to a worker, below that scheduling costs more than it saves
+constexpr int MIN_LINES_PER_TASK = 16;
+// Column strips start on a cache line boundary so workers never write to the same line
+constexpr int COLUMN_STRIP_ALIGNMENT = 64;
+
+// Splits [0, count) into contiguous ranges (starting at multiples of alignment) processed on the shared pool
+void parallelRanges(int count, int alignment, const std::function<void(int, int)>& fn) {
+    auto& pool = utility::ThreadPool::shared();
+    const int maxTasks = std::max(1, count / MIN_LINES_PER_TASK);
+    const int numTasks = std::min(static_cast<int>(pool.getNumThreads()) + 1, maxTasks);
+    if(numTasks <= 1) {
+        fn(0, count);
+        return;
+    }
+    const int step = ((count + numTasks - 1) / numTasks + alignment - 1) / alignment * alignment;
+    pool.parallelFor(numTasks, [&](size_t task) {
+        const int begin = static_cast<int>(task) * step;
+        const int end = std::min(count, begin + step);
+        if(begin < end) fn(begin, end);
+    });
+}
+
+// One step of the vertical spatial pass on a row segment of RAW16 depth:
+// if |dst - other| < deltaZ (and both are valid when requireValid): dst = dst * alpha + other * (1 - alpha), rounded
+using SpatialBlendRowFn = void (*)(uint16_t* dst, const uint16_t* other, int begin, int end, float alpha, uint16_t deltaZ, bool requireValid);
+// Horizontal spatial pass (left to right, then right to left) over `lanes` consecutive RAW16 rows at once.
+// The rows are transposed into scratch (width * lanes elements) so every step of the recursion handles one pixel of each row.
+// See recursiveFilterHorizontalRows() for the per pixel logic.
+struct SpatialHorizontalKernel {
+    void (*fn)(uint16_t* rows, int stride, int width, uint16_t* scratch, float alpha, uint16_t deltaZ, uint16_t holesFillingRadius) = nullptr;
+    int lanes = 0;
+};
+// Temporal pass over a span of RAW16 depth, see processImpl() for the per pixel logic
+using TemporalSpanFn = void (*)(uint16_t* frame,
+                                uint16_t* lastFrame,
+                                uint8_t* history,
+                                const uint8_t* persistenceMap,
+                                size_t begin,
+                                size_t end,
+                                float alpha,
+                                uint16_t deltaZ,
+                                uint8_t mask);
+
+// Scalar versions, also used for the tails of the vector versions. Operation order matches the original loops bit for bit.
+void spatialBlendRowScalar(uint16_t* dst, const uint16_t* other, int begin, int end, float alpha, uint16_t deltaZ, bool requireValid) {
+    for(int u = begin; u < end; u++) {
+        const uint16_t d = dst[u];
+        const uint16_t o = other[u];
+        if(requireValid && (d == 0 || o == 0)) continue;
+        const uint16_t diff = static_cast<uint16_t>(d > o ? d - o : o - d);
+        if(diff < deltaZ) {
+            const float filtered = d * alpha + o * (1.f - alpha);
+            dst[u] = static_cast<uint16_t>(filtered + 0.5f);
+        }
+    }
+}
+
+void temporalSpanScalar(uint16_t* frame,
+                        uint16_t* lastFrame,
+                        uint8_t* history,
+                        const uint8_t* persistenceMap,
+                        size_t begin,
+                        size_t end,
+                        float alpha,
+                        uint16_t deltaZ,
+                        uint8_t mask) {
+    const float oneMinusAlpha = 1 - alpha;
+    for(size_t i = begin; i < end; i++) {
+        const uint16_t currentVal = frame[i];
+        const uint16_t previousVal = lastFrame[i];
+        if(currentVal) {
+            if(!previousVal) {
+                lastFrame[i] = currentVal;
+                history[i] = mask;
+            } else {
+                const uint16_t diff = static_cast<uint16_t>(currentVal > previousVal ? currentVal - previousVal : previousVal - currentVal);
+                if(diff < deltaZ) {
+                    history[i] |= mask;
+                    const float filtered = alpha * currentVal + oneMinusAlpha * previousVal;
+                    const auto result = static_cast<uint16_t>(filtered);
+                    frame[i] = result;
+                    lastFrame[i] = result;
+                } else {
+                    lastFrame[i] = currentVal;
+                    history[i] = mask;
+                }
+            }
+        } else {
+            if(previousVal && (persistenceMap[history[i]] & mask)) {
+                frame[i] = previousVal;
+            }
+            history[i] &= ~mask;
+        }
+    }
+}
+
+#ifdef DEPTHAI_IMAGE_FILTERS_X86
+
+DEPTHAI_TARGET("sse4.1")
+inline __m128i lessThanU16(__m128i a, __m128i b) {
+    const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+    return _mm_cmplt_epi16(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+}
+
+// (a * wa + b * wb) + bias, truncated, for 8 unsigned 16 bit values
+DEPTHAI_TARGET("sse4.1")
+inline __m128i blendU16(__m128i a, __m128i b, __m128 wa, __m128 wb, __m128 bias) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 aLo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(a, zero));
+    const __m128 aHi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(a, zero));
+    const __m128 bLo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(b, zero));
+    const __m128 bHi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(b, zero));
+    const __m128 lo = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aLo, wa), _mm_mul_ps(bLo, wb)), bias);
+    const __m128 hi = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aHi, wa), _mm_mul_ps(bHi, wb)), bias);
+    return _mm_packus_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
+}
+
+DEPTHAI_TARGET("sse4.1")
+void spatialBlendRowSse41(uint16_t* dst, const uint16_t* other, int begin, int end, float alpha, uint16_t deltaZ, bool requireValid) {
+    const __m128 wa = _mm_set1_ps(alpha);
+    const __m128 wb = _mm_set1_ps(1.f - alpha);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128i delta = _mm_set1_epi16(static_cast<short>(deltaZ));
+    const __m128i zero = _mm_setzero_si128();
+    int u = begin;
+    for(; u + 8 <= end; u += 8) {
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + u));
+        const __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(other + u));
+        const __m128i diff = _mm_sub_epi16(_mm_max_epu16(d, o), _mm_min_epu16(d, o));
+        __m128i apply = lessThanU16(diff, delta);
+        if(requireValid) apply = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi16(d, zero), _mm_cmpeq_epi16(o, zero)), apply);
+        if(_mm_testz_si128(apply, apply)) continue;
+        const __m128i filtered = blendU16(d, o, wa, wb, half);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + u), _mm_blendv_epi8(d, filtered, apply));
+    }
+    spatialBlendRowScalar(dst, other, u, end, alpha, deltaZ, requireValid);
+}
+
+// Transposes 8 rows x 8 columns of 16 bit values, its own inverse
+DEPTHAI_TARGET("sse4.1")
+inline void transpose8x8(__m128i v[8]) {
+    const __m128i b0 = _mm_unpacklo_epi16(v[0], v[1]);
+    const __m128i b1 = _mm_unpackhi_epi16(v[0], v[1]);
+    const __m128i b2 = _mm_unpacklo_epi16(v[2], v[3]);
+    const __m128i b3 = _mm_unpackhi_epi16(v[2], v[3]);
+    const __m128i b4 = _mm_unpacklo_epi16(v[4], v[5]);
+    const __m128i b5 = _mm_unpackhi_epi16(v[4], v[5]);
+    const __m128i b6 = _mm_unpacklo_epi16(v[6], v[7]);
+    const __m128i b7 = _mm_unpackhi_epi16(v[6], v[7]);
+    const __m128i c0 = _mm_unpacklo_epi32(b0, b2);
+    const __m128i c1 = _mm_unpackhi_epi32(b0, b2);
+    const __m128i c2 = _mm_unpacklo_epi32(b1, b3);
+    const __m128i c3 = _mm_unpackhi_epi32(b1, b3);
+    const __m128i c4 = _mm_unpacklo_epi32(b4, b6);
+    const __m128i c5 = _mm_unpackhi_epi32(b4, b6);
+    const __m128i c6 = _mm_unpacklo_epi32(b5, b7);
+    const __m128i c7 = _mm_unpackhi_epi32(b5, b7);
+    v[0] = _mm_unpacklo_epi64(c0, c4);
+    v[1] = _mm_unpackhi_epi64(c0, c4);
+    v[2] = _mm_unpacklo_epi64(c1, c5);
+    v[3] = _mm_unpackhi_epi64(c1, c5);
+    v[4] = _mm_unpacklo_epi64(c2, c6);
+    v[5] = _mm_unpackhi_epi64(c2, c6);
+    v[6] = _mm_unpacklo_epi64(c3, c7);
+    v[7] = _mm_unpackhi_epi64(c3, c7);
+}
+
+// rows (lanes x width, row stride in elements) <-> columns (width x lanes)
+DEPTHAI_TARGET("sse4.1")
+void rowsToColumns(const uint16_t* rows, int stride, int width, int lanes, uint16_t* columns) {
+    for(int r = 0; r < lanes; r += 8) {
+        int p = 0;
+        for(; p + 8 <= width; p += 8) {
+            __m128i v[8];
+            for(int i = 0; i < 8; i++) v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + (r + i) * stride + p));
+            transpose8x8(v);
+            for(int i = 0; i < 8; i++) _mm_storeu_si128(reinterpret_cast<__m128i*>(columns + (p + i) * lanes + r), v[i]);
+        }
+        for(; p < width; p++) {
+            for(int i = 0; i < 8; i++) columns[p * lanes + r + i] = rows[(r + i) * stride + p];
+        }
+    }
+}
+
+DEPTHAI_TARGET("sse4.1")
+void columnsToRows(const uint16_t* columns, int width, int lanes, uint16_t* rows, int stride) {
+    for(int r = 0; r < lanes; r += 8) {
+        int p = 0;
+        for(; p + 8 <= width; p += 8) {
+            __m128i v[8];
+            for(int i = 0; i < 8; i++) v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns + (p + i) * lanes + r));
+            transpose8x8(v);
+            for(int i = 0; i < 8; i++) _mm_storeu_si128(reinterpret_cast<__m128i*>(rows + (r + i) * stride + p), v[i]);
+        }
+        for(; p < width; p++) {
+            for(int i = 0; i < 8; i++) rows[(r + i) * stride + p] = columns[p * lanes + r + i];
+        }
+    }
+}
+
+DEPTHAI_TARGET("sse4.1")
+void spatialHorizontalColumnsSse41(uint16_t* columns, int width, float alpha, uint16_t deltaZ, uint16_t holesFillingRadius) {
+    const __m128 wa = _mm_set1_ps(alpha);
+    const __m128 wb = _mm_set1_ps(1.0f - alpha);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i delta = _mm_set1_epi16(static_cast<short>(deltaZ));
+    const __m128i radius = _mm_set1_epi16(static_cast<short>(holesFillingRadius));
+    const __m128i fillHoles = holesFillingRadius ? _mm_set1_epi16(-1) : zero;
+
+    // left to right
+    __m128i val0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns));
+    __m128i fill = zero;
+    for(int p = 1; p < width - 1; p++) {
+        __m128i* col = reinterpret_cast<__m128i*>(columns + p * 8);
+        const __m128i val1 = _mm_loadu_si128(col);
+        const __m128i valid0 = _mm_xor_si128(_mm_cmpeq_epi16(val0, zero), _mm_set1_epi16(-1));
+        const __m128i invalid1 = _mm_cmpeq_epi16(val1, zero);
+        const __m128i bothValid = _mm_andnot_si128(invalid1, valid0);
+        const __m128i hole = _mm_and_si128(valid0, invalid1);
+        const __m128i diff = _mm_sub_epi16(_mm_max_epu16(val1, val0), _mm_min_epu16(val1, val0));
+        const __m128i inRange = _mm_andnot_si128(_mm_cmpeq_epi16(diff, zero), _mm_cmpeq_epi16(_mm_min_epu16(diff, delta), diff));
+        const __m128i filter = _mm_and_si128(bothValid, inRange);
+        fill = _mm_andnot_si128(bothValid, _mm_add_epi16(fill, _mm_and_si128(hole, one)));
+        const __m128i fillHere = _mm_and_si128(_mm_and_si128(hole, fillHoles), lessThanU16(fill, radius));
+        __m128i out = _mm_blendv_epi8(val1, val0, fillHere);
+        if(!_mm_testz_si128(filter, filter)) out = _mm_blendv_epi8(out, blendU16(val1, val0, wa, wb, half), filter);
+        _mm_storeu_si128(col, out);
+        val0 = out;
+    }
+
+    // right to left
+    __m128i val1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns + (width - 1) * 8));
+    fill = zero;
+    for(int p = width - 2; p >= 0; p--) {
+        __m128i* col = reinterpret_cast<__m128i*>(columns + p * 8);
+        const __m128i v0 = _mm_loadu_si128(col);
+        const __m128i valid1 = _mm_xor_si128(_mm_cmpeq_epi16(val1, zero), _mm_set1_epi16(-1));
+        // val0 has to be strictly above the valid threshold here
+        const __m128i above0 = lessThanU16(one, v0);
+        const __m128i bothValid = _mm_and_si128(valid1, above0);
+        const __m128i hole = _mm_andnot_si128(above0, valid1);
+        const __m128i diff = _mm_sub_epi16(_mm_max_epu16(val1, v0), _mm_min_epu16(val1, v0));
+        const __m128i filter = _mm_and_si128(bothValid, _mm_cmpeq_epi16(_mm_min_epu16(diff, delta), diff));
+        fill = _mm_andnot_si128(bothValid, _mm_add_epi16(fill, _mm_and_si128(hole, one)));
+        const __m128i fillHere = _mm_and_si128(_mm_and_si128(hole, fillHoles), lessThanU16(fill, radius));
+        __m128i out = _mm_blendv_epi8(v0, val1, fillHere);
+        if(!_mm_testz_si128(filter, filter)) out = _mm_blendv_epi8(out, blendU16(v0, val1, wa, wb, half), filter);
+        _mm_storeu_si128(col, out);
+        val1 = out;
+    }
+}
+
+DEPTHAI_TARGET("sse4.1")
+void spatialHorizontalSse41(uint16_t* rows, int stride, int width, uint16_t* scratch, float alpha, uint16_t deltaZ, uint16_t holesFillingRadius) {
+    rowsToColumns(rows, stride, width, 8, scratch);
+    spatialHorizontalColumnsSse41(scratch, width, alpha, deltaZ, holesFillingRadius);
+    columnsToRows(scratch, width, 8, rows, stride);
+}
+
+DEPTHAI_TARGET("sse4.1")
+void temporalSpanSse41(uint16_t* frame,
+                       uint16_t* lastFrame,
+                       uint8_t* history,
+                       const uint8_t* persistenceMap,
+                       size_t begin,
+                       size_t end,
+                       float alpha,
+                       uint16_t deltaZ,
+                       uint8_t mask) {
+    const __m128 wa = _mm_set1_ps(alpha);
+    const __m128 wb = _mm_set1_ps(1 - alpha);
+    const __m128 noBias = _mm_setzero_ps();
+    const __m128i delta = _mm_set1_epi16(static_cast<short>(deltaZ));
+    const __m128i maskV = _mm_set1_epi16(mask);
+    const __m128i notMaskV = _mm_set1_epi16(static_cast<uint8_t>(~mask));
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = begin;
+    for(; i + 8 <= end; i += 8) {
+        const __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(frame + i));
+        const __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lastFrame + i));
+        const __m128i hist = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(history + i)));
+        const __m128i curZero = _mm_cmpeq_epi16(cur, zero);
+        const __m128i prevZero = _mm_cmpeq_epi16(prev, zero);
+        const __m128i diff = _mm_sub_epi16(_mm_max_epu16(cur, prev), _mm_min_epu16(cur, prev));
+        const __m128i agree = _mm_andnot_si128(_mm_or_si128(curZero, prevZero), lessThanU16(diff, delta));
+        const __m128i filtered = blendU16(cur, prev, wa, wb, noBias);
+
+        // Holes that may be filled from the accumulator, persistence lookup only when there are any
+        const __m128i holes = _mm_andnot_si128(prevZero, curZero);
+        __m128i fill = zero;
+        if(!_mm_testz_si128(holes, holes)) {
+            alignas(16) uint16_t hit[8];
+            for(int k = 0; k < 8; k++) hit[k] = (persistenceMap[history[i + k]] & mask) ? 0xFFFF : 0;
+            fill = _mm_and_si128(holes, _mm_load_si128(reinterpret_cast<const __m128i*>(hit)));
+        }
+
+        const __m128i newFrame = _mm_blendv_epi8(_mm_blendv_epi8(cur, prev, fill), filtered, agree);
+        const __m128i newLast = _mm_blendv_epi8(_mm_blendv_epi8(cur, filtered, agree), prev, curZero);
+        const __m128i histValid = _mm_blendv_epi8(maskV, _mm_or_si128(hist, maskV), agree);
+        const __m128i newHist = _mm_blendv_epi8(histValid, _mm_and_si128(hist, notMaskV), curZero);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(frame + i), newFrame);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lastFrame + i), newLast);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(history + i), _mm_packus_epi16(newHist, newHist));
+    }
+    temporalSpanScalar(frame, lastFrame, history, persistenceMap, i, end, alpha, deltaZ, mask);
+}
+
+DEPTHAI_TARGET("avx2")
+inline __m256i lessThanU16Avx2(__m256i a, __m256i b) {
+    const __m256i bias = _mm256_set1_epi16(static_cast<short>(0x8000));
+    return _mm256_cmpgt_epi16(_mm256_xor_si256(b, bias), _mm256_xor_si256(a, bias));
+}
+
+// (a * wa + b * wb) + bias, truncated, for 16 unsigned 16 bit values
+DEPTHAI_TARGET("avx2")
+inline __m256i blendU16Avx2(__m256i a, __m256i b, __m256 wa, __m256 wb, __m256 bias) {
+    const __m256 aLo = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(a)));
+    const __m256 aHi = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(a, 1)));
+    const __m256 bLo = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(b)));
+    const __m256 bHi = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(b, 1)));
+    const __m256 lo = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(aLo, wa), _mm256_mul_ps(bLo, wb)), bias);
+    const __m256 hi = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(aHi, wa), _mm256_mul_ps(bHi, wb)), bias);
+    // Packing works per 128 bit lane, restore the element order afterwards
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_cvttps_epi32(lo), _mm256_cvttps_epi32(hi)), 0xD8);
+}
+
+DEPTHAI_TARGET("avx2")
+void spatialBlendRowAvx2(uint16_t* dst, const uint16_t* other, int begin, int end, float alpha, uint16_t deltaZ, bool requireValid) {
+    const __m256 wa = _mm256_set1_ps(alpha);
+    const __m256 wb = _mm256_set1_ps(1.f - alpha);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256i delta = _mm256_set1_epi16(static_cast<short>(deltaZ));
+    const __m256i zero = _mm256_setzero_si256();
+    int u = begin;
+    for(; u + 16 <= end; u += 16) {
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + u));
+        const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(other + u));
+        const __m256i diff = _mm256_sub_epi16(_mm256_max_epu16(d, o), _mm256_min_epu16(d, o));
+        __m256i apply = lessThanU16Avx2(diff, delta);
+        if(requireValid) apply = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi16(d, zero), _mm256_cmpeq_epi16(o, zero)), apply);
+        if(_mm256_testz_si256(apply, apply)) continue;
+        const __m256i filtered = blendU16Avx2(d, o, wa, wb, half);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + u), _mm256_blendv_epi8(d, filtered, apply));
+    }
+    spatialBlendRowScalar(dst, other, u, end, alpha, deltaZ, requireValid);
+}
+
+DEPTHAI_TARGET("avx2")
+void spatialHorizontalColumnsAvx2(uint16_t* columns, int width, float alpha, uint16_t deltaZ, uint16_t holesFillingRadius) {
+    const __m256 wa = _mm256_set1_ps(alpha);
+    const __m256 wb = _mm256_set1_ps(1.0f - alpha);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i delta = _mm256_set1_epi16(static_cast<short>(deltaZ));
+    const __m256i radius = _mm256_set1_epi16(static_cast<short>(holesFillingRadius));
+    const __m256i fillHoles = holesFillingRadius ? _mm256_set1_epi16(-1) : zero;
+
+    // left to right
+    __m256i val0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns));
+    __m256i fill = zero;
+    for(int p = 1; p < width - 1; p++) {
+        __m256i* col = reinterpret_cast<__m256i*>(columns + p * 16);
+        const __m256i val1 = _mm256_loadu_si256(col);
+        const __m256i valid0 = _mm256_xor_si256(_mm256_cmpeq_epi16(val0, zero), _mm256_set1_epi16(-1));
+        const __m256i invalid1 = _mm256_cmpeq_epi16(val1, zero);
+        const __m256i bothValid = _mm256_andnot_si256(invalid1, valid0);
+        const __m256i hole = _mm256_and_si256(valid0, invalid1);
+        const __m256i diff = _mm256_sub_epi16(_mm256_max_epu16(val1, val0), _mm256_min_epu16(val1, val0));
+        const __m256i inRange = _mm256_andnot_si256(_mm256_cmpeq_epi16(diff, zero), _mm256_cmpeq_epi16(_mm256_min_epu16(diff, delta), diff));
+        const __m256i filter = _mm256_and_si256(bothValid, inRange);
+        fill = _mm256_andnot_si256(bothValid, _mm256_add_epi16(fill, _mm256_and_si256(hole, one)));
+        const __m256i fillHere = _mm256_and_si256(_mm256_and_si256(hole, fillHoles), lessThanU16Avx2(fill, radius));
+        __m256i out = _mm256_blendv_epi8(val1, val0, fillHere);
+        if(!_mm256_testz_si256(filter, filter)) out = _mm256_blendv_epi8(out, blendU16Avx2(val1, val0, wa, wb, half), filter);
+        _mm256_storeu_si256(col, out);
+        val0 = out;
+    }
+
+    // right to left
+    __m256i val1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns + (width - 1) * 16));
+    fill = zero;
+    for(int p = width - 2; p >= 0; p--) {
+        __m256i* col = reinterpret_cast<__m256i*>(columns + p * 16);
+        const __m256i v0 = _mm256_loadu_si256(col);
+        const __m256i valid1 = _mm256_xor_si256(_mm256_cmpeq_epi16(val1, zero), _mm256_set1_epi16(-1));
+        const __m256i above0 = lessThanU16Avx2(one, v0);
+        const __m256i bothValid = _mm256_and_si256(valid1, above0);
+        const __m256i hole = _mm256_andnot_si256(above0, valid1);
+        const __m256i diff = _mm256_sub_epi16(_mm256_max_epu16(val1, v0), _mm256_min_epu16(val1, v0));
+        const __m256i filter = _mm256_and_si256(bothValid, _mm256_cmpeq_epi16(_mm256_min_epu16(diff, delta), diff));
+        fill = _mm256_andnot_si256(bothValid, _mm256_add_epi16(fill, _mm256_and_si256(hole, one)));
+        const __m256i fillHere = _mm256_and_si256(_mm256_and_si256(hole, fillHoles), lessThanU16Avx2(fill, radius));
+        __m256i out = _mm256_blendv_epi8(v0, val1, fillHere);
+        if(!_mm256_testz_si256(filter, filter)) out = _mm256_blendv_epi8(out, blendU16Avx2(v0, val1, wa, wb, half), filter);
+        _mm256_storeu_si256(col, out);
+        val1 = out;
+    }
+}
+
+DEPTHAI_TARGET("avx2")
+void spatialHorizontalAvx2(uint16_t* rows, int stride, int width, uint16_t* scratch, float alpha, uint16_t deltaZ, uint16_t holesFillingRadius) {
+    rowsToColumns(rows, stride, width, 16, scratch);
+    spatialHorizontalColumnsAvx2(scratch, width, alpha, deltaZ, holesFillingRadius);
+    columnsToRows(scratch, width, 16, rows, stride);
+}
+
+DEPTHAI_TARGET("avx2")
+void temporalSpanAvx2(uint16_t* frame,
+                      uint16_t* lastFrame,
+                      uint8_t* history,
+                      const uint8_t* persistenceMap,
+                      size_t begin,
+                      size_t end,
+                      float alpha,
+                      uint16_t deltaZ,
+                      uint8_t mask) {
+    const __m256 wa = _mm256_set1_ps(alpha);
+    const __m256 wb = _mm256_set1_ps(1 - alpha);
+    const __m256 noBias = _mm256_setzero_ps();
+    const __m256i delta = _mm256_set1_epi16(static_cast<short>(deltaZ));
+    const __m256i maskV = _mm256_set1_epi16(mask);
+    const __m256i notMaskV = _mm256_set1_epi16(static_cast<uint8_t>(~mask));
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = begin;
+    for(; i + 16 <= end; i += 16) {
+        const __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(frame + i));
+        const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lastFrame + i));
+        const __m256i hist = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(history + i)));
+        const __m256i curZero = _mm256_cmpeq_epi16(cur, zero);
+        const __m256i prevZero = _mm256_cmpeq_epi16(prev, zero);
+        const __m256i diff = _mm256_sub_epi16(_mm256_max_epu16(cur, prev), _mm256_min_epu16(cur, prev));
+        const __m256i agree = _mm256_andnot_si256(_mm256_or_si256(curZero, prevZero), lessThanU16Avx2(diff, delta));
+        const __m256i filtered = blendU16Avx2(cur, prev, wa, wb, noBias);
+
+        // Holes that may be filled from the accumulator, persistence lookup only when there are any
+        const __m256i holes = _mm256_andnot_si256(prevZero, curZero);
+        __m256i fill = zero;
+        if(!_mm256_testz_si256(holes, holes)) {
+            alignas(32) uint16_t hit[16];
+            for(int k = 0; k < 16; k++) hit[k] = (persistenceMap[history[i + k]] & mask) ? 0xFFFF : 0;
+            fill = _mm256_and_si256(holes, _mm256_load_si256(reinterpret_cast<const __m256i*>(hit)));
+        }
+
+        const __m256i newFrame = _mm256_blendv_epi8(_mm256_blendv_epi8(cur, prev, fill), filtered, agree);
+        const __m256i newLast = _mm256_blendv_epi8(_mm256_blendv_epi8(cur, filtered, agree), prev, curZero);
+        const __m256i histValid = _mm256_blendv_epi8(maskV, _mm256_or_si256(hist, maskV), agree);
+        const __m256i newHist = _mm256_blendv_epi8(histValid, _mm256_and_si256(hist, notMaskV), curZero);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(frame + i), newFrame);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lastFrame + i), newLast);
+        const __m256i packedHist = _mm256_permute4x64_epi64(_mm256_packus_epi16(newHist, newHist), 0xD8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(history + i), _mm256_castsi256_si128(packedHist));
+    }
+    temporalSpanScalar(frame, lastFrame, history, persistenceMap, i, end, alpha, deltaZ, mask);
+}
+
+#endif
+
+SpatialBlendRowFn getSpatialBlendRowFn() {
+#ifdef DEPTHAI_IMAGE_FILTERS_X86
+    const auto& cpu = utility::getCpuFeatures();
+    if(cpu.avx2) return spatialBlendRowAvx2;
+    if(cpu.sse41) return spatialBlendRowSse41;
+#endif
+    return spatialBlendRowScalar;
+}
+
+SpatialHorizontalKernel getSpatialHorizontalKernel() {
+    SpatialHorizontalKernel kernel;
+#ifdef DEPTHAI_IMAGE_FILTERS_X86
+    const auto& cpu = utility::getCpuFeatures();
+    if(cpu.avx2) {
+        kernel.fn = spatialHorizontalAvx2;
+        kernel.lanes = 16;
+    } else if(cpu.sse41) {
+        kernel.fn = spatialHorizontalSse41;
+        kernel.lanes = 8;
+    }
+#endif
+    return kernel;
+}
+
+TemporalSpanFn getTemporalSpanFn() {
+#ifdef DEPTHAI_IMAGE_FILTERS_X86
+    const auto& cpu = utility::getCpuFeatures();
+    if(cpu.avx2) return temporalSpanAvx2;
+    if(cpu.sse41) return temporalSpanSse41;
+#endif
+    return temporalSpanScalar;
+}
+
 class MedianFilter {
    public:
     MedianFilter();
@@ -148,11 +667,10 @@ void MedianFilter::process(std::shared_ptr<dai::ImgFrame>& frame, int medianSize
 /***********************************************************************************************************/
 
 template <typename T>
-void recursiveFilterHorizontal(SpatialFilterParamsImpl* params) {
+void recursiveFilterHorizontalRows(SpatialFilterParamsImpl* params, int rowBegin, int rowEnd) {
     void* image_data = (void*)params->currentFrame->data->getData().data();
     float alpha = params->alpha;
     int _width = params->currentFrame->getWidth();
-    int _height = params->currentFrame->getHeight();
     size_t _holesFillingRadius = params->holesFillingRadius;
 
     // Handle conversions for invalid input data
@@ -167,7 +685,7 @@ void recursiveFilterHorizontal(SpatialFilterParamsImpl* params) {
     auto image = reinterpret_cast<T*>(image_data);
     size_t currentFill = 0;
 
-    for(int v = 0; v < _height; v++) {
+    for(int v = rowBegin; v < rowEnd; v++) {
         // left to right
         T* im = image + v * _width;
         T val0 = im[0];
@@ -230,8 +748,40 @@ void recursiveFilterHorizontal(SpatialFilterParamsImpl* params) {
     }
 }
 
+// RAW16 rows are filtered in groups of kernel.lanes in lockstep, the remainder with the scalar version
+void recursiveFilterHorizontalRowsU16(SpatialFilterParamsImpl* params, int rowBegin, int rowEnd) {
+    static const SpatialHorizontalKernel kernel = getSpatialHorizontalKernel();
+    if(kernel.fn == nullptr) {
+        recursiveFilterHorizontalRows<uint16_t>(params, rowBegin, rowEnd);
+        return;
+    }
+    const int width = params->currentFrame->getWidth();
+    // A negative radius fills every hole in the scalar version, the counter can not get past the row width either way
+    const int maxRadius = std::numeric_limits<uint16_t>::max();
+    const auto radius = static_cast<uint16_t>(params->holesFillingRadius < 0 ? maxRadius : std::min(params->holesFillingRadius, maxRadius));
+    auto image = reinterpret_cast<uint16_t*>(params->currentFrame->data->getData().data());
+    std::vector<uint16_t> scratch(static_cast<size_t>(width) * kernel.lanes);
+    int v = rowBegin;
+    for(; v + kernel.lanes <= rowEnd; v += kernel.lanes) {
+        kernel.fn(image + static_cast<size_t>(v) * width, width, width, scratch.data(), params->alpha, static_cast<uint16_t>(params->delta), radius);
+    }
+    recursiveFilterHorizontalRows<uint16_t>(params, v, rowEnd);
+}
+
+// Rows are independent, so they are spread across the shared pool
 template <typename T>
-void recursiveFilterVertical(SpatialFilterParamsImpl* params) {
+void recursiveFilterHorizontal(SpatialFilterParamsImpl* params) {
+    parallelRanges(params->currentFrame->getHeight(), 1, [&](int rowBegin, int rowEnd) {
+        if constexpr(std::is_same<T, uint16_t>::value) {
+            recursiveFilterHorizontalRowsU16(params, rowBegin, rowEnd);
+        } else {
+            recursiveFilterHorizontalRows<T>(params, rowBegin, rowEnd);
+        }
+    });
+}
+
+template <typename T>
+void recursiveFilterVerticalColumns(SpatialFilterParamsImpl* params, int columnBegin, int columnEnd) {
     void* image_data = (void*)params->currentFrame->data->getData().data();
     float alpha = params->alpha;
     int _width = params->currentFrame->getWidth();
@@ -251,46 +801,71 @@ void recursiveFilterVertical(SpatialFilterParamsImpl* params) {
     // we'll do one row at a time, top to bottom, then bottom to top
 
     // top to bottom
-
-    T* im = image;
     T im0{};
     T imw{};
     for(int v = 1; v < _height; v++) {
-        for(int u = 0; u < _width; u++) {
-            im0 = im[0];
-            imw = im[_width];
+        T* im = image + (v - 1) * _width;
+        for(int u = columnBegin; u < columnEnd; u++) {
+            im0 = im[u];
+            imw = im[u + _width];
 
             // if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
             {
                 T diff = static_cast<T>(fabs(im0 - imw));
                 if(diff < deltaZ) {
                     float filtered = imw * alpha + im0 * (1.f - alpha);
-                    im[_width] = static_cast<T>(filtered + round);
+                    im[u + _width] = static_cast<T>(filtered + round);
                 }
             }
-            im += 1;
         }
     }
 
     // bottom to top
-    im = image + (_height - 2) * _width;
-    for(int v = 1; v < _height; v++, im -= (_width * 2)) {
-        for(int u = 0; u < _width; u++) {
-            im0 = im[0];
-            imw = im[_width];
+    for(int v = _height - 2; v >= 0; v--) {
+        T* im = image + v * _width;
+        for(int u = columnBegin; u < columnEnd; u++) {
+            im0 = im[u];
+            imw = im[u + _width];
 
             if((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold)) {
                 T diff = static_cast<T>(fabs(im0 - imw));
                 if(diff < deltaZ) {
                     float filtered = im0 * alpha + imw * (1.f - alpha);
-                    im[0] = static_cast<T>(filtered + round);
+                    im[u] = static_cast<T>(filtered + round);
                 }
             }
-            im += 1;
         }
     }
 }
 
+// RAW16 depth goes through the vectorized row kernel
+template <>
+void recursiveFilterVerticalColumns<uint16_t>(SpatialFilterParamsImpl* params, int columnBegin, int columnEnd) {
+    static const SpatialBlendRowFn blendRow = getSpatialBlendRowFn();
+    auto image = reinterpret_cast<uint16_t*>(params->currentFrame->data->getData().data());
+    const float alpha = params->alpha;
+    const int width = params->currentFrame->getWidth();
+    const int height = params->currentFrame->getHeight();
+    const auto deltaZ = static_cast<uint16_t>(params->delta);
+
+    // top to bottom, each row blended towards the (already filtered) row above
+    for(int v = 1; v < height; v++) {
+        blendRow(image + v * width, image + (v - 1) * width, columnBegin, columnEnd, alpha, deltaZ, false);
+    }
+    // bottom to top, only between valid pixels
+    for(int v = height - 2; v >= 0; v--) {
+        blendRow(image + v * width, image + (v + 1) * width, columnBegin, columnEnd, alpha, deltaZ, true);
+    }
+}
+
+// Columns are independent, so column strips are spread across the shared pool
+template <typename T>
+void recursiveFilterVertical(SpatialFilterParamsImpl* params) {
+    parallelRanges(params->currentFrame->getWidth(), COLUMN_STRIP_ALIGNMENT, [&](int columnBegin, int columnEnd) {
+        recursiveFilterVerticalColumns<T>(params, columnBegin, columnEnd);
+    });
+}
+
 SpatialFilter::SpatialFilter() {}
 
 int SpatialFilter::Init(float alpha, int delta, int iterationNr, int holesFillingRadius) {
@@ -361,7 +936,7 @@ void SpeckleFilter::process(std::shared_ptr<dai::ImgFrame>& frame, int speckleRa
 /***********************************************************************************************************/
 
 template <typename T>
-void processImpl(TemporalFilterParamsImpl* params) {
+void processSpan(TemporalFilterParamsImpl* params, size_t begin, size_t end) {
     auto& currentFrame = params->currentFrame;
     auto& accumulatorFrame = params->accumulatorFrame;
     auto& history = params->history;
@@ -377,12 +952,10 @@ void processImpl(TemporalFilterParamsImpl* params) {
     auto _lastFrame = reinterpret_cast<T*>(accumulatorFrame->data());
     unsigned char mask = 1 << currFrameIdx;
 
-    size_t frameSize = currentFrame->getWidth() * currentFrame->getHeight();
-
     decltype(alpha) oneMinusAlpha = 1 - alpha;
 
     // pass one -- go through image and update all
-    for(size_t i = 0; i < frameSize; i++) {
+    for(size_t i = begin; i < end; i++) {
         T currentVal = frame[i];
         T previousVal = _lastFrame[i];
 
@@ -417,6 +990,28 @@ void processImpl(TemporalFilterParamsImpl* params) {
     }
 }
 
+// RAW16 depth goes through the vectorized kernel
+template <>
+void processSpan<uint16_t>(TemporalFilterParamsImpl* params, size_t begin, size_t end) {
+    static const TemporalSpanFn processFn = getTemporalSpanFn();
+    processFn(reinterpret_cast<uint16_t*>(params->currentFrame->data->getData().data()),
+              reinterpret_cast<uint16_t*>(params->accumulatorFrame->data()),
+              params->history->data(),
+              params->persistenceMap->data(),
+              begin,
+              end,
+              params->alpha,
+              static_cast<uint16_t>(params->delta),
+              static_cast<uint8_t>(1 << params->currFrameIdx));
+}
+
+// Pixels are independent, so the frame is split into row bands across the shared pool
+template <typename T>
+void processImpl(TemporalFilterParamsImpl* params) {
+    const size_t width = params->currentFrame->getWidth();
+    parallelRanges(params->currentFrame->getHeight(), 1, [&](int rowBegin, int rowEnd) { processSpan<T>(params, rowBegin * width, rowEnd * width); });
+}
+
 TemporalFilter::TemporalFilter() {}
 
 int TemporalFilter::Init(size_t frameSize, float alpha, int delta, int _persistenceMode) {
@@ -841,7 +1436,18 @@ void ImageFilters::run() {
 
         // If there are no filters, serve as a passthrough
         // Otherwise, create a copy and run filters inplace on the copy
-        std::shared_ptr<dai::ImgFrame> filteredFrame = filters.size() == 0 ? frame : frame->clone();
+        std::shared_ptr<dai::ImgFrame> filteredFrame = frame;
+        if(filters.size() > 0) {
+            if(framePool) {
+                filteredFrame = std::make_shared<dai::ImgFrame>();
+                filteredFrame->setMetadata(*frame);
+                auto srcData = frame->getData();
+                filteredFrame->data = framePool->acquire(srcData.size());
+                std::memcpy(filteredFrame->data->getData().data(), srcData.data(), srcData.size());
+            } else {
+                filteredFrame = frame->clone();
+            }
+        }
 
         auto t1 = std::chrono::high_resolution_clock::now();
         for(const auto& filter : filters) {
@@ -874,6 +1480,18 @@ void ImageFilters::setDefaultProfilePreset(ImageFiltersPresetMode mode) {
     initialConfig->setProfilePreset(mode);
 }
 
+void ImageFilters::setNumFramesPool(int numFramesPool) {
+    framePool = numFramesPool > 0 ? MemoryPool::create(numFramesPool) : nullptr;
+}
+
+int ImageFilters::getNumFramesPool() const {
+    return framePool ? static_cast<int>(framePool->getCapacity()) : 0;
+}
+
+MemoryPool::Stats ImageFilters::getPoolStats() const {
+    return framePool ? framePool->getStats() : MemoryPool::Stats{};
+}
+
 std::shared_ptr<ToFDepthConfidenceFilter> ToFDepthConfidenceFilter::build(Node::Output& depth, Node::Output& amplitude, ImageFiltersPresetMode presetMode) {
     depth.link(this->depth);
     amplitude.link(this->amplitude);
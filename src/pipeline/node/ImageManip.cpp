@@ -1,5 +1,7 @@
 #include "depthai/pipeline/node/ImageManip.hpp"
 
+#include <algorithm>
+
 #include "depthai/utility/ImageManipImpl.hpp"
 #include "pipeline/ThreadedNodeImpl.hpp"
 
@@ -16,7 +18,8 @@ ImageManip::ImageManip(std::unique_ptr<Properties> props)
       initialConfig(std::make_shared<decltype(properties.initialConfig)>(properties.initialConfig)) {}
 
 void ImageManip::run() {
-    impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, impl::WarpH> manip(properties, pimpl->logger);
+    impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, impl::WarpTiled> manip(properties, pimpl->logger);
+    manip.setNumThreads(static_cast<uint32_t>(std::max(0, numThreads)));
     auto iConf = runOnHost() ? *initialConfig : properties.initialConfig;
     impl::loop<ImageManip, impl::_ImageManipBuffer, impl::_ImageManipMemory>(
         *this,
@@ -41,35 +44,7 @@ void ImageManip::run() {
             auto srcMem = std::make_shared<impl::_ImageManipMemory>(src->getData());
             return manip.apply(srcMem, dst);
         },
-        [&](const ImgFrame& srcFrame, ImgFrame& dstFrame) {
-            auto outType = manip.getOutputFrameType();
-            auto dstSpecs = manip.getOutputFrameSpecs(outType);
-            dstFrame.sourceFb = srcFrame.sourceFb;
-            dstFrame.cam = srcFrame.cam;
-            dstFrame.instanceNum = srcFrame.instanceNum;
-            dstFrame.sequenceNum = srcFrame.sequenceNum;
-            dstFrame.tsDevice = srcFrame.tsDevice;
-            dstFrame.ts = srcFrame.ts;
-            dstFrame.category = srcFrame.category;
-            dstFrame.event = srcFrame.event;
-            dstFrame.fb.height = dstSpecs.height;
-            dstFrame.fb.width = dstSpecs.width;
-            dstFrame.fb.stride = dstSpecs.p1Stride;
-            dstFrame.fb.p1Offset = dstSpecs.p1Offset;
-            dstFrame.fb.p2Offset = dstSpecs.p2Offset;
-            dstFrame.fb.p3Offset = dstSpecs.p3Offset;
-            dstFrame.setType(outType);
-
-            // Transformations
-            dstFrame.transformation = srcFrame.transformation;
-            if(manip.undistortEnabled()) {
-                dstFrame.transformation.setDistortionCoefficients({});
-            }
-            auto srcCrops = manip.getSrcCrops();
-            dstFrame.transformation.addSrcCrops(srcCrops);
-            dstFrame.transformation.addTransformation(manip.getMatrix());
-            dstFrame.transformation.setSize(dstSpecs.width, dstSpecs.height);
-        });
+        [&](const ImgFrame& srcFrame, ImgFrame& dstFrame) { impl::setOutputFrameInfo(manip, srcFrame, dstFrame); });
 }
 
 void ImageManip::setNumFramesPool(int numFramesPool) {
@@ -96,6 +71,13 @@ ImageManip& ImageManip::setPerformanceMode(ImageManip::PerformanceMode performan
     properties.performanceMode = performanceMode;
     return *this;
 }
+ImageManip& ImageManip::setNumThreads(int numThreads) {
+    this->numThreads = numThreads;
+    return *this;
+}
+int ImageManip::getNumThreads() const {
+    return numThreads;
+}
 
 /**
  * Check if the node is set to run on host
@@ -1,6 +1,11 @@
 #include "depthai/pipeline/node/SpatialLocationCalculator.hpp"
 
+#include <chrono>
+
+#include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "pipeline/ThreadedNodeImpl.hpp"
 #include "spdlog/fmt/fmt.h"
+#include "utility/SpatialLocationCalculatorImpl.hpp"
 
 namespace dai {
 namespace node {
@@ -13,5 +18,68 @@ SpatialLocationCalculator::Properties& SpatialLocationCalculator::getProperties(
     return properties;
 }
 
+void SpatialLocationCalculator::setRunOnHost(bool runOnHost) {
+    runOnHostVar = runOnHost;
+}
+
+bool SpatialLocationCalculator::runOnHost() const {
+    return runOnHostVar;
+}
+
+void SpatialLocationCalculator::run() {
+    auto& logger = pimpl->logger;
+    impl::RoiDepthCalculator calculator;
+    auto config = initialConfig;
+    bool warnedIntrinsics = false;
+
+    while(isRunning()) {
+        if(inputConfig.getWaitForMessage()) {
+            auto newConfig = inputConfig.get<SpatialLocationCalculatorConfig>();
+            if(newConfig) config = newConfig;
+        } else {
+            while(inputConfig.has()) {
+                auto newConfig = inputConfig.get<SpatialLocationCalculatorConfig>();
+                if(newConfig) config = newConfig;
+            }
+        }
+
+        auto depth = inputDepth.get<ImgFrame>();
+        if(depth == nullptr) continue;
+        if(depth->getType() != ImgFrame::Type::RAW16) {
+            logger->error("SpatialLocationCalculator | Depth frame must be RAW16, skipping frame");
+            continue;
+        }
+        const auto data = depth->getData();
+        if(data.size() < static_cast<size_t>(depth->getStride()) * depth->getHeight()) {
+            logger->error("SpatialLocationCalculator | Depth frame data is smaller than its size, skipping frame");
+            continue;
+        }
+
+        std::optional<impl::RoiDepthCalculator::Intrinsics> intrinsics;
+        if(depth->transformation.isValid()) {
+            const auto matrix = depth->transformation.getIntrinsicMatrix();
+            intrinsics = impl::RoiDepthCalculator::Intrinsics{matrix[0][0], matrix[1][1], matrix[0][2], matrix[1][2]};
+        } else if(!warnedIntrinsics) {
+            logger->warn("SpatialLocationCalculator | Depth frame has no valid transformation, spatial X and Y are set to 0");
+            warnedIntrinsics = true;
+        }
+
+        auto t1 = std::chrono::steady_clock::now();
+        calculator.setFrame(data.data(), depth->getWidth(), depth->getHeight(), depth->getStride(), intrinsics);
+        auto spatialData = std::make_shared<SpatialLocationCalculatorData>();
+        spatialData->spatialLocations = calculator.calculate(config->config);
+        auto t2 = std::chrono::steady_clock::now();
+        logger->trace("SpatialLocationCalculator | {} ROIs took {}us",
+                      config->config.size(),
+                      std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+
+        spatialData->setTimestamp(depth->getTimestamp());
+        spatialData->setTimestampDevice(depth->getTimestampDevice());
+        spatialData->setSequenceNum(depth->getSequenceNum());
+        out.send(spatialData);
+        passthroughDepth.send(depth);
+    }
+}
+
 }  // namespace node
 }  // namespace dai
@@ -1,7 +1,11 @@
 #include "depthai/pipeline/node/Sync.hpp"
 
+// std
+#include <algorithm>
+
 #include "depthai/pipeline/datatype/MessageGroup.hpp"
 #include "pipeline/ThreadedNodeImpl.hpp"
+#include "utility/SyncEngine.hpp"
 
 namespace dai {
 namespace node {
@@ -33,112 +37,93 @@ bool Sync::runOnHost() const {
     return runOnHostVar;
 }
 
+Sync::SyncStats Sync::getStats() const {
+    std::lock_guard<std::mutex> lock(statsMtx);
+    return stats;
+}
+
+void Sync::buildStage1() {
+    // Wake up the host loop once a message is in the queue. Callbacks would run before the push
+    for(auto& in : inputs) {
+        in.second.setPushListener([this]() {
+            {
+                std::lock_guard<std::mutex> lock(arrivalMtx);
+                arrivals++;
+            }
+            arrivalCv.notify_one();
+        });
+    }
+}
+
 void Sync::run() {
     using namespace std::chrono;
     auto& logger = pimpl->logger;
-    const auto inputsName = inputs.name;
 
     if(inputs.empty()) {
         throw std::runtime_error("Sync node must have at least 1 input!");
     }
     std::vector<std::string> inputNames;
+    std::vector<Input*> inputRefs;
+    std::size_t capacity = 1;
     for(auto& in : inputs) {
-        auto inputName = in.first.second;
-        inputNames.push_back(inputName);
+        inputNames.push_back(in.first.second);
+        inputRefs.push_back(&in.second);
+        capacity = std::max<std::size_t>(capacity, in.second.getMaxSize());
     }
 
     auto syncThresholdNs = properties.syncThresholdNs;
     logger->trace("Sync threshold: {}", syncThresholdNs);
+    impl::SyncEngine engine(inputRefs.size(), syncThresholdNs, properties.syncAttempts, capacity);
 
-    while(isRunning()) {
-        auto tAbsoluteBeginning = steady_clock::now();
-        std::unordered_map<std::string, std::shared_ptr<dai::Buffer>> inputFrames;
-        for(auto name : inputNames) {
-            logger->trace("Receiving input: {}", name);
-            inputFrames[name] = inputs[name].get<dai::Buffer>();
-            if(inputFrames[name] == nullptr) {
-                logger->error("Received nullptr from input {}, sync node only accepts messages inherited from Buffer on the inputs", name);
-                throw std::runtime_error("Received nullptr from input " + name);
+    auto receive = [&]() {
+        for(std::size_t i = 0; i < inputRefs.size(); i++) {
+            while(auto msg = inputRefs[i]->tryGet()) {
+                auto buffer = std::dynamic_pointer_cast<dai::Buffer>(msg);
+                if(buffer == nullptr) {
+                    logger->error("Received nullptr from input {}, sync node only accepts messages inherited from Buffer on the inputs", inputNames[i]);
+                    throw std::runtime_error("Received nullptr from input " + inputNames[i]);
+                }
+                engine.add(i, std::move(buffer));
             }
         }
-        // Print out the timestamps
-        for(const auto& frame : inputFrames) {
-            logger->debug(
-                "Starting input {} timestamp is {} ms", frame.first, static_cast<float>(frame.second->getTimestamp().time_since_epoch().count()) / 1000000.f);
+    };
+
+    std::vector<std::shared_ptr<dai::Buffer>> group;
+    while(isRunning()) {
+        // Anything pushed after this point wakes up the wait below, so no message is left behind
+        std::uint64_t seen = 0;
+        {
+            std::lock_guard<std::mutex> lock(arrivalMtx);
+            seen = arrivals;
         }
-        auto tAfterMessageBeginning = steady_clock::now();
-        int attempts = 0;
-        while(true) {
-            logger->trace("There have been {} attempts to sync", attempts);
-            if(attempts > 50) {
-                logger->warn("Sync node has been trying to sync for {} messages, but the messages are still not in sync.", attempts);
-                for(const auto& frame : inputFrames) {
-                    logger->warn(
-                        "Output {} timestamp is {} ms", frame.first, static_cast<float>(frame.second->getTimestamp().time_since_epoch().count()) / 1000000.f);
-                }
-            }
-            if(attempts > properties.syncAttempts && properties.syncAttempts != -1) {
-                logger->warn(
-                    "Sync node has been trying to sync for {} messages, but the messages are still not in sync. "
-                    "The node will send the messages anyway.",
-                    attempts);
-                break;
-            }
-            // Find a minimum timestamp
-            auto minTs = inputFrames.begin()->second->getTimestamp();
-            for(const auto& frame : inputFrames) {
-                if(frame.second->getTimestamp() < minTs) {
-                    minTs = frame.second->getTimestamp();
-                }
-            }
+        receive();
 
-            // Find a max timestamp
-            auto maxTs = inputFrames.begin()->second->getTimestamp();
-            for(const auto& frame : inputFrames) {
-                if(frame.second->getTimestamp() > maxTs) {
-                    maxTs = frame.second->getTimestamp();
+        while(engine.next(group)) {
+            auto outputGroup = std::make_shared<dai::MessageGroup>();
+            dai::Buffer* newestFrame = group.front().get();
+            for(std::size_t i = 0; i < group.size(); i++) {
+                outputGroup->add(inputNames[i], group[i]);
+                if(group[i]->getTimestamp() > newestFrame->getTimestamp()) {
+                    newestFrame = group[i].get();
                 }
             }
-            logger->debug("Diff: {} ms", duration_cast<milliseconds>(maxTs - minTs).count());
-
-            if(duration_cast<nanoseconds>(maxTs - minTs).count() < syncThresholdNs) {
-                break;
+            outputGroup->setTimestamp(newestFrame->getTimestamp());
+            outputGroup->setTimestampDevice(newestFrame->getTimestampDevice());
+            outputGroup->setSequenceNum(newestFrame->getSequenceNum());
+            {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                stats = engine.getStats();
             }
-
-            // Get the message with the minimum timestamp (oldest message)
-            std::string minTsName;
-            for(const auto& frame : inputFrames) {
-                if(frame.second->getTimestamp() == minTs) {
-                    minTsName = frame.first;
-                    break;
-                }
-            }
-            logger->trace("Receiving input: {}", minTsName);
-            inputFrames[minTsName] = inputs[minTsName].get<dai::Buffer>();
-            attempts++;
+            out.send(outputGroup);
         }
-        auto tBeforeSend = steady_clock::now();
-        auto outputGroup = std::make_shared<dai::MessageGroup>();
-        dai::Buffer* newestFrame = inputFrames.begin()->second.get();
-        for(const auto& name : inputNames) {
-            logger->trace("Sending output: {}", name);
-            logger->trace("Timestamp: {} ms",
-                          static_cast<float>(duration_cast<microseconds>(inputFrames[name]->getTimestamp().time_since_epoch()).count()) / 1000.f);
-            outputGroup->add(name, inputFrames[name]);
-            if(inputFrames[name]->getTimestamp() > newestFrame->getTimestamp()) {
-                newestFrame = inputFrames[name].get();
-            }
+        {
+            std::lock_guard<std::mutex> lock(statsMtx);
+            stats = engine.getStats();
         }
-        outputGroup->setTimestamp(newestFrame->getTimestamp());
-        outputGroup->setTimestampDevice(newestFrame->getTimestampDevice());
-        outputGroup->setSequenceNum(newestFrame->getSequenceNum());
-        out.send(outputGroup);
-        auto tAbsoluteEnd = steady_clock::now();
-        logger->debug("Sync total took {}ms, processing {}ms, getting_frames {}ms, sending_frames {}ms",
-                      duration_cast<microseconds>(tAbsoluteEnd - tAbsoluteBeginning).count() / 1000,
-                      duration_cast<microseconds>(tBeforeSend - tAfterMessageBeginning).count() / 1000,
-                      duration_cast<microseconds>(tAfterMessageBeginning - tAbsoluteBeginning).count() / 1000,
-                      duration_cast<microseconds>(tAbsoluteEnd - tBeforeSend).count() / 1000);
+
+        std::unique_lock<std::mutex> lock(arrivalMtx);
+        // Time out now and then, to notice the node being stopped
+        arrivalCv.wait_for(lock, milliseconds(100), [&]() { return arrivals != seen; });
     }
 }
 }  // namespace node
@@ -1,11 +1,31 @@
 #include "depthai/pipeline/node/host/HostNode.hpp"
 
+#include <condition_variable>
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include "depthai/pipeline/Pipeline.hpp"
+#include "pipeline/ThreadedNodeImpl.hpp"
+#include "utility/WorkStealingExecutor.hpp"
 
 namespace dai {
 namespace node {
+
+struct HostNode::ExecutorState {
+    std::shared_ptr<utility::WorkStealingExecutor> executor;
+    std::mutex mtx;
+    std::condition_variable cv;
+    // Groups taken from the input and not sent out yet
+    unsigned inFlight = 0;
+    // Tasks submitted to the executor and not finished yet
+    unsigned processing = 0;
+    std::uint64_t nextSeq = 0;
+    std::uint64_t nextToSend = 0;
+    // Processed groups waiting to be sent by the node's thread, in order
+    std::map<std::uint64_t, std::shared_ptr<Buffer>> finished;
+};
+
 void HostNode::buildStage1() {
     // If the user has been explicit about the sync node, set it
     if(syncOnHost.has_value()) {
@@ -14,9 +34,26 @@ void HostNode::buildStage1() {
         sync->setRunOnHost(true);
     }
     sync->out.link(input);
+
+    if(executorMaxInFlight > 0) {
+        executorState = std::make_shared<ExecutorState>();
+        // Schedule processing right as a group arrives, instead of a thread waiting on the input
+        input.setPushListener([this]() { scheduleOnExecutor(); });
+    }
 }
 
 void HostNode::run() {
+    if(executorState) {
+        {
+            std::lock_guard<std::mutex> lock(executorState->mtx);
+            executorState->executor = getParentPipeline().impl()->getHostExecutor();
+        }
+        // Pick up groups which arrived before the node started
+        scheduleOnExecutor();
+        sendFromExecutor();
+        return;
+    }
+
     while(isRunning()) {
         // Get input
         auto in = input.get<dai::MessageGroup>();
@@ -41,5 +78,101 @@ void HostNode::run() {
         }
     }
 }
+
+void HostNode::scheduleOnExecutor() {
+    auto& state = *executorState;
+    std::lock_guard<std::mutex> lock(state.mtx);
+    if(!state.executor || !isRunning()) return;
+    try {
+        while(state.inFlight < executorMaxInFlight) {
+            auto msg = input.tryGet();
+            if(!msg) break;
+            auto in = std::dynamic_pointer_cast<dai::MessageGroup>(msg);
+            if(!in) continue;
+            const auto seq = state.nextSeq++;
+            state.inFlight++;
+            state.processing++;
+            state.executor->submit([self = std::static_pointer_cast<HostNode>(shared_from_this()), seq, in]() { self->processOnExecutor(seq, in); });
+        }
+    } catch(const MessageQueue::QueueException&) {
+        // Input got closed, the node is stopping
+    }
+}
+
+void HostNode::processOnExecutor(std::uint64_t seq, std::shared_ptr<dai::MessageGroup> in) {
+    // Sending may block on a full downstream queue, which is left to the node's thread.
+    // A blocked worker could otherwise starve the downstream nodes sharing the executor.
+    // The slot is recorded however processing ends, sendFromExecutor() and wait() wait for every one of them
+    struct FinishGuard {
+        ExecutorState& state;
+        std::uint64_t seq;
+        std::shared_ptr<Buffer> result;
+
+        ~FinishGuard() {
+            {
+                std::lock_guard<std::mutex> lock(state.mtx);
+                state.finished.emplace(seq, std::move(result));
+                state.processing--;
+            }
+            state.cv.notify_all();
+        }
+    } guard{*executorState, seq, nullptr};
+
+    try {
+        guard.result = processGroup(in);
+    } catch(const MessageQueue::QueueException& ex) {
+        pimpl->logger->trace("Node stopped with a queue exception: {}", ex.what());
+    } catch(const std::exception& ex) {
+        pimpl->logger->error("Node threw exception, stopping the node. Exception message: {}", ex.what());
+        stopPipeline();
+    } catch(...) {
+        pimpl->logger->error("Node threw an unknown exception, stopping the node");
+        stopPipeline();
+    }
+}
+
+void HostNode::sendFromExecutor() {
+    auto& state = *executorState;
+    std::unique_lock<std::mutex> lock(state.mtx);
+    while(true) {
+        state.cv.wait(lock, [&]() { return !isRunning() || (!state.finished.empty() && state.finished.begin()->first == state.nextToSend); });
+        if(!isRunning()) break;
+        auto next = std::move(state.finished.begin()->second);
+        state.finished.erase(state.finished.begin());
+        state.nextToSend++;
+        lock.unlock();
+        if(next) {
+            try {
+                out.send(next);
+            } catch(const MessageQueue::QueueException&) {
+                // Downstream closed, the pipeline is stopping
+                break;
+            }
+        }
+        lock.lock();
+        state.inFlight--;
+        lock.unlock();
+        // A slot got free, take the next group
+        scheduleOnExecutor();
+        lock.lock();
+    }
+}
+
+void HostNode::stop() {
+    ThreadedHostNode::stop();
+    if(executorState) {
+        // Wake up wait(), holding the lock so the notification can't slip in between its check and sleep
+        std::lock_guard<std::mutex> lock(executorState->mtx);
+        executorState->cv.notify_all();
+    }
+}
+
+void HostNode::wait() {
+    ThreadedHostNode::wait();
+    if(!executorState) return;
+    std::unique_lock<std::mutex> lock(executorState->mtx);
+    executorState->cv.wait(lock, [this]() { return !isRunning() && executorState->processing == 0; });
+}
+
 }  // namespace node
 }  // namespace dai
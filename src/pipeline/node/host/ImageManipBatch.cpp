@@ -0,0 +1,222 @@
+#include "depthai/pipeline/node/host/ImageManipBatch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "depthai/utility/ImageManipImpl.hpp"
+#include "pipeline/ThreadedNodeImpl.hpp"
+
+namespace dai {
+namespace node {
+
+namespace {
+
+using Operations = impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, impl::WarpTiled>;
+
+std::array<float, 9> flatten(std::array<std::array<float, 3>, 3> mat) {
+    return {mat[0][0], mat[0][1], mat[0][2], mat[1][0], mat[1][1], mat[1][2], mat[2][0], mat[2][1], mat[2][2]};
+}
+
+// Channels of the types which can be stacked into a tensor, 0 otherwise
+unsigned getTensorChannels(ImgFrame::Type type, bool& planar) {
+    switch(type) {
+        case ImgFrame::Type::RGB888p:
+        case ImgFrame::Type::BGR888p:
+            planar = true;
+            return 3;
+        case ImgFrame::Type::RGB888i:
+        case ImgFrame::Type::BGR888i:
+            planar = false;
+            return 3;
+        case ImgFrame::Type::GRAY8:
+        case ImgFrame::Type::RAW8:
+            planar = true;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+}  // namespace
+
+ImageManipBatch& ImageManipBatch::setNumFramesPool(int numFramesPool) {
+    this->numFramesPool = numFramesPool;
+    return *this;
+}
+
+int ImageManipBatch::getNumFramesPool() const {
+    return numFramesPool;
+}
+
+ImageManipBatch& ImageManipBatch::setNumThreads(int numThreads) {
+    this->numThreads = numThreads;
+    return *this;
+}
+
+int ImageManipBatch::getNumThreads() const {
+    return numThreads;
+}
+
+void ImageManipBatch::run() {
+    auto& logger = pimpl->logger;
+    const auto threads = static_cast<uint32_t>(std::max(0, numThreads));
+
+    // One set of operations per output slot, so unchanged configs skip the rebuild
+    std::vector<std::unique_ptr<Operations>> manips;
+    Operations converter(ImageManipProperties{}, logger);
+    auto convertedFrame = std::make_shared<impl::_ImageManipMemory>();
+
+    // Output buffers are reused once all frames and tensors sliced from them are released downstream
+    std::vector<std::shared_ptr<impl::_ImageManipMemory>> outPool;
+    const size_t poolSize = std::max(numFramesPool, 0);
+    auto getOutputData = [&](size_t size) {
+        for(const auto& data : outPool) {
+            if(!data->hasSlices()) {
+                data->setSize(size);
+                return data;
+            }
+        }
+        auto data = std::make_shared<impl::_ImageManipMemory>(size);
+        if(outPool.size() < poolSize) {
+            outPool.push_back(data);
+        }
+        return data;
+    };
+
+    while(isRunning()) {
+        auto configGroup = inputConfig.get<MessageGroup>();
+        auto frame = inputImage.get<ImgFrame>();
+        if(configGroup == nullptr || frame == nullptr) continue;
+
+        std::vector<std::pair<std::string, std::shared_ptr<ImageManipConfig>>> configs;
+        for(auto& entry : *configGroup) {
+            auto config = std::dynamic_pointer_cast<ImageManipConfig>(entry.second);
+            if(config == nullptr) {
+                logger->warn("ImageManipBatch | '{}' is not an ImageManipConfig, skipping it", entry.first);
+                continue;
+            }
+            configs.emplace_back(entry.first, std::move(config));
+        }
+        while(manips.size() < configs.size()) {
+            manips.push_back(std::make_unique<Operations>(ImageManipProperties{}, logger));
+            manips.back()->setNumThreads(threads);
+        }
+
+        // Convert the source once, instead of in every output
+        std::shared_ptr<impl::_ImageManipMemory> src = std::make_shared<impl::_ImageManipMemory>(frame->data->getData());
+        auto srcSpecs = impl::getSrcFrameSpecs(frame->fb);
+        auto srcType = frame->getType();
+        if(!impl::isTypeSupported(srcType)) {
+            converter.build(ImageManipConfig{}.base, impl::getValidType(srcType), srcSpecs, srcType);
+            convertedFrame->setSize(converter.getOutputSize());
+            if(!converter.apply(src, convertedFrame)) {
+                logger->error("ImageManipBatch | Conversion of the input frame failed, skipping frame");
+                continue;
+            }
+            srcType = converter.getOutputFrameType();
+            srcSpecs = converter.getOutputFrameSpecs(srcType);
+            src = convertedFrame;
+        }
+
+        // Build all outputs first, to lay them out in one buffer
+        std::vector<size_t> offsets(configs.size());
+        size_t totalSize = 0;
+        for(size_t i = 0; i < configs.size(); i++) {
+            auto& manip = *manips[i];
+            const auto& config = *configs[i].second;
+            manip.build(config.base, config.outputFrameType, srcSpecs, srcType);
+            auto newCameraMatrix = impl::matmul(manip.getMatrix(), frame->transformation.getIntrinsicMatrix());
+            manip.buildUndistort(config.base.undistort,
+                                 flatten(frame->transformation.getIntrinsicMatrix()),
+                                 flatten(newCameraMatrix),
+                                 frame->transformation.getDistortionCoefficients(),
+                                 srcType,
+                                 frame->getWidth(),
+                                 frame->getHeight(),
+                                 manip.getOutputWidth(),
+                                 manip.getOutputHeight());
+            offsets[i] = totalSize;
+            totalSize += manip.getOutputSize();
+        }
+
+        auto t1 = std::chrono::steady_clock::now();
+        auto outData = getOutputData(totalSize);
+        auto group = std::make_shared<MessageGroup>();
+        bool stackable = !configs.empty();
+        for(size_t i = 0; i < configs.size(); i++) {
+            auto& manip = *manips[i];
+            const auto& name = configs[i].first;
+            const auto outputSize = manip.getOutputSize();
+            if(outputSize == 0) {
+                // Nothing to do, pass the frame through
+                group->add(name, frame);
+                stackable = false;
+                continue;
+            }
+            auto data = outData->slice(offsets[i], outputSize);
+            if(!manip.apply(src, data)) {
+                logger->error("ImageManipBatch | Processing of '{}' failed, potentially unsupported config", name);
+            }
+            auto outFrame = std::make_shared<ImgFrame>();
+            outFrame->data = data;
+            impl::setOutputFrameInfo(manip, *frame, *outFrame);
+            group->add(name, outFrame);
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        logger->trace("ImageManipBatch | {} outputs took {}us",
+                      configs.size(),
+                      std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+
+        group->setTimestamp(frame->getTimestamp());
+        group->setTimestampDevice(frame->getTimestampDevice());
+        group->setSequenceNum(frame->getSequenceNum());
+
+        // Outputs without row padding lie back to back, which is already a batched tensor
+        bool planar = false;
+        const auto outType = stackable ? manips[0]->getOutputFrameType() : ImgFrame::Type::NONE;
+        const auto channels = getTensorChannels(outType, planar);
+        const auto width = stackable ? manips[0]->getOutputWidth() : 0;
+        const auto height = stackable ? manips[0]->getOutputHeight() : 0;
+        for(size_t i = 0; stackable && i < configs.size(); i++) {
+            const auto& manip = *manips[i];
+            stackable = channels > 0 && manip.getOutputFrameType() == outType && manip.getOutputWidth() == width && manip.getOutputHeight() == height
+                        && manip.getOutputSize() == width * height * channels;
+        }
+
+        out.send(group);
+        if(stackable) {
+            auto tensor = std::make_shared<NNData>();
+            tensor->data = outData->slice(0, totalSize);
+            TensorInfo info;
+            info.name = "batch";
+            info.offset = 0;
+            info.dataType = TensorInfo::DataType::U8F;
+            info.order = planar ? TensorInfo::StorageOrder::NCHW : TensorInfo::StorageOrder::NHWC;
+            if(planar) {
+                info.dims = {static_cast<unsigned>(configs.size()), channels, static_cast<unsigned>(height), static_cast<unsigned>(width)};
+            } else {
+                info.dims = {static_cast<unsigned>(configs.size()), static_cast<unsigned>(height), static_cast<unsigned>(width), channels};
+            }
+            info.numDimensions = static_cast<unsigned>(info.dims.size());
+            info.strides.resize(info.dims.size());
+            unsigned stride = 1;
+            for(size_t d = info.dims.size(); d-- > 0;) {
+                info.strides[d] = stride;
+                stride *= info.dims[d];
+            }
+            tensor->tensors.push_back(info);
+            tensor->setTimestamp(frame->getTimestamp());
+            tensor->setTimestampDevice(frame->getTimestampDevice());
+            tensor->setSequenceNum(frame->getSequenceNum());
+            outTensor.send(tensor);
+        }
+    }
+}
+
+}  // namespace node
+}  // namespace dai
@@ -1,7 +1,11 @@
 #include "depthai/pipeline/node/host/RGBD.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
-#include <future>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 
 #include "common/CameraBoardSocket.hpp"
 #include "common/CameraFeatures.hpp"
@@ -21,30 +25,354 @@
     #include "depthai/shaders/rgbd2pointcloud.hpp"
     #include "kompute/Kompute.hpp"
 #endif
+#include "utility/CpuFeatures.hpp"
 #include "utility/PimplImpl.hpp"
+#include "utility/ThreadPool.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define DEPTHAI_RGBD_X86
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(__aarch64__) || defined(_M_ARM64)
+    #define DEPTHAI_RGBD_NEON
+    #include <arm_neon.h>
+#endif
+
+// Allows compiling functions for an instruction set not enabled for the whole translation unit
+#if defined(DEPTHAI_RGBD_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define DEPTHAI_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define DEPTHAI_TARGET(isa)
+#endif
 
 namespace dai {
 namespace node {
 
+namespace {
+
+// minX, minY, minZ, maxX, maxY, maxZ
+using Bounds = std::array<float, 6>;
+
+// One row of input, x = z * rayX[col] and y = z * rayY with rays precomputed from the intrinsics
+struct PointRow {
+    const uint16_t* depth;
+    const uint8_t* color;  // RGB888i
+    const float* rayX;
+    float rayY;
+    float scale;
+    int width;
+};
+
+// Output of one row, interleaved Point3fRGBA or x / y / z / RGBA planes
+struct PointDst {
+    Point3fRGBA* points = nullptr;
+    float* x = nullptr;
+    float* y = nullptr;
+    float* z = nullptr;
+    uint32_t* rgba = nullptr;
+};
+
+// Fills one row of points and extends the bounds, the vectorized versions are bit exact with the scalar one
+using PointRowFn = void (*)(const PointRow&, const PointDst&, Bounds&);
+
+inline void updateBounds(Bounds& bounds, float x, float y, float z) {
+    bounds[0] = std::min(bounds[0], x);
+    bounds[1] = std::min(bounds[1], y);
+    bounds[2] = std::min(bounds[2], z);
+    bounds[3] = std::max(bounds[3], x);
+    bounds[4] = std::max(bounds[4], y);
+    bounds[5] = std::max(bounds[5], z);
+}
+
+// Folds per lane minimums / maximums, stored as x, y and z groups of `lanes` values
+inline void foldBounds(Bounds& bounds, const float* mins, const float* maxs, int lanes) {
+    for(int k = 0; k < 3; k++) {
+        for(int l = 0; l < lanes; l++) {
+            bounds[k] = std::min(bounds[k], mins[k * lanes + l]);
+            bounds[k + 3] = std::max(bounds[k + 3], maxs[k * lanes + l]);
+        }
+    }
+}
+
+template <bool Planar>
+inline void storePoint(const PointDst& dst, size_t i, float x, float y, float z, const uint8_t* rgb) {
+    if(Planar) {
+        dst.x[i] = x;
+        dst.y[i] = y;
+        dst.z[i] = z;
+        const uint8_t rgba[4] = {rgb[0], rgb[1], rgb[2], 255};
+        std::memcpy(dst.rgba + i, rgba, sizeof(rgba));
+    } else {
+        dst.points[i] = Point3fRGBA{x, y, z, rgb[0], rgb[1], rgb[2]};
+    }
+}
+
+template <bool Planar>
+void pointSpanScalar(const PointRow& row, const PointDst& dst, int start, Bounds& bounds) {
+    for(int i = start; i < row.width; i++) {
+        const float z = static_cast<float>(row.depth[i]) * row.scale;
+        const float x = z * row.rayX[i];
+        const float y = z * row.rayY;
+        updateBounds(bounds, x, y, z);
+        storePoint<Planar>(dst, i, x, y, z, row.color + 3 * i);
+    }
+}
+
+template <bool Planar>
+void pointRowScalar(const PointRow& row, const PointDst& dst, Bounds& bounds) {
+    pointSpanScalar<Planar>(row, dst, 0, bounds);
+}
+
+#if defined(DEPTHAI_RGBD_X86)
+
+// Min / max with the accumulator as second operand keep std::min / std::max semantics, so the bounds match the scalar path
+template <bool Planar>
+DEPTHAI_TARGET("sse4.1")
+void pointRowSse41(const PointRow& row, const PointDst& dst, Bounds& bounds) {
+    const __m128 scale = _mm_set1_ps(row.scale);
+    const __m128 rayY = _mm_set1_ps(row.rayY);
+    const __m128i expand = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    __m128 mins[3] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+    __m128 maxs[3] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+    int i = 0;
+    for(; i + 4 <= row.width; i += 4) {
+        const __m128i d = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row.depth + i)));
+        __m128 z = _mm_mul_ps(_mm_cvtepi32_ps(d), scale);
+        __m128 x = _mm_mul_ps(z, _mm_loadu_ps(row.rayX + i));
+        __m128 y = _mm_mul_ps(z, rayY);
+
+        // 12 bytes of RGB, loaded without reading past the end of the frame
+        const uint8_t* rgb = row.color + 3 * i;
+        int32_t rgbTail;
+        std::memcpy(&rgbTail, rgb + 8, sizeof(rgbTail));
+        const __m128i rgbVec = _mm_insert_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(rgb)), rgbTail, 2);
+        const __m128i rgba = _mm_or_si128(_mm_shuffle_epi8(rgbVec, expand), alpha);
+
+        mins[0] = _mm_min_ps(x, mins[0]);
+        mins[1] = _mm_min_ps(y, mins[1]);
+        mins[2] = _mm_min_ps(z, mins[2]);
+        maxs[0] = _mm_max_ps(x, maxs[0]);
+        maxs[1] = _mm_max_ps(y, maxs[1]);
+        maxs[2] = _mm_max_ps(z, maxs[2]);
+
+        if(Planar) {
+            _mm_storeu_ps(dst.x + i, x);
+            _mm_storeu_ps(dst.y + i, y);
+            _mm_storeu_ps(dst.z + i, z);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst.rgba + i), rgba);
+        } else {
+            __m128 c = _mm_castsi128_ps(rgba);
+            _MM_TRANSPOSE4_PS(x, y, z, c);
+            float* out = reinterpret_cast<float*>(dst.points + i);
+            _mm_storeu_ps(out, x);
+            _mm_storeu_ps(out + 4, y);
+            _mm_storeu_ps(out + 8, z);
+            _mm_storeu_ps(out + 12, c);
+        }
+    }
+    alignas(16) float minLanes[12], maxLanes[12];
+    for(int k = 0; k < 3; k++) {
+        _mm_store_ps(minLanes + 4 * k, mins[k]);
+        _mm_store_ps(maxLanes + 4 * k, maxs[k]);
+    }
+    foldBounds(bounds, minLanes, maxLanes, 4);
+    pointSpanScalar<Planar>(row, dst, i, bounds);
+}
+
+template <bool Planar>
+DEPTHAI_TARGET("avx2")
+void pointRowAvx2(const PointRow& row, const PointDst& dst, Bounds& bounds) {
+    const __m256 scale = _mm256_set1_ps(row.scale);
+    const __m256 rayY = _mm256_set1_ps(row.rayY);
+    // Low lane holds pixels 0-3 at bytes 0-11, high lane pixels 4-7 at bytes 4-15 (loaded from byte 8 of the row)
+    const __m256i expand = _mm256_setr_epi8(
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 4, 5, 6, -1, 7, 8, 9, -1, 10, 11, 12, -1, 13, 14, 15, -1);
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    __m256 mins[3] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+    __m256 maxs[3] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+    int i = 0;
+    for(; i + 8 <= row.width; i += 8) {
+        const __m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row.depth + i)));
+        const __m256 z = _mm256_mul_ps(_mm256_cvtepi32_ps(d), scale);
+        const __m256 x = _mm256_mul_ps(z, _mm256_loadu_ps(row.rayX + i));
+        const __m256 y = _mm256_mul_ps(z, rayY);
+
+        const uint8_t* rgb = row.color + 3 * i;
+        const __m256i rgbVec = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb))),
+                                                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + 8)),
+                                                       1);
+        const __m256i rgba = _mm256_or_si256(_mm256_shuffle_epi8(rgbVec, expand), alpha);
+
+        mins[0] = _mm256_min_ps(x, mins[0]);
+        mins[1] = _mm256_min_ps(y, mins[1]);
+        mins[2] = _mm256_min_ps(z, mins[2]);
+        maxs[0] = _mm256_max_ps(x, maxs[0]);
+        maxs[1] = _mm256_max_ps(y, maxs[1]);
+        maxs[2] = _mm256_max_ps(z, maxs[2]);
+
+        if(Planar) {
+            _mm256_storeu_ps(dst.x + i, x);
+            _mm256_storeu_ps(dst.y + i, y);
+            _mm256_storeu_ps(dst.z + i, z);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst.rgba + i), rgba);
+        } else {
+            // 4x8 transpose, each 128 bit lane of p0..p3 is one point
+            const __m256 c = _mm256_castsi256_ps(rgba);
+            const __m256 t0 = _mm256_unpacklo_ps(x, y);
+            const __m256 t1 = _mm256_unpackhi_ps(x, y);
+            const __m256 t2 = _mm256_unpacklo_ps(z, c);
+            const __m256 t3 = _mm256_unpackhi_ps(z, c);
+            const __m256 p0 = _mm256_shuffle_ps(t0, t2, 0x44);
+            const __m256 p1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+            const __m256 p2 = _mm256_shuffle_ps(t1, t3, 0x44);
+            const __m256 p3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+            float* out = reinterpret_cast<float*>(dst.points + i);
+            _mm256_storeu_ps(out, _mm256_permute2f128_ps(p0, p1, 0x20));
+            _mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(p2, p3, 0x20));
+            _mm256_storeu_ps(out + 16, _mm256_permute2f128_ps(p0, p1, 0x31));
+            _mm256_storeu_ps(out + 24, _mm256_permute2f128_ps(p2, p3, 0x31));
+        }
+    }
+    alignas(32) float minLanes[24], maxLanes[24];
+    for(int k = 0; k < 3; k++) {
+        _mm256_store_ps(minLanes + 8 * k, mins[k]);
+        _mm256_store_ps(maxLanes + 8 * k, maxs[k]);
+    }
+    foldBounds(bounds, minLanes, maxLanes, 8);
+    pointSpanScalar<Planar>(row, dst, i, bounds);
+}
+
+#elif defined(DEPTHAI_RGBD_NEON)
+
+template <bool Planar>
+void pointRowNeon(const PointRow& row, const PointDst& dst, Bounds& bounds) {
+    const float32x4_t scale = vdupq_n_f32(row.scale);
+    const float32x4_t rayY = vdupq_n_f32(row.rayY);
+    const uint8x8_t alpha = vdup_n_u8(255);
+    float32x4_t mins[3] = {vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f)};
+    float32x4_t maxs[3] = {vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f)};
+    int i = 0;
+    for(; i + 8 <= row.width; i += 8) {
+        const uint16x8_t d = vld1q_u16(row.depth + i);
+        const uint8x8x3_t rgb = vld3_u8(row.color + 3 * i);
+        const uint8x8x2_t rg = vzip_u8(rgb.val[0], rgb.val[1]);
+        const uint8x8x2_t ba = vzip_u8(rgb.val[2], alpha);
+        for(int h = 0; h < 2; h++) {
+            const uint16x4x2_t px = vzip_u16(vreinterpret_u16_u8(rg.val[h]), vreinterpret_u16_u8(ba.val[h]));
+            const uint32x4_t rgba = vreinterpretq_u32_u16(vcombine_u16(px.val[0], px.val[1]));
+            const uint32x4_t di = vmovl_u16(h == 0 ? vget_low_u16(d) : vget_high_u16(d));
+            const float32x4_t z = vmulq_f32(vcvtq_f32_u32(di), scale);
+            const float32x4_t x = vmulq_f32(z, vld1q_f32(row.rayX + i + 4 * h));
+            const float32x4_t y = vmulq_f32(z, rayY);
+
+            mins[0] = vminq_f32(mins[0], x);
+            mins[1] = vminq_f32(mins[1], y);
+            mins[2] = vminq_f32(mins[2], z);
+            maxs[0] = vmaxq_f32(maxs[0], x);
+            maxs[1] = vmaxq_f32(maxs[1], y);
+            maxs[2] = vmaxq_f32(maxs[2], z);
+
+            const int o = i + 4 * h;
+            if(Planar) {
+                vst1q_f32(dst.x + o, x);
+                vst1q_f32(dst.y + o, y);
+                vst1q_f32(dst.z + o, z);
+                vst1q_u32(dst.rgba + o, rgba);
+            } else {
+                const float32x4x4_t points = {{x, y, z, vreinterpretq_f32_u32(rgba)}};
+                vst4q_f32(reinterpret_cast<float*>(dst.points + o), points);
+            }
+        }
+    }
+    float minLanes[12], maxLanes[12];
+    for(int k = 0; k < 3; k++) {
+        vst1q_f32(minLanes + 4 * k, mins[k]);
+        vst1q_f32(maxLanes + 4 * k, maxs[k]);
+    }
+    foldBounds(bounds, minLanes, maxLanes, 4);
+    pointSpanScalar<Planar>(row, dst, i, bounds);
+}
+
+#endif
+
+PointRowFn getPointRowFn(bool planar) {
+#if defined(DEPTHAI_RGBD_X86)
+    const auto& cpu = utility::getCpuFeatures();
+    if(cpu.avx2) return planar ? pointRowAvx2<true> : pointRowAvx2<false>;
+    if(cpu.sse41) return planar ? pointRowSse41<true> : pointRowSse41<false>;
+#elif defined(DEPTHAI_RGBD_NEON)
+    if(utility::getCpuFeatures().neon) return planar ? pointRowNeon<true> : pointRowNeon<false>;
+#endif
+    return planar ? pointRowScalar<true> : pointRowScalar<false>;
+}
+
+#ifdef DEPTHAI_ENABLE_KOMPUTE
+
+using DepthToFloatFn = void (*)(const uint16_t*, float*, size_t);
+
+void depthToFloatScalar(const uint16_t* depth, float* out, size_t n) {
+    for(size_t i = 0; i < n; i++) out[i] = static_cast<float>(depth[i]);
+}
+
+    #if defined(DEPTHAI_RGBD_X86)
+
+DEPTHAI_TARGET("avx2")
+void depthToFloatAvx2(const uint16_t* depth, float* out, size_t n) {
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        const __m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(depth + i)));
+        _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(d));
+    }
+    depthToFloatScalar(depth + i, out + i, n - i);
+}
+
+    #elif defined(DEPTHAI_RGBD_NEON)
+
+void depthToFloatNeon(const uint16_t* depth, float* out, size_t n) {
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        const uint16x8_t d = vld1q_u16(depth + i);
+        vst1q_f32(out + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(d))));
+        vst1q_f32(out + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(d))));
+    }
+    depthToFloatScalar(depth + i, out + i, n - i);
+}
+
+    #endif
+
+DepthToFloatFn getDepthToFloatFn() {
+    #if defined(DEPTHAI_RGBD_X86)
+    if(utility::getCpuFeatures().avx2) return depthToFloatAvx2;
+    #elif defined(DEPTHAI_RGBD_NEON)
+    if(utility::getCpuFeatures().neon) return depthToFloatNeon;
+    #endif
+    return depthToFloatScalar;
+}
+
+#endif
+
+}  // namespace
+
 class RGBD::Impl {
    public:
     Impl() = default;
-    void computePointCloud(const uint8_t* depthData, const uint8_t* colorData, std::vector<Point3fRGBA>& points) {
+    /**
+     * Writes the point cloud into out, which must hold getSize() points in either layout.
+     * Returns the number of points written, lower than getSize() if invalid points are dropped
+     */
+    size_t computePointCloud(const uint8_t* depthData, const uint8_t* colorData, uint8_t* out, Bounds& bounds) {
         if(!intrinsicsSet) {
             throw std::runtime_error("Intrinsics not set");
         }
-        points.reserve(size);
         switch(computeMethod) {
             case ComputeMethod::CPU:
-                computePointCloudCPU(depthData, colorData, points);
-                break;
+                return computePointCloudCPU(depthData, colorData, out, bounds);
             case ComputeMethod::CPU_MT:
-                computePointCloudCPUMT(depthData, colorData, points);
-                break;
+                return computePointCloudCPUMT(depthData, colorData, out, bounds);
             case ComputeMethod::GPU:
-                computePointCloudGPU(depthData, colorData, points);
-                break;
+                return computePointCloudGPU(depthData, colorData, out, bounds);
         }
+        return 0;
     }
     void setDepthUnit(StereoDepthConfig::AlgorithmControl::DepthUnit depthUnit) {
         // Default is millimeter
@@ -81,7 +409,7 @@ class RGBD::Impl {
         computeMethod = ComputeMethod::CPU;
     }
     void useCPUMT(uint32_t numThreads) {
-        threadNum = numThreads;
+        threadNum = static_cast<int>(std::max(numThreads, 1u));
         computeMethod = ComputeMethod::CPU_MT;
     }
     void useGPU(uint32_t device) {
@@ -95,10 +423,31 @@ class RGBD::Impl {
         this->width = width;
         this->height = height;
         size = this->width * this->height;
+        // Intrinsics are separable, so a ray per column and one per row is all the per pixel LUT needs
+        rayX.resize(width);
+        rayY.resize(height);
+        for(unsigned int col = 0; col < width; col++) rayX[col] = (static_cast<float>(col) - cx) / fx;
+        for(unsigned int row = 0; row < height; row++) rayY[row] = (static_cast<float>(row) - cy) / fy;
         intrinsicsSet = true;
     }
+    int getSize() const {
+        return size;
+    }
+    void setDropInvalidPoints(bool drop) {
+        dropInvalid = drop;
+    }
+    void setPlanarOutput(bool planarOutput) {
+        planar = planarOutput;
+        pointRowFn = getPointRowFn(planar);
+    }
 
    private:
+    struct ChunkResult {
+        size_t offset = 0;  // index of the first point of the chunk in the dense cloud
+        size_t count = 0;
+        Bounds bounds = {};
+    };
+
     void initializeGPU(uint32_t device) {
 #ifdef DEPTHAI_ENABLE_KOMPUTE
         // Initialize Kompute
@@ -110,22 +459,12 @@ class RGBD::Impl {
         throw std::runtime_error("Kompute not enabled in this build");
 #endif
     }
-    void computePointCloudGPU(const uint8_t* depthData, const uint8_t* colorData, std::vector<Point3fRGBA>& points) {
+    size_t computePointCloudGPU(const uint8_t* depthData, const uint8_t* colorData, uint8_t* out, Bounds& bounds) {
 #ifdef DEPTHAI_ENABLE_KOMPUTE
-        std::vector<float> xyzOut;
-
-        xyzOut.resize(size * 3);
-
-        // Convert depth to float
-        // Depth is in mm by default, convert to meters if outputMeters == true
-        // If outputMeters is true, scale = 1/1000.0 else scale = 1.0
+        // Depth is in mm by default, the shader multiplies it by scale to get the selected unit
         float scale = scaleFactor;
-
-        std::vector<float> depthDataFloat(size);
-        for(int i = 0; i < size; i++) {
-            uint16_t depthValue = *(reinterpret_cast<const uint16_t*>(depthData + i * 2));
-            depthDataFloat[i] = static_cast<float>(depthValue);  // will multiply by scale in shader
-        }
+        depthDataFloat.resize(size);
+        depthToFloat(reinterpret_cast<const uint16_t*>(depthData), depthDataFloat.data(), size);
 
         // Intrinsics: [fx, fy, cx, cy, scale, width, height]
         std::vector<float> intrinsics = {fx, fy, cx, cy, scale, static_cast<float>(width), static_cast<float>(height)};
@@ -134,7 +473,7 @@ class RGBD::Impl {
         if(!tensorsInitialized) {
             depthTensor = mgr->tensor(depthDataFloat);
             intrinsicsTensor = mgr->tensor(intrinsics);
-            xyzTensor = mgr->tensor(xyzOut);
+            xyzTensor = mgr->tensor(std::vector<float>(size * 3));
             tensorsInitialized = true;
         } else {
             depthTensor->setData(depthDataFloat);
@@ -149,78 +488,117 @@ class RGBD::Impl {
         }
         mgr->sequence()->record<kp::OpSyncDevice>(tensors)->record<kp::OpAlgoDispatch>(algo)->record<kp::OpSyncLocal>(tensors)->eval();
         // Retrieve results
-        xyzOut = xyzTensor->vector<float>();
+        const auto xyzOut = xyzTensor->vector<float>();
+        const PointDst dst = getDst(out, 0);
+        ChunkResult result;
         for(int i = 0; i < size; i++) {
-            Point3fRGBA p;
-            p.x = xyzOut[i * 3 + 0];
-            p.y = xyzOut[i * 3 + 1];
-            p.z = xyzOut[i * 3 + 2];
-            p.r = colorData[i * 3 + 0];
-            p.g = colorData[i * 3 + 1];
-            p.b = colorData[i * 3 + 2];
-            points.emplace_back(p);
+            const float* p = xyzOut.data() + i * 3;
+            updateBounds(result.bounds, p[0], p[1], p[2]);
+            if(planar) {
+                storePoint<true>(dst, i, p[0], p[1], p[2], colorData + i * 3);
+            } else {
+                storePoint<false>(dst, i, p[0], p[1], p[2], colorData + i * 3);
+            }
         }
+        result.count = dropInvalid ? compactPoints(dst, 0, size, 0) : size;
+        chunks.assign(1, result);
+        return mergeChunks(out, bounds);
 #else
         (void)depthData;
         (void)colorData;
-        (void)points;
+        (void)out;
+        (void)bounds;
         throw std::runtime_error("Kompute not enabled in this build");
 #endif
     }
-    void calcPointsChunk(const uint8_t* depthData, const uint8_t* colorData, std::vector<Point3fRGBA>& outChunk, int startRow, int endRow) {
-        float scale = scaleFactor;
-        outChunk.reserve((endRow - startRow) * width);
-
-        for(int row = startRow; row < endRow; row++) {
-            int rowStart = row * width;
-            for(int col = 0; col < width; col++) {
-                size_t i = rowStart + col;
-
-                uint16_t depthValue = *(reinterpret_cast<const uint16_t*>(depthData + i * 2));
-                float z = static_cast<float>(depthValue) * scale;
-
-                float xCoord = (col - cx) * z / fx;
-                float yCoord = (row - cy) * z / fy;
-
-                // BGR order in colorData
-                uint8_t r = colorData[i * 3 + 0];
-                uint8_t g = colorData[i * 3 + 1];
-                uint8_t b = colorData[i * 3 + 2];
-
-                outChunk.push_back(Point3fRGBA{xCoord, yCoord, z, r, g, b});
+    PointDst getDst(uint8_t* out, size_t offset) const {
+        PointDst dst;
+        if(planar) {
+            auto* planes = reinterpret_cast<float*>(out);
+            dst.x = planes + offset;
+            dst.y = planes + size + offset;
+            dst.z = planes + 2 * size + offset;
+            dst.rgba = reinterpret_cast<uint32_t*>(planes + 3 * size) + offset;
+        } else {
+            dst.points = reinterpret_cast<Point3fRGBA*>(out) + offset;
+        }
+        return dst;
+    }
+    // Moves the valid points of [from, from + n) to index to onwards, returns the index past the last moved point
+    size_t compactPoints(const PointDst& dst, size_t from, size_t n, size_t to) const {
+        for(size_t i = from; i < from + n; i++) {
+            if(planar) {
+                if(dst.z[i] == 0.0f) continue;
+                dst.x[to] = dst.x[i];
+                dst.y[to] = dst.y[i];
+                dst.z[to] = dst.z[i];
+                dst.rgba[to] = dst.rgba[i];
+            } else {
+                if(dst.points[i].z == 0.0f) continue;
+                dst.points[to] = dst.points[i];
             }
+            to++;
         }
+        return to;
     }
-
-    void computePointCloudCPU(const uint8_t* depthData, const uint8_t* colorData, std::vector<Point3fRGBA>& points) {
-        // Single-threaded directly writes into points
-        calcPointsChunk(depthData, colorData, points, 0, height);
+    ChunkResult calcPointsChunk(const uint8_t* depthData, const uint8_t* colorData, uint8_t* out, int startRow, int endRow) const {
+        ChunkResult result;
+        result.offset = static_cast<size_t>(startRow) * width;
+        const auto* depth = reinterpret_cast<const uint16_t*>(depthData);
+        const PointDst dst = getDst(out, 0);
+        size_t next = result.offset;
+        for(int row = startRow; row < endRow; row++) {
+            const size_t rowStart = static_cast<size_t>(row) * width;
+            const PointRow src{depth + rowStart, colorData + rowStart * 3, rayX.data(), rayY[row], scaleFactor, width};
+            pointRowFn(src, getDst(out, rowStart), result.bounds);
+            // Compacted right away, while the row is still in cache
+            next = dropInvalid ? compactPoints(dst, rowStart, width, next) : next + width;
+        }
+        result.count = next - result.offset;
+        return result;
     }
-
-    void computePointCloudCPUMT(const uint8_t* depthData, const uint8_t* colorData, std::vector<Point3fRGBA>& points) {
-        int rowsPerThread = height / threadNum;
-        std::vector<std::future<std::vector<Point3fRGBA>>> futures;
-
-        // Each thread returns a local vector
-        auto processRows = [&](int startRow, int endRow) {
-            std::vector<Point3fRGBA> localPoints;
-            calcPointsChunk(depthData, colorData, localPoints, startRow, endRow);
-            return localPoints;
-        };
-
-        for(int t = 0; t < threadNum; ++t) {
-            int startRow = t * rowsPerThread;
-            int endRow = (t == threadNum - 1) ? height : (startRow + rowsPerThread);
-            futures.emplace_back(std::async(std::launch::async, processRows, startRow, endRow));
+    // Combines the chunk results, returns the number of points in the cloud
+    size_t mergeChunks(uint8_t* out, Bounds& bounds) const {
+        // Bounds always include the origin, where points without depth end up
+        bounds = {};
+        size_t total = 0;
+        for(const auto& chunk : chunks) {
+            total += chunk.count;
+            foldBounds(bounds, chunk.bounds.data(), chunk.bounds.data() + 3, 1);
         }
-
-        // Merge all results
-        for(auto& f : futures) {
-            auto localPoints = f.get();
-            // Now we do one lock per merge if needed
-            // If this is not called concurrently from multiple places, no lock needed
-            points.insert(points.end(), localPoints.begin(), localPoints.end());
+        if(!dropInvalid) return total;
+        // Each chunk was compacted in place, close the gaps between the chunks (and the planes).
+        // Points only ever move towards the start, so going in ascending order never overwrites one that wasn't moved yet
+        const size_t numPlanes = planar ? 4 : 1;
+        const size_t elementSize = planar ? sizeof(float) : sizeof(Point3fRGBA);
+        for(size_t plane = 0; plane < numPlanes; plane++) {
+            size_t next = plane * total;
+            for(const auto& chunk : chunks) {
+                std::memmove(out + next * elementSize, out + (plane * size + chunk.offset) * elementSize, chunk.count * elementSize);
+                next += chunk.count;
+            }
         }
+        return total;
+    }
+    size_t computePointCloudCPU(const uint8_t* depthData, const uint8_t* colorData, uint8_t* out, Bounds& bounds) {
+        chunks.assign(1, calcPointsChunk(depthData, colorData, out, 0, height));
+        return mergeChunks(out, bounds);
+    }
+    size_t computePointCloudCPUMT(const uint8_t* depthData, const uint8_t* colorData, uint8_t* out, Bounds& bounds) {
+        const int numChunks = std::max(1, std::min(threadNum, height));
+        const int rowsPerChunk = height / numChunks;
+        chunks.resize(numChunks);
+
+        // Rows are disjoint, so each chunk writes directly into its part of the output
+        utility::ThreadPool::shared().parallelFor(
+            numChunks,
+            [&](size_t t) {
+                const int startRow = static_cast<int>(t) * rowsPerChunk;
+                const int endRow = (static_cast<int>(t) == numChunks - 1) ? height : (startRow + rowsPerChunk);
+                chunks[t] = calcPointsChunk(depthData, colorData, out, startRow, endRow);
+            },
+            threadNum);
+        return mergeChunks(out, bounds);
     }
     enum class ComputeMethod { CPU, CPU_MT, GPU };
     ComputeMethod computeMethod = ComputeMethod::CPU;
@@ -232,6 +610,8 @@ class RGBD::Impl {
     std::shared_ptr<kp::Tensor> intrinsicsTensor;
     std::shared_ptr<kp::Tensor> xyzTensor;
     std::vector<std::shared_ptr<kp::Memory>> tensors;
+    std::vector<float> depthDataFloat;
+    DepthToFloatFn depthToFloat = getDepthToFloatFn();
     bool algoInitialized = false;
     bool tensorsInitialized = false;
 #endif
@@ -239,8 +619,14 @@ class RGBD::Impl {
     float fx, fy, cx, cy;
     int width, height;
     int size;
+    std::vector<float> rayX;
+    std::vector<float> rayY;
     bool intrinsicsSet = false;
     int threadNum = 2;
+    bool dropInvalid = false;
+    bool planar = false;
+    PointRowFn pointRowFn = getPointRowFn(false);
+    std::vector<ChunkResult> chunks;
 };
 
 RGBD::RGBD() = default;
@@ -370,35 +756,32 @@ void RGBD::run() {
             auto height = colorFrame->getHeight();
             pc->setSize(width, height);
 
-            std::vector<Point3fRGBA> points;
-            // Fill the point cloud
+            // Fill the point cloud, directly in the output buffer
+            const size_t numPoints = pimpl->getSize();
+            std::shared_ptr<VectorMemory> pointsData;
+            if(pointCloudPool) {
+                pointsData = pointCloudPool->acquire(numPoints * sizeof(Point3fRGBA));
+            } else {
+                pointsData = std::make_shared<VectorMemory>(std::vector<uint8_t>(numPoints * sizeof(Point3fRGBA)));
+            }
             auto* depthData = depthFrame->getData().data();
             auto* colorData = colorFrame->getData().data();
-            // Use GPU to compute point cloud
-            pimpl->computePointCloud(depthData, colorData, points);
-
-            float minX = 0.0;
-            float minY = 0.0;
-            float minZ = 0.0;
-            float maxX = 0.0;
-            float maxY = 0.0;
-            float maxZ = 0.0;
-            for(const auto& p : points) {
-                minX = std::min(minX, p.x);
-                minY = std::min(minY, p.y);
-                minZ = std::min(minZ, p.z);
-                maxX = std::max(maxX, p.x);
-                maxY = std::max(maxY, p.y);
-                maxZ = std::max(maxZ, p.z);
-            }
-            pc->setMinX(minX);
-            pc->setMinY(minY);
-            pc->setMinZ(minZ);
-            pc->setMaxX(maxX);
-            pc->setMaxY(maxY);
-            pc->setMaxZ(maxZ);
-
-            pc->setPointsRGB(points);
+            Bounds bounds;
+            const size_t count = pimpl->computePointCloud(depthData, colorData, pointsData->data(), bounds);
+            // Shrinking keeps the capacity, so pooled buffers aren't reallocated
+            pointsData->setSize(count * sizeof(Point3fRGBA));
+
+            pc->setMinX(bounds[0]);
+            pc->setMinY(bounds[1]);
+            pc->setMinZ(bounds[2]);
+            pc->setMaxX(bounds[3]);
+            pc->setMaxY(bounds[4]);
+            pc->setMaxZ(bounds[5]);
+
+            pc->data = pointsData;
+            pc->setColor(true);
+            pc->setSparse(dropInvalidPoints);
+            pc->setPlanar(planarOutput);
             pc->setTimestamp(colorFrame->getTimestamp());
             pc->setTimestampDevice(colorFrame->getTimestampDevice());
             pc->setSequenceNum(colorFrame->getSequenceNum());
@@ -418,6 +801,15 @@ void RGBD::run() {
         }
     }
 }
+void RGBD::setNumFramesPool(int numFramesPool) {
+    pointCloudPool = numFramesPool > 0 ? MemoryPool::create(numFramesPool) : nullptr;
+}
+int RGBD::getNumFramesPool() const {
+    return pointCloudPool ? static_cast<int>(pointCloudPool->getCapacity()) : 0;
+}
+MemoryPool::Stats RGBD::getPoolStats() const {
+    return pointCloudPool ? pointCloudPool->getStats() : MemoryPool::Stats{};
+}
 void RGBD::setDepthUnit(StereoDepthConfig::AlgorithmControl::DepthUnit depthUnit) {
     pimpl->setDepthUnit(depthUnit);
 }
@@ -433,6 +825,20 @@ void RGBD::useGPU(uint32_t device) {
 void RGBD::printDevices() {
     pimpl->printDevices();
 }
+void RGBD::setDropInvalidPoints(bool drop) {
+    dropInvalidPoints = drop;
+    pimpl->setDropInvalidPoints(drop);
+}
+bool RGBD::getDropInvalidPoints() const {
+    return dropInvalidPoints;
+}
+void RGBD::setPlanarOutput(bool planar) {
+    planarOutput = planar;
+    pimpl->setPlanarOutput(planar);
+}
+bool RGBD::getPlanarOutput() const {
+    return planarOutput;
+}
 
 }  // namespace node
 }  // namespace dai
@@ -1,10 +1,13 @@
 #include "depthai/pipeline/node/host/Record.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 #include "depthai/config/config.hpp"
+#include "depthai/pipeline/Pipeline.hpp"
 #include "depthai/pipeline/datatype/DatatypeEnum.hpp"
 #include "depthai/pipeline/datatype/EncodedFrame.hpp"
 #include "depthai/pipeline/datatype/IMUData.hpp"
@@ -13,7 +16,9 @@
 #include "depthai/properties/VideoEncoderProperties.hpp"
 #include "depthai/utility/span.hpp"
 #include "pipeline/ThreadedNodeImpl.hpp"
+#include "utility/AsyncWriter.hpp"
 #include "utility/RecordReplayImpl.hpp"
+#include "utility/WorkStealingExecutor.hpp"
 
 #ifdef DEPTHAI_ENABLE_PROTOBUF
     #include "depthai/schemas/EncodedFrame.pb.h"
@@ -28,6 +33,56 @@ namespace node {
 
 using VideoCodec = dai::utility::VideoRecorder::VideoCodec;
 
+namespace {
+
+// Closes the asynchronous writer when run() exits, also by an exception, so no write outlives the recorders it uses
+struct WriterGuard {
+    std::shared_ptr<utility::AsyncWriter> writer;
+    std::shared_ptr<spdlog::async_logger> logger;
+
+    ~WriterGuard() {
+        if(!writer) return;
+        try {
+            writer->close();
+        } catch(const std::exception& ex) {
+            if(logger) logger->error("Failed to write the recording: {}", ex.what());
+        }
+    }
+};
+
+// Messages are converted and serialized on the pipeline's host executor, shared with the other writers and host nodes
+std::shared_ptr<utility::AsyncWriter> createWriter(Pipeline pipeline, size_t maxQueuedBytes, bool dropWhenFull) {
+    if(maxQueuedBytes == 0) return nullptr;
+    return std::make_shared<utility::AsyncWriter>(maxQueuedBytes, dropWhenFull, pipeline.impl()->getHostExecutor());
+}
+
+// Hands the message to the asynchronous writer if there is one, otherwise prepares and writes it right away.
+// bytes is the expected size of the prepared data, prepare returns the actual one
+void record(utility::AsyncWriter* writer, size_t bytes, std::function<size_t()> prepare, std::function<void()> write) {
+    if(writer) {
+        writer->push(bytes, std::move(prepare), std::move(write));
+    } else {
+        prepare();
+        write();
+    }
+}
+
+RecordWriterStats getStats(const std::shared_ptr<utility::AsyncWriter>& writer) {
+    RecordWriterStats stats;
+    if(writer) {
+        const auto writerStats = writer->getStats();
+        stats.queuedBytes = writerStats.queuedBytes;
+        stats.maxQueuedBytes = writerStats.maxQueuedBytes;
+        stats.writtenBytes = writerStats.writtenBytes;
+        stats.writtenMessages = writerStats.writtenMessages;
+        stats.droppedBytes = writerStats.droppedBytes;
+        stats.droppedMessages = writerStats.droppedMessages;
+    }
+    return stats;
+}
+
+}  // namespace
+
 void RecordVideo::run() {
 #ifdef DEPTHAI_ENABLE_PROTOBUF
     auto& logger = pimpl->logger;
@@ -46,6 +101,10 @@ void RecordVideo::run() {
     }
     bool recordMetadata = !recordMetadataFile.empty();
 
+    auto asyncWriter = createWriter(getParentPipeline(), asyncWriteQueueSize, asyncWriteDropWhenFull);
+    std::atomic_store(&writer, asyncWriter);
+    WriterGuard writerGuard{asyncWriter, logger};
+
     DatatypeEnum streamType = DatatypeEnum::ADatatype;
     unsigned int width = 0;
     unsigned int height = 0;
@@ -104,32 +163,61 @@ void RecordVideo::run() {
                 }
             }
             if(i >= fpsInitLength - 1) {
-                auto data = msg->getData();
                 if(streamType == DatatypeEnum::ImgFrame) {
     #ifdef DEPTHAI_HAVE_OPENCV_SUPPORT
+                    struct Prepared {
+                        cv::Mat frame;
+                        std::vector<uint8_t> metadata;
+                    };
                     auto imgFrame = std::dynamic_pointer_cast<ImgFrame>(msg);
-                    auto frame = imgFrame->getCvFrame();
-                    bool isGrayscale = imgFrame->getType() == ImgFrame::Type::GRAY8 || imgFrame->getType() == ImgFrame::Type::GRAYF16
-                                       || (ImgFrame::Type::RAW16 <= imgFrame->getType() && imgFrame->getType() <= ImgFrame::Type::RAW8);
-                    if(isGrayscale) {
-                        cv::cvtColor(frame, frame, cv::COLOR_GRAY2BGR);
-                    }
-                    assert(frame.isContinuous());
-                    span cvData(frame.data, frame.total() * frame.elemSize());
-                    videoRecorder->write(cvData, frame.step);
-                    if(recordMetadata) {
-                        byteRecorder.write(imgFrame->serializeProto(true));
-                    }
+                    auto prepared = std::make_shared<Prepared>();
+                    // Written as a BGR frame
+                    record(
+                        asyncWriter.get(),
+                        static_cast<size_t>(imgFrame->getWidth()) * imgFrame->getHeight() * 3,
+                        [imgFrame, prepared, recordMetadata]() {
+                            prepared->frame = imgFrame->getCvFrame();
+                            bool isGrayscale = imgFrame->getType() == ImgFrame::Type::GRAY8 || imgFrame->getType() == ImgFrame::Type::GRAYF16
+                                               || (ImgFrame::Type::RAW16 <= imgFrame->getType() && imgFrame->getType() <= ImgFrame::Type::RAW8);
+                            if(isGrayscale) {
+                                cv::cvtColor(prepared->frame, prepared->frame, cv::COLOR_GRAY2BGR);
+                            }
+                            if(recordMetadata) {
+                                prepared->metadata = imgFrame->serializeProto(true);
+                            }
+                            return prepared->frame.total() * prepared->frame.elemSize() + prepared->metadata.size();
+                        },
+                        [&videoRecorder, &byteRecorder, prepared, recordMetadata]() {
+                            auto& frame = prepared->frame;
+                            assert(frame.isContinuous());
+                            span cvData(frame.data, frame.total() * frame.elemSize());
+                            videoRecorder->write(cvData, frame.step);
+                            if(recordMetadata) {
+                                byteRecorder.write(prepared->metadata);
+                            }
+                        });
     #else
                     throw std::runtime_error("RecordVideo node requires OpenCV support");
     #endif
                 } else {
-                    videoRecorder->write(data);
-                    if(recordMetadata) {
-                        auto encFrame = std::dynamic_pointer_cast<EncodedFrame>(msg);
-                        auto imgFrame = encFrame->getImgFrameMeta();
-                        byteRecorder.write(imgFrame.serializeProto(true));
-                    }
+                    auto encFrame = std::dynamic_pointer_cast<EncodedFrame>(msg);
+                    auto metadata = std::make_shared<std::vector<uint8_t>>();
+                    record(
+                        asyncWriter.get(),
+                        encFrame->getData().size(),
+                        [encFrame, metadata, recordMetadata]() {
+                            if(recordMetadata) {
+                                *metadata = encFrame->getImgFrameMeta().serializeProto(true);
+                            }
+                            return encFrame->getData().size() + metadata->size();
+                        },
+                        [&videoRecorder, &byteRecorder, encFrame, metadata, recordMetadata]() {
+                            auto data = encFrame->getData();
+                            videoRecorder->write(data);
+                            if(recordMetadata) {
+                                byteRecorder.write(*metadata);
+                            }
+                        });
                 }
             }
             if(i < fpsInitLength) ++i;
@@ -138,6 +226,7 @@ void RecordVideo::run() {
         }
     }
 
+    if(asyncWriter) asyncWriter->close();
     videoRecorder->close();
 #else
     throw std::runtime_error("RecordVideo node requires protobuf support");
@@ -149,6 +238,10 @@ void RecordMetadataOnly::run() {
     auto& logger = pimpl->logger;
     utility::ByteRecorder byteRecorder;
 
+    auto asyncWriter = createWriter(getParentPipeline(), asyncWriteQueueSize, asyncWriteDropWhenFull);
+    std::atomic_store(&writer, asyncWriter);
+    WriterGuard writerGuard{asyncWriter, logger};
+
     DatatypeEnum streamType = DatatypeEnum::ADatatype;
     while(isRunning()) {
         auto msg = input.get<dai::Buffer>();
@@ -175,8 +268,18 @@ void RecordMetadataOnly::run() {
         if(serializable == nullptr) {
             throw std::runtime_error("RecordMetadataOnly unsupported message type");
         }
-        byteRecorder.write(serializable->serializeProto());
+        auto data = std::make_shared<std::vector<uint8_t>>();
+        record(
+            asyncWriter.get(),
+            msg->getData().size(),
+            [serializable, data]() {
+                *data = serializable->serializeProto();
+                return data->size();
+            },
+            [&byteRecorder, data]() { byteRecorder.write(*data); });
     }
+
+    if(asyncWriter) asyncWriter->close();
 #else
     throw std::runtime_error("RecordMetadataOnly node requires protobuf support");
 #endif
@@ -204,6 +307,20 @@ RecordVideo& RecordVideo::setCompressionLevel(CompressionLevel compressionLevel)
     this->compressionLevel = compressionLevel;
     return *this;
 }
+RecordVideo& RecordVideo::setAsyncWrite(size_t maxQueuedBytes, bool dropWhenFull) {
+    this->asyncWriteQueueSize = maxQueuedBytes;
+    this->asyncWriteDropWhenFull = dropWhenFull;
+    return *this;
+}
+size_t RecordVideo::getAsyncWriteQueueSize() const {
+    return asyncWriteQueueSize;
+}
+bool RecordVideo::getAsyncWriteDropWhenFull() const {
+    return asyncWriteDropWhenFull;
+}
+RecordWriterStats RecordVideo::getWriterStats() const {
+    return getStats(std::atomic_load(&writer));
+}
 
 std::filesystem::path RecordMetadataOnly::getRecordFile() const {
     return recordFile;
@@ -220,6 +337,20 @@ RecordMetadataOnly& RecordMetadataOnly::setCompressionLevel(CompressionLevel com
     this->compressionLevel = compressionLevel;
     return *this;
 }
+RecordMetadataOnly& RecordMetadataOnly::setAsyncWrite(size_t maxQueuedBytes, bool dropWhenFull) {
+    this->asyncWriteQueueSize = maxQueuedBytes;
+    this->asyncWriteDropWhenFull = dropWhenFull;
+    return *this;
+}
+size_t RecordMetadataOnly::getAsyncWriteQueueSize() const {
+    return asyncWriteQueueSize;
+}
+bool RecordMetadataOnly::getAsyncWriteDropWhenFull() const {
+    return asyncWriteDropWhenFull;
+}
+RecordWriterStats RecordMetadataOnly::getWriterStats() const {
+    return getStats(std::atomic_load(&writer));
+}
 
 }  // namespace node
 }  // namespace dai
@@ -4,16 +4,21 @@
 #include "depthai/pipeline/datatype/EncodedFrame.hpp"
 #include "depthai/pipeline/datatype/PointCloudData.hpp"
 #define _USE_MATH_DEFINES
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdio>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 
 #include "depthai/pipeline/datatype/IMUData.hpp"
 #include "depthai/pipeline/datatype/ImgFrame.hpp"
 #include "depthai/pipeline/node/host/Replay.hpp"
 #include "pipeline/ThreadedNodeImpl.hpp"
+#include "utility/Prefetcher.hpp"
 #include "utility/RecordReplayImpl.hpp"
 
 #ifdef DEPTHAI_ENABLE_PROTOBUF
@@ -31,12 +36,20 @@ namespace node {
 
 #ifdef DEPTHAI_ENABLE_PROTOBUF
 // Video Message
-inline std::shared_ptr<Buffer> getVideoMessage(const proto::img_frame::ImgFrame& metadata, ImgFrame::Type outFrameType, std::vector<uint8_t>& frame) {
+inline std::shared_ptr<Buffer> getVideoMessage(const proto::img_frame::ImgFrame& metadata,
+                                               ImgFrame::Type outFrameType,
+                                               std::vector<uint8_t>& frame,
+                                               MemoryPool* pool = nullptr,
+                                               size_t pooledSize = 0) {
     auto imgFrame = std::make_shared<ImgFrame>();
     utility::setProtoMessage(*imgFrame, &metadata, true);
 
     assert(frame.size() == imgFrame->getWidth() * imgFrame->getHeight() * 3);
     cv::Mat img(imgFrame->getHeight(), imgFrame->getWidth(), CV_8UC3, frame.data());
+    // setCvFrame converts directly into the existing buffer if it is large enough
+    if(pool != nullptr && pooledSize > 0) {
+        imgFrame->data = pool->acquire(pooledSize);
+    }
     imgFrame->setCvFrame(img, outFrameType);
     return std::dynamic_pointer_cast<Buffer>(imgFrame);
 }
@@ -162,6 +175,39 @@ inline std::shared_ptr<google::protobuf::Message> getProtoMessage(utility::ByteP
     }
     return {};
 }
+
+template <typename T>
+std::int64_t parseSequenceNum(const mcap::Message& message) {
+    T proto;
+    if(!proto.ParseFromArray(reinterpret_cast<const char*>(message.data), message.dataSize)) {
+        throw std::runtime_error("Failed to parse protobuf message");
+    }
+    return proto.sequencenum();
+}
+
+// Reads the sequence number of a recorded message, used to search the recording
+inline std::function<std::int64_t(const mcap::Message&)> getSequenceNumParser(DatatypeEnum datatype) {
+    if(datatype == DatatypeEnum::ImgFrame) return parseSequenceNum<proto::img_frame::ImgFrame>;
+    if(datatype == DatatypeEnum::EncodedFrame) return parseSequenceNum<proto::encoded_frame::EncodedFrame>;
+    if(datatype == DatatypeEnum::IMUData) return parseSequenceNum<proto::imu_data::IMUData>;
+    if(datatype == DatatypeEnum::PointCloudData) return parseSequenceNum<proto::point_cloud_data::PointCloudData>;
+    throw std::runtime_error("Cannot seek in message type: " + std::to_string((int)datatype));
+}
+
+struct SeekRequest {
+    std::optional<std::chrono::nanoseconds> timestamp;
+    std::optional<std::int64_t> sequenceNum;
+};
+
+// Takes the seek requested since the last call, if any
+inline std::optional<SeekRequest> takeSeek(std::mutex& mtx, std::optional<std::chrono::nanoseconds>& timestamp, std::optional<std::int64_t>& sequenceNum) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if(!timestamp.has_value() && !sequenceNum.has_value()) return std::nullopt;
+    SeekRequest request{timestamp, sequenceNum};
+    timestamp.reset();
+    sequenceNum.reset();
+    return request;
+}
 #endif
 
 void ReplayVideo::run() {
@@ -195,61 +241,88 @@ void ReplayVideo::run() {
     if(!hasVideo) {
         throw std::runtime_error("Video file not found or could not be opened");
     }
+    if(hasMetadata && datatype != DatatypeEnum::ImgFrame) {
+        throw std::runtime_error("Invalid message type, expected ImgFrame");
+    }
+
+    struct Frame {
+        std::shared_ptr<proto::img_frame::ImgFrame> metadata;
+        std::vector<uint8_t> data;
+    };
+    // Reads the metadata and the video frame together, until either of the files ends
+    utility::Prefetcher<Frame> prefetcher(prefetchSize, [&]() -> std::optional<Frame> {
+        Frame frame;
+        if(hasMetadata) {
+            auto msg = getProtoMessage(bytePlayer, datatype);
+            if(msg == nullptr) return std::nullopt;
+            frame.metadata = std::dynamic_pointer_cast<proto::img_frame::ImgFrame>(msg);
+        }
+        auto data = videoPlayer.next();
+        if(!data.has_value()) return std::nullopt;
+        frame.data = std::move(data.value());
+        return frame;
+    });
+
     bool first = true;
+    // Nothing was read or seeked to yet, an empty replay at this point means there are no frames at all
+    bool started = false;
+    bool restarted = false;
+    size_t pooledFrameSize = 0;
     auto start = std::chrono::steady_clock::now();
     uint64_t index = 0;
     auto loopStart = std::chrono::steady_clock::now();
     auto prevMsgTs = loopStart;
     while(isRunning()) {
-        std::shared_ptr<proto::img_frame::ImgFrame> metadata;
-        std::vector<uint8_t> frame;
-        if(hasMetadata) {
-            if(datatype != DatatypeEnum::ImgFrame) {
-                throw std::runtime_error("Invalid message type, expected ImgFrame");
-            }
-            auto msg = getProtoMessage(bytePlayer, datatype);
-            if(msg != nullptr) {
-                metadata = std::dynamic_pointer_cast<proto::img_frame::ImgFrame>(msg);
-            } else if(!first) {
-                // End of file
-                if(loop) {
-                    bytePlayer.restart();
-                    if(hasVideo) {
-                        videoPlayer.restart();
+        if(auto request = takeSeek(seekMtx, seekTimestamp, seekSequenceNum)) {
+            prefetcher.reposition([&]() {
+                if(hasMetadata) {
+                    if(request->timestamp.has_value()) {
+                        bytePlayer.seek(request->timestamp.value());
+                    } else {
+                        bytePlayer.seekToSequenceNum(request->sequenceNum.value(), getSequenceNumParser(datatype));
+                    }
+                    // Metadata messages and video frames are recorded in pairs
+                    auto position = bytePlayer.position();
+                    if(position.has_value()) videoPlayer.seekToFrame(position.value());
+                } else {
+                    // Without metadata the sequence numbers are the frame indices
+                    if(request->timestamp.has_value()) {
+                        videoPlayer.seekToTime(request->timestamp.value());
+                    } else {
+                        videoPlayer.seekToFrame(std::max<std::int64_t>(request->sequenceNum.value(), 0));
                     }
-                    continue;
                 }
-                break;
-            } else {
-                hasMetadata = false;
-            }
+                // Keep the frame counter in step with the video, whichever file was searched
+                index = videoPlayer.position();
+            });
+            first = true;
+            started = true;
+            restarted = false;
         }
-        if(hasVideo) {
-            auto msg = videoPlayer.next();
-            if(msg.has_value()) {
-                frame = msg.value();
-            } else if(!first) {
-                // End of file
-                if(loop) {
+
+        auto next = prefetcher.next();
+        if(!next.has_value()) {
+            if(!started) {
+                throw std::runtime_error("Video file not found");
+            }
+            // End of file, a restart which gives nothing more ends the replay as well
+            if(loop && !restarted) {
+                prefetcher.reposition([&]() {
                     if(hasMetadata) {
                         bytePlayer.restart();
                     }
                     videoPlayer.restart();
-                    continue;
-                }
-                break;
-            } else {
-                hasVideo = false;
+                    index = 0;
+                });
+                first = true;
+                restarted = true;
+                continue;
             }
-        }
-
-        if(!hasMetadata && !hasVideo) {
             break;
         }
-
-        if(!hasVideo) {
-            throw std::runtime_error("Video file not found");
-        }
+        started = true;
+        restarted = false;
+        auto metadata = next->metadata;
 
         if(!hasMetadata) {
             ImgFrame frame;
@@ -270,19 +343,24 @@ void ReplayVideo::run() {
             metadata->mutable_fb()->set_height(std::get<1>(size.value()));
         }
 
-        auto buffer = getVideoMessage(*metadata, outFrameType, frame);
+        // Converted frame size is constant for the whole replay, so it's taken from the first frame
+        auto buffer = getVideoMessage(*metadata, outFrameType, next->data, framePool.get(), pooledFrameSize);
+        if(framePool && pooledFrameSize == 0) {
+            pooledFrameSize = buffer->getData().size();
+        }
 
         if(first) prevMsgTs = buffer->getTimestampDevice();
 
-        if(hasMetadata && !(fps.has_value() && fps.value() > 0.1f)) {
+        const bool fixedFps = !maxSpeed && fps.has_value() && fps.value() > 0.1f;
+        if(hasMetadata && !maxSpeed && !fixedFps) {
             std::this_thread::sleep_until(loopStart + (buffer->getTimestampDevice() - prevMsgTs));
         }
 
         if(buffer) out.send(buffer);
 
-        if(fps.has_value() && fps.value() > 0.1f) {
+        if(fixedFps) {
             std::this_thread::sleep_until(loopStart + std::chrono::milliseconds((uint32_t)roundf(1000.f / fps.value())));
-        } else if(!hasMetadata) {
+        } else if(!hasMetadata && !maxSpeed) {
             std::this_thread::sleep_until(loopStart + std::chrono::milliseconds(1000 / 30));
         }
 
@@ -324,39 +402,64 @@ void ReplayMetadataOnly::run() {
     if(!hasMetadata) {
         throw std::runtime_error("Metadata file not found");
     }
+    if(!utility::deserializationSupported(datatype)) {
+        throw std::runtime_error("Invalid message type. Cannot replay");
+    }
+
+    utility::Prefetcher<std::shared_ptr<Buffer>> prefetcher(prefetchSize, [&]() -> std::optional<std::shared_ptr<Buffer>> {
+        auto metadata = getProtoMessage(bytePlayer, datatype);
+        if(metadata == nullptr) return std::nullopt;
+        return getMessage(metadata, datatype);
+    });
+
     bool first = true;
+    // Nothing was read or seeked to yet, an empty replay at this point means there are no messages at all
+    bool started = false;
+    bool restarted = false;
     auto loopStart = std::chrono::steady_clock::now();
     auto prevMsgTs = loopStart;
     while(isRunning()) {
-        std::shared_ptr<google::protobuf::Message> metadata;
-        std::vector<uint8_t> frame;
-        if(!utility::deserializationSupported(datatype)) {
-            throw std::runtime_error("Invalid message type. Cannot replay");
+        if(auto request = takeSeek(seekMtx, seekTimestamp, seekSequenceNum)) {
+            prefetcher.reposition([&]() {
+                if(request->timestamp.has_value()) {
+                    bytePlayer.seek(request->timestamp.value());
+                } else {
+                    bytePlayer.seekToSequenceNum(request->sequenceNum.value(), getSequenceNumParser(datatype));
+                }
+            });
+            first = true;
+            started = true;
+            restarted = false;
         }
-        auto msg = getProtoMessage(bytePlayer, datatype);
-        if(msg != nullptr) {
-            metadata = msg;
-        } else if(!first) {
-            // End of file
-            if(loop) {
-                bytePlayer.restart();
+
+        auto next = prefetcher.next();
+        if(!next.has_value()) {
+            if(!started) {
+                throw std::runtime_error("Metadata file contains no messages");
+            }
+            // End of file, a restart which gives nothing more ends the replay as well
+            if(loop && !restarted) {
+                prefetcher.reposition([&]() { bytePlayer.restart(); });
+                first = true;
+                restarted = true;
                 continue;
             }
             break;
-        } else {
-            throw std::runtime_error("Metadata file contains no messages");
         }
-        auto buffer = getMessage(metadata, datatype);
+        started = true;
+        restarted = false;
+        auto buffer = next.value();
 
         if(first) prevMsgTs = buffer->getTimestampDevice();
 
-        if(!(fps.has_value() && fps.value() > 0.1f)) {
+        const bool fixedFps = !maxSpeed && fps.has_value() && fps.value() > 0.1f;
+        if(!maxSpeed && !fixedFps) {
             std::this_thread::sleep_until(loopStart + (buffer->getTimestampDevice() - prevMsgTs));
         }
 
         if(buffer) out.send(buffer);
 
-        if(fps.has_value() && fps.value() > 0.1f) {
+        if(fixedFps) {
             std::this_thread::sleep_until(loopStart + std::chrono::milliseconds((uint32_t)roundf(1000.f / fps.value())));
         }
 
@@ -394,6 +497,14 @@ std::tuple<int, int> ReplayVideo::getSize() const {
     return size.value_or(std::make_tuple(0, 0));
 }
 
+int ReplayVideo::getNumFramesPool() const {
+    return framePool ? static_cast<int>(framePool->getCapacity()) : 0;
+}
+
+MemoryPool::Stats ReplayVideo::getPoolStats() const {
+    return framePool ? framePool->getStats() : MemoryPool::Stats{};
+}
+
 float ReplayVideo::getFps() const {
     return fps.value_or(0.0f);
 }
@@ -433,6 +544,36 @@ ReplayVideo& ReplayVideo::setLoop(bool loop) {
     return *this;
 }
 
+ReplayVideo& ReplayVideo::setNumFramesPool(int numFramesPool) {
+    framePool = numFramesPool > 0 ? MemoryPool::create(numFramesPool) : nullptr;
+    return *this;
+}
+
+void ReplayVideo::seek(std::chrono::nanoseconds timestamp) {
+    std::lock_guard<std::mutex> lock(seekMtx);
+    seekTimestamp = timestamp;
+    seekSequenceNum.reset();
+}
+void ReplayVideo::seekToSequenceNum(std::int64_t sequenceNum) {
+    std::lock_guard<std::mutex> lock(seekMtx);
+    seekSequenceNum = sequenceNum;
+    seekTimestamp.reset();
+}
+bool ReplayVideo::getMaxSpeed() const {
+    return maxSpeed;
+}
+int ReplayVideo::getPrefetchSize() const {
+    return prefetchSize;
+}
+ReplayVideo& ReplayVideo::setMaxSpeed(bool maxSpeed) {
+    this->maxSpeed = maxSpeed;
+    return *this;
+}
+ReplayVideo& ReplayVideo::setPrefetchSize(int prefetchSize) {
+    this->prefetchSize = std::max(prefetchSize, 0);
+    return *this;
+}
+
 std::filesystem::path ReplayMetadataOnly::getReplayFile() const {
     return replayFile;
 }
@@ -456,5 +597,30 @@ ReplayMetadataOnly& ReplayMetadataOnly::setLoop(bool loop) {
     return *this;
 }
 
+void ReplayMetadataOnly::seek(std::chrono::nanoseconds timestamp) {
+    std::lock_guard<std::mutex> lock(seekMtx);
+    seekTimestamp = timestamp;
+    seekSequenceNum.reset();
+}
+void ReplayMetadataOnly::seekToSequenceNum(std::int64_t sequenceNum) {
+    std::lock_guard<std::mutex> lock(seekMtx);
+    seekSequenceNum = sequenceNum;
+    seekTimestamp.reset();
+}
+bool ReplayMetadataOnly::getMaxSpeed() const {
+    return maxSpeed;
+}
+int ReplayMetadataOnly::getPrefetchSize() const {
+    return prefetchSize;
+}
+ReplayMetadataOnly& ReplayMetadataOnly::setMaxSpeed(bool maxSpeed) {
+    this->maxSpeed = maxSpeed;
+    return *this;
+}
+ReplayMetadataOnly& ReplayMetadataOnly::setPrefetchSize(int prefetchSize) {
+    this->prefetchSize = std::max(prefetchSize, 0);
+    return *this;
+}
+
 }  // namespace node
 }  // namespace dai
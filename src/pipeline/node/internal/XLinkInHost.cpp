@@ -47,8 +47,10 @@ void XLinkInHost::run() {
                 if(std::dynamic_pointer_cast<MessageGroup>(msg) != nullptr) {
                     auto msgGrp = std::static_pointer_cast<MessageGroup>(msg);
                     for(auto& msg : msgGrp->group) {
+                        // Framed groups arrive with their members already parsed
+                        if(msg.second != nullptr) continue;
                         auto dpacket = stream.readMove();
-                        msg.second = StreamMessageParser::parseMessage(&dpacket);
+                        msg.second = StreamMessageParser::parseMessage(std::move(dpacket));
                     }
                 }
                 const auto t2Parse = std::chrono::steady_clock::now();
@@ -9,12 +9,33 @@
 
 // libraries
 #include "depthai/pipeline/datatype/MessageGroup.hpp"
+#include "depthai/pipeline/datatype/PointCloudData.hpp"
+#include "utility/Environment.hpp"
 #include "utility/Logging.hpp"
 #include "utility/SharedMemory.hpp"
 
 namespace dai {
 namespace node {
 namespace internal {
+
+// Planar point clouds are a host side layout only, the device receives the points interleaved
+static std::shared_ptr<ADatatype> toDeviceLayout(const std::shared_ptr<ADatatype>& message) {
+    if(auto pointCloud = std::dynamic_pointer_cast<PointCloudData>(message)) {
+        return pointCloud->isPlanar() ? pointCloud->getInterleaved() : message;
+    }
+    if(auto msgGroup = std::dynamic_pointer_cast<MessageGroup>(message)) {
+        std::shared_ptr<MessageGroup> converted;
+        for(const auto& member : msgGroup->group) {
+            auto memberOut = toDeviceLayout(member.second);
+            if(memberOut == member.second) continue;
+            // Members are shared with other receivers of the group, only the copy is changed
+            if(!converted) converted = std::make_shared<MessageGroup>(*msgGroup);
+            converted->group[member.first] = std::move(memberOut);
+        }
+        if(converted) return converted;
+    }
+    return message;
+}
 // XLinkInHost::XLinkInHost(std::shared_ptr<XLinkConnection> conn, std::string streamName) : conn(std::move(conn)), streamName(std::move(streamName)){};
 
 void XLinkOutHost::setStreamName(const std::string& name) {
@@ -40,6 +61,8 @@ void XLinkOutHost::allowStreamResize(bool allow) {
 void XLinkOutHost::run() {
     // // Create a stream for the connection
     // TODO(Morato) - automatically increase the buffer size lazily
+    // Groups in a single packet need a peer which understands the framed format, off by default
+    const bool framedGroups = utility::getEnvAs<bool>("DEPTHAI_XLINK_FRAMED_GROUPS", false);
     bool reconnect = true;
     while(reconnect) {
         reconnect = false;
@@ -55,7 +78,27 @@ void XLinkOutHost::run() {
         };
         while(isRunning()) {
             try {
-                auto outgoing = in.get();
+                auto outgoing = toDeviceLayout(in.get());
+
+                if(framedGroups) {
+                    if(auto msgGroupPtr = std::dynamic_pointer_cast<MessageGroup>(outgoing)) {
+                        auto framed = StreamMessageParser::serializeFramedGroup(*msgGroupPtr);
+                        if(framed.size() > currentMaxSize) {
+                            increaseBufferSize(framed.size());
+                        }
+                        if(framed.largestPayload.empty()) {
+                            stream.write(framed.rest);
+                        } else {
+                            stream.write(framed.largestPayload, framed.rest);
+                        }
+                        logger::trace("Sent framed group message to device ({}) with {} messages, size: {}",
+                                      stream.getStreamName(),
+                                      msgGroupPtr->group.size(),
+                                      framed.size());
+                        continue;
+                    }
+                }
+
                 auto metadata = StreamMessageParser::serializeMetadata(outgoing);
 
                 using namespace std::chrono;
@@ -0,0 +1,129 @@
+#include "PreviewTransform.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "depthai/pipeline/datatype/EncodedFrame.hpp"
+#include "depthai/pipeline/datatype/ImageManipConfig.hpp"
+
+#ifdef DEPTHAI_HAVE_OPENCV_SUPPORT
+    #include <opencv2/imgcodecs.hpp>
+#endif
+
+namespace dai {
+
+static bool isGray(ImgFrame::Type type) {
+    return type == ImgFrame::Type::GRAY8 || type == ImgFrame::Type::RAW8;
+}
+
+PreviewTransform::PreviewTransform(const RemoteConnection::PreviewConfig& config) : config(config), manip(ImageManipProperties{}) {
+#ifndef DEPTHAI_HAVE_OPENCV_SUPPORT
+    throw std::runtime_error("RemoteConnection topic previews require OpenCV support");
+#endif
+    if(config.jpegQuality < 1 || config.jpegQuality > 100) {
+        throw std::invalid_argument("RemoteConnection preview JPEG quality must be between 1 and 100");
+    }
+}
+
+bool PreviewTransform::isSupported(ImgFrame::Type type) {
+    // 16 bit frames (eg. depth) are left to the visualization of the client
+    return type != ImgFrame::Type::RAW16 && impl::isTypeSupported(type);
+}
+
+std::shared_ptr<Buffer> PreviewTransform::apply(const std::shared_ptr<ImgFrame>& frame) {
+    const auto [width, height] = getPreviewSize(frame->getWidth(), frame->getHeight());
+    // JPEG encoding takes interleaved BGR or a single channel
+    const auto type = config.encodeJpeg && !isGray(frame->getType()) ? ImgFrame::Type::BGR888i : frame->getType();
+
+    auto preview = frame;
+    if(width != frame->getWidth() || height != frame->getHeight() || type != frame->getType()) {
+        preview = manipulate(*frame, width, height, type);
+    }
+    if(!config.encodeJpeg) return preview;
+    return encodeJpeg(*preview);
+}
+
+std::pair<unsigned int, unsigned int> PreviewTransform::getPreviewSize(unsigned int width, unsigned int height) const {
+    float scale = 1.0f;
+    if(config.maxWidth > 0 && width > config.maxWidth) scale = std::min(scale, static_cast<float>(config.maxWidth) / width);
+    if(config.maxHeight > 0 && height > config.maxHeight) scale = std::min(scale, static_cast<float>(config.maxHeight) / height);
+    if(scale == 1.0f) return {width, height};
+    // Even sizes keep the chroma planes of YUV frames aligned
+    const auto scaled = [scale](unsigned int size) { return std::max(2u, static_cast<unsigned int>(std::lround(size * scale)) & ~1u); };
+    return {scaled(width), scaled(height)};
+}
+
+std::shared_ptr<ImgFrame> PreviewTransform::manipulate(const ImgFrame& frame, unsigned int width, unsigned int height, ImgFrame::Type type) {
+    ImageManipConfig manipConfig;
+    manipConfig.setOutputSize(width, height, ImageManipConfig::ResizeMode::STRETCH);
+    manipConfig.setFrameType(type);
+    manip.build(manipConfig.base, manipConfig.outputFrameType, impl::getSrcFrameSpecs(frame.fb), frame.getType());
+
+    const auto outputSize = manip.getOutputSize();
+    if(!output || output.use_count() > 1) {
+        output = std::make_shared<impl::_ImageManipMemory>(outputSize);
+    } else {
+        output->setSize(outputSize);
+    }
+    auto src = std::make_shared<impl::_ImageManipMemory>(frame.data->getData());
+    if(!manip.apply(src, output)) {
+        throw std::runtime_error("Failed to create the preview frame");
+    }
+
+    auto preview = std::make_shared<ImgFrame>();
+    preview->data = output;
+    const auto outType = manip.getOutputFrameType();
+    const auto dstSpecs = manip.getOutputFrameSpecs(outType);
+    preview->sourceFb = frame.sourceFb;
+    preview->cam = frame.cam;
+    preview->instanceNum = frame.instanceNum;
+    preview->sequenceNum = frame.sequenceNum;
+    preview->tsDevice = frame.tsDevice;
+    preview->ts = frame.ts;
+    preview->category = frame.category;
+    preview->fb.height = dstSpecs.height;
+    preview->fb.width = dstSpecs.width;
+    preview->fb.stride = dstSpecs.p1Stride;
+    preview->fb.p1Offset = dstSpecs.p1Offset;
+    preview->fb.p2Offset = dstSpecs.p2Offset;
+    preview->fb.p3Offset = dstSpecs.p3Offset;
+    preview->setType(outType);
+    preview->transformation = frame.transformation;
+    preview->transformation.addTransformation(manip.getMatrix());
+    preview->transformation.setSize(dstSpecs.width, dstSpecs.height);
+    return preview;
+}
+
+std::shared_ptr<Buffer> PreviewTransform::encodeJpeg(const ImgFrame& frame) const {
+#ifdef DEPTHAI_HAVE_OPENCV_SUPPORT
+    const auto cvType = isGray(frame.getType()) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(static_cast<int>(frame.getHeight()), static_cast<int>(frame.getWidth()), cvType, frame.data->getData().data() + frame.fb.p1Offset, frame.getStride());
+    std::vector<uint8_t> jpeg;
+    cv::imencode(".jpg", image, jpeg, {cv::IMWRITE_JPEG_QUALITY, static_cast<int>(config.jpegQuality)});
+
+    auto encoded = std::make_shared<EncodedFrame>();
+    encoded->cam = frame.cam;
+    encoded->transformation = frame.transformation;
+    encoded->frameOffset = 0;
+    encoded->frameSize = static_cast<uint32_t>(jpeg.size());
+    encoded->setInstanceNum(frame.getInstanceNum())
+        .setSize(frame.getWidth(), frame.getHeight())
+        .setProfile(EncodedFrame::Profile::JPEG)
+        .setQuality(config.jpegQuality)
+        .setBitrate(0)
+        .setLossless(false)
+        .setFrameType(EncodedFrame::FrameType::I);
+    encoded->setData(std::move(jpeg));
+    encoded->setSequenceNum(frame.getSequenceNum());
+    encoded->setTimestamp(frame.getTimestamp());
+    encoded->setTimestampDevice(frame.getTimestampDevice());
+    return encoded;
+#else
+    (void)frame;
+    throw std::runtime_error("RemoteConnection topic previews require OpenCV support");
+#endif
+}
+
+}  // namespace dai
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "depthai/pipeline/datatype/Buffer.hpp"
+#include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "depthai/remote_connection/RemoteConnection.hpp"
+#include "depthai/utility/ImageManipImpl.hpp"
+
+namespace dai {
+
+/**
+ * Turns the frames of a RemoteConnection topic into a cheaper preview before they are serialized.
+ * Frames are downscaled with the host ImageManip implementation and optionally JPEG encoded.
+ */
+class PreviewTransform {
+   public:
+    /// Throws if the library was built without OpenCV support
+    explicit PreviewTransform(const RemoteConnection::PreviewConfig& config);
+
+    /// Whether frames of the given type are transformed, others are published as they are
+    static bool isSupported(ImgFrame::Type type);
+
+    /// Whether the previews are EncodedFrame messages
+    bool encodesJpeg() const {
+        return config.encodeJpeg;
+    }
+
+    /**
+     * Creates the preview of a frame
+     * @param frame Frame of a supported type
+     * @return The preview, an ImgFrame or an EncodedFrame when JPEG encoding is enabled
+     */
+    std::shared_ptr<Buffer> apply(const std::shared_ptr<ImgFrame>& frame);
+
+   private:
+    std::pair<unsigned int, unsigned int> getPreviewSize(unsigned int width, unsigned int height) const;
+    std::shared_ptr<ImgFrame> manipulate(const ImgFrame& frame, unsigned int width, unsigned int height, ImgFrame::Type type);
+    std::shared_ptr<Buffer> encodeJpeg(const ImgFrame& frame) const;
+
+    RemoteConnection::PreviewConfig config;
+    impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, impl::WarpTiled> manip;
+    // Reused once the previous preview was released
+    std::shared_ptr<impl::_ImageManipMemory> output;
+};
+
+}  // namespace dai
@@ -22,6 +22,18 @@ bool RemoteConnection::removeTopic(const std::string& topicName) {
     return impl->removeTopic(topicName);
 }
 
+void RemoteConnection::setTopicMaxRate(const std::string& topicName, float maxRate) {
+    impl->setTopicMaxRate(topicName, maxRate);
+}
+
+void RemoteConnection::setTopicPreview(const std::string& topicName, const PreviewConfig& config) {
+    impl->setTopicPreview(topicName, config);
+}
+
+RemoteConnection::TopicStats RemoteConnection::getTopicStats(const std::string& topicName) {
+    return impl->getTopicStats(topicName);
+}
+
 void RemoteConnection::registerPipeline(const Pipeline& pipeline) {
     impl->registerPipeline(pipeline);
 }
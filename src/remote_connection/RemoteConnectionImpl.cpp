@@ -11,7 +11,9 @@
 #include "depthai/pipeline/MessageQueue.hpp"
 #include "foxglove/websocket/common.hpp"
 #include "pipeline/datatype/Buffer.hpp"
+#include "pipeline/datatype/EncodedFrame.hpp"
 #include "pipeline/datatype/ImgAnnotations.hpp"
+#include "utility/Environment.hpp"
 #include "utility/ErrorMacros.hpp"
 #include "utility/Logging.hpp"
 #include "utility/ProtoSerializable.hpp"
@@ -19,6 +21,10 @@
 
 namespace dai {
 
+// Bounds the data queued for each client. When a client doesn't keep up, messages for it are dropped
+// until the buffer drains, so it resumes with the newest ones instead of falling behind
+constexpr size_t DEFAULT_SEND_BUFFER_LIMIT_BYTES = 32 * 1024 * 1024;
+
 inline static uint64_t nanosecondsSinceEpoch() {
     return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
 }
@@ -50,18 +56,25 @@ RemoteConnectionImpl::RemoteConnectionImpl(const std::string& address, uint16_t
     // Expose services
     exposeKeyPressedService();
     exposeTopicGroupsService();
+
+    publishThread = std::thread([this]() { publishLoop(); });
 }
 
 RemoteConnectionImpl::~RemoteConnectionImpl() {
+    {
+        std::lock_guard<std::mutex> lock(publishSignal->mtx);
+        publishSignal->stop = true;
+    }
+    publishSignal->cv.notify_one();
+    if(publishThread.joinable()) {
+        publishThread.join();
+    }
     for(auto& topicInfo : topics) {
         topicInfo.second.outputQueue->close();
     }
 
     server->stop();
 
-    for(auto& topicInfo : topics) {
-        topicInfo.second.thread->join();
-    }
     if(httpServer) {
         httpServer->stop();
     }
@@ -119,7 +132,7 @@ bool RemoteConnectionImpl::initWebsocketServer(const std::string& address, uint1
         }
     };
     foxglove::ServerOptions serverOptions;
-    serverOptions.sendBufferLimitBytes = 100 * 1024 * 1024;  // 100 MB
+    serverOptions.sendBufferLimitBytes = utility::getEnvAs<size_t>("DEPTHAI_REMOTE_CONNECTION_SEND_BUFFER_LIMIT", DEFAULT_SEND_BUFFER_LIMIT_BYTES);
     serverOptions.capabilities.emplace_back("services");
     serverOptions.supportedEncodings.emplace_back("json");
 
@@ -132,10 +145,15 @@ bool RemoteConnectionImpl::initWebsocketServer(const std::string& address, uint1
     hdlrs.subscribeHandler = [&](foxglove::ChannelId chanId, foxglove::ConnHandle clientHandle) {
         const auto clientStr = server->remoteEndpointString(clientHandle);
         logger::info("Client {} subscribed to {}", clientStr, chanId);
+        std::lock_guard<std::mutex> lock(subscribersMtx);
+        subscriberCounts[chanId]++;
     };
     hdlrs.unsubscribeHandler = [&](foxglove::ChannelId chanId, foxglove::ConnHandle clientHandle) {
         const auto clientStr = server->remoteEndpointString(clientHandle);
         logger::info("Client {} unsubscribed from {}", clientStr, chanId);
+        std::lock_guard<std::mutex> lock(subscribersMtx);
+        auto it = subscriberCounts.find(chanId);
+        if(it != subscriberCounts.end() && it->second > 0) it->second--;
     };
 
     hdlrs.serviceRequestHandler = [&](const foxglove::ServiceRequest& request, foxglove::ConnHandle clientHandle) {
@@ -162,112 +180,231 @@ bool RemoteConnectionImpl::initWebsocketServer(const std::string& address, uint1
     }
 }
 
-void RemoteConnectionImpl::addPublishThread(const std::string& topicName,
-                                            const std::shared_ptr<MessageQueue>& outputQueue,
-                                            const std::string& group,
-                                            bool useVisualizationIfAvailable) {
+void RemoteConnectionImpl::PublishSignal::notify() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        notified = true;
+    }
+    cv.notify_one();
+}
+
+void RemoteConnectionImpl::registerTopic(const std::string& topicName,
+                                         const std::shared_ptr<MessageQueue>& outputQueue,
+                                         const std::string& group,
+                                         bool useVisualizationIfAvailable) {
+    std::lock_guard<std::mutex> lock(topicsMtx);
     if(topics.find(topicName) != topics.end()) {
         logger::error("Topic named {} is already present", topicName);
         return;
     }
-    topics[topicName].outputQueue = outputQueue;
-    topics[topicName].group = group;
-    topics[topicName].thread = std::make_unique<std::thread>([this, topicName, outputQueue, group, useVisualizationIfAvailable]() {
-        bool isRunning = true;
-        std::shared_ptr<dai::Buffer> firstMessage = nullptr;
-        try {
-            firstMessage = outputQueue->get<dai::Buffer>();
-        } catch(const dai::MessageQueue::QueueException& ex) {
-            isRunning = false;
-            return;
-        } catch(const std::exception& ex) {
-            isRunning = false;
-            logger::error("Error while getting message from output queue for topic: {} - exception {}", topicName, ex.what());
-        }
+    auto& topic = topics[topicName];
+    topic.outputQueue = outputQueue;
+    topic.group = group;
+    topic.useVisualizationIfAvailable = useVisualizationIfAvailable;
+    // The sender only flags the publisher, it never waits on the clients
+    outputQueue->setPushListener([signal = publishSignal]() { signal->notify(); });
+}
 
-        if(!firstMessage) {
-            logger::error("No message received from the output for topic: {}", topicName);
-            return;
+void RemoteConnectionImpl::publishLoop() {
+    using Clock = std::chrono::steady_clock;
+    while(true) {
+        // Earliest time a topic held back by its rate limit can be published
+        std::optional<Clock::time_point> wakeUp;
+        std::vector<PublishJob> jobs;
+        {
+            std::lock_guard<std::mutex> lock(topicsMtx);
+            const auto now = Clock::now();
+            for(auto& [topicName, topic] : topics) {
+                std::vector<std::shared_ptr<ADatatype>> messages;
+                try {
+                    messages = topic.outputQueue->tryGetAll();
+                } catch(const MessageQueue::QueueException&) {
+                    continue;
+                }
+                // Only the newest message is published, older ones are skipped
+                topic.stats.receivedMessages += messages.size();
+                for(auto& message : messages) {
+                    if(topic.pending) topic.stats.skippedMessages++;
+                    topic.pending = std::move(message);
+                }
+                if(!topic.pending) continue;
+                if(topic.failed) {
+                    topic.pending.reset();
+                    topic.stats.skippedMessages++;
+                    continue;
+                }
+                if(topic.maxRate > 0.0f) {
+                    const auto nextPublish = topic.lastPublished + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(1.0f / topic.maxRate));
+                    if(now < nextPublish) {
+                        if(!wakeUp || nextPublish < *wakeUp) wakeUp = nextPublish;
+                        continue;
+                    }
+                }
+                topic.lastPublished = now;
+                auto message = std::move(topic.pending);
+                if(auto job = preparePublish(topicName, topic, message)) jobs.push_back(std::move(*job));
+            }
         }
-        if(!std::dynamic_pointer_cast<Buffer>(firstMessage)) {
-            logger::error("First message is not a Buffer message for topic: {}", topicName);
-            return;
+        // Previews and serialization take the longest, the topics can be changed meanwhile
+        std::vector<std::optional<size_t>> publishedSizes;
+        for(const auto& job : jobs) publishedSizes.push_back(publishMessage(job));
+        if(!jobs.empty()) {
+            std::lock_guard<std::mutex> lock(topicsMtx);
+            for(size_t i = 0; i < jobs.size(); i++) {
+                auto topicIterator = topics.find(jobs[i].topicName);
+                // Removed or advertised again in the meantime
+                if(topicIterator == topics.end() || topicIterator->second.id != jobs[i].channelId) continue;
+                auto& stats = topicIterator->second.stats;
+                if(publishedSizes[i]) {
+                    stats.publishedMessages++;
+                    stats.publishedBytes += *publishedSizes[i];
+                } else {
+                    stats.skippedMessages++;
+                }
+            }
         }
-        if(useVisualizationIfAvailable) {
-            firstMessage = getVisualizableMessage(std::dynamic_pointer_cast<Buffer>(firstMessage));
+
+        std::unique_lock<std::mutex> lock(publishSignal->mtx);
+        const auto woken = [this]() { return publishSignal->notified || publishSignal->stop; };
+        if(wakeUp) {
+            publishSignal->cv.wait_until(lock, *wakeUp, woken);
+        } else {
+            publishSignal->cv.wait(lock, woken);
         }
-        auto serializableMessage = std::dynamic_pointer_cast<ProtoSerializable>(firstMessage);
-        if(!serializableMessage) {
-            logger::error("First message is not a ProtoSerializable message for topic: {}", topicName);
-            return;
+        if(publishSignal->stop) return;
+        publishSignal->notified = false;
+    }
+}
+
+std::optional<RemoteConnectionImpl::PublishJob> RemoteConnectionImpl::preparePublish(const std::string& topicName,
+                                                                                     TopicData& topic,
+                                                                                     const std::shared_ptr<ADatatype>& message) {
+    auto buffer = std::dynamic_pointer_cast<Buffer>(message);
+    if(!buffer) {
+        logger::error("Message is not a Buffer message for topic: {}", topicName);
+        topic.failed = true;
+        topic.stats.skippedMessages++;
+        return std::nullopt;
+    }
+    if(topic.useVisualizationIfAvailable) {
+        buffer = getVisualizableMessage(buffer);
+    }
+    auto serializableMessage = std::dynamic_pointer_cast<ProtoSerializable>(buffer);
+    if(!serializableMessage) {
+        logger::error("Message is not a ProtoSerializable message for topic: {}", topicName);
+        // Without the first message there is no schema to advertise the channel with
+        if(!topic.id) topic.failed = true;
+        topic.stats.skippedMessages++;
+        return std::nullopt;
+    }
+    auto frame = topic.preview ? std::dynamic_pointer_cast<ImgFrame>(buffer) : nullptr;
+    if(frame && !PreviewTransform::isSupported(frame->getType())) frame = nullptr;
+
+    if(topic.readvertise) {
+        topic.readvertise = false;
+        if(topic.id) {
+            server->removeChannels({*topic.id});
+            std::lock_guard<std::mutex> lock(subscribersMtx);
+            subscriberCounts.erase(*topic.id);
+            topic.id.reset();
         }
-        const auto descriptor = serializableMessage->serializeSchema();
-
-        auto channelId = server->addChannels({{topicName, "protobuf", descriptor.schemaName, foxglove::base64Encode(descriptor.schema), std::nullopt}})[0];
-        topics[topicName].id = channelId;
-
-        while(isRunning) {
-            std::shared_ptr<ADatatype> message;
-            try {
-                message = outputQueue->get();
-            } catch(const dai::MessageQueue::QueueException& ex) {
-                isRunning = false;
-                continue;
-            } catch(const std::exception& ex) {
-                logger::error("Error while getting message from output queue for topic: {}", topicName);
-                isRunning = false;
-                continue;
-            }
-            if(!message) continue;
-            if(!std::dynamic_pointer_cast<Buffer>(message)) {
-                logger::error("First message is not a Buffer message for topic: {}", topicName);
-                return;
-            }
-            if(useVisualizationIfAvailable) {
-                message = getVisualizableMessage(std::dynamic_pointer_cast<Buffer>(message));
-            }
-            auto serializableMessage = std::dynamic_pointer_cast<ProtoSerializable>(message);
-            if(!serializableMessage) {
-                logger::error("Message is not a ProtoSerializable message for topic: {}", topicName);
-                continue;
-            }
+    }
+    if(!topic.id) {
+        // JPEG previews are advertised with the schema of the message they turn into
+        const auto descriptor = frame && topic.preview->encodesJpeg() ? EncodedFrame().serializeSchema() : serializableMessage->serializeSchema();
+        topic.id = server->addChannels({{topicName, "protobuf", descriptor.schemaName, foxglove::base64Encode(descriptor.schema), std::nullopt}})[0];
+    }
+    {
+        // Don't serialize for nobody
+        std::lock_guard<std::mutex> lock(subscribersMtx);
+        auto it = subscriberCounts.find(*topic.id);
+        if(it == subscriberCounts.end() || it->second == 0) {
+            topic.stats.skippedMessages++;
+            return std::nullopt;
+        }
+    }
+
+    return PublishJob{topicName, *topic.id, serializableMessage, frame, frame ? topic.preview : nullptr};
+}
 
-            auto serializedMsg = serializableMessage->serializeProto();
-            server->broadcastMessage(channelId, nanosecondsSinceEpoch(), static_cast<const uint8_t*>(serializedMsg.data()), serializedMsg.size());
+std::optional<size_t> RemoteConnectionImpl::publishMessage(const PublishJob& job) {
+    auto serializableMessage = job.message;
+    // Previews are only created for messages which are sent
+    if(job.frame) {
+        try {
+            serializableMessage = std::dynamic_pointer_cast<ProtoSerializable>(job.preview->apply(job.frame));
+        } catch(const std::exception& ex) {
+            logger::error("Failed to create the preview for topic: {} - exception {}", job.topicName, ex.what());
+            return std::nullopt;
         }
-    });
+    }
+
+    // Serialized once for all the subscribed clients
+    auto serializedMsg = serializableMessage->serializeProto();
+    server->broadcastMessage(job.channelId, nanosecondsSinceEpoch(), static_cast<const uint8_t*>(serializedMsg.data()), serializedMsg.size());
+    return serializedMsg.size();
 }
 
 void RemoteConnectionImpl::addTopic(const std::string& topicName, Node::Output& output, const std::string& group, bool useVisualizationIfAvailable) {
     auto outputQueue = output.createOutputQueue();
-    addPublishThread(topicName, outputQueue, group, useVisualizationIfAvailable);
+    registerTopic(topicName, outputQueue, group, useVisualizationIfAvailable);
 }
 
 std::shared_ptr<MessageQueue> RemoteConnectionImpl::addTopic(
     const std::string& topicName, const std::string& group, unsigned int maxSize, bool blocking, bool useVisualizationIfAvailable) {
     auto outputQueue = std::make_shared<MessageQueue>(maxSize, blocking);
-    addPublishThread(topicName, outputQueue, group, useVisualizationIfAvailable);
+    registerTopic(topicName, outputQueue, group, useVisualizationIfAvailable);
     return outputQueue;
 }
 
 bool RemoteConnectionImpl::removeTopic(const std::string& topicName) {
-    auto topicGroupIterator = topics.find(topicName);
-    if(topicGroupIterator == topics.end()) {
-        logger::error("Topic named {} not found", topicName);
-        return false;
+    std::optional<foxglove::ChannelId> channelId;
+    {
+        std::lock_guard<std::mutex> lock(topicsMtx);
+        auto topicIterator = topics.find(topicName);
+        if(topicIterator == topics.end()) {
+            logger::error("Topic named {} not found", topicName);
+            return false;
+        }
+        topicIterator->second.outputQueue->close();
+        channelId = topicIterator->second.id;
+        topics.erase(topicIterator);
     }
-    // Move the topic out of the map
-    auto topicData = std::move(topicGroupIterator->second);
-    topicData.outputQueue->close();
-    if(topicData.thread->joinable()) {
-        topicData.thread->join();
+    if(channelId) {
+        server->removeChannels({*channelId});
+        std::lock_guard<std::mutex> lock(subscribersMtx);
+        subscriberCounts.erase(*channelId);
     }
-
-    topics.erase(topicGroupIterator);
-    server->removeChannels({topicData.id});
     return true;
 }
 
+void RemoteConnectionImpl::setTopicMaxRate(const std::string& topicName, float maxRate) {
+    DAI_CHECK_V(maxRate >= 0.0f, "Invalid max rate {} for topic {}, must not be negative", maxRate, topicName);
+    std::lock_guard<std::mutex> lock(topicsMtx);
+    auto topicIterator = topics.find(topicName);
+    DAI_CHECK_V(topicIterator != topics.end(), "Topic named {} not found", topicName);
+    topicIterator->second.maxRate = maxRate;
+}
+
+void RemoteConnectionImpl::setTopicPreview(const std::string& topicName, const RemoteConnection::PreviewConfig& config) {
+    const bool enabled = config.maxWidth > 0 || config.maxHeight > 0 || config.encodeJpeg;
+    auto preview = enabled ? std::make_unique<PreviewTransform>(config) : nullptr;
+    std::lock_guard<std::mutex> lock(topicsMtx);
+    auto topicIterator = topics.find(topicName);
+    DAI_CHECK_V(topicIterator != topics.end(), "Topic named {} not found", topicName);
+    auto& topic = topicIterator->second;
+    const bool wasJpeg = topic.preview && topic.preview->encodesJpeg();
+    if(wasJpeg != config.encodeJpeg) topic.readvertise = true;
+    topic.preview = std::move(preview);
+}
+
+RemoteConnection::TopicStats RemoteConnectionImpl::getTopicStats(const std::string& topicName) const {
+    std::lock_guard<std::mutex> lock(topicsMtx);
+    auto topicIterator = topics.find(topicName);
+    DAI_CHECK_V(topicIterator != topics.end(), "Topic named {} not found", topicName);
+    return topicIterator->second.stats;
+}
+
 void RemoteConnectionImpl::registerPipeline(const Pipeline& pipeline) {
     exposePipelineService(pipeline);
 }
@@ -344,6 +481,7 @@ void RemoteConnectionImpl::exposeTopicGroupsService() {
         (void)request;
         auto response = foxglove::ServiceResponse();
         auto topicGroups = std::unordered_map<std::string, std::string>();
+        std::lock_guard<std::mutex> lock(topicsMtx);
         for(const auto& topic : topics) {
             topicGroups[topic.first] = topic.second.group;
         }
@@ -2,19 +2,23 @@
 
 #include <httplib.h>
 
+#include <chrono>
 #include <condition_variable>
 #include <depthai/pipeline/Node.hpp>
+#include <depthai/remote_connection/RemoteConnection.hpp>
 #include <depthai/utility/Pimpl.hpp>
 #include <depthai/utility/ProtoSerializable.hpp>
 #include <foxglove/websocket/server_interface.hpp>
 #include <foxglove/websocket/websocket_server.hpp>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "PreviewTransform.hpp"
 #include "utility/PimplImpl.hpp"
 
 namespace dai {
@@ -28,6 +32,9 @@ class RemoteConnectionImpl {
     std::shared_ptr<MessageQueue> addTopic(
         const std::string& topicName, const std::string& group, unsigned int maxSize, bool blocking, bool useVisualizationIfAvailable);
     bool removeTopic(const std::string& topicName);
+    void setTopicMaxRate(const std::string& topicName, float maxRate);
+    void setTopicPreview(const std::string& topicName, const RemoteConnection::PreviewConfig& config);
+    RemoteConnection::TopicStats getTopicStats(const std::string& topicName) const;
     void registerPipeline(const Pipeline& pipeline);
     void registerService(const std::string& serviceName, std::function<nlohmann::json(const nlohmann::json&)> callback);
     int waitKey(int delayMs);
@@ -50,10 +57,11 @@ class RemoteConnectionImpl {
      */
     bool initHttpServer(const std::string& address, uint16_t port);
 
-    void addPublishThread(const std::string& topicName,
-                          const std::shared_ptr<MessageQueue>& outputQueue,
-                          const std::string& group,
-                          bool useVisualizationIfAvailable);
+    void registerTopic(const std::string& topicName,
+                       const std::shared_ptr<MessageQueue>& outputQueue,
+                       const std::string& group,
+                       bool useVisualizationIfAvailable);
+    void publishLoop();
     void exposeTopicGroupsService();
     void exposeKeyPressedService();
     void exposePipelineService(const Pipeline& pipeline);
@@ -66,11 +74,52 @@ class RemoteConnectionImpl {
     struct TopicData {
         std::string group;
         std::shared_ptr<MessageQueue> outputQueue;
-        foxglove::ServiceId id;
-        std::unique_ptr<std::thread> thread;
+        bool useVisualizationIfAvailable = true;
+        // Advertised once the first message provides the schema
+        std::optional<foxglove::ChannelId> id;
+        // Set when the messages can't be published, they are only drained afterwards
+        bool failed = false;
+        // Set when the message type changes, the channel is advertised again with the next message
+        bool readvertise = false;
+        // Shared with a publish in progress, which runs without topicsMtx
+        std::shared_ptr<PreviewTransform> preview;
+        // Messages per second, 0 for no limit
+        float maxRate = 0.0f;
+        std::chrono::steady_clock::time_point lastPublished;
+        // Newest message not yet published, replaced when a newer one arrives
+        std::shared_ptr<ADatatype> pending;
+        RemoteConnection::TopicStats stats;
     };
 
+    // Message picked under topicsMtx, turned into a preview, serialized and broadcast after releasing it
+    struct PublishJob {
+        std::string topicName;
+        foxglove::ChannelId channelId;
+        std::shared_ptr<ProtoSerializable> message;
+        // Set when a preview of the frame is published instead
+        std::shared_ptr<ImgFrame> frame;
+        std::shared_ptr<PreviewTransform> preview;
+    };
+
+    std::optional<PublishJob> preparePublish(const std::string& topicName, TopicData& topic, const std::shared_ptr<ADatatype>& message);
+    // Size of the broadcast message, std::nullopt if it was skipped
+    std::optional<size_t> publishMessage(const PublishJob& job);
+
+    // Wakes the publisher, shared with the push listeners of the topic queues which can outlive this object
+    struct PublishSignal {
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool notified = false;
+        bool stop = false;
+        void notify();
+    };
+
+    mutable std::mutex topicsMtx;
     std::unordered_map<std::string, TopicData> topics;
+    std::mutex subscribersMtx;
+    std::unordered_map<foxglove::ChannelId, size_t> subscriberCounts;
+    std::shared_ptr<PublishSignal> publishSignal = std::make_shared<PublishSignal>();
+    std::thread publishThread;
     std::unique_ptr<foxglove::ServerInterface<websocketpp::connection_hdl>> server;
     std::unique_ptr<httplib::Server> httpServer;
     std::unique_ptr<std::thread> httpServerThread;
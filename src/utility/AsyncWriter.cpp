@@ -0,0 +1,141 @@
+#include "AsyncWriter.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "Logging.hpp"
+#include "WorkStealingExecutor.hpp"
+
+namespace dai {
+namespace utility {
+
+AsyncWriter::AsyncWriter(size_t maxQueuedBytes, bool dropWhenFull, std::shared_ptr<WorkStealingExecutor> prepareExecutor)
+    : maxQueuedBytes(maxQueuedBytes), dropWhenFull(dropWhenFull), prepareExecutor(std::move(prepareExecutor)) {
+    thread = std::thread([this]() { writerLoop(); });
+}
+
+AsyncWriter::~AsyncWriter() {
+    try {
+        close();
+    } catch(const std::exception& ex) {
+        logger::error("Asynchronous write failed: {}", ex.what());
+    }
+}
+
+bool AsyncWriter::push(size_t bytes, std::function<size_t()> prepare, std::function<void()> write) {
+    std::unique_lock<std::mutex> lock(mtx);
+    rethrowError();
+    if(closed) throw std::runtime_error("AsyncWriter is closed");
+
+    const auto fits = [this, bytes]() { return stats.queuedBytes == 0 || stats.queuedBytes + bytes <= maxQueuedBytes; };
+    if(!fits()) {
+        if(dropWhenFull) {
+            stats.droppedBytes += bytes;
+            stats.droppedMessages++;
+            return false;
+        }
+        cv.wait(lock, [this, &fits]() { return fits() || error || closed; });
+        rethrowError();
+        if(closed) throw std::runtime_error("AsyncWriter is closed");
+    }
+
+    Job job{std::make_shared<size_t>(bytes), {}, std::move(write)};
+    if(prepare) {
+        // The writer waits for every prepare before it is done, so the writer outlives them
+        auto prepareAndCount = [this, prepare = std::move(prepare), jobBytes = job.bytes]() {
+            const size_t prepared = prepare();
+            std::lock_guard<std::mutex> lock(mtx);
+            updateQueuedBytes(*jobBytes, prepared);
+        };
+        if(prepareExecutor) {
+            auto task = std::make_shared<std::packaged_task<void()>>(std::move(prepareAndCount));
+            job.prepared = task->get_future();
+            prepareExecutor->submit([task]() { (*task)(); });
+        } else {
+            // Runs on the writer thread when it waits for the result
+            job.prepared = std::async(std::launch::deferred, std::move(prepareAndCount));
+        }
+    }
+    stats.queuedBytes += bytes;
+    stats.maxQueuedBytes = std::max(stats.maxQueuedBytes, stats.queuedBytes);
+    jobs.push_back(std::move(job));
+    lock.unlock();
+    cv.notify_all();
+    return true;
+}
+
+void AsyncWriter::flush() {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this]() { return jobs.empty() && !writing; });
+    rethrowError();
+}
+
+void AsyncWriter::close() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        closed = true;
+    }
+    cv.notify_all();
+    // The writer thread finishes the queued jobs before it exits
+    if(thread.joinable()) thread.join();
+    std::lock_guard<std::mutex> lock(mtx);
+    rethrowError();
+}
+
+AsyncWriter::Stats AsyncWriter::getStats() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return stats;
+}
+
+void AsyncWriter::writerLoop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while(true) {
+        cv.wait(lock, [this]() { return closed || !jobs.empty(); });
+        if(jobs.empty()) return;
+
+        size_t bytes = 0;
+        std::exception_ptr jobError;
+        // After an error nothing is written anymore, the prepares are still waited for as they may use the producer's data
+        const bool failed = error != nullptr;
+        {
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+            writing = true;
+            lock.unlock();
+            try {
+                if(job.prepared.valid()) job.prepared.get();
+                if(!failed) job.write();
+            } catch(...) {
+                if(!failed) jobError = std::current_exception();
+            }
+            lock.lock();
+            bytes = *job.bytes;
+        }
+        writing = false;
+        stats.queuedBytes -= bytes;
+        if(failed || jobError) {
+            stats.droppedBytes += bytes;
+            stats.droppedMessages++;
+        } else {
+            stats.writtenBytes += bytes;
+            stats.writtenMessages++;
+        }
+        if(jobError) error = jobError;
+        cv.notify_all();
+    }
+}
+
+void AsyncWriter::updateQueuedBytes(size_t& bytes, size_t prepared) {
+    stats.queuedBytes = stats.queuedBytes - bytes + prepared;
+    stats.maxQueuedBytes = std::max(stats.maxQueuedBytes, stats.queuedBytes);
+    bytes = prepared;
+    // Less queued than expected, waiting producers may fit now
+    cv.notify_all();
+}
+
+void AsyncWriter::rethrowError() {
+    if(error) std::rethrow_exception(error);
+}
+
+}  // namespace utility
+}  // namespace dai
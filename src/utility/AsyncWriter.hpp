@@ -0,0 +1,102 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace dai {
+namespace utility {
+
+class WorkStealingExecutor;
+
+/**
+ * Writes to storage on a dedicated thread, so stalls of the storage don't block the producer.
+ * Every write has a prepare step (eg. conversion or serialization of a message), prepares run in parallel on a shared executor,
+ * the writes run one at a time in the order they were pushed. The amount of pending data is bounded,
+ * when the bound is reached push() either waits for space or drops the write
+ */
+class AsyncWriter {
+   public:
+    struct Stats {
+        /// Bytes pushed and not written yet
+        std::uint64_t queuedBytes = 0;
+        /// Highest queuedBytes seen
+        std::uint64_t maxQueuedBytes = 0;
+        std::uint64_t writtenBytes = 0;
+        std::uint64_t writtenMessages = 0;
+        std::uint64_t droppedBytes = 0;
+        std::uint64_t droppedMessages = 0;
+    };
+
+    /**
+     * @param maxQueuedBytes Limit for the bytes pushed and not written yet. A single write larger than the limit is let through when nothing is queued
+     * @param dropWhenFull Drop writes when the limit is reached, instead of waiting for space
+     * @param prepareExecutor Executor running the prepare steps, nullptr runs them on the writer thread
+     */
+    AsyncWriter(size_t maxQueuedBytes, bool dropWhenFull, std::shared_ptr<WorkStealingExecutor> prepareExecutor);
+
+    /**
+     * Finishes the pending writes, errors are logged
+     */
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    /**
+     * Queue a write. Rethrows the error of an earlier prepare or write, after which nothing more is written
+     * @param bytes Expected size of the prepared data, counted against the limit
+     * @param prepare Runs on a worker thread and returns the actual size of the prepared data, which then replaces bytes. Can be empty
+     * @param write Runs on the writer thread after its prepare and all the earlier writes
+     * @returns False if the write was dropped
+     */
+    bool push(size_t bytes, std::function<size_t()> prepare, std::function<void()> write);
+
+    /**
+     * Waits until everything pushed so far is written. Rethrows the error of a prepare or write
+     */
+    void flush();
+
+    /**
+     * Flushes and stops the writer thread, later pushes throw
+     */
+    void close();
+
+    Stats getStats() const;
+
+   private:
+    struct Job {
+        // Updated to the prepared size once known, guarded by mtx
+        std::shared_ptr<size_t> bytes;
+        std::future<void> prepared;
+        std::function<void()> write;
+    };
+
+    void writerLoop();
+    void rethrowError();
+    void updateQueuedBytes(size_t& bytes, size_t prepared);
+
+    const size_t maxQueuedBytes;
+    const bool dropWhenFull;
+    std::shared_ptr<WorkStealingExecutor> prepareExecutor;
+
+    mutable std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<Job> jobs;
+    // Job taken by the writer thread and not finished yet
+    bool writing = false;
+    bool closed = false;
+    std::exception_ptr error;
+    Stats stats;
+    std::thread thread;
+};
+
+}  // namespace utility
+}  // namespace dai
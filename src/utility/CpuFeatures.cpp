@@ -0,0 +1,79 @@
+#include "CpuFeatures.hpp"
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <immintrin.h>
+    #include <intrin.h>
+    #define DEPTHAI_CPU_X86_MSVC
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+    #define DEPTHAI_CPU_X86_GCC
+#endif
+
+namespace dai {
+namespace utility {
+
+namespace {
+
+#if defined(DEPTHAI_CPU_X86_MSVC) || defined(DEPTHAI_CPU_X86_GCC)
+void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+    #if defined(DEPTHAI_CPU_X86_MSVC)
+    int r[4];
+    __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for(int i = 0; i < 4; i++) regs[i] = static_cast<uint32_t>(r[i]);
+    #else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+}
+
+uint64_t xgetbv0() {
+    #if defined(DEPTHAI_CPU_X86_MSVC)
+    return _xgetbv(0);
+    #else
+    uint32_t eax = 0, edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+    #endif
+}
+#endif
+
+CpuFeatures detect() {
+    CpuFeatures features;
+#if defined(DEPTHAI_CPU_X86_MSVC) || defined(DEPTHAI_CPU_X86_GCC)
+    uint32_t regs[4] = {0, 0, 0, 0};
+    cpuid(0, 0, regs);
+    const uint32_t maxLeaf = regs[0];
+    if(maxLeaf < 1) return features;
+
+    cpuid(1, 0, regs);
+    const uint32_t ecx1 = regs[2];
+    features.sse41 = (ecx1 & (1u << 19)) != 0;
+
+    // AVX state (XMM and YMM registers) has to be enabled by the OS
+    const bool osxsave = (ecx1 & (1u << 27)) != 0;
+    const bool avx = (ecx1 & (1u << 28)) != 0;
+    const bool avxEnabled = osxsave && avx && (xgetbv0() & 0x6) == 0x6;
+    if(avxEnabled) {
+        features.fma = (ecx1 & (1u << 12)) != 0;
+        features.f16c = (ecx1 & (1u << 29)) != 0;
+        if(maxLeaf >= 7) {
+            cpuid(7, 0, regs);
+            features.avx2 = (regs[1] & (1u << 5)) != 0;
+        }
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(__aarch64__) || defined(_M_ARM64)
+    features.neon = true;
+#endif
+    return features;
+}
+
+}  // namespace
+
+const CpuFeatures& getCpuFeatures() {
+    static const CpuFeatures features = detect();
+    return features;
+}
+
+}  // namespace utility
+}  // namespace dai
@@ -0,0 +1,23 @@
+#pragma once
+
+namespace dai {
+namespace utility {
+
+/**
+ * Instruction set extensions available at runtime, used to select vectorized code paths
+ */
+struct CpuFeatures {
+    bool sse41 = false;
+    bool avx2 = false;
+    bool fma = false;
+    bool f16c = false;
+    bool neon = false;
+};
+
+/**
+ * Get CPU features of the machine, detected once on first call
+ */
+const CpuFeatures& getCpuFeatures();
+
+}  // namespace utility
+}  // namespace dai
@@ -0,0 +1,635 @@
+#include "DetectionParserImpl.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "spdlog/fmt/fmt.h"
+#include "utility/CpuFeatures.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define DEPTHAI_DETECTION_X86
+    #include <immintrin.h>
+#elif defined(__aarch64__)
+    #define DEPTHAI_DETECTION_NEON
+    #include <arm_neon.h>
+#endif
+
+// Allows compiling functions for an instruction set not enabled for the whole translation unit
+#if defined(DEPTHAI_DETECTION_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define DEPTHAI_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define DEPTHAI_TARGET(isa)
+#endif
+
+namespace dai {
+namespace impl {
+
+namespace {
+
+// Writes the indices of values greater or equal to the threshold, returns their count
+using SelectFn = size_t (*)(const float*, size_t, float, uint32_t*);
+// Max and index of the max over the rows of a channel major tensor, for each of the count columns
+using ColumnMaxFn = void (*)(const float*, size_t, size_t, size_t, float*, uint32_t*);
+// Max of a contiguous range and the index of its first occurrence
+using ArgMaxFn = uint32_t (*)(const float*, size_t, float&);
+
+size_t selectRange(const float* src, size_t begin, size_t end, float threshold, uint32_t* indices) {
+    size_t count = 0;
+    for(size_t i = begin; i < end; i++) {
+        indices[count] = static_cast<uint32_t>(i);
+        count += src[i] >= threshold;
+    }
+    return count;
+}
+
+size_t selectScalar(const float* src, size_t count, float threshold, uint32_t* indices) {
+    return selectRange(src, 0, count, threshold, indices);
+}
+
+void columnMaxScalar(const float* src, size_t rows, size_t count, size_t stride, float* maxOut, uint32_t* argOut) {
+    std::copy(src, src + count, maxOut);
+    std::fill(argOut, argOut + count, 0);
+    for(size_t r = 1; r < rows; r++) {
+        const float* row = src + r * stride;
+        for(size_t i = 0; i < count; i++) {
+            if(row[i] > maxOut[i]) {
+                maxOut[i] = row[i];
+                argOut[i] = static_cast<uint32_t>(r);
+            }
+        }
+    }
+}
+
+uint32_t argMaxScalar(const float* src, size_t count, float& max) {
+    uint32_t arg = 0;
+    max = src[0];
+    for(size_t i = 1; i < count; i++) {
+        if(src[i] > max) {
+            max = src[i];
+            arg = static_cast<uint32_t>(i);
+        }
+    }
+    return arg;
+}
+
+// Index of the first occurrence of the max found by a vectorized reduction, so all paths give identical results
+uint32_t findFirst(const float* src, size_t count, float& max) {
+    for(size_t i = 0; i < count; i++) {
+        if(src[i] == max) return static_cast<uint32_t>(i);
+    }
+    // Only with NaNs in the range
+    return argMaxScalar(src, count, max);
+}
+
+#if defined(DEPTHAI_DETECTION_X86)
+
+DEPTHAI_TARGET("avx2")
+size_t selectAvx2(const float* src, size_t count, float threshold, uint32_t* indices) {
+    const __m256 vThreshold = _mm256_set1_ps(threshold);
+    size_t selected = 0;
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(src + i), vThreshold, _CMP_GE_OQ));
+        // Most candidates are below the threshold
+        if(mask == 0) continue;
+        for(int bit = 0; bit < 8; bit++) {
+            if(mask & (1 << bit)) indices[selected++] = static_cast<uint32_t>(i + bit);
+        }
+    }
+    return selected + selectRange(src, i, count, threshold, indices + selected);
+}
+
+DEPTHAI_TARGET("avx2")
+void columnMaxAvx2(const float* src, size_t rows, size_t count, size_t stride, float* maxOut, uint32_t* argOut) {
+    size_t i = 0;
+    // Blocks of columns stay in registers over all rows
+    for(; i + 8 <= count; i += 8) {
+        __m256 vMax = _mm256_loadu_ps(src + i);
+        __m256i vArg = _mm256_setzero_si256();
+        for(size_t r = 1; r < rows; r++) {
+            const __m256 v = _mm256_loadu_ps(src + r * stride + i);
+            const __m256 greater = _mm256_cmp_ps(v, vMax, _CMP_GT_OQ);
+            vMax = _mm256_blendv_ps(vMax, v, greater);
+            vArg = _mm256_blendv_epi8(vArg, _mm256_set1_epi32(static_cast<int>(r)), _mm256_castps_si256(greater));
+        }
+        _mm256_storeu_ps(maxOut + i, vMax);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(argOut + i), vArg);
+    }
+    if(i < count) columnMaxScalar(src + i, rows, count - i, stride, maxOut + i, argOut + i);
+}
+
+DEPTHAI_TARGET("avx")
+uint32_t argMaxAvx(const float* src, size_t count, float& max) {
+    if(count < 16) return argMaxScalar(src, count, max);
+    __m256 vMax = _mm256_loadu_ps(src);
+    size_t i = 8;
+    for(; i + 8 <= count; i += 8) vMax = _mm256_max_ps(vMax, _mm256_loadu_ps(src + i));
+    const __m128 half = _mm_max_ps(_mm256_castps256_ps128(vMax), _mm256_extractf128_ps(vMax, 1));
+    const __m128 quarter = _mm_max_ps(half, _mm_movehl_ps(half, half));
+    max = _mm_cvtss_f32(_mm_max_ss(quarter, _mm_shuffle_ps(quarter, quarter, 1)));
+    for(; i < count; i++) max = std::max(max, src[i]);
+    return findFirst(src, count, max);
+}
+
+#elif defined(DEPTHAI_DETECTION_NEON)
+
+size_t selectNeon(const float* src, size_t count, float threshold, uint32_t* indices) {
+    const float32x4_t vThreshold = vdupq_n_f32(threshold);
+    size_t selected = 0;
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        // Most candidates are below the threshold
+        if(vmaxvq_u32(vcgeq_f32(vld1q_f32(src + i), vThreshold)) == 0) continue;
+        selected += selectRange(src, i, i + 4, threshold, indices + selected);
+    }
+    return selected + selectRange(src, i, count, threshold, indices + selected);
+}
+
+void columnMaxNeon(const float* src, size_t rows, size_t count, size_t stride, float* maxOut, uint32_t* argOut) {
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        float32x4_t vMax = vld1q_f32(src + i);
+        uint32x4_t vArg = vdupq_n_u32(0);
+        for(size_t r = 1; r < rows; r++) {
+            const float32x4_t v = vld1q_f32(src + r * stride + i);
+            const uint32x4_t greater = vcgtq_f32(v, vMax);
+            vMax = vbslq_f32(greater, v, vMax);
+            vArg = vbslq_u32(greater, vdupq_n_u32(static_cast<uint32_t>(r)), vArg);
+        }
+        vst1q_f32(maxOut + i, vMax);
+        vst1q_u32(argOut + i, vArg);
+    }
+    if(i < count) columnMaxScalar(src + i, rows, count - i, stride, maxOut + i, argOut + i);
+}
+
+uint32_t argMaxNeon(const float* src, size_t count, float& max) {
+    if(count < 8) return argMaxScalar(src, count, max);
+    float32x4_t vMax = vld1q_f32(src);
+    size_t i = 4;
+    for(; i + 4 <= count; i += 4) vMax = vmaxq_f32(vMax, vld1q_f32(src + i));
+    max = vmaxvq_f32(vMax);
+    for(; i < count; i++) max = std::max(max, src[i]);
+    return findFirst(src, count, max);
+}
+
+#endif
+
+SelectFn getSelectFn() {
+#if defined(DEPTHAI_DETECTION_X86)
+    if(utility::getCpuFeatures().avx2) return selectAvx2;
+#elif defined(DEPTHAI_DETECTION_NEON)
+    if(utility::getCpuFeatures().neon) return selectNeon;
+#endif
+    return selectScalar;
+}
+
+ColumnMaxFn getColumnMaxFn() {
+#if defined(DEPTHAI_DETECTION_X86)
+    if(utility::getCpuFeatures().avx2) return columnMaxAvx2;
+#elif defined(DEPTHAI_DETECTION_NEON)
+    if(utility::getCpuFeatures().neon) return columnMaxNeon;
+#endif
+    return columnMaxScalar;
+}
+
+ArgMaxFn getArgMaxFn() {
+#if defined(DEPTHAI_DETECTION_X86)
+    // AVX2 implies AVX
+    if(utility::getCpuFeatures().avx2) return argMaxAvx;
+#elif defined(DEPTHAI_DETECTION_NEON)
+    if(utility::getCpuFeatures().neon) return argMaxNeon;
+#endif
+    return argMaxScalar;
+}
+
+size_t select(const float* src, size_t count, float threshold, uint32_t* indices) {
+    static const auto fn = getSelectFn();
+    return fn(src, count, threshold, indices);
+}
+
+void columnMax(const float* src, size_t rows, size_t count, size_t stride, float* maxOut, uint32_t* argOut) {
+    static const auto fn = getColumnMaxFn();
+    fn(src, rows, count, stride, maxOut, argOut);
+}
+
+uint32_t argMax(const float* src, size_t count, float& max) {
+    static const auto fn = getArgMaxFn();
+    return fn(src, count, max);
+}
+
+float sigmoid(float x) {
+    return 1.0f / (1.0f + std::exp(-x));
+}
+
+// Inverse of the sigmoid, to compare raw logits against a probability threshold
+float logit(float p) {
+    if(p <= 0.0f) return -std::numeric_limits<float>::infinity();
+    if(p >= 1.0f) return std::numeric_limits<float>::infinity();
+    return std::log(p / (1.0f - p));
+}
+
+float iou(const DetectionDecoder::Candidate& a, const DetectionDecoder::Candidate& b) {
+    const float width = std::min(a.xmax, b.xmax) - std::max(a.xmin, b.xmin);
+    const float height = std::min(a.ymax, b.ymax) - std::max(a.ymin, b.ymin);
+    if(width <= 0.0f || height <= 0.0f) return 0.0f;
+    const float intersection = width * height;
+    const float areaA = (a.xmax - a.xmin) * (a.ymax - a.ymin);
+    const float areaB = (b.xmax - b.xmin) * (b.ymax - b.ymin);
+    return intersection / (areaA + areaB - intersection);
+}
+
+// Drops leading dimensions of size 1, keeping at least minRank dimensions
+std::vector<unsigned> squeezeLeading(const std::vector<unsigned>& dims, size_t minRank) {
+    size_t first = 0;
+    while(dims.size() - first > minRank && dims[first] == 1) first++;
+    return std::vector<unsigned>(dims.begin() + first, dims.end());
+}
+
+std::string toString(const std::vector<unsigned>& dims) {
+    std::string str = "[";
+    for(size_t i = 0; i < dims.size(); i++) str += (i > 0 ? ", " : "") + std::to_string(dims[i]);
+    return str + "]";
+}
+
+// YOLO version from subtypes like "yolov5", "yolov8n" or "yolov6r2", 0 if unknown
+int parseYoloVersion(std::string subtype) {
+    std::transform(subtype.begin(), subtype.end(), subtype.begin(), [](unsigned char c) { return std::tolower(c); });
+    const auto pos = subtype.find("yolo");
+    if(pos == std::string::npos) return 0;
+    size_t i = pos + 4;
+    while(i < subtype.size() && (subtype[i] == 'v' || subtype[i] == '-' || subtype[i] == '_')) i++;
+    int version = 0;
+    while(i < subtype.size() && std::isdigit(static_cast<unsigned char>(subtype[i]))) version = version * 10 + (subtype[i++] - '0');
+    return version;
+}
+
+}  // namespace
+
+DetectionDecoder::DetectionDecoder(const DetectionParserProperties& properties) : options(properties.parser) {
+    for(const auto& input : properties.networkInputs) networkInputs.push_back(input.second);
+    yoloVersion = parseYoloVersion(options.subtype);
+}
+
+void DetectionDecoder::decode(const NNData& data, std::vector<ImgDetection>& detections) {
+    detections.clear();
+    candidates.clear();
+    if(data.tensors.empty()) throw std::runtime_error("NNData has no tensors");
+    if(buffers.size() < data.tensors.size()) buffers.resize(data.tensors.size());
+
+    if(options.nnFamily == DetectionNetworkType::MOBILENET) {
+        const auto& info = data.tensors[0];
+        decodeSsd(getFloatData(data, info, buffers[0]), squeezeLeading(info.dims, 2));
+    } else {
+        if(options.classes <= 0) throw std::runtime_error("Number of classes is not set");
+        const auto [inputWidth, inputHeight] = getInputSize(data);
+        if(inputWidth <= 0.0f || inputHeight <= 0.0f) {
+            throw std::runtime_error("Network input size is unknown, set it with setInputImageSize or a blob");
+        }
+
+        const auto firstDims = squeezeLeading(data.tensors[0].dims, 2);
+        if(data.tensors.size() == 1 && firstDims.size() == 2) {
+            const float* values = getFloatData(data, data.tensors[0], buffers[0]);
+            if(yoloVersion == 10 && (firstDims[1] == 6 || firstDims[0] == 6)) {
+                decodeYoloEndToEnd(values, firstDims, inputWidth, inputHeight);
+            } else {
+                decodeYoloFlat(values, firstDims, inputWidth, inputHeight);
+            }
+        } else {
+            std::vector<Layer> layers;
+            for(size_t i = 0; i < data.tensors.size(); i++) {
+                const auto& info = data.tensors[i];
+                const auto dims = squeezeLeading(info.dims, 3);
+                if(dims.size() != 3) throw std::runtime_error(fmt::format("Unsupported YOLO output '{}' of shape {}", info.name, toString(info.dims)));
+                const bool channelsLast = info.order == TensorInfo::StorageOrder::NHWC || info.order == TensorInfo::StorageOrder::HWC;
+                Layer layer{};
+                layer.info = &info;
+                layer.data = getFloatData(data, info, buffers[i]);
+                layer.channelsLast = channelsLast;
+                layer.channels = channelsLast ? dims[2] : dims[0];
+                layer.height = channelsLast ? dims[0] : dims[1];
+                layer.width = channelsLast ? dims[1] : dims[2];
+                layers.push_back(layer);
+            }
+            decodeYoloGrid(layers, inputWidth, inputHeight);
+        }
+        nms(candidates, options.iouThreshold);
+    }
+
+    detections.reserve(candidates.size());
+    for(const auto& candidate : candidates) {
+        ImgDetection detection;
+        detection.label = candidate.label;
+        if(options.classNames && candidate.label < options.classNames->size()) detection.labelName = (*options.classNames)[candidate.label];
+        detection.confidence = candidate.confidence;
+        detection.xmin = std::clamp(candidate.xmin, 0.0f, 1.0f);
+        detection.ymin = std::clamp(candidate.ymin, 0.0f, 1.0f);
+        detection.xmax = std::clamp(candidate.xmax, 0.0f, 1.0f);
+        detection.ymax = std::clamp(candidate.ymax, 0.0f, 1.0f);
+        detections.push_back(std::move(detection));
+    }
+}
+
+size_t DetectionDecoder::nms(std::vector<Candidate>& candidates, float iouThreshold) {
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.label != b.label ? a.label < b.label : a.confidence > b.confidence;
+    });
+
+    // Each candidate is only compared to the already kept ones of its class, which are moved to the front
+    size_t kept = 0;
+    size_t classBegin = 0;
+    uint32_t label = 0;
+    for(size_t i = 0; i < candidates.size(); i++) {
+        const auto candidate = candidates[i];
+        if(i == 0 || candidate.label != label) {
+            label = candidate.label;
+            classBegin = kept;
+        }
+        bool suppressed = false;
+        for(size_t k = classBegin; k < kept && !suppressed; k++) {
+            suppressed = iou(candidate, candidates[k]) > iouThreshold;
+        }
+        if(!suppressed) candidates[kept++] = candidate;
+    }
+    candidates.resize(kept);
+    return kept;
+}
+
+const float* DetectionDecoder::getFloatData(const NNData& data, const TensorInfo& info, std::vector<float>& buffer) const {
+    const float scale = info.quantization ? info.qpScale : 1.0f;
+    const float zeroPoint = info.quantization ? info.qpZp : 0.0f;
+    switch(info.dataType) {
+        case TensorInfo::DataType::FP32:
+            // Read in place
+            return data.getTensorView<float>(info.name).data();
+        case TensorInfo::DataType::FP16: {
+            const auto view = data.getTensorView<uint16_t>(info.name);
+            buffer.resize(view.size());
+            NNData::fp16_to_fp32(view.data(), buffer.data(), view.size());
+            break;
+        }
+        case TensorInfo::DataType::U8F: {
+            const auto view = data.getTensorView<uint8_t>(info.name);
+            buffer.resize(view.size());
+            NNData::dequantize(view.data(), buffer.data(), view.size(), scale, zeroPoint);
+            break;
+        }
+        case TensorInfo::DataType::I8: {
+            const auto view = data.getTensorView<int8_t>(info.name);
+            buffer.resize(view.size());
+            NNData::dequantize(view.data(), buffer.data(), view.size(), scale, zeroPoint);
+            break;
+        }
+        case TensorInfo::DataType::INT: {
+            const auto view = data.getTensorView<int32_t>(info.name);
+            buffer.resize(view.size());
+            for(size_t i = 0; i < view.size(); i++) buffer[i] = (static_cast<float>(view[i]) - zeroPoint) * scale;
+            break;
+        }
+        case TensorInfo::DataType::FP64: {
+            const auto view = data.getTensorView<double>(info.name);
+            buffer.assign(view.begin(), view.end());
+            break;
+        }
+    }
+    return buffer.data();
+}
+
+std::pair<float, float> DetectionDecoder::getInputSize(const NNData& data) const {
+    for(auto input : networkInputs) {
+        // setInputImageSize stores the size as two dimensions
+        if(input.dims.size() == 2) return {static_cast<float>(input.dims[0]), static_cast<float>(input.dims[1])};
+        try {
+            return {static_cast<float>(input.getWidth()), static_cast<float>(input.getHeight())};
+        } catch(const std::runtime_error&) {
+            continue;
+        }
+    }
+    if(data.transformation) {
+        const auto [width, height] = data.transformation->getSize();
+        return {static_cast<float>(width), static_cast<float>(height)};
+    }
+    return {0.0f, 0.0f};
+}
+
+std::vector<std::vector<float>> DetectionDecoder::getLayerAnchors(const std::vector<Layer>& layers) const {
+    std::vector<std::vector<float>> layerAnchors(layers.size());
+    if(!options.anchorsV2.empty()) {
+        if(options.anchorsV2.size() != layers.size()) {
+            throw std::runtime_error(fmt::format("Anchors are set for {} layers, but the network has {} outputs", options.anchorsV2.size(), layers.size()));
+        }
+        // The finest grid detects the smallest objects
+        std::vector<size_t> layerOrder(layers.size());
+        std::vector<size_t> anchorOrder(layers.size());
+        for(size_t i = 0; i < layers.size(); i++) layerOrder[i] = anchorOrder[i] = i;
+        std::stable_sort(layerOrder.begin(), layerOrder.end(), [&](size_t a, size_t b) { return layers[a].width > layers[b].width; });
+        const auto area = [&](size_t layer) {
+            float sum = 0.0f;
+            for(const auto& anchor : options.anchorsV2[layer]) sum += anchor.size() >= 2 ? anchor[0] * anchor[1] : 0.0f;
+            return sum;
+        };
+        std::stable_sort(anchorOrder.begin(), anchorOrder.end(), [&](size_t a, size_t b) { return area(a) < area(b); });
+        for(size_t i = 0; i < layers.size(); i++) {
+            for(const auto& anchor : options.anchorsV2[anchorOrder[i]]) {
+                if(anchor.size() < 2) throw std::runtime_error("Anchors need a width and a height");
+                layerAnchors[layerOrder[i]].push_back(anchor[0]);
+                layerAnchors[layerOrder[i]].push_back(anchor[1]);
+            }
+        }
+        return layerAnchors;
+    }
+
+    if(options.anchors.empty()) throw std::runtime_error("Anchors are required to decode YOLO grid outputs");
+    for(size_t i = 0; i < layers.size(); i++) {
+        const auto mask = options.anchorMasks.find(fmt::format("side{}", layers[i].width));
+        if(mask == options.anchorMasks.end()) {
+            if(layers.size() == 1) {
+                // A single layer uses all anchors
+                layerAnchors[i] = options.anchors;
+                continue;
+            }
+            throw std::runtime_error(fmt::format("No anchor mask 'side{}' for output '{}'", layers[i].width, layers[i].info->name));
+        }
+        for(const auto index : mask->second) {
+            if(index < 0 || static_cast<size_t>(index) * 2 + 1 >= options.anchors.size()) throw std::runtime_error("Anchor mask index is out of range");
+            layerAnchors[i].push_back(options.anchors[index * 2]);
+            layerAnchors[i].push_back(options.anchors[index * 2 + 1]);
+        }
+    }
+    return layerAnchors;
+}
+
+void DetectionDecoder::decodeYoloGrid(const std::vector<Layer>& layers, float inputWidth, float inputHeight) {
+    const auto layerAnchors = getLayerAnchors(layers);
+    const auto classes = static_cast<unsigned>(options.classes);
+    const unsigned anchorChannels = 5 + classes;
+    const float threshold = options.confidenceThreshold;
+    // yolov3 and yolov4 outputs are raw logits, so their objectness is compared against the threshold as a logit
+    const bool rawLogits = yoloVersion == 0 || yoloVersion == 3 || yoloVersion == 4;
+    const float objectnessThreshold = rawLogits ? logit(threshold) : threshold;
+
+    for(size_t l = 0; l < layers.size(); l++) {
+        const auto& layer = layers[l];
+        const auto& anchors = layerAnchors[l];
+        const unsigned numAnchors = static_cast<unsigned>(anchors.size() / 2);
+        if(layer.channels != numAnchors * anchorChannels) {
+            throw std::runtime_error(fmt::format("Output '{}' has {} channels, expected {} anchors of {} classes",
+                                                 layer.info->name,
+                                                 layer.channels,
+                                                 numAnchors,
+                                                 classes));
+        }
+        const size_t cells = static_cast<size_t>(layer.width) * layer.height;
+        indices.resize(cells);
+
+        const auto addBox = [&](size_t cell, unsigned anchor, float tx, float ty, float tw, float th, float confidence, uint32_t label) {
+            const float col = static_cast<float>(cell % layer.width);
+            const float row = static_cast<float>(cell / layer.width);
+            float cx, cy, w, h;
+            if(rawLogits) {
+                cx = (col + sigmoid(tx)) / layer.width;
+                cy = (row + sigmoid(ty)) / layer.height;
+                w = std::exp(tw) * anchors[anchor * 2] / inputWidth;
+                h = std::exp(th) * anchors[anchor * 2 + 1] / inputHeight;
+            } else {
+                cx = (col + tx * 2.0f - 0.5f) / layer.width;
+                cy = (row + ty * 2.0f - 0.5f) / layer.height;
+                w = (tw * 2.0f) * (tw * 2.0f) * anchors[anchor * 2] / inputWidth;
+                h = (th * 2.0f) * (th * 2.0f) * anchors[anchor * 2 + 1] / inputHeight;
+            }
+            candidates.push_back({cx - w / 2, cy - h / 2, cx + w / 2, cy + h / 2, confidence, label});
+        };
+
+        for(unsigned a = 0; a < numAnchors; a++) {
+            if(!layer.channelsLast) {
+                // Planes of cells, the objectness plane is contiguous
+                const float* base = layer.data + static_cast<size_t>(a) * anchorChannels * cells;
+                const size_t selected = select(base + 4 * cells, cells, objectnessThreshold, indices.data());
+                for(size_t s = 0; s < selected; s++) {
+                    const size_t cell = indices[s];
+                    uint32_t label = 0;
+                    float score = base[5 * cells + cell];
+                    for(unsigned c = 1; c < classes; c++) {
+                        const float value = base[(5 + c) * cells + cell];
+                        if(value > score) {
+                            score = value;
+                            label = c;
+                        }
+                    }
+                    const float objectness = base[4 * cells + cell];
+                    const float confidence = rawLogits ? sigmoid(objectness) * sigmoid(score) : objectness * score;
+                    if(confidence < threshold) continue;
+                    addBox(cell, a, base[cell], base[cells + cell], base[2 * cells + cell], base[3 * cells + cell], confidence, label);
+                }
+            } else {
+                // Channels of each cell are contiguous
+                for(size_t cell = 0; cell < cells; cell++) {
+                    const float* values = layer.data + cell * layer.channels + static_cast<size_t>(a) * anchorChannels;
+                    if(values[4] < objectnessThreshold) continue;
+                    float score = 0.0f;
+                    const uint32_t label = argMax(values + 5, classes, score);
+                    const float confidence = rawLogits ? sigmoid(values[4]) * sigmoid(score) : values[4] * score;
+                    if(confidence < threshold) continue;
+                    addBox(cell, a, values[0], values[1], values[2], values[3], confidence, label);
+                }
+            }
+        }
+    }
+}
+
+void DetectionDecoder::decodeYoloFlat(const float* data, const std::vector<unsigned>& dims, float inputWidth, float inputHeight) {
+    const auto classes = static_cast<unsigned>(options.classes);
+    const auto isCandidateSize = [classes](unsigned size) { return size == classes + 5 || size == classes + 4; };
+    // Candidate major [N, K] or channel major [K, N], the larger dimension holds the candidates when both could match
+    bool channelMajor;
+    if(isCandidateSize(dims[1]) && (!isCandidateSize(dims[0]) || dims[0] >= dims[1])) {
+        channelMajor = false;
+    } else if(isCandidateSize(dims[0])) {
+        channelMajor = true;
+    } else {
+        throw std::runtime_error(fmt::format("YOLO output of shape {} doesn't match {} classes", toString(dims), classes));
+    }
+    const size_t count = channelMajor ? dims[1] : dims[0];
+    const unsigned channels = channelMajor ? dims[0] : dims[1];
+    const bool hasObjectness = channels == classes + 5;
+    const unsigned firstClass = hasObjectness ? 5 : 4;
+    const float threshold = options.confidenceThreshold;
+
+    const auto addBox = [&](float cx, float cy, float w, float h, float confidence, uint32_t label) {
+        cx /= inputWidth;
+        cy /= inputHeight;
+        w /= inputWidth;
+        h /= inputHeight;
+        candidates.push_back({cx - w / 2, cy - h / 2, cx + w / 2, cy + h / 2, confidence, label});
+    };
+
+    if(!channelMajor) {
+        for(size_t i = 0; i < count; i++) {
+            const float* values = data + i * channels;
+            // The confidence can't exceed the objectness
+            const float objectness = hasObjectness ? values[4] : 1.0f;
+            if(objectness < threshold) continue;
+            float score = 0.0f;
+            const uint32_t label = argMax(values + firstClass, classes, score);
+            const float confidence = objectness * score;
+            if(confidence < threshold) continue;
+            addBox(values[0], values[1], values[2], values[3], confidence, label);
+        }
+        return;
+    }
+
+    // Class planes are contiguous, so the best class of all candidates is found in one vectorized pass
+    maxScores.resize(count);
+    maxLabels.resize(count);
+    indices.resize(count);
+    columnMax(data + firstClass * count, classes, count, count, maxScores.data(), maxLabels.data());
+    if(hasObjectness) {
+        const float* objectness = data + 4 * count;
+        for(size_t i = 0; i < count; i++) maxScores[i] *= objectness[i];
+    }
+    const size_t selected = select(maxScores.data(), count, threshold, indices.data());
+    for(size_t s = 0; s < selected; s++) {
+        const size_t i = indices[s];
+        addBox(data[i], data[count + i], data[2 * count + i], data[3 * count + i], maxScores[i], maxLabels[i]);
+    }
+}
+
+void DetectionDecoder::decodeYoloEndToEnd(const float* data, const std::vector<unsigned>& dims, float inputWidth, float inputHeight) {
+    const bool channelMajor = dims[1] != 6;
+    const size_t count = channelMajor ? dims[1] : dims[0];
+    const size_t candidateStride = channelMajor ? 1 : 6;
+    const size_t channelStride = channelMajor ? count : 1;
+    const float threshold = options.confidenceThreshold;
+    for(size_t i = 0; i < count; i++) {
+        const float* values = data + i * candidateStride;
+        const float confidence = values[4 * channelStride];
+        if(confidence < threshold) continue;
+        const float label = values[5 * channelStride];
+        if(label < 0.0f) continue;
+        candidates.push_back({values[0] / inputWidth,
+                              values[channelStride] / inputHeight,
+                              values[2 * channelStride] / inputWidth,
+                              values[3 * channelStride] / inputHeight,
+                              confidence,
+                              static_cast<uint32_t>(label)});
+    }
+}
+
+void DetectionDecoder::decodeSsd(const float* data, const std::vector<unsigned>& dims) {
+    // Rows of [image_id, label, confidence, xmin, ymin, xmax, ymax], already suppressed by the network
+    if(dims.size() != 2 || dims[1] != 7) throw std::runtime_error(fmt::format("Unsupported SSD output of shape {}", toString(dims)));
+    const float threshold = options.confidenceThreshold;
+    for(size_t i = 0; i < dims[0]; i++) {
+        const float* values = data + i * 7;
+        // A negative image id ends the list
+        if(values[0] < 0.0f) break;
+        if(values[2] < threshold || values[1] < 0.0f) continue;
+        candidates.push_back({values[3], values[4], values[5], values[6], values[2], static_cast<uint32_t>(values[1])});
+    }
+}
+
+}  // namespace impl
+}  // namespace dai
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "depthai/pipeline/datatype/ImgDetections.hpp"
+#include "depthai/pipeline/datatype/NNData.hpp"
+#include "depthai/properties/DetectionParserProperties.hpp"
+
+namespace dai {
+namespace impl {
+
+/**
+ * Host implementation of the DetectionParser. Decodes YOLO and SSD (MobileNet) outputs into ImgDetections,
+ * normalized to the size of the network input.
+ *
+ * Supported YOLO outputs:
+ *  - one grid tensor per layer, [N, A*(5+C), H, W] or [N, H, W, A*(5+C)], decoded with the anchors (and masks).
+ *    yolov3 and yolov4 outputs are raw logits, later versions are expected to include the sigmoid.
+ *  - a single flat tensor of [N, K] candidates, either candidate or channel major (eg. 8400x85 or 84x8400).
+ *    Boxes are center and size in input pixels, followed by the objectness (when K == 5+C) and class scores.
+ *  - yolov10 end to end output [N, 6] of corner boxes in input pixels, score and label.
+ * Candidates are pruned by confidence before decoding and are followed by a per class NMS.
+ * Errors about unsupported outputs are thrown as std::runtime_error.
+ */
+class DetectionDecoder {
+   public:
+    struct Candidate {
+        float xmin, ymin, xmax, ymax;
+        float confidence;
+        uint32_t label;
+    };
+
+    explicit DetectionDecoder(const DetectionParserProperties& properties);
+
+    /**
+     * Decode detections of the NN output
+     * @param data NN output
+     * @param detections Decoded detections, the vector is cleared first
+     */
+    void decode(const NNData& data, std::vector<ImgDetection>& detections);
+
+    /**
+     * Per class non maximum suppression. Candidates are sorted by class and descending confidence in place
+     * and the kept ones are moved to the front
+     * @returns Number of kept candidates
+     */
+    static size_t nms(std::vector<Candidate>& candidates, float iouThreshold);
+
+   private:
+    struct Layer {
+        const TensorInfo* info;
+        const float* data;
+        unsigned height, width, channels;
+        bool channelsLast;
+    };
+
+    const float* getFloatData(const NNData& data, const TensorInfo& info, std::vector<float>& buffer) const;
+    std::pair<float, float> getInputSize(const NNData& data) const;
+
+    void decodeYoloGrid(const std::vector<Layer>& layers, float inputWidth, float inputHeight);
+    void decodeYoloFlat(const float* data, const std::vector<unsigned>& dims, float inputWidth, float inputHeight);
+    void decodeYoloEndToEnd(const float* data, const std::vector<unsigned>& dims, float inputWidth, float inputHeight);
+    void decodeSsd(const float* data, const std::vector<unsigned>& dims);
+
+    std::vector<std::vector<float>> getLayerAnchors(const std::vector<Layer>& layers) const;
+
+    DetectionParserOptions options;
+    std::vector<TensorInfo> networkInputs;
+    // YOLO version parsed from the subtype, 0 when unknown
+    int yoloVersion = 0;
+
+    // Reused between messages
+    std::vector<std::vector<float>> buffers;
+    std::vector<Candidate> candidates;
+    std::vector<uint32_t> indices;
+    std::vector<float> maxScores;
+    std::vector<uint32_t> maxLabels;
+};
+
+}  // namespace impl
+}  // namespace dai
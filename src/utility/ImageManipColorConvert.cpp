@@ -0,0 +1,550 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "depthai/utility/ImageManipImpl.hpp"
+#include "utility/CpuFeatures.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define DEPTHAI_COLOR_CONVERT_X86
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(__aarch64__) || defined(_M_ARM64)
+    #define DEPTHAI_COLOR_CONVERT_NEON
+    #include <arm_neon.h>
+#endif
+
+// Allows compiling functions for an instruction set not enabled for the whole translation unit
+#if defined(DEPTHAI_COLOR_CONVERT_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define DEPTHAI_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define DEPTHAI_TARGET(isa)
+#endif
+
+namespace dai {
+namespace impl {
+
+namespace {
+
+// BT.601 limited range in Q16 fixed point, same coefficients as YUVfromRGB() and RGBfromYUV()
+constexpr int SHIFT = 16;
+constexpr int32_t ROUND = 1 << (SHIFT - 1);
+constexpr int32_t C_Y = 76284;     // 1.164
+constexpr int32_t C_RV = 104595;   // 1.596
+constexpr int32_t C_GU = -25690;   // -0.392
+constexpr int32_t C_GV = -53281;   // -0.813
+constexpr int32_t C_BU = 132186;   // 2.017
+
+// out = (r * R + g * G + b * B + bias) >> SHIFT
+struct Weights {
+    int32_t r, g, b, bias;
+};
+constexpr Weights Y_WEIGHTS{16843, 33030, 6423, (16 << SHIFT) + ROUND};
+constexpr Weights U_WEIGHTS{-9699, -19071, 28770, (128 << SHIFT) + ROUND};
+constexpr Weights V_WEIGHTS{28770, -24117, -4653, (128 << SHIFT) + ROUND};
+// Luma of full range RGB (0.299, 0.587, 0.114)
+constexpr Weights GRAY_WEIGHTS{19595, 38470, 7471, ROUND};
+// Gray from limited range luma, equal to the luma of the RGBfromYUV() result
+constexpr Weights LUMA_TO_GRAY_WEIGHTS{C_Y, 0, 0, -16 * C_Y + ROUND};
+
+inline uint8_t clampU8(int32_t v) {
+    return static_cast<uint8_t>(std::clamp(v, 0, 255));
+}
+
+//--------------
+//--- Scalar ---
+//--------------
+
+// Converts one row, chroma is horizontally subsampled by 2
+void yuvToRgbRowScalar(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* r, uint8_t* g, uint8_t* b, int begin, int width) {
+    for(int j = begin; j < width; j++) {
+        const int32_t yy = (y[j] - 16) * C_Y + ROUND;
+        const int32_t uu = u[j / 2] - 128;
+        const int32_t vv = v[j / 2] - 128;
+        r[j] = clampU8((yy + C_RV * vv) >> SHIFT);
+        g[j] = clampU8((yy + C_GU * uu + C_GV * vv) >> SHIFT);
+        b[j] = clampU8((yy + C_BU * uu) >> SHIFT);
+    }
+}
+
+void weightedSumRowScalar(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, int begin, int width, const Weights& w) {
+    for(int j = begin; j < width; j++) {
+        out[j] = clampU8((w.r * r[j] + w.g * g[j] + w.b * b[j] + w.bias) >> SHIFT);
+    }
+}
+
+void yuvToRgbRowScalar(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* r, uint8_t* g, uint8_t* b, int width) {
+    yuvToRgbRowScalar(y, u, v, r, g, b, 0, width);
+}
+
+void weightedSumRowScalar(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, int width, const Weights& w) {
+    weightedSumRowScalar(r, g, b, out, 0, width, w);
+}
+
+#if defined(DEPTHAI_COLOR_CONVERT_X86)
+
+//--------------
+//--- SSE4.1 ---
+//--------------
+
+DEPTHAI_TARGET("sse4.1")
+inline void yuvToRgb4Sse41(__m128i y, __m128i u, __m128i v, __m128i& r, __m128i& g, __m128i& b) {
+    const __m128i yy = _mm_add_epi32(_mm_mullo_epi32(_mm_sub_epi32(y, _mm_set1_epi32(16)), _mm_set1_epi32(C_Y)), _mm_set1_epi32(ROUND));
+    const __m128i uu = _mm_sub_epi32(u, _mm_set1_epi32(128));
+    const __m128i vv = _mm_sub_epi32(v, _mm_set1_epi32(128));
+    r = _mm_srai_epi32(_mm_add_epi32(yy, _mm_mullo_epi32(vv, _mm_set1_epi32(C_RV))), SHIFT);
+    g = _mm_srai_epi32(_mm_add_epi32(yy, _mm_add_epi32(_mm_mullo_epi32(uu, _mm_set1_epi32(C_GU)), _mm_mullo_epi32(vv, _mm_set1_epi32(C_GV)))), SHIFT);
+    b = _mm_srai_epi32(_mm_add_epi32(yy, _mm_mullo_epi32(uu, _mm_set1_epi32(C_BU))), SHIFT);
+}
+
+DEPTHAI_TARGET("sse4.1")
+inline __m128i weightedSum4Sse41(__m128i r, __m128i g, __m128i b, const Weights& w) {
+    __m128i sum = _mm_add_epi32(_mm_mullo_epi32(r, _mm_set1_epi32(w.r)), _mm_set1_epi32(w.bias));
+    sum = _mm_add_epi32(sum, _mm_mullo_epi32(g, _mm_set1_epi32(w.g)));
+    sum = _mm_add_epi32(sum, _mm_mullo_epi32(b, _mm_set1_epi32(w.b)));
+    return _mm_srai_epi32(sum, SHIFT);
+}
+
+// Saturating pack of 4x4 int32 into 16 uint8
+DEPTHAI_TARGET("sse4.1")
+inline __m128i packU8Sse41(__m128i a, __m128i b, __m128i c, __m128i d) {
+    return _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+}
+
+DEPTHAI_TARGET("sse4.1")
+void yuvToRgbRowSse41(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* r, uint8_t* g, uint8_t* b, int width) {
+    int j = 0;
+    for(; j + 16 <= width; j += 16) {
+        const __m128i y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + j));
+        // Duplicate each chroma sample for two neighbouring pixels
+        const __m128i u8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + j / 2));
+        const __m128i v8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + j / 2));
+        const __m128i uDup = _mm_unpacklo_epi8(u8, u8);
+        const __m128i vDup = _mm_unpacklo_epi8(v8, v8);
+
+        __m128i r0, r1, r2, r3, g0, g1, g2, g3, b0, b1, b2, b3;
+        yuvToRgb4Sse41(_mm_cvtepu8_epi32(y8), _mm_cvtepu8_epi32(uDup), _mm_cvtepu8_epi32(vDup), r0, g0, b0);
+        yuvToRgb4Sse41(_mm_cvtepu8_epi32(_mm_srli_si128(y8, 4)),
+                       _mm_cvtepu8_epi32(_mm_srli_si128(uDup, 4)),
+                       _mm_cvtepu8_epi32(_mm_srli_si128(vDup, 4)),
+                       r1,
+                       g1,
+                       b1);
+        yuvToRgb4Sse41(_mm_cvtepu8_epi32(_mm_srli_si128(y8, 8)),
+                       _mm_cvtepu8_epi32(_mm_srli_si128(uDup, 8)),
+                       _mm_cvtepu8_epi32(_mm_srli_si128(vDup, 8)),
+                       r2,
+                       g2,
+                       b2);
+        yuvToRgb4Sse41(_mm_cvtepu8_epi32(_mm_srli_si128(y8, 12)),
+                       _mm_cvtepu8_epi32(_mm_srli_si128(uDup, 12)),
+                       _mm_cvtepu8_epi32(_mm_srli_si128(vDup, 12)),
+                       r3,
+                       g3,
+                       b3);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r + j), packU8Sse41(r0, r1, r2, r3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(g + j), packU8Sse41(g0, g1, g2, g3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(b + j), packU8Sse41(b0, b1, b2, b3));
+    }
+    yuvToRgbRowScalar(y, u, v, r, g, b, j, width);
+}
+
+DEPTHAI_TARGET("sse4.1")
+void weightedSumRowSse41(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, int width, const Weights& w) {
+    int j = 0;
+    for(; j + 16 <= width; j += 16) {
+        const __m128i r8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r + j));
+        const __m128i g8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(g + j));
+        const __m128i b8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        const __m128i s0 = weightedSum4Sse41(_mm_cvtepu8_epi32(r8), _mm_cvtepu8_epi32(g8), _mm_cvtepu8_epi32(b8), w);
+        const __m128i s1 = weightedSum4Sse41(
+            _mm_cvtepu8_epi32(_mm_srli_si128(r8, 4)), _mm_cvtepu8_epi32(_mm_srli_si128(g8, 4)), _mm_cvtepu8_epi32(_mm_srli_si128(b8, 4)), w);
+        const __m128i s2 = weightedSum4Sse41(
+            _mm_cvtepu8_epi32(_mm_srli_si128(r8, 8)), _mm_cvtepu8_epi32(_mm_srli_si128(g8, 8)), _mm_cvtepu8_epi32(_mm_srli_si128(b8, 8)), w);
+        const __m128i s3 = weightedSum4Sse41(
+            _mm_cvtepu8_epi32(_mm_srli_si128(r8, 12)), _mm_cvtepu8_epi32(_mm_srli_si128(g8, 12)), _mm_cvtepu8_epi32(_mm_srli_si128(b8, 12)), w);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), packU8Sse41(s0, s1, s2, s3));
+    }
+    weightedSumRowScalar(r, g, b, out, j, width, w);
+}
+
+//------------
+//--- AVX2 ---
+//------------
+
+DEPTHAI_TARGET("avx2")
+inline void yuvToRgb8Avx2(__m256i y, __m256i u, __m256i v, __m256i& r, __m256i& g, __m256i& b) {
+    const __m256i yy = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(y, _mm256_set1_epi32(16)), _mm256_set1_epi32(C_Y)), _mm256_set1_epi32(ROUND));
+    const __m256i uu = _mm256_sub_epi32(u, _mm256_set1_epi32(128));
+    const __m256i vv = _mm256_sub_epi32(v, _mm256_set1_epi32(128));
+    r = _mm256_srai_epi32(_mm256_add_epi32(yy, _mm256_mullo_epi32(vv, _mm256_set1_epi32(C_RV))), SHIFT);
+    g = _mm256_srai_epi32(
+        _mm256_add_epi32(yy, _mm256_add_epi32(_mm256_mullo_epi32(uu, _mm256_set1_epi32(C_GU)), _mm256_mullo_epi32(vv, _mm256_set1_epi32(C_GV)))), SHIFT);
+    b = _mm256_srai_epi32(_mm256_add_epi32(yy, _mm256_mullo_epi32(uu, _mm256_set1_epi32(C_BU))), SHIFT);
+}
+
+DEPTHAI_TARGET("avx2")
+inline __m256i weightedSum8Avx2(__m256i r, __m256i g, __m256i b, const Weights& w) {
+    __m256i sum = _mm256_add_epi32(_mm256_mullo_epi32(r, _mm256_set1_epi32(w.r)), _mm256_set1_epi32(w.bias));
+    sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(g, _mm256_set1_epi32(w.g)));
+    sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(b, _mm256_set1_epi32(w.b)));
+    return _mm256_srai_epi32(sum, SHIFT);
+}
+
+// Saturating pack of 2x8 int32 into 16 uint8
+DEPTHAI_TARGET("avx2")
+inline __m128i packU8Avx2(__m256i a, __m256i b) {
+    // packs works within 128-bit lanes, restore the element order afterwards
+    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+    return _mm_packus_epi16(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1));
+}
+
+DEPTHAI_TARGET("avx2")
+void yuvToRgbRowAvx2(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* r, uint8_t* g, uint8_t* b, int width) {
+    int j = 0;
+    for(; j + 16 <= width; j += 16) {
+        const __m128i y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + j));
+        const __m128i u8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + j / 2));
+        const __m128i v8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + j / 2));
+        const __m128i uDup = _mm_unpacklo_epi8(u8, u8);
+        const __m128i vDup = _mm_unpacklo_epi8(v8, v8);
+
+        __m256i r0, r1, g0, g1, b0, b1;
+        yuvToRgb8Avx2(_mm256_cvtepu8_epi32(y8), _mm256_cvtepu8_epi32(uDup), _mm256_cvtepu8_epi32(vDup), r0, g0, b0);
+        yuvToRgb8Avx2(_mm256_cvtepu8_epi32(_mm_srli_si128(y8, 8)),
+                      _mm256_cvtepu8_epi32(_mm_srli_si128(uDup, 8)),
+                      _mm256_cvtepu8_epi32(_mm_srli_si128(vDup, 8)),
+                      r1,
+                      g1,
+                      b1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r + j), packU8Avx2(r0, r1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(g + j), packU8Avx2(g0, g1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(b + j), packU8Avx2(b0, b1));
+    }
+    yuvToRgbRowScalar(y, u, v, r, g, b, j, width);
+}
+
+DEPTHAI_TARGET("avx2")
+void weightedSumRowAvx2(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, int width, const Weights& w) {
+    int j = 0;
+    for(; j + 16 <= width; j += 16) {
+        const __m128i r8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r + j));
+        const __m128i g8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(g + j));
+        const __m128i b8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        const __m256i s0 = weightedSum8Avx2(_mm256_cvtepu8_epi32(r8), _mm256_cvtepu8_epi32(g8), _mm256_cvtepu8_epi32(b8), w);
+        const __m256i s1 = weightedSum8Avx2(
+            _mm256_cvtepu8_epi32(_mm_srli_si128(r8, 8)), _mm256_cvtepu8_epi32(_mm_srli_si128(g8, 8)), _mm256_cvtepu8_epi32(_mm_srli_si128(b8, 8)), w);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), packU8Avx2(s0, s1));
+    }
+    weightedSumRowScalar(r, g, b, out, j, width, w);
+}
+
+#elif defined(DEPTHAI_COLOR_CONVERT_NEON)
+
+//------------
+//--- NEON ---
+//------------
+
+inline int32x4_t widenLow(uint16x8_t v) {
+    return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(v)));
+}
+inline int32x4_t widenHigh(uint16x8_t v) {
+    return vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(v)));
+}
+
+inline void yuvToRgb4Neon(int32x4_t y, int32x4_t u, int32x4_t v, int32x4_t& r, int32x4_t& g, int32x4_t& b) {
+    const int32x4_t yy = vmlaq_n_s32(vdupq_n_s32(ROUND), vsubq_s32(y, vdupq_n_s32(16)), C_Y);
+    const int32x4_t uu = vsubq_s32(u, vdupq_n_s32(128));
+    const int32x4_t vv = vsubq_s32(v, vdupq_n_s32(128));
+    r = vshrq_n_s32(vmlaq_n_s32(yy, vv, C_RV), SHIFT);
+    g = vshrq_n_s32(vmlaq_n_s32(vmlaq_n_s32(yy, uu, C_GU), vv, C_GV), SHIFT);
+    b = vshrq_n_s32(vmlaq_n_s32(yy, uu, C_BU), SHIFT);
+}
+
+inline int32x4_t weightedSum4Neon(int32x4_t r, int32x4_t g, int32x4_t b, const Weights& w) {
+    int32x4_t sum = vmlaq_n_s32(vdupq_n_s32(w.bias), r, w.r);
+    sum = vmlaq_n_s32(sum, g, w.g);
+    sum = vmlaq_n_s32(sum, b, w.b);
+    return vshrq_n_s32(sum, SHIFT);
+}
+
+// Saturating pack of 4x4 int32 into 16 uint8
+inline uint8x16_t packU8Neon(int32x4_t a, int32x4_t b, int32x4_t c, int32x4_t d) {
+    const int16x8_t lo = vcombine_s16(vqmovn_s32(a), vqmovn_s32(b));
+    const int16x8_t hi = vcombine_s16(vqmovn_s32(c), vqmovn_s32(d));
+    return vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi));
+}
+
+void yuvToRgbRowNeon(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* r, uint8_t* g, uint8_t* b, int width) {
+    int j = 0;
+    for(; j + 16 <= width; j += 16) {
+        const uint8x16_t y8 = vld1q_u8(y + j);
+        // Duplicate each chroma sample for two neighbouring pixels
+        const uint8x8x2_t uDup = vzip_u8(vld1_u8(u + j / 2), vld1_u8(u + j / 2));
+        const uint8x8x2_t vDup = vzip_u8(vld1_u8(v + j / 2), vld1_u8(v + j / 2));
+        const uint16x8_t yLo = vmovl_u8(vget_low_u8(y8)), yHi = vmovl_u8(vget_high_u8(y8));
+        const uint16x8_t uLo = vmovl_u8(uDup.val[0]), uHi = vmovl_u8(uDup.val[1]);
+        const uint16x8_t vLo = vmovl_u8(vDup.val[0]), vHi = vmovl_u8(vDup.val[1]);
+
+        int32x4_t r0, r1, r2, r3, g0, g1, g2, g3, b0, b1, b2, b3;
+        yuvToRgb4Neon(widenLow(yLo), widenLow(uLo), widenLow(vLo), r0, g0, b0);
+        yuvToRgb4Neon(widenHigh(yLo), widenHigh(uLo), widenHigh(vLo), r1, g1, b1);
+        yuvToRgb4Neon(widenLow(yHi), widenLow(uHi), widenLow(vHi), r2, g2, b2);
+        yuvToRgb4Neon(widenHigh(yHi), widenHigh(uHi), widenHigh(vHi), r3, g3, b3);
+        vst1q_u8(r + j, packU8Neon(r0, r1, r2, r3));
+        vst1q_u8(g + j, packU8Neon(g0, g1, g2, g3));
+        vst1q_u8(b + j, packU8Neon(b0, b1, b2, b3));
+    }
+    yuvToRgbRowScalar(y, u, v, r, g, b, j, width);
+}
+
+void weightedSumRowNeon(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, int width, const Weights& w) {
+    int j = 0;
+    for(; j + 16 <= width; j += 16) {
+        const uint8x16_t r8 = vld1q_u8(r + j), g8 = vld1q_u8(g + j), b8 = vld1q_u8(b + j);
+        const uint16x8_t rLo = vmovl_u8(vget_low_u8(r8)), rHi = vmovl_u8(vget_high_u8(r8));
+        const uint16x8_t gLo = vmovl_u8(vget_low_u8(g8)), gHi = vmovl_u8(vget_high_u8(g8));
+        const uint16x8_t bLo = vmovl_u8(vget_low_u8(b8)), bHi = vmovl_u8(vget_high_u8(b8));
+        vst1q_u8(out + j,
+                 packU8Neon(weightedSum4Neon(widenLow(rLo), widenLow(gLo), widenLow(bLo), w),
+                            weightedSum4Neon(widenHigh(rLo), widenHigh(gLo), widenHigh(bLo), w),
+                            weightedSum4Neon(widenLow(rHi), widenLow(gHi), widenLow(bHi), w),
+                            weightedSum4Neon(widenHigh(rHi), widenHigh(gHi), widenHigh(bHi), w)));
+    }
+    weightedSumRowScalar(r, g, b, out, j, width, w);
+}
+
+#endif
+
+//-----------------
+//--- Dispatch ---
+//-----------------
+
+struct Kernels {
+    void (*yuvToRgbRow)(const uint8_t*, const uint8_t*, const uint8_t*, uint8_t*, uint8_t*, uint8_t*, int);
+    void (*weightedSumRow)(const uint8_t*, const uint8_t*, const uint8_t*, uint8_t*, int, const Weights&);
+};
+
+bool getKernels(ColorConvertIsa isa, Kernels& kernels) {
+    switch(isa) {
+        case ColorConvertIsa::SCALAR:
+            kernels = {yuvToRgbRowScalar, weightedSumRowScalar};
+            return true;
+#if defined(DEPTHAI_COLOR_CONVERT_X86)
+        case ColorConvertIsa::SSE41:
+            kernels = {yuvToRgbRowSse41, weightedSumRowSse41};
+            return utility::getCpuFeatures().sse41;
+        case ColorConvertIsa::AVX2:
+            kernels = {yuvToRgbRowAvx2, weightedSumRowAvx2};
+            return utility::getCpuFeatures().avx2;
+#elif defined(DEPTHAI_COLOR_CONVERT_NEON)
+        case ColorConvertIsa::NEON:
+            kernels = {yuvToRgbRowNeon, weightedSumRowNeon};
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+void deinterleave2(const uint8_t* src, uint8_t* c0, uint8_t* c1, int width) {
+    for(int j = 0; j < width; j++) {
+        c0[j] = src[2 * j];
+        c1[j] = src[2 * j + 1];
+    }
+}
+
+void interleave2(const uint8_t* c0, const uint8_t* c1, uint8_t* dst, int width) {
+    for(int j = 0; j < width; j++) {
+        dst[2 * j] = c0[j];
+        dst[2 * j + 1] = c1[j];
+    }
+}
+
+void deinterleave3(const uint8_t* src, uint8_t* c0, uint8_t* c1, uint8_t* c2, int width) {
+    for(int j = 0; j < width; j++) {
+        c0[j] = src[3 * j];
+        c1[j] = src[3 * j + 1];
+        c2[j] = src[3 * j + 2];
+    }
+}
+
+void interleave3(const uint8_t* c0, const uint8_t* c1, const uint8_t* c2, uint8_t* dst, int width) {
+    for(int j = 0; j < width; j++) {
+        dst[3 * j] = c0[j];
+        dst[3 * j + 1] = c1[j];
+        dst[3 * j + 2] = c2[j];
+    }
+}
+
+bool isRgbType(ImgFrame::Type type) {
+    return type == ImgFrame::Type::RGB888p || type == ImgFrame::Type::BGR888p || type == ImgFrame::Type::RGB888i || type == ImgFrame::Type::BGR888i;
+}
+
+bool isYuv420Type(ImgFrame::Type type) {
+    return type == ImgFrame::Type::NV12 || type == ImgFrame::Type::YUV420p;
+}
+
+bool isGrayType(ImgFrame::Type type) {
+    return type == ImgFrame::Type::GRAY8 || type == ImgFrame::Type::RAW8;
+}
+
+void yuv420ToRgb(const Kernels& k, const uint8_t* src, const FrameSpecs& s, ImgFrame::Type from, uint8_t* dst, const FrameSpecs& d, ImgFrame::Type to) {
+    const int width = static_cast<int>(s.width);
+    const int chromaWidth = (width + 1) / 2;
+    std::vector<uint8_t> scratch(2 * chromaWidth + 3 * width);
+    uint8_t* uBuf = scratch.data();
+    uint8_t* vBuf = uBuf + chromaWidth;
+    uint8_t* rBuf = vBuf + chromaWidth;
+    uint8_t* gBuf = rBuf + width;
+    uint8_t* bBuf = gBuf + width;
+
+    for(uint32_t i = 0; i < s.height; ++i) {
+        const uint8_t* y = src + s.p1Offset + i * s.p1Stride;
+        uint8_t* out = dst + d.p1Offset + i * d.p1Stride;
+        if(isGrayType(to)) {
+            k.weightedSumRow(y, y, y, out, width, LUMA_TO_GRAY_WEIGHTS);
+            continue;
+        }
+
+        const uint8_t* u = uBuf;
+        const uint8_t* v = vBuf;
+        if(from == ImgFrame::Type::NV12) {
+            if(i % 2 == 0) deinterleave2(src + s.p2Offset + (i / 2) * s.p2Stride, uBuf, vBuf, chromaWidth);
+        } else {
+            u = src + s.p2Offset + (i / 2) * s.p2Stride;
+            v = src + s.p3Offset + (i / 2) * s.p3Stride;
+        }
+
+        switch(to) {
+            case ImgFrame::Type::RGB888p:
+                k.yuvToRgbRow(y, u, v, out, dst + d.p2Offset + i * d.p2Stride, dst + d.p3Offset + i * d.p3Stride, width);
+                break;
+            case ImgFrame::Type::BGR888p:
+                k.yuvToRgbRow(y, u, v, dst + d.p3Offset + i * d.p3Stride, dst + d.p2Offset + i * d.p2Stride, out, width);
+                break;
+            case ImgFrame::Type::RGB888i:
+                k.yuvToRgbRow(y, u, v, rBuf, gBuf, bBuf, width);
+                interleave3(rBuf, gBuf, bBuf, out, width);
+                break;
+            case ImgFrame::Type::BGR888i:
+                k.yuvToRgbRow(y, u, v, rBuf, gBuf, bBuf, width);
+                interleave3(bBuf, gBuf, rBuf, out, width);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void rgbToYuv420(const Kernels& k, const uint8_t* src, const FrameSpecs& s, ImgFrame::Type from, uint8_t* dst, const FrameSpecs& d, ImgFrame::Type to) {
+    const int width = static_cast<int>(s.width);
+    const int chromaWidth = (width + 1) / 2;
+    // Two rows of deinterleaved RGB, one row of 2x2 averaged RGB and one row of U and V
+    std::vector<uint8_t> scratch(6 * width + 5 * chromaWidth);
+    uint8_t* rows = scratch.data();
+    uint8_t* rAvg = rows + 6 * width;
+    uint8_t* gAvg = rAvg + chromaWidth;
+    uint8_t* bAvg = gAvg + chromaWidth;
+    uint8_t* uBuf = bAvg + chromaWidth;
+    uint8_t* vBuf = uBuf + chromaWidth;
+
+    const uint8_t* prev[3] = {nullptr, nullptr, nullptr};
+    for(uint32_t i = 0; i < s.height; ++i) {
+        const uint8_t* r = nullptr;
+        const uint8_t* g = nullptr;
+        const uint8_t* b = nullptr;
+        uint8_t* rowBuf = rows + (i % 2) * 3 * width;
+        switch(from) {
+            case ImgFrame::Type::RGB888p:
+                r = src + s.p1Offset + i * s.p1Stride;
+                g = src + s.p2Offset + i * s.p2Stride;
+                b = src + s.p3Offset + i * s.p3Stride;
+                break;
+            case ImgFrame::Type::BGR888p:
+                b = src + s.p1Offset + i * s.p1Stride;
+                g = src + s.p2Offset + i * s.p2Stride;
+                r = src + s.p3Offset + i * s.p3Stride;
+                break;
+            case ImgFrame::Type::RGB888i:
+                deinterleave3(src + s.p1Offset + i * s.p1Stride, rowBuf, rowBuf + width, rowBuf + 2 * width, width);
+                r = rowBuf;
+                g = rowBuf + width;
+                b = rowBuf + 2 * width;
+                break;
+            case ImgFrame::Type::BGR888i:
+                deinterleave3(src + s.p1Offset + i * s.p1Stride, rowBuf + 2 * width, rowBuf + width, rowBuf, width);
+                r = rowBuf;
+                g = rowBuf + width;
+                b = rowBuf + 2 * width;
+                break;
+            default:
+                return;
+        }
+
+        uint8_t* out = dst + d.p1Offset + i * d.p1Stride;
+        if(isGrayType(to)) {
+            k.weightedSumRow(r, g, b, out, width, GRAY_WEIGHTS);
+            continue;
+        }
+        k.weightedSumRow(r, g, b, out, width, Y_WEIGHTS);
+
+        if(i % 2 == 0 && i + 1 < s.height) {
+            prev[0] = r;
+            prev[1] = g;
+            prev[2] = b;
+            continue;
+        }
+        // Chroma from the average of each 2x2 block (a trailing odd row is averaged with itself)
+        const uint8_t* top[3] = {i % 2 == 0 ? r : prev[0], i % 2 == 0 ? g : prev[1], i % 2 == 0 ? b : prev[2]};
+        const uint8_t* bottom[3] = {r, g, b};
+        uint8_t* avg[3] = {rAvg, gAvg, bAvg};
+        for(int c = 0; c < 3; c++) {
+            for(int j = 0; j < chromaWidth; j++) {
+                const int j0 = 2 * j;
+                const int j1 = std::min(j0 + 1, width - 1);
+                avg[c][j] = static_cast<uint8_t>((top[c][j0] + top[c][j1] + bottom[c][j0] + bottom[c][j1] + 2) >> 2);
+            }
+        }
+        const uint32_t chromaRow = i / 2;
+        if(to == ImgFrame::Type::NV12) {
+            k.weightedSumRow(rAvg, gAvg, bAvg, uBuf, chromaWidth, U_WEIGHTS);
+            k.weightedSumRow(rAvg, gAvg, bAvg, vBuf, chromaWidth, V_WEIGHTS);
+            interleave2(uBuf, vBuf, dst + d.p2Offset + chromaRow * d.p2Stride, chromaWidth);
+        } else {
+            k.weightedSumRow(rAvg, gAvg, bAvg, dst + d.p2Offset + chromaRow * d.p2Stride, chromaWidth, U_WEIGHTS);
+            k.weightedSumRow(rAvg, gAvg, bAvg, dst + d.p3Offset + chromaRow * d.p3Stride, chromaWidth, V_WEIGHTS);
+        }
+    }
+}
+
+}  // namespace
+
+ColorConvertIsa getColorConvertIsa() {
+    const auto& features = utility::getCpuFeatures();
+#if defined(DEPTHAI_COLOR_CONVERT_X86)
+    if(features.avx2) return ColorConvertIsa::AVX2;
+    if(features.sse41) return ColorConvertIsa::SSE41;
+#elif defined(DEPTHAI_COLOR_CONVERT_NEON)
+    if(features.neon) return ColorConvertIsa::NEON;
+#endif
+    (void)features;
+    return ColorConvertIsa::SCALAR;
+}
+
+bool colorConvertFixedPoint(
+    const uint8_t* src, const FrameSpecs& srcSpecs, ImgFrame::Type from, uint8_t* dst, const FrameSpecs& dstSpecs, ImgFrame::Type to, ColorConvertIsa isa) {
+    Kernels kernels{};
+    if(!getKernels(isa, kernels)) return false;
+    if(isYuv420Type(from) && (isRgbType(to) || isGrayType(to))) {
+        yuv420ToRgb(kernels, src, srcSpecs, from, dst, dstSpecs, to);
+        return true;
+    }
+    if(isRgbType(from) && (isYuv420Type(to) || isGrayType(to))) {
+        rgbToYuv420(kernels, src, srcSpecs, from, dst, dstSpecs, to);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace impl
+}  // namespace dai
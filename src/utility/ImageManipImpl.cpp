@@ -1,8 +1,11 @@
 #include "depthai/utility/ImageManipImpl.hpp"
 
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
 
 #include "depthai/pipeline/datatype/ImageManipConfig.hpp"
+#include "utility/ThreadPool.hpp"
 
 #ifdef DEPTHAI_HAVE_OPENCV_SUPPORT
     #include <opencv2/calib3d.hpp>
@@ -14,24 +17,9 @@
     #define _RESTRICT __restrict__
 #endif
 
-void dai::impl::transformOpenCV(const uint8_t* src,
-                                uint8_t* dst,
-                                const size_t srcWidth,
-                                const size_t srcHeight,
-                                const size_t srcStride,
-                                const size_t dstWidth,
-                                const size_t dstHeight,
-                                const size_t dstStride,
-                                const uint16_t numChannels,
-                                const uint16_t bpp,
-                                const std::array<std::array<float, 3>, 3> matrix,
-                                const std::vector<uint32_t>& background,
-                                const FrameSpecs& srcImgSpecs,
-                                const size_t sourceMinX,
-                                const size_t sourceMinY,
-                                const size_t sourceMaxX,
-                                const size_t sourceMaxY) {
+namespace {
 #if defined(DEPTHAI_HAVE_OPENCV_SUPPORT) && DEPTHAI_IMAGEMANIPV2_OPENCV
+int getCvType(const uint16_t numChannels, const uint16_t bpp) {
     auto type = CV_8UC1;
     switch(numChannels) {
         case 1:
@@ -57,8 +45,39 @@ void dai::impl::transformOpenCV(const uint8_t* src,
         default:
             assert(false);
     }
-    auto bg = numChannels == 1 ? cv::Scalar(background[0])
-                               : (numChannels == 2 ? cv::Scalar(background[0], background[1]) : cv::Scalar(background[0], background[1], background[2]));
+    return type;
+}
+
+cv::Scalar getCvBackground(const std::vector<uint32_t>& background, const uint16_t numChannels) {
+    return numChannels == 1 ? cv::Scalar(background[0])
+                            : (numChannels == 2 ? cv::Scalar(background[0], background[1]) : cv::Scalar(background[0], background[1], background[2]));
+}
+#endif
+
+// Bands smaller than this cost more in scheduling than they save
+constexpr size_t TILED_WARP_MIN_BAND_ROWS = 32;
+}  // namespace
+
+void dai::impl::transformOpenCV(const uint8_t* src,
+                                uint8_t* dst,
+                                const size_t srcWidth,
+                                const size_t srcHeight,
+                                const size_t srcStride,
+                                const size_t dstWidth,
+                                const size_t dstHeight,
+                                const size_t dstStride,
+                                const uint16_t numChannels,
+                                const uint16_t bpp,
+                                const std::array<std::array<float, 3>, 3> matrix,
+                                const std::vector<uint32_t>& background,
+                                const FrameSpecs& srcImgSpecs,
+                                const size_t sourceMinX,
+                                const size_t sourceMinY,
+                                const size_t sourceMaxX,
+                                const size_t sourceMaxY) {
+#if defined(DEPTHAI_HAVE_OPENCV_SUPPORT) && DEPTHAI_IMAGEMANIPV2_OPENCV
+    const auto type = getCvType(numChannels, bpp);
+    const auto bg = getCvBackground(background, numChannels);
     const cv::Mat cvSrc(srcHeight, srcWidth, type, const_cast<uint8_t*>(src), srcStride);
     cv::Mat cvDst(dstHeight, dstWidth, type, dst, dstStride);
     int ssF = srcImgSpecs.width / srcWidth;
@@ -123,6 +142,148 @@ void dai::impl::transformOpenCV(const uint8_t* src,
     (void)(sourceMaxY);
 #endif
 }
+void dai::impl::transformOpenCVTiled(const uint8_t* src,
+                                     uint8_t* dst,
+                                     const size_t srcWidth,
+                                     const size_t srcHeight,
+                                     const size_t srcStride,
+                                     const size_t dstWidth,
+                                     const size_t dstHeight,
+                                     const size_t dstStride,
+                                     const uint16_t numChannels,
+                                     const uint16_t bpp,
+                                     const std::array<std::array<float, 3>, 3> matrix,
+                                     const std::vector<uint32_t>& background,
+                                     const FrameSpecs& srcImgSpecs,
+                                     const size_t sourceMinX,
+                                     const size_t sourceMinY,
+                                     const size_t sourceMaxX,
+                                     const size_t sourceMaxY,
+                                     const size_t numThreads) {
+#if defined(DEPTHAI_HAVE_OPENCV_SUPPORT) && DEPTHAI_IMAGEMANIPV2_OPENCV
+    const auto type = getCvType(numChannels, bpp);
+    const auto bg = getCvBackground(background, numChannels);
+    const cv::Mat cvSrc(srcHeight, srcWidth, type, const_cast<uint8_t*>(src), srcStride);
+    cv::Mat cvDst(dstHeight, dstWidth, type, dst, dstStride);
+    int ssF = srcImgSpecs.width / srcWidth;
+    assert(ssF == (int)(srcImgSpecs.height / srcHeight) && (ssF == 1 || ssF == 2));  // Sanity check
+    const cv::Rect roi(sourceMinX / ssF, sourceMinY / ssF, (sourceMaxX - sourceMinX) / ssF, (sourceMaxY - sourceMinY) / ssF);
+    const cv::Mat cvSrcRoi = cvSrc(roi);
+
+    const size_t threads = numThreads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : numThreads;
+
+    // Same forward transform of the ROI as in transformOpenCV
+    const bool isAffine = floatEq(matrix[2][0], 0) && floatEq(matrix[2][1], 0) && floatEq(matrix[2][2], 1);
+    float forward[9] = {matrix[0][0],
+                        matrix[0][1],
+                        matrix[0][2] / ssF,
+                        matrix[1][0],
+                        matrix[1][1],
+                        matrix[1][2] / ssF,
+                        isAffine ? 0.f : matrix[2][0],
+                        isAffine ? 0.f : matrix[2][1],
+                        isAffine ? 1.f : matrix[2][2]};
+    if(sourceMinX != 0 || sourceMinY != 0) {
+        forward[2] = forward[0] * ((float)sourceMinX / ssF) + forward[1] * ((float)sourceMinY / ssF) + forward[2];
+        forward[5] = forward[3] * ((float)sourceMinX / ssF) + forward[4] * ((float)sourceMinY / ssF) + forward[5];
+        if(!isAffine) forward[8] = forward[6] * ((float)sourceMinX / ssF) + forward[7] * ((float)sourceMinY / ssF) + forward[8];
+    }
+    const bool cropOnly = isAffine && floatEq(forward[0], 1.f) && floatEq(forward[1], 0.f) && floatEq(forward[3], 0.f) && floatEq(forward[4], 1.f)
+                          && floatEq(forward[5], 0.f);
+    if(threads == 1 || (cropOnly && cvSrcRoi.size() != cvDst.size())) {
+        // Single thread or nothing to split, keep the exact single threaded behavior
+        transformOpenCV(src,
+                        dst,
+                        srcWidth,
+                        srcHeight,
+                        srcStride,
+                        dstWidth,
+                        dstHeight,
+                        dstStride,
+                        numChannels,
+                        bpp,
+                        matrix,
+                        background,
+                        srcImgSpecs,
+                        sourceMinX,
+                        sourceMinY,
+                        sourceMaxX,
+                        sourceMaxY);
+        return;
+    }
+
+    // Destination -> source mapping, inverted the same way warpAffine / warpPerspective do it
+    double inverse[9] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0};
+    if(isAffine) {
+        double forwardD[6];
+        std::copy(std::begin(forward), std::begin(forward) + 6, std::begin(forwardD));
+        cv::Mat inverseMat(2, 3, CV_64F, inverse);
+        cv::invertAffineTransform(cv::Mat(2, 3, CV_64F, forwardD), inverseMat);
+    } else {
+        double forwardD[9];
+        std::copy(std::begin(forward), std::end(forward), std::begin(forwardD));
+        cv::Mat inverseMat(3, 3, CV_64F, inverse);
+        cv::invert(cv::Mat(3, 3, CV_64F, forwardD), inverseMat);
+    }
+
+    const size_t numBands = std::max<size_t>(1, std::min(threads, dstHeight / TILED_WARP_MIN_BAND_ROWS));
+    utility::ThreadPool::shared().parallelFor(
+        numBands,
+        [&](size_t band) {
+            const size_t rowBegin = dstHeight * band / numBands;
+            const size_t rowEnd = dstHeight * (band + 1) / numBands;
+            cv::Mat dstBand = cvDst.rowRange(rowBegin, rowEnd);
+            if(cropOnly) {
+                cvSrcRoi.rowRange(rowBegin, rowEnd).copyTo(dstBand);
+                return;
+            }
+            // Same warp as transformOpenCV, with the band's first row moved to the origin of the destination
+            double shifted[9];
+            std::copy(std::begin(inverse), std::end(inverse), std::begin(shifted));
+            const double y0 = (double)rowBegin;
+            shifted[2] += shifted[1] * y0;
+            shifted[5] += shifted[4] * y0;
+            shifted[8] += shifted[7] * y0;
+            if(isAffine) {
+                cv::warpAffine(cvSrcRoi,
+                               dstBand,
+                               cv::Mat(2, 3, CV_64F, shifted),
+                               dstBand.size(),
+                               cv::INTER_LINEAR | cv::WARP_INVERSE_MAP,
+                               cv::BORDER_CONSTANT,
+                               bg);
+            } else {
+                cv::warpPerspective(cvSrcRoi,
+                                    dstBand,
+                                    cv::Mat(3, 3, CV_64F, shifted),
+                                    dstBand.size(),
+                                    cv::INTER_LINEAR | cv::WARP_INVERSE_MAP,
+                                    cv::BORDER_CONSTANT,
+                                    bg);
+            }
+        },
+        threads);
+#else
+    (void)(src);
+    (void)(dst);
+    (void)(srcWidth);
+    (void)(srcHeight);
+    (void)(srcStride);
+    (void)(dstWidth);
+    (void)(dstHeight);
+    (void)(dstStride);
+    (void)(numChannels);
+    (void)(bpp);
+    (void)(matrix);
+    (void)(background);
+    (void)(srcImgSpecs);
+    (void)(sourceMinX);
+    (void)(sourceMinY);
+    (void)(sourceMaxX);
+    (void)(sourceMaxY);
+    (void)(numThreads);
+#endif
+}
 void dai::impl::transformFastCV(const uint8_t* src,
                                 uint8_t* dst,
                                 const size_t srcWidth,
@@ -0,0 +1,87 @@
+#include "depthai/utility/MappedFileMemory.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "utility/spdlog-fmt.hpp"
+
+namespace dai {
+
+MappedFileMemory::MappedFileMemory(const std::filesystem::path& path) {
+    fileSize = std::filesystem::file_size(path);
+    size = fileSize;
+    // Zero sized files can't be mapped
+    if(fileSize == 0) return;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error(fmt::format("Cannot open file {} for mapping", path.string()));
+    }
+    mappingHandle = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if(mappingHandle == nullptr) {
+        throw std::runtime_error(fmt::format("Cannot map file {}", path.string()));
+    }
+    mapping = static_cast<std::uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0));
+    if(mapping == nullptr) {
+        CloseHandle(mappingHandle);
+        throw std::runtime_error(fmt::format("Cannot map file {}", path.string()));
+    }
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0) {
+        throw std::runtime_error(fmt::format("Cannot open file {} for mapping", path.string()));
+    }
+    void* ptr = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+    if(ptr == MAP_FAILED) {
+        throw std::runtime_error(fmt::format("Cannot map file {}", path.string()));
+    }
+    mapping = static_cast<std::uint8_t*>(ptr);
+#endif
+}
+
+MappedFileMemory::~MappedFileMemory() {
+    if(mapping == nullptr) return;
+#ifdef _WIN32
+    UnmapViewOfFile(mapping);
+    CloseHandle(mappingHandle);
+#else
+    munmap(mapping, fileSize);
+#endif
+}
+
+span<std::uint8_t> MappedFileMemory::getData() {
+    return {mapping, size};
+}
+
+span<const std::uint8_t> MappedFileMemory::getData() const {
+    return {mapping, size};
+}
+
+std::size_t MappedFileMemory::getMaxSize() const {
+    return fileSize;
+}
+
+std::size_t MappedFileMemory::getOffset() const {
+    return 0;
+}
+
+void MappedFileMemory::setSize(std::size_t size) {
+    if(size > fileSize) {
+        throw std::invalid_argument("MappedFileMemory can't be larger than the mapped file");
+    }
+    this->size = size;
+}
+
+}  // namespace dai
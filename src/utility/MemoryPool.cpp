@@ -0,0 +1,85 @@
+#include "depthai/utility/MemoryPool.hpp"
+
+#include <algorithm>
+
+namespace dai {
+
+MemoryPool::MemoryPool(std::size_t capacity) {
+    stats.capacity = capacity;
+}
+
+std::shared_ptr<MemoryPool> MemoryPool::create(std::size_t capacity, std::size_t blockSize) {
+    std::shared_ptr<MemoryPool> pool(new MemoryPool(capacity));
+    if(blockSize > 0) {
+        pool->freeBlocks.reserve(capacity);
+        for(std::size_t i = 0; i < capacity; i++) {
+            pool->freeBlocks.push_back(std::make_unique<VectorMemory>(std::vector<std::uint8_t>(blockSize)));
+        }
+    }
+    return pool;
+}
+
+std::shared_ptr<VectorMemory> MemoryPool::acquire(std::size_t size) {
+    std::unique_ptr<VectorMemory> block;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stats.inUse++;
+        stats.highWaterMark = std::max(stats.highWaterMark, stats.inUse);
+        if(stats.inUse > stats.capacity) {
+            stats.overflows++;
+        }
+        if(!freeBlocks.empty()) {
+            // Prefer a block that is already large enough, to avoid reallocating
+            auto it = std::find_if(freeBlocks.rbegin(), freeBlocks.rend(), [size](const auto& b) { return b->capacity() >= size; });
+            auto pos = it == freeBlocks.rend() ? freeBlocks.end() - 1 : std::next(it).base();
+            block = std::move(*pos);
+            freeBlocks.erase(pos);
+        }
+    }
+    if(!block) {
+        block = std::make_unique<VectorMemory>();
+    }
+    block->resize(size);
+
+    std::weak_ptr<MemoryPool> weakPool = weak_from_this();
+    return std::shared_ptr<VectorMemory>(block.release(), [weakPool](VectorMemory* b) {
+        if(auto pool = weakPool.lock()) {
+            pool->release(b);
+        } else {
+            delete b;
+        }
+    });
+}
+
+void MemoryPool::release(VectorMemory* block) {
+    std::unique_ptr<VectorMemory> ptr(block);
+    std::unique_lock<std::mutex> lock(mtx);
+    stats.inUse--;
+    if(freeBlocks.size() < stats.capacity) {
+        freeBlocks.push_back(std::move(ptr));
+    }
+}
+
+void MemoryPool::setCapacity(std::size_t capacity) {
+    std::vector<std::unique_ptr<VectorMemory>> excess;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stats.capacity = capacity;
+        while(freeBlocks.size() > capacity) {
+            excess.push_back(std::move(freeBlocks.back()));
+            freeBlocks.pop_back();
+        }
+    }
+}
+
+std::size_t MemoryPool::getCapacity() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return stats.capacity;
+}
+
+MemoryPool::Stats MemoryPool::getStats() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return stats;
+}
+
+}  // namespace dai
@@ -4,8 +4,12 @@
 
 #include <fmt/base.h>
 
+#include <array>
+
+#include "depthai/utility/MultiStreamTracker.hpp"
 #include "eigen3/Eigen/Dense"
 #include "properties/ObjectTrackerProperties.hpp"
+#include "utility/ThreadPool.hpp"
 
 namespace dai {
 namespace impl {
@@ -31,17 +35,121 @@ typedef float cost_t;
 typedef char boolean;
 typedef enum fp_t { FP_1 = 1, FP_2 = 2, FP_DYNAMIC = 3 } fp_t;
 
-extern int_t lapjv_internal(const uint_t n, cost_t* cost[], int_t* x, int_t* y);
+// Kalman filter state [x, y, s, r, vx, vy, vs] and measurement [x, y, s, r], see convert_bbox_to_z()
+using StateVector = Eigen::Matrix<float, 7, 1>;
+using StateMatrix = Eigen::Matrix<float, 7, 7>;
+using MeasurementVector = Eigen::Matrix<float, 4, 1>;
+using MeasurementMatrix = Eigen::Matrix<float, 4, 4>;
+// [x1, y1, x2, y2, score]
+using BoxVector = Eigen::Matrix<float, 5, 1>;
+using BoxList = std::vector<BoxVector>;
+using Velocity = Eigen::Matrix<float, 1, 2>;
+using Match = Eigen::Matrix<int, 1, 2>;
+
+/**
+ * Row major float matrix backed by a vector which only ever grows, so per frame cost matrices can be rebuilt without allocating
+ */
+struct CostMatrix {
+    std::vector<float> data;
+    int rows = 0;
+    int cols = 0;
+
+    void resize(int rows_, int cols_) {
+        rows = rows_;
+        cols = cols_;
+        if(data.size() < static_cast<size_t>(rows * cols)) data.resize(rows * cols);
+    }
+    float& operator()(int row, int col) {
+        return data[row * cols + col];
+    }
+    float operator()(int row, int col) const {
+        return data[row * cols + col];
+    }
+    float maxCoeff() const {
+        float max = data[0];
+        for(int i = 1; i < rows * cols; i++) max = std::max(max, data[i]);
+        return max;
+    }
+};
+
+/**
+ * Scratch buffers of execLapjv(), reused between calls
+ */
+struct LapjvWorkspace {
+    std::vector<cost_t> cost;
+    std::vector<cost_t*> rows;
+    std::vector<int_t> x, y, freeRows, cols, pred;
+    std::vector<cost_t> v, d;
+    std::vector<boolean> unique;
+};
+
+/**
+ * Scratch buffers of associate(), reused between calls
+ */
+struct AssociationWorkspace {
+    CostMatrix iou;
+    CostMatrix cost;
+    LapjvWorkspace lapjv;
+    std::vector<int> rowsol, colsol;
+    std::vector<Match> candidates;
+    std::vector<char> detMatched, trkMatched;
+};
+
+/**
+ * The last few observations of a tracker, keyed by the tracker age at which they were made.
+ * Lookups only ever go delta_t frames back (or to the latest entry), so a small ring replaces an ever growing map.
+ */
+class ObservationHistory {
+   public:
+    static constexpr int CAPACITY = 8;
+
+    void push(int age, const BoxVector& box) {
+        head = (head + 1) % CAPACITY;
+        ages[head] = age;
+        boxes[head] = box;
+        if(count < CAPACITY) ++count;
+    }
+    const BoxVector* find(int age) const {
+        // Ages are strictly increasing, so walk from the newest entry until an older one shows up
+        for(int i = 0; i < count; i++) {
+            const int idx = (head - i + CAPACITY) % CAPACITY;
+            if(ages[idx] == age) return &boxes[idx];
+            if(ages[idx] < age) break;
+        }
+        return nullptr;
+    }
+    const BoxVector& latest() const {
+        return boxes[head];
+    }
+    bool empty() const {
+        return count == 0;
+    }
+
+   private:
+    std::array<int, CAPACITY> ages{};
+    std::array<BoxVector, CAPACITY> boxes;
+    int head = CAPACITY - 1;
+    int count = 0;
+};
+
+extern int_t lapjv_internal(const uint_t n, cost_t* cost[], int_t* x, int_t* y, LapjvWorkspace& ws);
 
 extern int_t lapmod_internal(const uint_t n, cost_t* cc, uint_t* ii, uint_t* kk, int_t* x, int_t* y, fp_t fp_version);
 float execLapjv(
-    const std::vector<std::vector<float>>& cost, std::vector<int>& rowsol, std::vector<int>& colsol, bool extend_cost, float cost_limit, bool return_cost);
-
-std::tuple<Eigen::MatrixXf, Eigen::MatrixXf> speed_direction_batch(const Eigen::MatrixXf& dets, const Eigen::MatrixXf& tracks);
-Eigen::MatrixXf iou_batch(const Eigen::MatrixXf& bboxes1, const Eigen::MatrixXf& bboxes2);
-Eigen::MatrixXf giou_batch(const Eigen::MatrixXf& bboxes1, const Eigen::MatrixXf& bboxes2);
-std::tuple<std::vector<Eigen::Matrix<int, 1, 2>>, std::vector<int>, std::vector<int>> associate(
-    Eigen::MatrixXf detections, Eigen::MatrixXf trackers, float iou_threshold, Eigen::MatrixXf velocities, Eigen::MatrixXf previous_obs_, float vdc_weight);
+    const CostMatrix& cost, std::vector<int>& rowsol, std::vector<int>& colsol, bool extend_cost, float cost_limit, bool return_cost, LapjvWorkspace& ws);
+
+void iou_batch(const BoxList& bboxes1, const BoxList& bboxes2, CostMatrix& out);
+void giou_batch(const BoxList& bboxes1, const BoxList& bboxes2, CostMatrix& out);
+void associate(const BoxList& detections,
+               const BoxList& trackers,
+               float iou_threshold,
+               const std::vector<Velocity>& velocities,
+               const BoxList& previous_obs,
+               float vdc_weight,
+               AssociationWorkspace& ws,
+               std::vector<Match>& matches,
+               std::vector<int>& unmatched_detections,
+               std::vector<int>& unmatched_trackers);
 /**
  * Takes a bounding box in the form [x1,y1,x2,y2] and returns z in the form
 [x,y,s,r] where x,y is the centre of the box and s is the scale/area and r is
@@ -49,11 +157,10 @@ the aspect ratio
  * @param bbox
  * @return z
  */
-Eigen::VectorXf convert_bbox_to_z(Eigen::VectorXf bbox);
-Eigen::VectorXf speed_direction(Eigen::VectorXf bbox1, Eigen::VectorXf bbox2);
-Eigen::VectorXf convert_x_to_bbox(Eigen::VectorXf x);
-Eigen::VectorXf k_previous_obs(const std::map<int, Eigen::VectorXf>& observations, int cur_age, int k);
-
+MeasurementVector convert_bbox_to_z(const BoxVector& bbox);
+Velocity speed_direction(const BoxVector& bbox1, const BoxVector& bbox2);
+MeasurementVector convert_x_to_bbox(const StateVector& x);
+BoxVector k_previous_obs(const ObservationHistory& observations, int cur_age, int k);
 class TrackletExt : public Tracklet {
    public:
     uint32_t ageSinceStatusUpdate = 1;
@@ -81,115 +188,131 @@ class OCSTracker::State {
    public:
     class KalmanFilterNew {
        public:
-        KalmanFilterNew() = default;
-        KalmanFilterNew(int dim_x_, int dim_z_);
+        KalmanFilterNew();
         void predict();
-        void update(Eigen::VectorXf z_);
+        /**
+         * @param z_ Measurement, nullptr when the object was not observed in this frame
+         */
+        void update(const MeasurementVector* z_);
         void freeze();
-        void unfreeze();
-        KalmanFilterNew& operator=(const KalmanFilterNew&) = delete;
+        /**
+         * Restores the state saved by freeze() and replays a virtual trajectory up to the new measurement.
+         * @return true if the state was restored, in which case the measurement is not kept in the observation history
+         */
+        bool unfreeze(const MeasurementVector& z_);
 
        public:
-        int dim_z = 4;
-        int dim_x = 7;
-        int dim_u = 0;
+        static constexpr int dim_z = 4;
+        static constexpr int dim_x = 7;
         // state: This is the Kalman state variable [7,1].
-        Eigen::VectorXf x;
+        StateVector x;
         // P: Covariance matrix. Initially declared as an identity matrix. Data type is float. [7,7].
-        Eigen::MatrixXf P;
+        StateMatrix P;
         // Q: Process noise covariance matrix. [7,7].
-        Eigen::MatrixXf Q;
-        // B: Control matrix. Not used in target tracking. [n,n].
-        Eigen::MatrixXf B;
+        StateMatrix Q;
         // F: Prediction matrix / state transition matrix. [7,7].
-        Eigen::Matrix<float, 7, 7> F;
+        StateMatrix F;
         // H: Observation model / matrix. [4,7].
         Eigen::Matrix<float, 4, 7> H;
         // R: Observation noise covariance matrix. [4,4].
-        Eigen::Matrix<float, 4, 4> R;
+        MeasurementMatrix R;
         // _alpha_sq: Fading memory control, controlling the update weight. Float.
         float _alpha_sq = 1.0;
-        // M: Measurement matrix, converting state vector x to measurement vector z. [7,4]. It has the opposite effect of matrix H.
-        Eigen::MatrixXf M;
         // z: Measurement vector. [4,1].
-        Eigen::VectorXf z;
+        MeasurementVector z;
         /* The following variables are intermediate variables used in calculations */
         // K: Kalman gain. [7,4].
-        Eigen::MatrixXf K;
+        Eigen::Matrix<float, 7, 4> K;
         // y: Measurement residual. [4,1].
-        Eigen::MatrixXf y;
+        MeasurementVector y;
         // S: Measurement residual covariance.
-        Eigen::MatrixXf S;
+        MeasurementMatrix S;
         // SI: Transpose of measurement residual covariance (simplified for subsequent calculations).
-        Eigen::MatrixXf SI;
-        // Identity matrix of size [dim_x,dim_x], used for convenient calculations. This cannot be changed.
-        const Eigen::MatrixXf I = Eigen::MatrixXf::Identity(dim_x, dim_x);
+        MeasurementMatrix SI;
         // There will always be a copy of x, P after predict() is called.
-        // If there is a need to assign values between two Eigen matrices, the precondition is that they should be initialized properly, as this ensures that
-        // the number of columns and rows are compatible.
-        Eigen::VectorXf x_prior;
-        Eigen::MatrixXf P_prior;
+        StateVector x_prior;
+        StateMatrix P_prior;
         // there will always be a copy of x,P after update() is called
-        Eigen::VectorXf x_post;
-        Eigen::MatrixXf P_post;
-        // keeps all observations. When there is a 'z', it is directly pushed back.
-        std::vector<Eigen::VectorXf> history_obs;
+        StateVector x_post;
+        StateMatrix P_post;
+        // Number of update() calls kept in the observation history, with or without a measurement.
+        // Only the last measurement and its position are needed to build the virtual trajectory, so the history itself is not stored.
+        int history_length = 0;
+        int last_obs_index = -1;
+        MeasurementVector last_obs;
         // The following is newly added by ocsort.
         // Used to mark the tracking state (whether there is still a target matching this trajectory), default value is false.
         bool observed = false;
-        std::vector<Eigen::VectorXf> new_history;  // Used to create a virtual trajectory.
 
         struct Data {
-            Eigen::VectorXf x;
-            Eigen::MatrixXf P;
-            Eigen::MatrixXf Q;
-            Eigen::MatrixXf B;
-            Eigen::MatrixXf F;
-            Eigen::MatrixXf H;
-            Eigen::MatrixXf R;
+            StateVector x;
+            StateMatrix P;
+            StateMatrix Q;
+            StateMatrix F;
+            Eigen::Matrix<float, 4, 7> H;
+            MeasurementMatrix R;
             float _alpha_sq = 1.;
-            Eigen::MatrixXf M;
-            Eigen::VectorXf z;
-            Eigen::MatrixXf K;
-            Eigen::MatrixXf y;
-            Eigen::MatrixXf S;
-            Eigen::MatrixXf SI;
-            Eigen::VectorXf x_prior;
-            Eigen::MatrixXf P_prior;
-            Eigen::VectorXf x_post;
-            Eigen::MatrixXf P_post;
-            std::vector<Eigen::VectorXf> history_obs;
-            bool observed = false;
+            MeasurementVector z;
+            Eigen::Matrix<float, 7, 4> K;
+            MeasurementVector y;
+            MeasurementMatrix S;
+            MeasurementMatrix SI;
+            StateVector x_prior;
+            StateMatrix P_prior;
+            StateVector x_post;
+            StateMatrix P_post;
             // The following is to determine whether the data has been saved due to freezing.
             bool IsInitialized = false;
         };
         struct Data attr_saved;
+
+       private:
+        void correct(const MeasurementVector& z_);
     };
     class KalmanBoxTracker {
        public:
         KalmanBoxTracker(){};
-        KalmanBoxTracker(Eigen::VectorXf bbox_, int cls_, int delta_t_ = 3);
-        void update(Eigen::Matrix<float, 5, 1>* bbox_, int cls_);
-        Eigen::RowVectorXf predict();
-        Eigen::VectorXf get_state();
+        KalmanBoxTracker(const BoxVector& bbox_, int cls_, int delta_t_ = 3);
+        void update(const BoxVector* bbox_, int cls_);
+        MeasurementVector predict();
 
        public:
-        Eigen::VectorXf bbox;  // [5,1]
-        std::shared_ptr<KalmanFilterNew> kf;
+        BoxVector bbox;
+        KalmanFilterNew kf;
         int time_since_update;
-        std::vector<Eigen::VectorXf> history;  //  [4,1]
         int hits;
         int hit_streak;
         int age = 0;
         float conf;
         int cls;
-        Eigen::RowVectorXf last_observation = Eigen::RowVectorXf::Zero(5);
-        std::map<int, Eigen::VectorXf> observations;
-        std::vector<Eigen::VectorXf> history_observations;
-        Eigen::RowVectorXf velocity = Eigen::RowVectorXf::Zero(2);  // [2,1]
+        Eigen::Matrix<float, 1, 5> last_observation = Eigen::Matrix<float, 1, 5>::Zero();
+        ObservationHistory observations;
+        Velocity velocity = Velocity::Zero();
         int delta_t;
         bool remove = false;
     };
+    /**
+     * Per frame buffers shared by all class states of a tracker. They keep their capacity between frames,
+     * so once the largest frame has been seen an update does not allocate.
+     */
+    struct Workspace {
+        // Boxes of the high / low confidence detections and their index into the input detections
+        BoxList dets_first, dets_second;
+        std::vector<uint32_t> first_index, second_index;
+        // Per tracker inputs of the association
+        BoxList trks, last_boxes, k_observations;
+        std::vector<Velocity> velocities;
+        // Subsets used by the second and third round of association
+        BoxList left_dets, left_trks;
+        CostMatrix iou_left;
+        std::vector<Match> matched;
+        std::vector<int> unmatched_dets, unmatched_trks, to_remove_dets, to_remove_trks, difference;
+        AssociationWorkspace association;
+        // Detection indices per class state
+        std::unordered_map<uint32_t, std::vector<uint32_t>> dets_by_class;
+        std::vector<uint32_t> ids;
+    };
+    using AssoFunc = void (*)(const BoxList&, const BoxList&, CostMatrix&);
     class ClassState {
        public:
         float det_thresh;
@@ -197,7 +320,7 @@ class OCSTracker::State {
         int min_hits;
         float iou_threshold;
         int delta_t;
-        std::function<Eigen::MatrixXf(const Eigen::MatrixXf&, const Eigen::MatrixXf&)> asso_func;
+        AssoFunc asso_func;
         float inertia;
         bool use_byte;
         std::vector<KalmanBoxTracker> trackers;
@@ -238,7 +361,13 @@ class OCSTracker::State {
                    float inertia_ = 0.2,
                    bool use_byte_ = false);
 
-        std::vector<Eigen::RowVectorXf> update(const std::vector<ImgDetection>& detections, const std::vector<Point3f>& spatialData, bool trackOnly = false);
+        /**
+         * @param indices Indices of the detections (and spatial data) belonging to this class state
+         */
+        void update(const std::vector<ImgDetection>& detections,
+                    const std::vector<Point3f>& spatialData,
+                    const std::vector<uint32_t>& indices,
+                    bool trackOnly = false);
     };
 
    private:
@@ -256,6 +385,7 @@ class OCSTracker::State {
     uint32_t max_trackers;
     std::atomic<uint32_t> num_trackers = 0;
     std::unordered_map<uint32_t, ClassState> class_states;
+    Workspace workspace;
 
     uint32_t get_next_id() {
         switch(id_assignment_policy) {
@@ -263,9 +393,9 @@ class OCSTracker::State {
                 return max_id++;
             case TrackerIdAssignmentPolicy::SMALLEST_ID: {
                 uint32_t id = 0;
-                std::vector<uint32_t> ids;
+                auto& ids = workspace.ids;
+                ids.clear();
                 for(const auto& [_, cs] : class_states) {
-                    ids.reserve(ids.size() + cs.tracklets.size());
                     for(const auto& t : cs.tracklets) ids.push_back(t.id);
                 }
                 std::sort(ids.begin(), ids.end());
@@ -297,7 +427,7 @@ class OCSTracker::State {
           float inertia_ = 0.2,
           bool use_byte_ = false);
 
-    std::vector<Eigen::RowVectorXf> update(const std::vector<ImgDetection>& detections, const std::vector<Point3f>& spatialData, bool trackOnly = false);
+    void update(const std::vector<ImgDetection>& detections, const std::vector<Point3f>& spatialData, bool trackOnly = false);
     void remove_tracklets(const std::vector<int32_t>& ids) {
         for(auto& [_, cs] : class_states) {
             cs.remove_tracklets(ids);
@@ -315,63 +445,46 @@ class OCSTracker::State {
     }
 };
 
-OCSTracker::State::KalmanBoxTracker::KalmanBoxTracker(Eigen::VectorXf bbox_, int cls_, int delta_t_) {
-    bbox = std::move(bbox_);
+OCSTracker::State::KalmanBoxTracker::KalmanBoxTracker(const BoxVector& bbox_, int cls_, int delta_t_) {
+    bbox = bbox_;
     delta_t = delta_t_;
-    kf = std::make_shared<KalmanFilterNew>(7, 4);
-    kf->F << 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1;
-    kf->H << 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0;
-    kf->R.block(2, 2, 2, 2) *= 10.0;
-    kf->P.block(4, 4, 3, 3) *= 1000.0;
-    kf->P *= 10.0;
-    kf->Q.bottomRightCorner(1, 1)(0, 0) *= 0.01f;
-    kf->Q.block(4, 4, 3, 3) *= 0.01;
-    kf->x.head<4>() = convert_bbox_to_z(bbox);
+    kf.F << 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1;
+    kf.H << 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0;
+    kf.R.block<2, 2>(2, 2) *= 10.0f;
+    kf.P.block<3, 3>(4, 4) *= 1000.0f;
+    kf.P *= 10.0f;
+    kf.Q(6, 6) *= 0.01f;
+    kf.Q.block<3, 3>(4, 4) *= 0.01f;
+    kf.x.head<4>() = convert_bbox_to_z(bbox);
     time_since_update = 0;
-    history.clear();
     hits = 0;
     hit_streak = 0;
     age = 0;
     conf = bbox(4);
     cls = cls_;
     last_observation.fill(-1);
-    observations.clear();
-    history_observations.clear();
     velocity.fill(0);
 }
-void OCSTracker::State::KalmanBoxTracker::update(Eigen::Matrix<float, 5, 1>* bbox_, int cls_) {
+void OCSTracker::State::KalmanBoxTracker::update(const BoxVector* bbox_, int cls_) {
     if(bbox_ != nullptr) {
         conf = (*bbox_)[4];
         cls = cls_;
         if(int(last_observation.sum()) >= 0) {
-            Eigen::VectorXf previous_box_tmp;
-            for(int dt = delta_t; dt > 0; --dt) {
-                auto it = observations.find(age - dt);
-                if(it != observations.end()) {
-                    previous_box_tmp = it->second;
-                    break;
-                }
-            }
-            if(0 == previous_box_tmp.size()) {
-                previous_box_tmp = last_observation;
+            const BoxVector* previous_box = nullptr;
+            for(int dt = delta_t; dt > 0 && previous_box == nullptr; --dt) {
+                previous_box = observations.find(age - dt);
             }
-            const int maxSize = 300;
-            if(observations.size() > maxSize) {
-                observations.erase(observations.begin());
-            }
-            velocity = speed_direction(previous_box_tmp, *bbox_);
+            velocity = speed_direction(previous_box ? *previous_box : BoxVector(last_observation.transpose()), *bbox_);
         }
-        last_observation = *bbox_;
-        observations[age] = *bbox_;
-        history_observations.push_back(*bbox_);
+        last_observation = bbox_->transpose();
+        observations.push(age, *bbox_);
         time_since_update = 0;
-        history.clear();
         hits += 1;
         hit_streak += 1;
-        Eigen::VectorXf tmp = convert_bbox_to_z(*bbox_);
-        kf->update(tmp);
+        const MeasurementVector tmp = convert_bbox_to_z(*bbox_);
+        kf.update(&tmp);
     } else {
-        kf->update(Eigen::VectorXf());
+        kf.update(nullptr);
     }
 }
 
@@ -403,100 +516,88 @@ OCSTracker::State::ClassState::ClassState(State* parent_,
     trackers.clear();
     frame_count = 0;
     det_thresh = det_thresh_;
-    delta_t = delta_t_;
-    std::unordered_map<std::string, std::function<Eigen::MatrixXf(const Eigen::MatrixXf&, const Eigen::MatrixXf&)>> ASSO_FUNCS{{"iou", iou_batch},
-                                                                                                                               {"giou", giou_batch}};
-    ;
-    asso_func = ASSO_FUNCS[asso_func_];
+    // Observations further back than the history holds are never looked up
+    delta_t = std::min(delta_t_, ObservationHistory::CAPACITY);
+    static const std::unordered_map<std::string, AssoFunc> ASSO_FUNCS{{"iou", iou_batch}, {"giou", giou_batch}};
+    asso_func = ASSO_FUNCS.at(asso_func_);
     inertia = inertia_;
     use_byte = use_byte_;
 }
-std::vector<Eigen::RowVectorXf> OCSTracker::State::ClassState::update(const std::vector<ImgDetection>& detections,
-                                                                      const std::vector<Point3f>& spatialData,
-                                                                      bool trackOnly) {
+void OCSTracker::State::ClassState::update(const std::vector<ImgDetection>& detections,
+                                           const std::vector<Point3f>& spatialData,
+                                           const std::vector<uint32_t>& indices,
+                                           bool trackOnly) {
     /*
-     * dets: (n,7): [[x1,y1,x2,y2,confidence_score, class, idx],...[...]]
+     * dets: (n,5): [[x1,y1,x2,y2,confidence_score],...[...]], the class and the index into detections are kept alongside
      * Params:
     dets - a numpy array of detections in the format [[x1,y1,x2,y2,score],[x1,y1,x2,y2,score],...]
     Requires: this method must be called once for each frame even with empty detections (use np.empty((0, 5)) for frames without detections).
-    Returns the a similar array, where the last column is the object ID.
     NOTE: The number of objects returned may differ from the number of detections provided.
      */
 
-    if(detections.size() != spatialData.size()) {
-        throw std::runtime_error("Number of detections and spatial data points must match");
-    }
-
     prep();
 
-    Eigen::Matrix<float, Eigen::Dynamic, 7> dets(detections.size(), 7);
-
-    for(size_t i = 0; i < detections.size(); i++) {
-        const auto& detection = detections[i];
-        // Convert normalized coordinates to absolute coordinates
-        dets(i, 0) = detection.xmin;        // x1
-        dets(i, 1) = detection.ymin;        // y1
-        dets(i, 2) = detection.xmax;        // x2
-        dets(i, 3) = detection.ymax;        // y2
-        dets(i, 4) = detection.confidence;  // confidence
-        dets(i, 5) = detection.label;       // class_id
-        dets(i, 6) = i;
-    }
+    auto& ws = parent->workspace;
+    auto spatialAt = [&spatialData](uint32_t index) { return index < spatialData.size() ? spatialData[index] : Point3f(0, 0, 0); };
 
     frame_count += 1;
-    Eigen::Matrix<float, Eigen::Dynamic, 4> xyxys = dets.leftCols(4);
-    Eigen::Matrix<float, 1, Eigen::Dynamic> confs = dets.col(4);
-    Eigen::Matrix<float, 1, Eigen::Dynamic> clss = dets.col(5);
-    Eigen::MatrixXf output_results = dets;
-    auto inds_low = confs.array() > 0.1;
-    auto inds_high = confs.array() < det_thresh;
-    auto inds_second = inds_low && inds_high;
-    Eigen::Matrix<float, Eigen::Dynamic, 7> dets_second;
-    Eigen::Matrix<bool, 1, Eigen::Dynamic> remain_inds = (confs.array() > det_thresh);
-    Eigen::Matrix<float, Eigen::Dynamic, 7> dets_first;
-    for(int i = 0; i < output_results.rows(); i++) {
-        if(true == inds_second(i)) {
-            dets_second.conservativeResize(dets_second.rows() + 1, Eigen::NoChange);
-            dets_second.row(dets_second.rows() - 1) = output_results.row(i);
+    ws.dets_first.clear();
+    ws.dets_second.clear();
+    ws.first_index.clear();
+    ws.second_index.clear();
+    for(const auto index : indices) {
+        const auto& detection = detections[index];
+        // Convert normalized coordinates to absolute coordinates
+        BoxVector box;
+        box << detection.xmin, detection.ymin, detection.xmax, detection.ymax, detection.confidence;
+        if(detection.confidence > 0.1f && detection.confidence < det_thresh) {
+            ws.dets_second.push_back(box);
+            ws.second_index.push_back(index);
         }
-        if(true == remain_inds(i)) {
-            dets_first.conservativeResize(dets_first.rows() + 1, Eigen::NoChange);
-            dets_first.row(dets_first.rows() - 1) = output_results.row(i);
+        if(detection.confidence > det_thresh) {
+            ws.dets_first.push_back(box);
+            ws.first_index.push_back(index);
         }
     }
     /*get predicted locations from existing trackers.*/
-    Eigen::MatrixXf trks = Eigen::MatrixXf::Zero(trackers.size(), 5);
-    std::vector<int> to_del;
-    std::vector<Eigen::RowVectorXf> ret;
-    for(int i = 0; i < trks.rows(); i++) {
-        Eigen::RowVectorXf pos = trackers[i].predict();
-        trks.row(i) << pos(0), pos(1), pos(2), pos(3), 0;
-    }
-    Eigen::MatrixXf velocities = Eigen::MatrixXf::Zero(trackers.size(), 2);
-    Eigen::MatrixXf last_boxes = Eigen::MatrixXf::Zero(trackers.size(), 5);
-    Eigen::MatrixXf k_observations = Eigen::MatrixXf::Zero(trackers.size(), 5);
-    for(uint32_t i = 0; i < trackers.size(); i++) {
-        velocities.row(i) = trackers[i].velocity;
-        last_boxes.row(i) = trackers[i].last_observation;
-        k_observations.row(i) = k_previous_obs(trackers[i].observations, trackers[i].age, delta_t);
+    const size_t num_trackers = trackers.size();
+    ws.trks.resize(num_trackers);
+    ws.velocities.resize(num_trackers);
+    ws.last_boxes.resize(num_trackers);
+    ws.k_observations.resize(num_trackers);
+    for(size_t i = 0; i < num_trackers; i++) {
+        const MeasurementVector pos = trackers[i].predict();
+        ws.trks[i] << pos(0), pos(1), pos(2), pos(3), 0;
     }
+    for(size_t i = 0; i < num_trackers; i++) {
+        ws.velocities[i] = trackers[i].velocity;
+        ws.last_boxes[i] = trackers[i].last_observation.transpose();
+        ws.k_observations[i] = k_previous_obs(trackers[i].observations, trackers[i].age, delta_t);
+    }
+
+    auto match = [&](int trk_ind, const BoxVector& bbox, uint32_t index) {
+        const auto& detection = detections[index];
+        trackers[trk_ind].update(&bbox, detection.label);
+        tracklets[trk_ind].update(Rect(bbox(0), bbox(1), bbox(2) - bbox(0), bbox(3) - bbox(1)), spatialAt(index));
+        tracklets[trk_ind].srcImgDetection = detection;
+    };
+    // unmatched = sorted(unmatched) \ sorted(removed)
+    auto removeIndices = [&ws](std::vector<int>& unmatched, std::vector<int>& removed) {
+        std::sort(unmatched.begin(), unmatched.end());
+        std::sort(removed.begin(), removed.end());
+        ws.difference.resize(unmatched.size());
+        auto end = std::set_difference(unmatched.begin(), unmatched.end(), removed.begin(), removed.end(), ws.difference.begin());
+        ws.difference.resize(end - ws.difference.begin());
+        std::swap(unmatched, ws.difference);
+    };
+    auto& lapjv = ws.association;
+
     /////////////////////////
     ///  Step1 First round of association
     ////////////////////////
-    std::vector<Eigen::Matrix<int, 1, 2>> matched;
-    std::vector<int> unmatched_dets;
-    std::vector<int> unmatched_trks;
-    auto result = associate(dets_first, trks, iou_threshold, velocities, k_observations, inertia);
-    matched = std::get<0>(result);
-    unmatched_dets = std::get<1>(result);
-    unmatched_trks = std::get<2>(result);
-    for(auto m : matched) {
-        Eigen::Matrix<float, 5, 1> tmp_bbox;
-        tmp_bbox = dets_first.block<1, 5>(m(0), 0);
-        uint32_t index = dets_first(m(0), 6);
-        trackers[m(1)].update(&(tmp_bbox), dets_first(m(0), 5));
-        tracklets[m(1)].update(Rect(tmp_bbox(0), tmp_bbox(1), tmp_bbox(2) - tmp_bbox(0), tmp_bbox(3) - tmp_bbox(1)), spatialData[index]);
-        tracklets[m(1)].srcImgDetection = detections[index];
+    associate(ws.dets_first, ws.trks, iou_threshold, ws.velocities, ws.k_observations, inertia, lapjv, ws.matched, ws.unmatched_dets, ws.unmatched_trks);
+    for(const auto& m : ws.matched) {
+        match(m(1), ws.dets_first[m(0)], ws.first_index[m(0)]);
         if(tracklets[m(1)].status == Tracklet::TrackingStatus::LOST) {
             tracklets[m(1)].updateStatus(Tracklet::TrackingStatus::TRACKED);
         } else if(tracklets[m(1)].status == Tracklet::TrackingStatus::NEW && tracklets[m(1)].age >= min_hits) {
@@ -507,139 +608,92 @@ std::vector<Eigen::RowVectorXf> OCSTracker::State::ClassState::update(const std:
     ///////////////////////
     /// Step2 Second round of associaton by OCR to find lost tracks back
     //////////////////////
-    if(true == use_byte && dets_second.rows() > 0 && unmatched_trks.size() > 0) {
-        Eigen::MatrixXf u_trks(unmatched_trks.size(), trks.cols());
-        int index_for_u_trks = 0;
-        for(auto i : unmatched_trks) {
-            u_trks.row(index_for_u_trks++) = trks.row(i);
+    if(true == use_byte && !ws.dets_second.empty() && !ws.unmatched_trks.empty()) {
+        ws.left_trks.clear();
+        for(auto i : ws.unmatched_trks) {
+            ws.left_trks.push_back(ws.trks[i]);
         }
-        Eigen::MatrixXf iou_left = asso_func(dets_second, u_trks);
-        // Eigen::MatrixXf iou_left = asso_func(dets_second, u_trks);
+        auto& iou_left = ws.iou_left;
+        asso_func(ws.dets_second, ws.left_trks, iou_left);
         if(iou_left.maxCoeff() > iou_threshold) {
             /**
                 NOTE: by using a lower threshold, e.g., self.iou_threshold - 0.1, you may
                 get a higher performance especially on MOT17/MOT20 datasets. But we keep it
                 uniform here for simplicity
              * */
-            std::vector<std::vector<float>> iou_matrix(iou_left.rows(), std::vector<float>(iou_left.cols()));
-            for(int i = 0; i < iou_left.rows(); i++) {
-                for(int j = 0; j < iou_left.cols(); j++) {
-                    iou_matrix[i][j] = -iou_left(i, j);
-                }
-            }
-            std::vector<int> rowsol, colsol;
-            execLapjv(iou_matrix, rowsol, colsol, true, 0.01, true);
-            std::vector<std::vector<int>> matched_indices;
-            for(uint32_t i = 0; i < rowsol.size(); i++) {
-                if(rowsol.at(i) >= 0) {
-                    matched_indices.push_back({colsol.at(rowsol.at(i)), rowsol.at(i)});
-                }
-            }
-
-            std::vector<int> to_remove_trk_indices;
-            for(auto m : matched_indices) {
-                int det_ind = m[0];
-                int trk_ind = unmatched_trks[m[1]];
-                if(iou_left(m[0], m[1]) < iou_threshold) continue;
-
-                Eigen::Matrix<float, 5, 1> tmp_box;
-                tmp_box = dets_second.block<1, 5>(det_ind, 0);
-                uint32_t index = dets_second(det_ind, 6);
-                trackers[trk_ind].update(&tmp_box, dets_second(det_ind, 5));
-                tracklets[trk_ind].update(Rect(tmp_box(0), tmp_box(1), tmp_box(2) - tmp_box(0), tmp_box(3) - tmp_box(1)), spatialData[index]);
-                tracklets[trk_ind].srcImgDetection = detections[index];
+            lapjv.cost.resize(iou_left.rows, iou_left.cols);
+            for(int i = 0; i < iou_left.rows * iou_left.cols; i++) lapjv.cost.data[i] = -iou_left.data[i];
+            execLapjv(lapjv.cost, lapjv.rowsol, lapjv.colsol, true, 0.01, true, lapjv.lapjv);
+
+            ws.to_remove_trks.clear();
+            for(uint32_t i = 0; i < lapjv.rowsol.size(); i++) {
+                if(lapjv.rowsol[i] < 0) continue;
+                const int det_ind = lapjv.colsol[lapjv.rowsol[i]];
+                const int trk_ind = ws.unmatched_trks[lapjv.rowsol[i]];
+                if(iou_left(det_ind, lapjv.rowsol[i]) < iou_threshold) continue;
+
+                match(trk_ind, ws.dets_second[det_ind], ws.second_index[det_ind]);
                 if(tracklets[trk_ind].status == Tracklet::TrackingStatus::LOST) {
                     tracklets[trk_ind].updateStatus(Tracklet::TrackingStatus::TRACKED);
                 } else if(tracklets[trk_ind].status == Tracklet::TrackingStatus::NEW && tracklets[trk_ind].age >= min_hits) {
                     tracklets[trk_ind].updateStatus(Tracklet::TrackingStatus::TRACKED);
                 }
-                to_remove_trk_indices.push_back(trk_ind);
+                ws.to_remove_trks.push_back(trk_ind);
             }
-            std::vector<int> tmp_res1(unmatched_trks.size());
-            sort(unmatched_trks.begin(), unmatched_trks.end());
-            sort(to_remove_trk_indices.begin(), to_remove_trk_indices.end());
-            auto end1 =
-                set_difference(unmatched_trks.begin(), unmatched_trks.end(), to_remove_trk_indices.begin(), to_remove_trk_indices.end(), tmp_res1.begin());
-            tmp_res1.resize(end1 - tmp_res1.begin());
-            unmatched_trks = tmp_res1;
+            removeIndices(ws.unmatched_trks, ws.to_remove_trks);
         }
     }
 
-    if(unmatched_dets.size() > 0 && unmatched_trks.size() > 0) {
-        Eigen::MatrixXf left_dets(unmatched_dets.size(), 7);
-        int inx_for_dets = 0;
-        for(auto i : unmatched_dets) {
-            left_dets.row(inx_for_dets++) = dets_first.row(i);
+    if(!ws.unmatched_dets.empty() && !ws.unmatched_trks.empty()) {
+        ws.left_dets.clear();
+        for(auto i : ws.unmatched_dets) {
+            ws.left_dets.push_back(ws.dets_first[i]);
         }
-        Eigen::MatrixXf left_trks(unmatched_trks.size(), last_boxes.cols());
-        int indx_for_trk = 0;
-        for(auto i : unmatched_trks) {
-            left_trks.row(indx_for_trk++) = last_boxes.row(i);
+        ws.left_trks.clear();
+        for(auto i : ws.unmatched_trks) {
+            ws.left_trks.push_back(ws.last_boxes[i]);
         }
-        Eigen::MatrixXf iou_left = asso_func(left_dets, left_trks);
+        auto& iou_left = ws.iou_left;
+        asso_func(ws.left_dets, ws.left_trks, iou_left);
         if(iou_left.maxCoeff() > iou_threshold) {
             /**
                 NOTE: by using a lower threshold, e.g., self.iou_threshold - 0.1, you may
                 get a higher performance especially on MOT17/MOT20 datasets. But we keep it
                 uniform here for simplicity
              * */
-            std::vector<std::vector<float>> iou_matrix(iou_left.rows(), std::vector<float>(iou_left.cols()));
-            for(int i = 0; i < iou_left.rows(); i++) {
-                for(int j = 0; j < iou_left.cols(); j++) {
-                    iou_matrix[i][j] = -iou_left(i, j);
-                }
-            }
-            std::vector<int> rowsol, colsol;
-            execLapjv(iou_matrix, rowsol, colsol, true, 0.01, true);
-            std::vector<std::vector<int>> rematched_indices;
-            for(uint32_t i = 0; i < rowsol.size(); i++) {
-                if(rowsol.at(i) >= 0) {
-                    rematched_indices.push_back({colsol.at(rowsol.at(i)), rowsol.at(i)});
-                }
-            }
-            std::vector<int> to_remove_det_indices;
-            std::vector<int> to_remove_trk_indices;
-            for(auto i : rematched_indices) {
-                int det_ind = unmatched_dets[i.at(0)];
-                int trk_ind = unmatched_trks[i.at(1)];
-                if(iou_left(i.at(0), i.at(1)) < iou_threshold) {
+            lapjv.cost.resize(iou_left.rows, iou_left.cols);
+            for(int i = 0; i < iou_left.rows * iou_left.cols; i++) lapjv.cost.data[i] = -iou_left.data[i];
+            execLapjv(lapjv.cost, lapjv.rowsol, lapjv.colsol, true, 0.01, true, lapjv.lapjv);
+
+            ws.to_remove_dets.clear();
+            ws.to_remove_trks.clear();
+            for(uint32_t i = 0; i < lapjv.rowsol.size(); i++) {
+                if(lapjv.rowsol[i] < 0) continue;
+                const int left_det = lapjv.colsol[lapjv.rowsol[i]];
+                const int left_trk = lapjv.rowsol[i];
+                const int det_ind = ws.unmatched_dets[left_det];
+                const int trk_ind = ws.unmatched_trks[left_trk];
+                if(iou_left(left_det, left_trk) < iou_threshold) {
                     continue;
                 }
                 ////////////////////////////////
                 ///  Step3  update status of second matched tracks
                 ///////////////////////////////
-                Eigen::Matrix<float, 5, 1> tmp_bbox;
-                tmp_bbox = dets_first.block<1, 5>(det_ind, 0);
-                uint32_t index = dets_first(det_ind, 6);
-                trackers.at(trk_ind).update(&tmp_bbox, dets_first(det_ind, 5));
-                tracklets[trk_ind].update(Rect(tmp_bbox(0), tmp_bbox(1), tmp_bbox(2) - tmp_bbox(0), tmp_bbox(3) - tmp_bbox(1)), spatialData[index]);
-                tracklets[trk_ind].srcImgDetection = detections[index];
+                match(trk_ind, ws.dets_first[det_ind], ws.first_index[det_ind]);
                 if(tracklets[trk_ind].status == Tracklet::TrackingStatus::LOST) {
                     tracklets[trk_ind].updateStatus(Tracklet::TrackingStatus::TRACKED);
                 } else if(tracklets[trk_ind].status == Tracklet::TrackingStatus::NEW && trackers[trk_ind].hit_streak >= min_hits) {
                     tracklets[trk_ind].updateStatus(Tracklet::TrackingStatus::TRACKED);
                 }
-                to_remove_det_indices.push_back(det_ind);
-                to_remove_trk_indices.push_back(trk_ind);
+                ws.to_remove_dets.push_back(det_ind);
+                ws.to_remove_trks.push_back(trk_ind);
             }
-            std::vector<int> tmp_res(unmatched_dets.size());
-            sort(unmatched_dets.begin(), unmatched_dets.end());
-            sort(to_remove_det_indices.begin(), to_remove_det_indices.end());
-            auto end =
-                set_difference(unmatched_dets.begin(), unmatched_dets.end(), to_remove_det_indices.begin(), to_remove_det_indices.end(), tmp_res.begin());
-            tmp_res.resize(end - tmp_res.begin());
-            unmatched_dets = tmp_res;
-            std::vector<int> tmp_res1(unmatched_trks.size());
-            sort(unmatched_trks.begin(), unmatched_trks.end());
-            sort(to_remove_trk_indices.begin(), to_remove_trk_indices.end());
-            auto end1 =
-                set_difference(unmatched_trks.begin(), unmatched_trks.end(), to_remove_trk_indices.begin(), to_remove_trk_indices.end(), tmp_res1.begin());
-            tmp_res1.resize(end1 - tmp_res1.begin());
-            unmatched_trks = tmp_res1;
+            removeIndices(ws.unmatched_dets, ws.to_remove_dets);
+            removeIndices(ws.unmatched_trks, ws.to_remove_trks);
         }
     }
 
-    for(auto m : unmatched_trks) {
+    for(auto m : ws.unmatched_trks) {
         trackers.at(m).update(nullptr, 0);
         if(!trackOnly) {
             if(tracklets[m].status == Tracklet::TrackingStatus::TRACKED) {
@@ -653,71 +707,47 @@ std::vector<Eigen::RowVectorXf> OCSTracker::State::ClassState::update(const std:
     /// Step4 Initialize new tracks and remove expired tracks
     ///////////////////////////////
     /*create and initialise new trackers for unmatched detections*/
-    for(int i : unmatched_dets) {
+    for(int i : ws.unmatched_dets) {
         if(parent->num_trackers < parent->max_trackers) {
-            Eigen::RowVectorXf tmp_bbox = dets_first.block(i, 0, 1, 5);
-            uint32_t index = dets_first(i, 6);
-            int cls_ = int(dets(i, 5));
-            KalmanBoxTracker trk = KalmanBoxTracker(tmp_bbox, cls_, delta_t);
+            const BoxVector& bbox = ws.dets_first[i];
+            const uint32_t index = ws.first_index[i];
+            const int cls_ = static_cast<int>(detections[index].label);
             ++parent->num_trackers;
-            trackers.push_back(trk);
-            tracklets.push_back(TrackletExt{Tracklet{Rect(tmp_bbox(0), tmp_bbox(1), tmp_bbox(2) - tmp_bbox(0), tmp_bbox(3) - tmp_bbox(1)),
+            trackers.emplace_back(bbox, cls_, delta_t);
+            tracklets.push_back(TrackletExt{Tracklet{Rect(bbox(0), bbox(1), bbox(2) - bbox(0), bbox(3) - bbox(1)),
                                                      (int)parent->get_next_id(),
                                                      cls_,
                                                      1,
                                                      Tracklet::TrackingStatus::NEW,
                                                      detections[index],
-                                                     spatialData[index]}});
+                                                     spatialAt(index)}});
         }
     }
+    // remove dead tracklets
     for(int i = trackers.size() - 1; i >= 0; i--) {
-        Eigen::Matrix<float, 1, 4> d;
-        int last_observation_sum = trackers.at(i).last_observation.sum();
-        if(last_observation_sum < 0) {
-            d = trackers.at(i).get_state();
-        } else {
-            /**
-                this is optional to use the recent observation or the kalman filter prediction,
-                we didn't notice significant difference here
-             * */
-            d = trackers.at(i).last_observation.block(0, 0, 1, 4);
-        }
-        if(trackers.at(i).time_since_update < 1 && ((trackers.at(i).hit_streak >= min_hits) | (frame_count <= min_hits))) {
-            // +1 as MOT benchmark requires positive
-            Eigen::RowVectorXf tracking_res(6);
-            tracking_res << d(0), d(1), d(2), d(3), trackers.at(i).cls, trackers.at(i).conf;
-            ret.push_back(tracking_res);
-        }
-        // remove dead tracklets
         if(trackers.at(i).time_since_update > max_age) {
             remove_tracker(i);
         }
     }
-    return ret;
 }
 
-std::vector<Eigen::RowVectorXf> OCSTracker::State::update(const std::vector<ImgDetection>& detections,
-                                                          const std::vector<Point3f>& spatialData,
-                                                          bool trackOnly) {
-    std::vector<Eigen::RowVectorXf> ret;
-    std::unordered_map<uint32_t, std::pair<std::vector<ImgDetection>, std::vector<Point3f>>> dets_map;
+void OCSTracker::State::update(const std::vector<ImgDetection>& detections, const std::vector<Point3f>& spatialData, bool trackOnly) {
+    // Every class state is updated each frame, even without detections of its class
+    auto& dets_by_class = workspace.dets_by_class;
+    for(auto& [index, indices] : dets_by_class) {
+        indices.clear();
+    }
     for(auto& [index, cs] : class_states) {
-        dets_map.try_emplace(index, std::pair<std::vector<ImgDetection>, std::vector<Point3f>>());
+        dets_by_class.try_emplace(index);
     }
     for(size_t i = 0; i < detections.size(); i++) {
         uint32_t index = track_by_class ? detections[i].label : 0;
-        dets_map[index].first.push_back(detections[i]);
-        if(i <= spatialData.size())
-            dets_map[index].second.push_back(spatialData[i]);
-        else
-            dets_map[index].second.push_back(Point3f(0, 0, 0));
+        dets_by_class[index].push_back(static_cast<uint32_t>(i));
     }
-    for(auto& [index, dets] : dets_map) {
-        class_states.try_emplace(index, this, det_thresh, max_age, min_hits, iou_threshold, delta_t, asso_func, inertia, use_byte);
-        auto out = class_states.at(index).update(dets.first, dets.second, trackOnly);
-        ret.insert(ret.end(), out.begin(), out.end());
+    for(auto& [index, indices] : dets_by_class) {
+        auto it = class_states.try_emplace(index, this, det_thresh, max_age, min_hits, iou_threshold, delta_t, asso_func, inertia, use_byte).first;
+        it->second.update(detections, spatialData, indices, trackOnly);
     }
-    return ret;
 }
 OCSTracker::State::State(float det_thresh_,
                          int max_age_,
@@ -743,238 +773,196 @@ OCSTracker::State::State(float det_thresh_,
     use_byte = use_byte_;
 }
 
-std::tuple<Eigen::MatrixXf, Eigen::MatrixXf> speed_direction_batch(const Eigen::MatrixXf& dets, const Eigen::MatrixXf& tracks) {
-    Eigen::VectorXf CX1 = (dets.col(0) + dets.col(2)) / 2.0;
-    Eigen::VectorXf CY1 = (dets.col(1) + dets.col(3)) / 2.f;
-    Eigen::MatrixXf CX2 = (tracks.col(0) + tracks.col(2)) / 2.f;
-    Eigen::MatrixXf CY2 = (tracks.col(1) + tracks.col(3)) / 2.f;
-    Eigen::MatrixXf dx = CX1.transpose().replicate(tracks.rows(), 1) - CX2.replicate(1, dets.rows());
-    Eigen::MatrixXf dy = CY1.transpose().replicate(tracks.rows(), 1) - CY2.replicate(1, dets.rows());
-    Eigen::MatrixXf norm = (dx.array().square() + dy.array().square()).sqrt() + 1e-6f;
-    dx = dx.array() / norm.array();
-    dy = dy.array() / norm.array();
-    return std::make_tuple(dy, dx);
-}
-Eigen::MatrixXf iou_batch(const Eigen::MatrixXf& bboxes1, const Eigen::MatrixXf& bboxes2) {
-    Eigen::Matrix<float, Eigen::Dynamic, 1> a = bboxes1.col(0);  // bboxes1[..., 0] (n1,1)
-    Eigen::Matrix<float, 1, Eigen::Dynamic> b = bboxes2.col(0);  // bboxes2[..., 0] (1,n2)
-    Eigen::MatrixXf xx1 = (a.replicate(1, b.cols())).cwiseMax(b.replicate(a.rows(), 1));
-    a = bboxes1.col(1);  // bboxes1[..., 1]
-    b = bboxes2.col(1);  // bboxes2[..., 1]
-    Eigen::MatrixXf yy1 = (a.replicate(1, b.cols())).cwiseMax(b.replicate(a.rows(), 1));
-    a = bboxes1.col(2);  // bboxes1[..., 2]
-    b = bboxes2.col(2);  // bboxes1[..., 2]
-    Eigen::MatrixXf xx2 = (a.replicate(1, b.cols())).cwiseMin(b.replicate(a.rows(), 1));
-    a = bboxes1.col(3);  // bboxes1[..., 3]
-    b = bboxes2.col(3);  // bboxes1[..., 3]
-    Eigen::MatrixXf yy2 = (a.replicate(1, b.cols())).cwiseMin(b.replicate(a.rows(), 1));
-    Eigen::MatrixXf w = (xx2 - xx1).cwiseMax(0);
-    Eigen::MatrixXf h = (yy2 - yy1).cwiseMax(0);
-    Eigen::MatrixXf wh = w.array() * h.array();
-    a = (bboxes1.col(2) - bboxes1.col(0)).array() * (bboxes1.col(3) - bboxes1.col(1)).array();
-    b = (bboxes2.col(2) - bboxes2.col(0)).array() * (bboxes2.col(3) - bboxes2.col(1)).array();
-
-    Eigen::MatrixXf part1_ = a.replicate(1, b.cols());
-    Eigen::MatrixXf part2_ = b.replicate(a.rows(), 1);
-    Eigen::MatrixXf Sum = part1_ + part2_ - wh;
-    return wh.cwiseQuotient(Sum);
+// Fills out (n1,n2) with the pairwise overlap terms of two box lists, calling fn(i, j, iou, wh, xx1, yy1, xx2, yy2) for every pair
+template <typename Fn>
+void pairwise_overlap(const BoxList& bboxes1, const BoxList& bboxes2, Fn&& fn) {
+    for(size_t i = 0; i < bboxes1.size(); i++) {
+        const auto& a = bboxes1[i];
+        const float area1 = (a(2) - a(0)) * (a(3) - a(1));
+        for(size_t j = 0; j < bboxes2.size(); j++) {
+            const auto& b = bboxes2[j];
+            const float w = std::max(std::min(a(2), b(2)) - std::max(a(0), b(0)), 0.f);
+            const float h = std::max(std::min(a(3), b(3)) - std::max(a(1), b(1)), 0.f);
+            const float wh = w * h;
+            const float area2 = (b(2) - b(0)) * (b(3) - b(1));
+            fn(i, j, wh / (area1 + area2 - wh), wh);
+        }
+    }
 }
 /**
  *
- * @param bboxes1 (n1,7)
+ * @param bboxes1 (n1,5)
  * @param bboxes2 (n2,5)
- * @return (n1,n2)
+ * @param out (n1,n2)
  */
-Eigen::MatrixXf giou_batch(const Eigen::MatrixXf& bboxes1, const Eigen::MatrixXf& bboxes2) {
-    Eigen::Matrix<float, Eigen::Dynamic, 1> a = bboxes1.col(0);  // bboxes1[..., 0] (n1,1)
-    Eigen::Matrix<float, 1, Eigen::Dynamic> b = bboxes2.col(0);  // bboxes2[..., 0] (1,n2)
-    Eigen::MatrixXf xx1 = (a.replicate(1, b.cols())).cwiseMax(b.replicate(a.rows(), 1));
-    a = bboxes1.col(1);  // bboxes1[..., 1]
-    b = bboxes2.col(1);  // bboxes2[..., 1]
-    Eigen::MatrixXf yy1 = (a.replicate(1, b.cols())).cwiseMax(b.replicate(a.rows(), 1));
-    a = bboxes1.col(2);  // bboxes1[..., 2]
-    b = bboxes2.col(2);  // bboxes1[..., 2]
-    Eigen::MatrixXf xx2 = (a.replicate(1, b.cols())).cwiseMin(b.replicate(a.rows(), 1));
-    a = bboxes1.col(3);  // bboxes1[..., 3]
-    b = bboxes2.col(3);  // bboxes1[..., 3]
-    Eigen::MatrixXf yy2 = (a.replicate(1, b.cols())).cwiseMin(b.replicate(a.rows(), 1));
-    Eigen::MatrixXf w = (xx2 - xx1).cwiseMax(0);
-    Eigen::MatrixXf h = (yy2 - yy1).cwiseMax(0);
-    Eigen::MatrixXf wh = w.array() * h.array();
-    a = (bboxes1.col(2) - bboxes1.col(0)).array() * (bboxes1.col(3) - bboxes1.col(1)).array();
-    b = (bboxes2.col(2) - bboxes2.col(0)).array() * (bboxes2.col(3) - bboxes2.col(1)).array();
-
-    Eigen::MatrixXf part1_ = a.replicate(1, b.cols());
-    Eigen::MatrixXf part2_ = b.replicate(a.rows(), 1);
-    Eigen::MatrixXf Sum = part1_ + part2_ - wh;
-    Eigen::MatrixXf iou = wh.cwiseQuotient(Sum);
-
-    a = bboxes1.col(0);
-    b = bboxes2.col(0);
-    Eigen::MatrixXf xxc1 = (a.replicate(1, b.cols())).cwiseMin(b.replicate(a.rows(), 1));
-    a = bboxes1.col(1);  // bboxes1[..., 1]
-    b = bboxes2.col(1);  // bboxes2[..., 1]
-    Eigen::MatrixXf yyc1 = (a.replicate(1, b.cols())).cwiseMin(b.replicate(a.rows(), 1));
-    a = bboxes1.col(2);  // bboxes1[..., 2]
-    b = bboxes2.col(2);  // bboxes1[..., 2]
-    Eigen::MatrixXf xxc2 = (a.replicate(1, b.cols())).cwiseMax(b.replicate(a.rows(), 1));
-    a = bboxes1.col(3);  // bboxes1[..., 3]
-    b = bboxes2.col(3);  // bboxes1[..., 3]
-    Eigen::MatrixXf yyc2 = (a.replicate(1, b.cols())).cwiseMax(b.replicate(a.rows(), 1));
-
-    Eigen::MatrixXf wc = xxc2 - xxc1;
-    Eigen::MatrixXf hc = yyc2 - yyc1;
-
-    if((wc.array() > 0).all() && (hc.array() > 0).all())
-        return iou;
-    else {
-        Eigen::MatrixXf area_enclose = wc.array() * hc.array();
-        Eigen::MatrixXf giou = iou.array() - (area_enclose.array() - wh.array()) / area_enclose.array();
-        giou = (giou.array() + 1) / 2.0;
-        return giou;
+void iou_batch(const BoxList& bboxes1, const BoxList& bboxes2, CostMatrix& out) {
+    out.resize(bboxes1.size(), bboxes2.size());
+    pairwise_overlap(bboxes1, bboxes2, [&out](int i, int j, float iou, float /* wh */) { out(i, j) = iou; });
+}
+void giou_batch(const BoxList& bboxes1, const BoxList& bboxes2, CostMatrix& out) {
+    out.resize(bboxes1.size(), bboxes2.size());
+    // The enclosing box only matters if any pair has an empty one, then all pairs use giou
+    bool all_enclosed = true;
+    for(const auto& a : bboxes1) {
+        for(const auto& b : bboxes2) {
+            const float wc = std::max(a(2), b(2)) - std::min(a(0), b(0));
+            const float hc = std::max(a(3), b(3)) - std::min(a(1), b(1));
+            all_enclosed = all_enclosed && wc > 0 && hc > 0;
+        }
     }
+    pairwise_overlap(bboxes1, bboxes2, [&](int i, int j, float iou, float wh) {
+        if(all_enclosed) {
+            out(i, j) = iou;
+            return;
+        }
+        const auto& a = bboxes1[i];
+        const auto& b = bboxes2[j];
+        const float area_enclose = (std::max(a(2), b(2)) - std::min(a(0), b(0))) * (std::max(a(3), b(3)) - std::min(a(1), b(1)));
+        const float giou = iou - (area_enclose - wh) / area_enclose;
+        out(i, j) = (giou + 1) / 2.0f;
+    });
 }
 
-std::tuple<std::vector<Eigen::Matrix<int, 1, 2>>, std::vector<int>, std::vector<int>> associate(
-    Eigen::MatrixXf detections, Eigen::MatrixXf trackers, float iou_threshold, Eigen::MatrixXf velocities, Eigen::MatrixXf previous_obs_, float vdc_weight) {
-    if(trackers.rows() == 0) {
-        std::vector<int> unmatched_dets;
-        for(int i = 0; i < detections.rows(); i++) {
-            unmatched_dets.push_back(i);
+void associate(const BoxList& detections,
+               const BoxList& trackers,
+               float iou_threshold,
+               const std::vector<Velocity>& velocities,
+               const BoxList& previous_obs,
+               float vdc_weight,
+               AssociationWorkspace& ws,
+               std::vector<Match>& matches,
+               std::vector<int>& unmatched_detections,
+               std::vector<int>& unmatched_trackers) {
+    const int num_dets = detections.size();
+    const int num_trks = trackers.size();
+    matches.clear();
+    unmatched_detections.clear();
+    unmatched_trackers.clear();
+    if(num_trks == 0) {
+        for(int i = 0; i < num_dets; i++) {
+            unmatched_detections.push_back(i);
+        }
+        return;
+    }
+    auto& iou_matrix = ws.iou;
+    iou_batch(detections, trackers, iou_matrix);
+
+    auto& matched_indices = ws.candidates;
+    matched_indices.clear();
+    if(std::min(num_dets, num_trks) > 0) {
+        // Fast path if every detection and tracker has at most one candidate above the threshold
+        int max_per_det = 0;
+        ws.trkMatched.assign(num_trks, 0);
+        for(int i = 0; i < num_dets; i++) {
+            int count = 0;
+            for(int j = 0; j < num_trks; j++) {
+                if(iou_matrix(i, j) > iou_threshold) {
+                    ++count;
+                    ++ws.trkMatched[j];
+                }
+            }
+            max_per_det = std::max(max_per_det, count);
         }
-        return std::make_tuple(std::vector<Eigen::Matrix<int, 1, 2>>(), unmatched_dets, std::vector<int>());
-    }
-    Eigen::MatrixXf Y, X;
-    auto result = speed_direction_batch(detections, previous_obs_);
-    Y = std::get<0>(result);
-    X = std::get<1>(result);
-    Eigen::MatrixXf inertia_Y = velocities.col(0);
-    Eigen::MatrixXf inertia_X = velocities.col(1);
-    Eigen::MatrixXf inertia_Y_ = inertia_Y.replicate(1, Y.cols());
-    Eigen::MatrixXf inertia_X_ = inertia_X.replicate(1, X.cols());
-    Eigen::MatrixXf diff_angle_cos = inertia_X_.array() * X.array() + inertia_Y_.array() * Y.array();
-
-    diff_angle_cos = (diff_angle_cos.array().min(1).max(-1)).matrix();
-
-    Eigen::MatrixXf diff_angle = Eigen::acos(diff_angle_cos.array());
-
-    diff_angle = (pi / 2.0 - diff_angle.array().abs()).array() / (pi);
-    Eigen::Array<bool, 1, Eigen::Dynamic> valid_mask = Eigen::Array<bool, Eigen::Dynamic, 1>::Ones(previous_obs_.rows());
-    valid_mask = valid_mask.array() * ((previous_obs_.col(4).array() >= 0).transpose()).array();
-    Eigen::MatrixXf iou_matrix = iou_batch(detections, trackers);
-    Eigen::MatrixXf scores = detections.col(detections.cols() - 3).replicate(1, trackers.rows());
-    Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic> valid_mask_ = (valid_mask.transpose()).replicate(1, X.cols());
-    Eigen::MatrixXf angle_diff_cost;
-    auto valid_float = valid_mask_.cast<float>();
-    auto intermediate_result = (valid_float.array() * diff_angle.array() * vdc_weight).transpose();
-    angle_diff_cost.noalias() = (intermediate_result.array() * scores.array()).matrix();
-
-    Eigen::Matrix<float, Eigen::Dynamic, 2> matched_indices(0, 2);
-    if(std::min(iou_matrix.cols(), iou_matrix.rows()) > 0) {
-        Eigen::MatrixXf a = (iou_matrix.array() > iou_threshold).cast<float>();
-        float sum1 = (a.rowwise().sum()).maxCoeff();
-        float sum0 = (a.colwise().sum()).maxCoeff();
-
-        if((fabs((double)sum1 - 1) < 1e-12) && (fabs((double)sum0 - 1) < 1e-12)) {
-            for(int i = 0; i < a.rows(); i++) {
-                for(int j = 0; j < a.cols(); j++) {
-                    if(a(i, j) > 0) {
-                        Eigen::RowVectorXf row(2);
-                        row << i, j;
-                        matched_indices.conservativeResize(matched_indices.rows() + 1, Eigen::NoChange);
-                        matched_indices.row(matched_indices.rows() - 1) = row;
+        const int max_per_trk = *std::max_element(ws.trkMatched.begin(), ws.trkMatched.end());
+
+        if(max_per_det == 1 && max_per_trk == 1) {
+            for(int i = 0; i < num_dets; i++) {
+                for(int j = 0; j < num_trks; j++) {
+                    if(iou_matrix(i, j) > iou_threshold) {
+                        matched_indices.push_back(Match(i, j));
                     }
                 }
             }
         } else {
-            Eigen::MatrixXf cost_matrix = iou_matrix.array() + angle_diff_cost.array();
-
-            std::vector<std::vector<float>> cost_iou_matrix(cost_matrix.rows(), std::vector<float>(cost_matrix.cols()));
-            for(int i = 0; i < cost_matrix.rows(); i++) {
-                for(int j = 0; j < cost_matrix.cols(); j++) {
-                    cost_iou_matrix[i][j] = -cost_matrix(i, j);
+            // cost = -(iou + angle_diff_cost), the angle cost favours detections in the direction the tracker has been moving
+            const float half_pi = static_cast<float>(pi / 2.0);
+            const float pi_f = static_cast<float>(pi);
+            auto& cost_matrix = ws.cost;
+            cost_matrix.resize(num_dets, num_trks);
+            for(int i = 0; i < num_dets; i++) {
+                const auto& det = detections[i];
+                const float cx1 = (det(0) + det(2)) / 2.f;
+                const float cy1 = (det(1) + det(3)) / 2.f;
+                for(int j = 0; j < num_trks; j++) {
+                    const auto& prev = previous_obs[j];
+                    const float cx2 = (prev(0) + prev(2)) / 2.f;
+                    const float cy2 = (prev(1) + prev(3)) / 2.f;
+                    float dx = cx1 - cx2;
+                    float dy = cy1 - cy2;
+                    const float norm = std::sqrt(dx * dx + dy * dy) + 1e-6f;
+                    dx = dx / norm;
+                    dy = dy / norm;
+                    float diff_angle_cos = velocities[j](1) * dx + velocities[j](0) * dy;
+                    diff_angle_cos = std::max(std::min(diff_angle_cos, 1.f), -1.f);
+                    const float diff_angle = (half_pi - std::abs(std::acos(diff_angle_cos))) / pi_f;
+                    const float valid = prev(4) >= 0 ? 1.f : 0.f;
+                    const float angle_diff_cost = valid * diff_angle * vdc_weight * det(4);
+                    cost_matrix(i, j) = -(iou_matrix(i, j) + angle_diff_cost);
                 }
             }
 
-            std::vector<int> rowsol, colsol;
-            execLapjv(cost_iou_matrix, rowsol, colsol, true, 0.01, true);
-            for(uint32_t i = 0; i < rowsol.size(); i++) {
-                if(rowsol.at(i) >= 0) {
-                    Eigen::RowVectorXf row(2);
-                    row << colsol.at(rowsol.at(i)), rowsol.at(i);
-                    matched_indices.conservativeResize(matched_indices.rows() + 1, Eigen::NoChange);
-                    matched_indices.row(matched_indices.rows() - 1) = row;
+            execLapjv(cost_matrix, ws.rowsol, ws.colsol, true, 0.01, true, ws.lapjv);
+            for(uint32_t i = 0; i < ws.rowsol.size(); i++) {
+                if(ws.rowsol[i] >= 0) {
+                    matched_indices.push_back(Match(ws.colsol[ws.rowsol[i]], ws.rowsol[i]));
                 }
             }
         }
-    } else {
-        matched_indices = Eigen::MatrixXf(0, 2);
     }
-    std::vector<int> unmatched_detections;
-    for(int i = 0; i < detections.rows(); i++) {
-        if((matched_indices.col(0).array() == i).sum() == 0) {
+    ws.detMatched.assign(num_dets, 0);
+    ws.trkMatched.assign(num_trks, 0);
+    for(const auto& m : matched_indices) {
+        ws.detMatched[m(0)] = 1;
+        ws.trkMatched[m(1)] = 1;
+    }
+    for(int i = 0; i < num_dets; i++) {
+        if(!ws.detMatched[i]) {
             unmatched_detections.push_back(i);
         }
     }
-    std::vector<int> unmatched_trackers;
-    for(int i = 0; i < trackers.rows(); i++) {
-        if((matched_indices.col(1).array() == i).sum() == 0) {
+    for(int i = 0; i < num_trks; i++) {
+        if(!ws.trkMatched[i]) {
             unmatched_trackers.push_back(i);
         }
     }
-    std::vector<Eigen::Matrix<int, 1, 2>> matches;
-    Eigen::Matrix<int, 1, 2> tmp;
-    for(int i = 0; i < matched_indices.rows(); i++) {
-        tmp = (matched_indices.row(i)).cast<int>();
-        if(iou_matrix(tmp(0), tmp(1)) < iou_threshold) {
-            unmatched_detections.push_back(tmp(0));
-            unmatched_trackers.push_back(tmp(1));
+    for(const auto& m : matched_indices) {
+        if(iou_matrix(m(0), m(1)) < iou_threshold) {
+            unmatched_detections.push_back(m(0));
+            unmatched_trackers.push_back(m(1));
         } else {
-            matches.push_back(tmp);
+            matches.push_back(m);
         }
     }
-    if(matches.size() == 0) {
-        matches.clear();
-    }
-    return std::make_tuple(matches, unmatched_detections, unmatched_trackers);
 }
 
-Eigen::RowVectorXf OCSTracker::State::KalmanBoxTracker::predict() {
-    if(kf->x[6] + kf->x[2] <= 0) kf->x[6] *= 0.0f;
-    kf->predict();
+MeasurementVector OCSTracker::State::KalmanBoxTracker::predict() {
+    if(kf.x[6] + kf.x[2] <= 0) kf.x[6] *= 0.0f;
+    kf.predict();
     age += 1;
     if(time_since_update > 0) hit_streak = 0;
     time_since_update += 1;
 
-    auto vec_out = convert_x_to_bbox(kf->x);
-    history.push_back(vec_out);
-    return vec_out;
-}
-Eigen::VectorXf OCSTracker::State::KalmanBoxTracker::get_state() {
-    return convert_x_to_bbox(kf->x);
+    return convert_x_to_bbox(kf.x);
 }
 
-OCSTracker::State::KalmanFilterNew::KalmanFilterNew(int dim_x_, int dim_z_) {
-    dim_x = dim_x_;
-    dim_z = dim_z_;
-    x = Eigen::VectorXf::Zero(dim_x_, 1);
-    P = Eigen::MatrixXf::Identity(dim_x_, dim_x_);
-    Q = Eigen::MatrixXf::Identity(dim_x_, dim_x_);
-    B = Eigen::MatrixXf::Identity(dim_x_, dim_x_);
-    F = Eigen::MatrixXf::Identity(dim_x_, dim_x_);
-    H = Eigen::MatrixXf::Zero(dim_z_, dim_x_);
-    R = Eigen::MatrixXf::Identity(dim_z_, dim_z_);
-    M = Eigen::MatrixXf::Zero(dim_x_, dim_z_);
-    z = Eigen::VectorXf::Zero(dim_z_, 1);
+OCSTracker::State::KalmanFilterNew::KalmanFilterNew() {
+    x.setZero();
+    P.setIdentity();
+    Q.setIdentity();
+    F.setIdentity();
+    H.setZero();
+    R.setIdentity();
+    z.setZero();
     /*
         gain and residual are computed during the innovation step. We
         save them so that in case you want to inspect them for various
         purposes
     * */
-    K = Eigen::MatrixXf::Zero(dim_x_, dim_z_);
-    y = Eigen::VectorXf::Zero(dim_x_, 1);
-    S = Eigen::MatrixXf::Zero(dim_z_, dim_z_);
-    SI = Eigen::MatrixXf::Zero(dim_z_, dim_z_);
+    K.setZero();
+    y.setZero();
+    S.setZero();
+    SI.setZero();
+    last_obs.setZero();
 
     x_prior = x;
     P_prior = P;
@@ -1005,7 +993,7 @@ Q : np.array(dim_x, dim_x), scalar, or None
     x_prior = x;
     P_prior = P;
 }
-void OCSTracker::State::KalmanFilterNew::update(Eigen::VectorXf z_) {
+void OCSTracker::State::KalmanFilterNew::update(const MeasurementVector* z_) {
     /*
     Add a new measurement (z) to the Kalman filter.
     If z is None, nothing is computed. However, x_post and P_post are
@@ -1024,39 +1012,44 @@ void OCSTracker::State::KalmanFilterNew::update(Eigen::VectorXf z_) {
         Optionally provide H to override the measurement function for this
         one call, otherwise self.H will be used.
      * */
-    history_obs.push_back(z_);
-    if(z_.size() == 0) {
+    if(z_ == nullptr) {
+        ++history_length;
         if(true == observed) freeze();
         observed = false;
 
-        z = Eigen::VectorXf::Zero(dim_z, 1);
+        z.setZero();
         x_post = x;
         P_post = P;
-        y = Eigen::VectorXf::Zero(dim_z, 1);
+        y.setZero();
         return;
     }
 
-    if(false == observed) unfreeze();
+    bool restored = false;
+    if(false == observed) restored = unfreeze(*z_);
     observed = true;
+    if(!restored) {
+        last_obs_index = history_length++;
+        last_obs = *z_;
+    }
 
+    correct(*z_);
+}
+void OCSTracker::State::KalmanFilterNew::correct(const MeasurementVector& z_) {
     // y = z - Hx
     y.noalias() = z_ - H * x;
 
-    Eigen::MatrixXf PHT;
-    PHT.noalias() = P * H.transpose();
+    const Eigen::Matrix<float, 7, 4> PHT = P * H.transpose();
     // S = HPH' + R
     S.noalias() = H * PHT + R;
 
     SI = S.inverse();
     // K = PH'SI
     K.noalias() = PHT * SI;
-    x.noalias() = x + K * y;
+    x = x + K * y;
     /*This is more numerically stable and works for non-optimal K vs the
      * equation P = (I-KH)P usually seen in the literature.*/
-    Eigen::MatrixXf I_KH;
-    I_KH.noalias() = I - K * H;
-    Eigen::MatrixXf P_INT;
-    P_INT.noalias() = (I_KH * P);
+    const StateMatrix I_KH = StateMatrix::Identity() - K * H;
+    const StateMatrix P_INT = I_KH * P;
     P.noalias() = (P_INT * I_KH.transpose()) + ((K * R) * K.transpose());
     // save the measurement and posterior state
     z = z_;
@@ -1068,12 +1061,10 @@ void OCSTracker::State::KalmanFilterNew::freeze() {
     attr_saved.x = x;
     attr_saved.P = P;
     attr_saved.Q = Q;
-    attr_saved.B = B;
     attr_saved.F = F;
     attr_saved.H = H;
     attr_saved.R = R;
     attr_saved._alpha_sq = _alpha_sq;
-    attr_saved.M = M;
     attr_saved.z = z;
     attr_saved.K = K;
     attr_saved.y = y;
@@ -1083,160 +1074,115 @@ void OCSTracker::State::KalmanFilterNew::freeze() {
     attr_saved.P_prior = P_prior;
     attr_saved.x_post = x_post;
     attr_saved.P_post = P_post;
-    attr_saved.history_obs = history_obs;
 }
-void OCSTracker::State::KalmanFilterNew::unfreeze() {
-    if(true == attr_saved.IsInitialized) {
-        new_history = history_obs;
-        x = attr_saved.x;
-        P = attr_saved.P;
-        Q = attr_saved.Q;
-        B = attr_saved.B;
-        F = attr_saved.F;
-        H = attr_saved.H;
-        R = attr_saved.R;
-        _alpha_sq = attr_saved._alpha_sq;
-        M = attr_saved.M;
-        z = attr_saved.z;
-        K = attr_saved.K;
-        y = attr_saved.y;
-        S = attr_saved.S;
-        SI = attr_saved.SI;
-        x_prior = attr_saved.x_prior;
-        P_prior = attr_saved.P_prior;
-        x_post = attr_saved.x_post;
-        history_obs.erase(history_obs.end() - 1);
-        Eigen::VectorXf box1;
-        Eigen::VectorXf box2;
-        int lastNotNullIndex = -1;
-        int secondLastNotNullIndex = -1;
-        for(int i = new_history.size() - 1; i >= 0; i--) {
-            if(new_history[i].size() > 0) {
-                if(lastNotNullIndex == -1) {
-                    // The current element is the last non -NULLPTR element
-                    lastNotNullIndex = i;
-                    box2 = new_history.at(lastNotNullIndex);
-                } else if(secondLastNotNullIndex == -1) {
-                    // The current element is the last second non -NULLPTR element
-                    secondLastNotNullIndex = i;
-                    box1 = new_history.at(secondLastNotNullIndex);
-                    break;
-                }
-            }
-        }
-
-        double time_gap = lastNotNullIndex - secondLastNotNullIndex;
-
-        double x1 = (double)box1[0];
-        double x2 = (double)box2[0];
-        double y1 = (double)box1[1];
-        double y2 = (double)box2[1];
-        double w1 = (double)std::sqrt(box1[2] * box1[3]);
-        double h1 = (double)std::sqrt(box1[2] / box1[3]);
-        double w2 = (double)std::sqrt(box2[2] * box2[3]);
-        double h2 = (double)std::sqrt(box2[2] / box2[3]);
-
-        double dx = (x2 - x1) / time_gap;
-        double dy = (y1 - y2) / time_gap;
-        double dw = (w2 - w1) / time_gap;
-        double dh = (h2 - h1) / time_gap;
-
-        for(int i = 0; i < time_gap; i++) {
-            /*
-                The default virtual trajectory generation is by linear
-                motion (constant speed hypothesis), you could modify this
-                part to implement your own.
-             */
-            double x = x1 + (i + 1) * dx;
-            double y = y1 + (i + 1) * dy;
-            double w = w1 + (i + 1) * dw;
-            double h = h1 + (i + 1) * dh;
-            double s = w * h;
-            double r = w / (h * 1.0);
-            Eigen::VectorXf new_box(4, 1);
-            new_box << x, y, s, r;
-            /*
-                I still use predict-update loop here to refresh the parameters,
-                but this can be faster by directly modifying the internal parameters
-                as suggested in the paper. I keep this naive but slow way for
-                easy read and understanding
-             */
-
-            // y = z - Hx
-            this->y.noalias() = new_box - this->H * this->x;
-
-            Eigen::MatrixXf PHT;
-            PHT.noalias() = this->P * this->H.transpose();
-            // S = HPH' + R
-            this->S.noalias() = this->H * PHT + this->R;
-
-            this->SI = (this->S).inverse();
-            // K = PH'SI
-            this->K.noalias() = PHT * this->SI;
-
-            this->x.noalias() = this->x + this->K * this->y;
-
-            /*This is more numerically stable and works for non-optimal K vs the
-             * equation P = (I-KH)P usually seen in the literature.*/
-            Eigen::MatrixXf I_KH;
-            I_KH.noalias() = this->I - this->K * this->H;
-            Eigen::MatrixXf P_INT;
-            P_INT.noalias() = (I_KH * this->P);
-            this->P.noalias() = (P_INT * I_KH.transpose()) + ((this->K * this->R) * (this->K).transpose());
-            // save the measurement and posterior state
-            this->z = new_box;
-            this->x_post = this->x;
-            this->P_post = this->P;
-            if(i != (time_gap - 1)) predict();
-        }
-    } /* if attr_saved is null, do nothing */
+bool OCSTracker::State::KalmanFilterNew::unfreeze(const MeasurementVector& z_) {
+    /* if attr_saved is null, do nothing */
+    if(false == attr_saved.IsInitialized || last_obs_index < 0) return false;
+
+    x = attr_saved.x;
+    P = attr_saved.P;
+    Q = attr_saved.Q;
+    F = attr_saved.F;
+    H = attr_saved.H;
+    R = attr_saved.R;
+    _alpha_sq = attr_saved._alpha_sq;
+    z = attr_saved.z;
+    K = attr_saved.K;
+    y = attr_saved.y;
+    S = attr_saved.S;
+    SI = attr_saved.SI;
+    x_prior = attr_saved.x_prior;
+    P_prior = attr_saved.P_prior;
+    x_post = attr_saved.x_post;
+
+    // Virtual trajectory between the last kept observation and the new one
+    const MeasurementVector& box1 = last_obs;
+    const MeasurementVector& box2 = z_;
+    double time_gap = history_length - last_obs_index;
+
+    double x1 = (double)box1[0];
+    double x2 = (double)box2[0];
+    double y1 = (double)box1[1];
+    double y2 = (double)box2[1];
+    double w1 = (double)std::sqrt(box1[2] * box1[3]);
+    double h1 = (double)std::sqrt(box1[2] / box1[3]);
+    double w2 = (double)std::sqrt(box2[2] * box2[3]);
+    double h2 = (double)std::sqrt(box2[2] / box2[3]);
+
+    double dx = (x2 - x1) / time_gap;
+    double dy = (y1 - y2) / time_gap;
+    double dw = (w2 - w1) / time_gap;
+    double dh = (h2 - h1) / time_gap;
+
+    for(int i = 0; i < time_gap; i++) {
+        /*
+            The default virtual trajectory generation is by linear
+            motion (constant speed hypothesis), you could modify this
+            part to implement your own.
+         */
+        double x = x1 + (i + 1) * dx;
+        double y = y1 + (i + 1) * dy;
+        double w = w1 + (i + 1) * dw;
+        double h = h1 + (i + 1) * dh;
+        double s = w * h;
+        double r = w / (h * 1.0);
+        MeasurementVector new_box;
+        new_box << x, y, s, r;
+        /*
+            I still use predict-update loop here to refresh the parameters,
+            but this can be faster by directly modifying the internal parameters
+            as suggested in the paper. I keep this naive but slow way for
+            easy read and understanding
+         */
+        correct(new_box);
+        if(i != (time_gap - 1)) predict();
+    }
+    return true;
 }
 
-Eigen::VectorXf convert_bbox_to_z(Eigen::VectorXf bbox) {
+MeasurementVector convert_bbox_to_z(const BoxVector& bbox) {
     double w = (double)(bbox[2] - bbox[0]);
     double h = (double)(bbox[3] - bbox[1]);
     double x = (double)bbox[0] + w / 2.0;
     double y = (double)bbox[1] + h / 2.0;
     double s = w * h;
     double r = w / (h + 1e-6);
-    Eigen::MatrixXf z(4, 1);
+    MeasurementVector z;
     z << x, y, s, r;
     return z;
 }
-Eigen::VectorXf speed_direction(Eigen::VectorXf bbox1, Eigen::VectorXf bbox2) {
+Velocity speed_direction(const BoxVector& bbox1, const BoxVector& bbox2) {
     double cx1 = (double)(bbox1[0] + bbox1[2]) / 2.0;
     double cy1 = (double)(bbox1[1] + bbox1[3]) / 2.0;
     double cx2 = (double)(bbox2[0] + bbox2[2]) / 2.0;
     double cy2 = (double)(bbox2[1] + bbox2[3]) / 2.0;
-    Eigen::VectorXf speed(2, 1);
+    Velocity speed;
     speed << cy2 - cy1, cx2 - cx1;
     double norm = sqrt(pow(cy2 - cy1, 2) + pow(cx2 - cx1, 2)) + 1e-6;
-    return speed / norm;
+    return speed / static_cast<float>(norm);
 }
-Eigen::VectorXf convert_x_to_bbox(Eigen::VectorXf x) {
+MeasurementVector convert_x_to_bbox(const StateVector& x) {
     float w = std::sqrt(x(2) * x(3));
     float h = x(2) / w;
-    Eigen::VectorXf bbox = Eigen::VectorXf::Ones(4, 1);
+    MeasurementVector bbox;
     bbox << x(0) - w / 2, x(1) - h / 2, x(0) + w / 2, x(1) + h / 2;
     return bbox;
 }
-Eigen::VectorXf k_previous_obs(const std::map<int, Eigen::VectorXf>& observations, int cur_age, int k) {
-    if(observations.empty()) return Eigen::VectorXf::Constant(5, -1.0);
+BoxVector k_previous_obs(const ObservationHistory& observations, int cur_age, int k) {
+    if(observations.empty()) return BoxVector::Constant(-1.0f);
 
     for(int i = 0; i < k; ++i) {
         int dt = k - i;
-        auto it = observations.find(cur_age - dt);
-        if(it != observations.end()) return it->second;
+        if(const auto* obs = observations.find(cur_age - dt)) return *obs;
     }
-    auto max_iter = observations.rbegin();
-    return max_iter->second;
+    return observations.latest();
 }
 
+
 /** Column-reduction and reduction transfer for a dense cost matrix.
  */
-int_t _ccrrt_dense(const uint_t n, cost_t* cost[], int_t* free_rows, int_t* x, int_t* y, cost_t* v) {
+int_t _ccrrt_dense(const uint_t n, cost_t* cost[], int_t* free_rows, int_t* x, int_t* y, cost_t* v, boolean* unique) {
     int_t n_free_rows;
-    boolean* unique;
 
     for(uint_t i = 0; i < n; i++) {
         x[i] = -1;
@@ -1255,8 +1201,6 @@ int_t _ccrrt_dense(const uint_t n, cost_t* cost[], int_t* free_rows, int_t* x, i
     }
     PRINT_COST_ARRAY(v, n);
     PRINT_INDEX_ARRAY(y, n);
-    unique = new boolean[n];
-
     memset(unique, 1, n);
     {
         int_t j = n;
@@ -1291,7 +1235,6 @@ int_t _ccrrt_dense(const uint_t n, cost_t* cost[], int_t* free_rows, int_t* x, i
             v[j] -= min;
         }
     }
-    delete[] unique;
     return n_free_rows;
 }
 
@@ -1423,15 +1366,10 @@ int_t _scan_dense(const uint_t n, cost_t* cost[], uint_t* plo, uint_t* phi, cost
  *
  * \return The closest free column index.
  */
-int_t find_path_dense(const uint_t n, cost_t* cost[], const int_t start_i, int_t* y, cost_t* v, int_t* pred) {
+int_t find_path_dense(const uint_t n, cost_t* cost[], const int_t start_i, int_t* y, cost_t* v, int_t* pred, int_t* cols, cost_t* d) {
     uint_t lo = 0, hi = 0;
     int_t final_j = -1;
     uint_t n_ready = 0;
-    int_t* cols;
-    cost_t* d;
-
-    cols = new int_t[n];
-    d = new cost_t[n];
 
     for(uint_t i = 0; i < n; i++) {
         cols[i] = i;
@@ -1473,25 +1411,20 @@ int_t find_path_dense(const uint_t n, cost_t* cost[], const int_t start_i, int_t
         }
     }
 
-    delete[] cols;
-    delete[] d;
-
     return final_j;
 }
 
 /** Augment for a dense cost matrix.
  */
-int_t _ca_dense(const uint_t n, cost_t* cost[], const uint_t n_free_rows, int_t* free_rows, int_t* x, int_t* y, cost_t* v) {
-    int_t* pred;
-
-    pred = new int_t[n];
+int_t _ca_dense(const uint_t n, cost_t* cost[], const uint_t n_free_rows, int_t* free_rows, int_t* x, int_t* y, cost_t* v, LapjvWorkspace& ws) {
+    int_t* pred = ws.pred.data();
 
     for(int_t* pfree_i = free_rows; pfree_i < free_rows + n_free_rows; pfree_i++) {
         int_t i = -1, j;
         uint_t k = 0;
 
         PRINTF("looking at free_i=%d\n", *pfree_i);
-        j = find_path_dense(n, cost, *pfree_i, y, v, pred);
+        j = find_path_dense(n, cost, *pfree_i, y, v, pred, ws.cols.data(), ws.d.data());
         ASSERT(j >= 0);
         ASSERT(j < n);
         while(i != *pfree_i) {
@@ -1508,41 +1441,38 @@ int_t _ca_dense(const uint_t n, cost_t* cost[], const uint_t n_free_rows, int_t*
             }
         }
     }
-    delete[] pred;
     return 0;
 }
 
 /**
  * Solve dense sparse LAP.
  */
-int lapjv_internal(const uint_t n, cost_t* cost[], int_t* x, int_t* y) {
+int lapjv_internal(const uint_t n, cost_t* cost[], int_t* x, int_t* y, LapjvWorkspace& ws) {
     int ret;
-    int_t* free_rows;
-    cost_t* v;
-
-    free_rows = new int_t[n];
-    v = new cost_t[n];
-
-    ret = _ccrrt_dense(n, cost, free_rows, x, y, v);
+    ws.freeRows.resize(n);
+    ws.v.resize(n);
+    ws.unique.resize(n);
+    ws.cols.resize(n);
+    ws.d.resize(n);
+    ws.pred.resize(n);
+    int_t* free_rows = ws.freeRows.data();
+    cost_t* v = ws.v.data();
+
+    ret = _ccrrt_dense(n, cost, free_rows, x, y, v, ws.unique.data());
     int i = 0;
     while(ret > 0 && i < 2) {
         ret = _carr_dense(n, cost, ret, free_rows, x, y, v);
         i++;
     }
     if(ret > 0) {
-        ret = _ca_dense(n, cost, ret, free_rows, x, y, v);
+        ret = _ca_dense(n, cost, ret, free_rows, x, y, v, ws);
     }
-    delete[] v;
-    delete[] free_rows;
     return ret;
 }
 float execLapjv(
-    const std::vector<std::vector<float>>& cost, std::vector<int>& rowsol, std::vector<int>& colsol, bool extend_cost, float cost_limit, bool return_cost) {
-    std::vector<std::vector<float>> cost_c;
-    cost_c.assign(cost.begin(), cost.end());
-    std::vector<std::vector<float>> cost_c_extended;
-    int n_rows = cost.size();
-    int n_cols = cost[0].size();
+    const CostMatrix& cost, std::vector<int>& rowsol, std::vector<int>& colsol, bool extend_cost, float cost_limit, bool return_cost, LapjvWorkspace& ws) {
+    const int n_rows = cost.rows;
+    const int n_cols = cost.cols;
     rowsol.resize(n_rows);
     colsol.resize(n_cols);
     int n = 0;
@@ -1554,57 +1484,40 @@ float execLapjv(
         }
     }
 
+    auto& cost_c = ws.cost;
     if(extend_cost || cost_limit < std::numeric_limits<float>::max()) {
         n = n_rows + n_cols;
-        cost_c_extended.resize(n);
-        for(size_t i = 0; i < cost_c_extended.size(); i++) cost_c_extended[i].resize(n);
-
-        if(cost_limit < std::numeric_limits<float>::max()) {
-            for(size_t i = 0; i < cost_c_extended.size(); i++) {
-                for(size_t j = 0; j < cost_c_extended[i].size(); j++) {
-                    cost_c_extended[i][j] = cost_limit / 2.0f;
-                }
-            }
-        } else {
+        float fill = cost_limit / 2.0f;
+        if(cost_limit >= std::numeric_limits<float>::max()) {
             float cost_max = -1;
-            for(size_t i = 0; i < cost_c.size(); i++) {
-                for(size_t j = 0; j < cost_c[i].size(); j++) {
-                    if(cost_c[i][j] > cost_max) cost_max = cost_c[i][j];
-                }
-            }
-            for(size_t i = 0; i < cost_c_extended.size(); i++) {
-                for(size_t j = 0; j < cost_c_extended[i].size(); j++) {
-                    cost_c_extended[i][j] = cost_max + 1;
+            for(int i = 0; i < n_rows; i++) {
+                for(int j = 0; j < n_cols; j++) {
+                    if(cost(i, j) > cost_max) cost_max = cost(i, j);
                 }
             }
+            fill = cost_max + 1;
         }
-
-        for(size_t i = n_rows; i < cost_c_extended.size(); i++) {
-            for(size_t j = n_cols; j < cost_c_extended[i].size(); j++) {
-                cost_c_extended[i][j] = 0;
-            }
+        cost_c.assign(static_cast<size_t>(n) * n, fill);
+        for(int i = n_rows; i < n; i++) {
+            std::fill(cost_c.begin() + static_cast<size_t>(i) * n + n_cols, cost_c.begin() + static_cast<size_t>(i + 1) * n, 0.f);
         }
-        for(int i = 0; i < n_rows; i++) {
-            for(int j = 0; j < n_cols; j++) {
-                cost_c_extended[i][j] = cost_c[i][j];
-            }
-        }
-
-        cost_c.clear();
-        cost_c.assign(cost_c_extended.begin(), cost_c_extended.end());
+    } else {
+        cost_c.resize(static_cast<size_t>(n) * n);
     }
-
-    float** cost_ptr;
-    cost_ptr = new float*[n];
-    for(int i = 0; i < n; i++) cost_ptr[i] = new float[n];
-    for(int i = 0; i < n; i++) {
-        for(int j = 0; j < n; j++) {
-            cost_ptr[i][j] = cost_c[i][j];
+    for(int i = 0; i < n_rows; i++) {
+        for(int j = 0; j < n_cols; j++) {
+            cost_c[static_cast<size_t>(i) * n + j] = cost(i, j);
         }
     }
-    int* x_c = new int[n];
-    int* y_c = new int[n];
-    int ret = lapjv_internal(n, cost_ptr, x_c, y_c);
+
+    ws.rows.resize(n);
+    for(int i = 0; i < n; i++) ws.rows[i] = cost_c.data() + static_cast<size_t>(i) * n;
+    ws.x.resize(n);
+    ws.y.resize(n);
+    float** cost_ptr = ws.rows.data();
+    int* x_c = ws.x.data();
+    int* y_c = ws.y.data();
+    int ret = lapjv_internal(n, cost_ptr, x_c, y_c, ws);
     if(ret != 0) {
         throw std::runtime_error("The result of lapjv_internal() is invalid.");
     }
@@ -1628,18 +1541,19 @@ float execLapjv(
                 }
             }
         }
-    } else if(return_cost) {
-        for(size_t i = 0; i < rowsol.size(); i++) {
-            opt += cost_ptr[i][rowsol[i]];
+    } else {
+        for(int i = 0; i < n_rows; i++) {
+            rowsol[i] = x_c[i];
+        }
+        for(int i = 0; i < n_cols; i++) {
+            colsol[i] = y_c[i];
+        }
+        if(return_cost) {
+            for(size_t i = 0; i < rowsol.size(); i++) {
+                opt += cost_ptr[i][rowsol[i]];
+            }
         }
     }
-
-    for(int i = 0; i < n; i++) {
-        delete[] cost_ptr[i];
-    }
-    delete[] cost_ptr;
-    delete[] x_c;
-    delete[] y_c;
     return opt;
 }
 
@@ -1691,4 +1605,42 @@ std::vector<Tracklet> OCSTracker::getTracklets() const {
 }
 
 }  // namespace impl
+
+MultiStreamTracker::MultiStreamTracker(const ObjectTrackerProperties& properties, size_t numStreams) {
+    streams.reserve(numStreams);
+    for(size_t i = 0; i < numStreams; i++) {
+        streams.push_back(std::make_unique<impl::OCSTracker>(properties));
+    }
+}
+MultiStreamTracker::~MultiStreamTracker() = default;
+void MultiStreamTracker::process(const std::vector<StreamInput>& inputs) {
+    if(inputs.size() != streams.size()) {
+        throw std::runtime_error("MultiStreamTracker: number of inputs does not match the number of streams");
+    }
+    // Streams share nothing, so each one is a task of its own. Same logic as the ObjectTracker node: either update or track, not both
+    utility::ThreadPool::shared().parallelFor(streams.size(), [&](size_t i) {
+        const auto& input = inputs[i];
+        auto& tracker = *streams[i];
+        if(input.frame == nullptr) return;
+        if(input.config && tracker.isInitialized()) {
+            tracker.configure(*input.config);
+        }
+        if(input.detections) {
+            static const std::vector<Point3f> noSpatialData;
+            const auto& spatialData = input.spatialData ? *input.spatialData : noSpatialData;
+            if(!input.detections->empty() && !tracker.isInitialized()) {
+                tracker.init(*input.frame, *input.detections, spatialData);
+            } else if(tracker.isInitialized()) {
+                tracker.update(*input.frame, *input.detections, spatialData);
+            }
+        } else if(tracker.isInitialized()) {
+            tracker.track(*input.frame);
+        }
+    });
+}
+std::vector<Tracklet> MultiStreamTracker::getTracklets(size_t stream) const {
+    const auto& tracker = *streams.at(stream);
+    return tracker.isInitialized() ? tracker.getTracklets() : std::vector<Tracklet>();
+}
+
 }  // namespace dai
@@ -1,5 +1,6 @@
 #include "Platform.hpp"
 
+#include <cstdlib>
 #include <filesystem>
 #include <memory>
 
@@ -92,6 +93,32 @@ std::filesystem::path getTempPath() {
     return std::filesystem::path(tmpPath);
 }
 
+std::filesystem::path getCachePath() {
+    std::filesystem::path base;
+#if defined(_WIN32) || defined(__USE_W32_SOCKETS)
+    const char* localAppData = std::getenv("LOCALAPPDATA");
+    if(localAppData != nullptr && localAppData[0] != '\0') base = localAppData;
+#else
+    // Relative XDG paths are invalid and have to be ignored
+    const char* xdgCache = std::getenv("XDG_CACHE_HOME");
+    const char* home = std::getenv("HOME");
+    if(xdgCache != nullptr && xdgCache[0] == '/') {
+        base = xdgCache;
+    } else if(home != nullptr && home[0] != '\0') {
+        base = std::filesystem::path(home) / ".cache";
+    }
+#endif
+    if(base.empty()) return getTempPath();
+
+    const auto path = base / "depthai";
+    std::error_code ec;
+    if(std::filesystem::create_directories(path, ec)) {
+        std::filesystem::permissions(path, std::filesystem::perms::owner_all, std::filesystem::perm_options::replace, ec);
+    }
+    if(!checkPathExists(path, true) || !checkWritePermissions(path)) return getTempPath();
+    return path;
+}
+
 bool checkPathExists(const std::filesystem::path& path, bool directory) {
     if(directory) {
         return std::filesystem::exists(path) && std::filesystem::is_directory(path);
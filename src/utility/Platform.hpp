@@ -29,6 +29,14 @@ std::string getIPv4AddressAsString(std::uint32_t binary);
  */
 std::filesystem::path getTempPath();
 
+/**
+ * @brief Get the per-user cache path, the same for every process of the user.
+ * $XDG_CACHE_HOME/depthai or ~/.cache/depthai (%LOCALAPPDATA%\depthai on Windows), created only accessible to the user.
+ * Falls back to a temporary path if there is no home folder or it isn't writable.
+ * @return Cache path
+ */
+std::filesystem::path getCachePath();
+
 /**
  * @brief Check if a path exists
  * @param path Path to check
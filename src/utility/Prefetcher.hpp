@@ -0,0 +1,140 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace dai {
+namespace utility {
+
+/**
+ * Produces items ahead of the consumer on a reader thread (eg. decoding of replayed frames), keeping up to `capacity` of them ready.
+ * With a capacity of 0 the items are produced on demand, on the consumer's thread
+ */
+template <typename T>
+class Prefetcher {
+   public:
+    /**
+     * @param capacity Number of items read ahead
+     * @param produce Returns the next item, std::nullopt at the end of the input
+     */
+    Prefetcher(size_t capacity, std::function<std::optional<T>()> produce) : capacity(capacity), produce(std::move(produce)) {
+        if(capacity > 0) {
+            thread = std::thread([this]() { readerLoop(); });
+        }
+    }
+
+    ~Prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        cv.notify_all();
+        if(thread.joinable()) thread.join();
+    }
+
+    Prefetcher(const Prefetcher&) = delete;
+    Prefetcher& operator=(const Prefetcher&) = delete;
+
+    /**
+     * Waits for the next item. Rethrows the error of produce
+     * @returns The next item, std::nullopt at the end of the input
+     */
+    std::optional<T> next() {
+        if(capacity == 0) return produce();
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]() { return !items.empty() || ended || error; });
+        if(items.empty()) {
+            if(error) std::rethrow_exception(error);
+            return std::nullopt;
+        }
+        std::optional<T> item(std::move(items.front()));
+        items.pop_front();
+        lock.unlock();
+        cv.notify_all();
+        return item;
+    }
+
+    /**
+     * Drops the items read ahead and runs fn on the reader thread (eg. to seek or restart the input), reading continues from there.
+     * Rethrows the error of fn
+     */
+    void reposition(const std::function<void()>& fn) {
+        if(capacity == 0) {
+            fn();
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mtx);
+        repositionFn = &fn;
+        cv.notify_all();
+        cv.wait(lock, [this]() { return repositionFn == nullptr; });
+        if(repositionError) {
+            auto ex = repositionError;
+            repositionError = nullptr;
+            std::rethrow_exception(ex);
+        }
+    }
+
+   private:
+    void readerLoop() {
+        std::unique_lock<std::mutex> lock(mtx);
+        while(true) {
+            cv.wait(lock, [this]() { return stopping || repositionFn || (!ended && !error && items.size() < capacity); });
+            if(stopping) return;
+            if(repositionFn) {
+                // The consumer waits for this, so it can run under the lock
+                items.clear();
+                ended = false;
+                error = nullptr;
+                try {
+                    (*repositionFn)();
+                } catch(...) {
+                    repositionError = std::current_exception();
+                }
+                repositionFn = nullptr;
+                cv.notify_all();
+                continue;
+            }
+
+            lock.unlock();
+            std::optional<T> item;
+            std::exception_ptr produceError;
+            try {
+                item = produce();
+            } catch(...) {
+                produceError = std::current_exception();
+            }
+            lock.lock();
+            // An item produced while a reposition was requested is dropped with the others
+            if(produceError) {
+                error = produceError;
+            } else if(item) {
+                items.push_back(std::move(*item));
+            } else {
+                ended = true;
+            }
+            cv.notify_all();
+        }
+    }
+
+    const size_t capacity;
+    std::function<std::optional<T>()> produce;
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<T> items;
+    bool ended = false;
+    bool stopping = false;
+    std::exception_ptr error;
+    const std::function<void()>* repositionFn = nullptr;
+    std::exception_ptr repositionError;
+    std::thread thread;
+};
+
+}  // namespace utility
+}  // namespace dai
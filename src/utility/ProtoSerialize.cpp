@@ -4,6 +4,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/util/time_util.h>
 
+#include <cstring>
 #include <queue>
 
 #include "depthai/schemas/PointCloudData.pb.h"
@@ -44,6 +45,45 @@ std::vector<std::uint8_t> serializeProto(std::unique_ptr<google::protobuf::Messa
     return buffer;
 }
 
+namespace {
+void appendVarint(std::vector<std::uint8_t>& buffer, std::uint64_t value) {
+    while(value >= 0x80) {
+        buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<std::uint8_t>(value));
+}
+}  // namespace
+
+ProtoSerializable::SerializedProto serializeProtoParts(std::unique_ptr<google::protobuf::Message> protoMessage,
+                                                       int payloadFieldNumber,
+                                                       span<const std::uint8_t> payload) {
+    ProtoSerializable::SerializedProto parts;
+    std::size_t nbytes = protoMessage->ByteSizeLong();
+    // Room for the key and length of the payload field
+    parts.header.reserve(nbytes + 2 * 10);
+    parts.header.resize(nbytes);
+    if(nbytes > 0) {
+        protoMessage->SerializeToArray(parts.header.data(), nbytes);
+    }
+    // Empty bytes fields aren't serialized in proto3
+    if(!payload.empty()) {
+        constexpr std::uint32_t wireTypeLengthDelimited = 2;
+        appendVarint(parts.header, (static_cast<std::uint64_t>(payloadFieldNumber) << 3) | wireTypeLengthDelimited);
+        appendVarint(parts.header, payload.size());
+        parts.payload = payload;
+    }
+    return parts;
+}
+
+std::vector<std::uint8_t> serializeProto(const ProtoSerializable::SerializedProto& parts) {
+    std::vector<std::uint8_t> buffer;
+    buffer.reserve(parts.size());
+    buffer.insert(buffer.end(), parts.header.begin(), parts.header.end());
+    buffer.insert(buffer.end(), parts.payload.begin(), parts.payload.end());
+    return buffer;
+}
+
 ProtoSerializable::SchemaPair serializeSchema(std::unique_ptr<google::protobuf::Message> protoMessage) {
     const auto* descriptor = protoMessage->GetDescriptor();
     if(descriptor == nullptr) {
@@ -524,7 +564,21 @@ std::unique_ptr<google::protobuf::Message> getProtoMessage(const PointCloudData*
     pointCloudData->set_color(message->isColor());
 
     if(!metadataOnly) {
-        pointCloudData->set_data(message->data->getData().data(), message->data->getSize());
+        const auto data = message->data->getData();
+        if(message->isPlanar()) {
+            // Planar is a host side layout only, points are always stored interleaved
+            const size_t numPlanes = message->isColor() ? 4 : 3;
+            const size_t numPoints = data.size() / (numPlanes * sizeof(float));
+            auto* out = pointCloudData->mutable_data();
+            out->resize(numPoints * numPlanes * sizeof(float));
+            for(size_t i = 0; i < numPoints; i++) {
+                for(size_t k = 0; k < numPlanes; k++) {
+                    std::memcpy(&(*out)[(i * numPlanes + k) * sizeof(float)], data.data() + (k * numPoints + i) * sizeof(float), sizeof(float));
+                }
+            }
+        } else {
+            pointCloudData->set_data(data.data(), data.size());
+        }
     }
 
     return pointCloudData;
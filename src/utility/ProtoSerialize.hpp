@@ -24,6 +24,13 @@ namespace dai {
 namespace utility {
 
 std::vector<std::uint8_t> serializeProto(std::unique_ptr<google::protobuf::Message> protoMessage);
+// Serializes the message without its payload field, the header ends with the key and length of the payload field.
+// The payload field has to be the last one of the message, so the header and payload together serialize the same as a message with it set
+ProtoSerializable::SerializedProto serializeProtoParts(std::unique_ptr<google::protobuf::Message> protoMessage,
+                                                       int payloadFieldNumber,
+                                                       span<const std::uint8_t> payload);
+// Joins the parts into a single buffer
+std::vector<std::uint8_t> serializeProto(const ProtoSerializable::SerializedProto& parts);
 ProtoSerializable::SchemaPair serializeSchema(std::unique_ptr<google::protobuf::Message> protoMessage);
 
 // Common functions for serializing
@@ -2,6 +2,7 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <mcap/types.hpp>
 #include <optional>
 #include <stdexcept>
@@ -111,6 +112,7 @@ std::string BytePlayer::init(const std::string& filePath) {
         throw std::runtime_error("No messages in file");
     }
     it = std::make_unique<mcap::LinearMessageView::Iterator>(messageView->begin());
+    startTime = (*it)->message.logTime;
     initialized = true;
     return (*it)->schema->name;
 }
@@ -119,6 +121,72 @@ void BytePlayer::restart() {
     if(!initialized) {
         throw std::runtime_error("BytePlayer not initialized");
     }
+    // A seek leaves a view starting at the seek point, read the whole file again
+    it.reset();
+    messageView = std::make_unique<mcap::LinearMessageView>(reader.readMessages());
+    it = std::make_unique<mcap::LinearMessageView::Iterator>(messageView->begin());
+}
+
+void BytePlayer::seek(std::chrono::nanoseconds offset) {
+    if(!initialized) {
+        throw std::runtime_error("BytePlayer not initialized");
+    }
+    seekToTime(startTime + static_cast<mcap::Timestamp>(std::max<int64_t>(offset.count(), 0)));
+}
+
+void BytePlayer::seekToSequenceNum(int64_t sequenceNum, const std::function<int64_t(const mcap::Message&)>& getSequenceNum) {
+    if(!initialized) {
+        throw std::runtime_error("BytePlayer not initialized");
+    }
+    // Sequence number of the first message logged at or after the given time, std::nullopt past the end
+    const auto probe = [&](mcap::Timestamp time) -> std::optional<int64_t> {
+        auto view = reader.readMessages(time);
+        auto first = view.begin();
+        if(first == view.end()) return std::nullopt;
+        return getSequenceNum(first->message);
+    };
+    const auto before = [&](mcap::Timestamp time) {
+        const auto found = probe(time);
+        return found.has_value() && found.value() < sequenceNum;
+    };
+
+    // Each probe reads a single chunk. Find a time past the target with growing steps, then bisect down to a millisecond
+    constexpr mcap::Timestamp resolution = 1000000;
+    mcap::Timestamp low = startTime;
+    if(!before(low)) {
+        seekToTime(startTime);
+        return;
+    }
+    mcap::Timestamp step = 1000000000;
+    mcap::Timestamp high = low + step;
+    while(before(high)) {
+        low = high;
+        step *= 2;
+        high = low + step;
+    }
+    while(high - low > resolution) {
+        const auto mid = low + (high - low) / 2;
+        if(before(mid)) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    seekToTime(low);
+    while(*it != messageView->end() && getSequenceNum((*it)->message) < sequenceNum) {
+        ++(*it);
+    }
+}
+
+std::optional<uint32_t> BytePlayer::position() const {
+    if(!initialized || *it == messageView->end()) return std::nullopt;
+    return (*it)->message.sequence;
+}
+
+void BytePlayer::seekToTime(mcap::Timestamp time) {
+    // The iterator refers to the view, release it first
+    it.reset();
+    messageView = std::make_unique<mcap::LinearMessageView>(reader.readMessages(time));
     it = std::make_unique<mcap::LinearMessageView::Iterator>(messageView->begin());
 }
 
@@ -1,3 +1,6 @@
+#include <chrono>
+#include <functional>
+
 #include "depthai/utility/RecordReplay.hpp"
 #include "mcap/mcap.hpp"
 #ifdef DEPTHAI_ENABLE_MP4V2
@@ -70,7 +73,7 @@ class ByteRecorder {
         throw std::runtime_error("ByteRecorder not supported without protobuf support");
 #endif
     }
-    void write(std::vector<uint8_t> data) {
+    void write(const std::vector<uint8_t>& data) {
         mcap::Timestamp writeTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
         mcap::Message msg;
         msg.channelId = channelId;
@@ -105,6 +108,11 @@ class VideoPlayer {
     std::optional<std::vector<uint8_t>> next();
     std::tuple<uint32_t, uint32_t> size();
     void restart();
+    // Seeking decodes from the closest keyframe before the target
+    void seekToFrame(uint64_t index);
+    void seekToTime(std::chrono::nanoseconds time);
+    // Index of the frame returned by the next call to next()
+    uint64_t position();
     void close();
     bool isInitialized() const {
         return initialized;
@@ -145,6 +153,12 @@ class BytePlayer {
         return data;
     }
     void restart();
+    // Continues from the first message logged at least `offset` after the first message of the file, only the chunks from there on are read
+    void seek(std::chrono::nanoseconds offset);
+    // Continues from the first message with a sequence number at or after the given one. Sequence numbers have to grow with the log time
+    void seekToSequenceNum(int64_t sequenceNum, const std::function<int64_t(const mcap::Message&)>& getSequenceNum);
+    // Index of the next message in the file (same as the index of its video frame), std::nullopt at the end
+    std::optional<uint32_t> position() const;
     void close();
     static std::optional<std::tuple<uint32_t, uint32_t>> getVideoSize(const std::string& filePath);
     bool isInitialized() const {
@@ -155,7 +169,10 @@ class BytePlayer {
     mcap::McapReader reader;
     std::unique_ptr<mcap::LinearMessageView> messageView;
     std::unique_ptr<mcap::LinearMessageView::Iterator> it;
+    mcap::Timestamp startTime = 0;
     bool initialized = false;
+
+    void seekToTime(mcap::Timestamp time);
 };
 
 bool checkRecordConfig(std::filesystem::path& recordPath, RecordConfig& config);
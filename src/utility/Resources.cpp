@@ -2,10 +2,12 @@
 
 #include <array>
 #include <cassert>
-#include <condition_variable>
+#include <cstring>
 #include <exception>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <thread>
 
@@ -30,6 +32,7 @@
 #include "utility/ArchiveUtil.hpp"
 #include "utility/Environment.hpp"
 #include "utility/ErrorMacros.hpp"
+#include "utility/Platform.hpp"
 #include "utility/spdlog-fmt.hpp"
 
 extern "C" {
@@ -114,6 +117,69 @@ TarXzAccessor Resources::getEmbeddedVisualizer() const {
 
 static std::vector<std::uint8_t> createPrebootHeader(const std::vector<uint8_t>& payload, uint32_t magic1, uint32_t magic2);
 
+// Firmware cache - patched firmware images are stored on disk, so that later processes skip decompression and patching
+static fs::path getFirmwareCachePath(const fs::path& name) {
+    auto cacheDirectory = utility::getEnvAs<fs::path>("DEPTHAI_FIRMWARE_CACHE_PATH", fs::path(), false);
+    if(cacheDirectory.empty()) {
+        // Only created when the cache isn't placed elsewhere
+        static const auto defaultCacheDirectory = platform::getCachePath() / "firmware";
+        cacheDirectory = defaultCacheDirectory;
+    }
+    return cacheDirectory / name;
+}
+
+// Cached images are followed by their size and checksum, a truncated or corrupted file is a cache miss
+constexpr static std::size_t FIRMWARE_CACHE_FOOTER_SIZE = sizeof(std::uint64_t) + sizeof(std::uint32_t);
+
+static std::optional<std::vector<std::uint8_t>> readCachedFirmware(const fs::path& path) {
+    std::ifstream stream(path, std::ios::binary);
+    if(!stream.is_open()) {
+        return std::nullopt;
+    }
+    std::vector<std::uint8_t> binary(std::istreambuf_iterator<char>(stream), {});
+    if(binary.size() < FIRMWARE_CACHE_FOOTER_SIZE) {
+        return std::nullopt;
+    }
+
+    std::uint64_t size = 0;
+    std::uint32_t checksum = 0;
+    const auto* footer = binary.data() + binary.size() - FIRMWARE_CACHE_FOOTER_SIZE;
+    std::memcpy(&size, footer, sizeof(size));
+    std::memcpy(&checksum, footer + sizeof(size), sizeof(checksum));
+    binary.resize(binary.size() - FIRMWARE_CACHE_FOOTER_SIZE);
+    if(size != binary.size() || checksum != utility::checksum(binary.data(), binary.size())) {
+        logger::debug("Ignoring invalid cached firmware {}", path);
+        return std::nullopt;
+    }
+    return binary;
+}
+
+static void writeCachedFirmware(const fs::path& path, const std::vector<std::uint8_t>& binary) {
+    try {
+        fs::create_directories(path.parent_path());
+        // Other processes may populate the cache concurrently
+        auto lock = platform::FileLock::lock(path.string() + ".lock", true);
+        if(readCachedFirmware(path)) return;
+
+        // Written to a temporary file first, so that readers never see a partial image. An invalid image is replaced
+        auto tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            const std::uint64_t size = binary.size();
+            const std::uint32_t checksum = utility::checksum(binary.data(), binary.size());
+            std::ofstream stream(tmpPath, std::ios::binary | std::ios::trunc);
+            stream.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+            stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            stream.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+            stream.close();
+            if(!stream) throw std::runtime_error("write failed");
+        }
+        fs::rename(tmpPath, path);
+    } catch(const std::exception& ex) {
+        logger::debug("Couldn't cache firmware at {}: {}", path, ex.what());
+    }
+}
+
 constexpr static auto CMRC_DEPTHAI_DEVICE_TAR_XZ = "depthai-device-fwp-" DEPTHAI_DEVICE_VERSION ".tar.xz";
 
 // Main FW
@@ -145,12 +211,6 @@ std::vector<std::uint8_t> Resources::getDeviceFirmware(Device::Config config, fs
     throw std::invalid_argument("DepthAI compiled without support for MyriadX Device FW");
 #endif
 
-    // Wait until lazy load is complete
-    {
-        std::unique_lock<std::mutex> lock(mtxDevice);
-        cvDevice.wait(lock, [this]() { return readyDevice; });
-    }
-
     std::vector<std::uint8_t> finalFwBinary;
 
     // Get OpenVINO version
@@ -190,67 +250,7 @@ std::vector<std::uint8_t> Resources::getDeviceFirmware(Device::Config config, fs
             logger::warn("OpenVINO {} is deprecated!", OpenVINO::getVersionName(version));
         }
 
-        // Main FW
-        std::vector<std::uint8_t> depthaiBinary;
-        // Patch from main to specified
-        std::vector<std::uint8_t> depthaiPatch;
-
-        switch(version) {
-            case OpenVINO::VERSION_2020_3:
-                throw std::runtime_error(fmt::format("OpenVINO {} is not available anymore", OpenVINO::getVersionName(version)));
-                break;
-
-            case OpenVINO::VERSION_2020_4:
-                depthaiPatch = resourceMapDevice.at(DEPTHAI_CMD_OPENVINO_2020_4_PATCH_PATH);
-                break;
-
-            case OpenVINO::VERSION_2021_1:
-                depthaiPatch = resourceMapDevice.at(DEPTHAI_CMD_OPENVINO_2021_1_PATCH_PATH);
-                break;
-
-            case OpenVINO::VERSION_2021_2:
-                depthaiPatch = resourceMapDevice.at(DEPTHAI_CMD_OPENVINO_2021_2_PATCH_PATH);
-                break;
-
-            case OpenVINO::VERSION_2021_3:
-                depthaiPatch = resourceMapDevice.at(DEPTHAI_CMD_OPENVINO_2021_3_PATCH_PATH);
-                break;
-
-            case OpenVINO::VERSION_2021_4:
-            case OpenVINO::VERSION_2022_1:
-            case MAIN_FW_VERSION:
-                depthaiBinary = resourceMapDevice.at(MAIN_FW_PATH);
-                break;
-        }
-
-        // is patching required?
-        if(!depthaiPatch.empty()) {
-            logger::debug("Patching OpenVINO FW version from {} to {}", OpenVINO::getVersionName(MAIN_FW_VERSION), OpenVINO::getVersionName(version));
-
-            // Load full binary for patch
-            depthaiBinary = resourceMapDevice.at(MAIN_FW_PATH);
-
-            // Get new size
-            int64_t patchedSize = bspatch_mem_get_newsize(depthaiPatch.data(), depthaiPatch.size());
-
-            // Reserve space for patched binary
-            std::vector<std::uint8_t> tmpDepthaiBinary{};
-            tmpDepthaiBinary.resize(patchedSize);
-
-            // Patch
-            int error = bspatch_mem(depthaiBinary.data(), depthaiBinary.size(), depthaiPatch.data(), depthaiPatch.size(), tmpDepthaiBinary.data());
-
-            // if patch not successful
-            if(error > 0) {
-                throw std::runtime_error(fmt::format(
-                    "Error while patching OpenVINO FW version from {} to {}", OpenVINO::getVersionName(MAIN_FW_VERSION), OpenVINO::getVersionName(version)));
-            }
-
-            // Change depthaiBinary to tmpDepthaiBinary
-            depthaiBinary = std::move(tmpDepthaiBinary);
-        }
-
-        finalFwBinary = std::move(depthaiBinary);
+        finalFwBinary = getPatchedDeviceFirmware(version);
 
 #else
         // Binaries from default path (TODO)
@@ -268,6 +268,79 @@ std::vector<std::uint8_t> Resources::getDeviceFirmware(Device::Config config, fs
     return finalFwBinary;
 }
 
+std::vector<std::uint8_t> Resources::getPatchedDeviceFirmware(OpenVINO::Version version) const {
+    // Patch from main to specified
+    const char* patchPath = nullptr;
+
+    switch(version) {
+        case OpenVINO::VERSION_2020_3:
+            throw std::runtime_error(fmt::format("OpenVINO {} is not available anymore", OpenVINO::getVersionName(version)));
+            break;
+
+        case OpenVINO::VERSION_2020_4:
+            patchPath = DEPTHAI_CMD_OPENVINO_2020_4_PATCH_PATH;
+            break;
+
+        case OpenVINO::VERSION_2021_1:
+            patchPath = DEPTHAI_CMD_OPENVINO_2021_1_PATCH_PATH;
+            break;
+
+        case OpenVINO::VERSION_2021_2:
+            patchPath = DEPTHAI_CMD_OPENVINO_2021_2_PATCH_PATH;
+            break;
+
+        case OpenVINO::VERSION_2021_3:
+            patchPath = DEPTHAI_CMD_OPENVINO_2021_3_PATCH_PATH;
+            break;
+
+        case OpenVINO::VERSION_2021_4:
+        case OpenVINO::VERSION_2022_1:
+        case MAIN_FW_VERSION:
+            break;
+    }
+
+    // Resource names contain the device version, so a cached image never outlives its firmware
+    const auto cachePath = getFirmwareCachePath(fs::path(patchPath != nullptr ? patchPath : MAIN_FW_PATH).replace_extension(".cmd"));
+    if(auto cached = readCachedFirmware(cachePath)) {
+        logger::debug("Using cached firmware {}", cachePath);
+        return std::move(*cached);
+    }
+
+    // Wait until lazy load is complete
+    lazyDevice.get();
+
+    // Main FW
+    std::vector<std::uint8_t> depthaiBinary = resourceMapDevice.at(MAIN_FW_PATH);
+
+    // is patching required?
+    if(patchPath != nullptr) {
+        logger::debug("Patching OpenVINO FW version from {} to {}", OpenVINO::getVersionName(MAIN_FW_VERSION), OpenVINO::getVersionName(version));
+        const auto& depthaiPatch = resourceMapDevice.at(patchPath);
+
+        // Get new size
+        int64_t patchedSize = bspatch_mem_get_newsize(depthaiPatch.data(), depthaiPatch.size());
+
+        // Reserve space for patched binary
+        std::vector<std::uint8_t> tmpDepthaiBinary{};
+        tmpDepthaiBinary.resize(patchedSize);
+
+        // Patch
+        int error = bspatch_mem(depthaiBinary.data(), depthaiBinary.size(), depthaiPatch.data(), depthaiPatch.size(), tmpDepthaiBinary.data());
+
+        // if patch not successful
+        if(error > 0) {
+            throw std::runtime_error(fmt::format(
+                "Error while patching OpenVINO FW version from {} to {}", OpenVINO::getVersionName(MAIN_FW_VERSION), OpenVINO::getVersionName(version)));
+        }
+
+        // Change depthaiBinary to tmpDepthaiBinary
+        depthaiBinary = std::move(tmpDepthaiBinary);
+    }
+
+    writeCachedFirmware(cachePath, depthaiBinary);
+    return depthaiBinary;
+}
+
 constexpr static auto CMRC_DEPTHAI_BOOTLOADER_TAR_XZ = "depthai-bootloader-fwp-" DEPTHAI_BOOTLOADER_VERSION ".tar.xz";
 constexpr static auto DEVICE_BOOTLOADER_USB_PATH = "depthai-bootloader-usb.cmd";
 constexpr static auto DEVICE_BOOTLOADER_ETH_PATH = "depthai-bootloader-eth.cmd";
@@ -283,12 +356,6 @@ std::vector<std::uint8_t> Resources::getBootloaderFirmware(dai::bootloader::Type
     throw std::invalid_argument("DepthAI compiled without support for MyriadX Device Bootloader FW");
 #endif
 
-    // Wait until lazy load is complete
-    {
-        std::unique_lock<std::mutex> lock(mtxBootloader);
-        cvDevice.wait(lock, [this]() { return readyBootloader; });
-    }
-
     // Check if env variable DEPTHAI_BOOTLOADER_BINARY_USB/_ETH is set
     std::string blEnvVar;
     if(type == dai::bootloader::Type::USB) {
@@ -310,6 +377,9 @@ std::vector<std::uint8_t> Resources::getBootloaderFirmware(dai::bootloader::Type
         return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(stream), {});
     }
 
+    // Wait until lazy load is complete
+    lazyBootloader.get();
+
     switch(type) {
         case dai::bootloader::Type::AUTO:
             throw std::invalid_argument("DeviceBootloader::Type::AUTO not allowed, when getting bootloader firmware.");
@@ -395,9 +465,9 @@ Resources& Resources::getInstance() {
     return instance;
 }
 
-template <typename CV, typename BOOL, typename MTX, typename PATH, typename LIST, typename MAP>
-std::function<void()> getLazyTarXzFunction(MTX& mtx, CV& cv, BOOL& ready, PATH cmrcPath, LIST& resourceList, MAP& resourceMap) {
-    return [&mtx, &cv, &ready, cmrcPath, &resourceList, &resourceMap] {
+template <typename PATH, typename LIST, typename MAP>
+std::function<void()> getLazyTarXzFunction(PATH cmrcPath, LIST& resourceList, MAP& resourceMap) {
+    return [cmrcPath, &resourceList, &resourceMap] {
         using namespace std::chrono;
 
         // Get binaries from internal sources
@@ -443,13 +513,6 @@ std::function<void()> getLazyTarXzFunction(MTX& mtx, CV& cv, BOOL& ready, PATH c
         // Debug - logs loading times
         logger::debug(
             "Resources - Archive '{}' open: {}, archive read: {}", cmrcPath, duration_cast<milliseconds>(t2 - t1), duration_cast<milliseconds>(t3 - t2));
-
-        // Notify that that preload is finished
-        {
-            std::unique_lock<std::mutex> l(mtx);
-            ready = true;
-        }
-        cv.notify_all();
     };
 }
 
@@ -464,27 +527,27 @@ Resources::Resources() {
 // First check if device kb fw is enabled
 #ifdef DEPTHAI_ENABLE_DEVICE_FW
     // Device resources
-    // Create a thread which lazy-loads firmware resources package
-    lazyThreadDevice = std::thread(getLazyTarXzFunction(mtxDevice, cvDevice, readyDevice, CMRC_DEPTHAI_DEVICE_TAR_XZ, RESOURCE_LIST_DEVICE, resourceMapDevice));
+    // Lazy-load firmware resources package in the background, unless the main firmware is already cached
+    const bool cached = fs::exists(getFirmwareCachePath(fs::path(MAIN_FW_PATH)));
+    lazyDevice = std::async(cached ? std::launch::deferred : std::launch::async,
+                            getLazyTarXzFunction(CMRC_DEPTHAI_DEVICE_TAR_XZ, RESOURCE_LIST_DEVICE, resourceMapDevice))
+                     .share();
 #endif
 
 // First check if device bootloader fw is enabled
 #ifdef DEPTHAI_ENABLE_DEVICE_BOOTLOADER_FW
     // Bootloader resources
-    // Create a thread which lazy-loads firmware resources package
-    lazyThreadBootloader = std::thread(
-        getLazyTarXzFunction(mtxBootloader, cvBootloader, readyBootloader, CMRC_DEPTHAI_BOOTLOADER_TAR_XZ, RESOURCE_LIST_BOOTLOADER, resourceMapBootloader));
+    // Lazy-load bootloader resources package on first use
+    lazyBootloader =
+        std::async(std::launch::deferred, getLazyTarXzFunction(CMRC_DEPTHAI_BOOTLOADER_TAR_XZ, RESOURCE_LIST_BOOTLOADER, resourceMapBootloader)).share();
 #endif
 }
 
 Resources::~Resources() {
-    // join the lazy threads
-#ifdef DEPTHAI_ENABLE_DEVICE_FW
-    if(lazyThreadDevice.joinable()) lazyThreadDevice.join();
-#endif
-#ifdef DEPTHAI_ENABLE_DEVICE_BOOTLOADER_FW
-    if(lazyThreadBootloader.joinable()) lazyThreadBootloader.join();
-#endif
+    // Wait for the background loads, the ones that were never used aren't started
+    for(auto* lazy : {&lazyDevice, &lazyBootloader}) {
+        if(lazy->valid() && lazy->wait_for(std::chrono::seconds(0)) != std::future_status::deferred) lazy->wait();
+    }
 }
 
 // Get device firmware
@@ -2,9 +2,8 @@
 
 #include <cstdint>
 #include <filesystem>
-#include <mutex>
+#include <future>
 #include <string>
-#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -36,18 +35,16 @@ class Resources {
     Resources();
     ~Resources();
 
-    mutable std::mutex mtxDevice;
-    mutable std::condition_variable cvDevice;
-    std::thread lazyThreadDevice;
-    bool readyDevice;
+    // Decompresses the firmware package, in the background at startup or on first use when the firmware is cached
+    std::shared_future<void> lazyDevice;
     std::unordered_map<std::string, std::vector<std::uint8_t>> resourceMapDevice;
 
-    mutable std::mutex mtxBootloader;
-    mutable std::condition_variable cvBootloader;
-    std::thread lazyThreadBootloader;
-    bool readyBootloader;
+    // Decompresses the bootloader package on first use
+    std::shared_future<void> lazyBootloader;
     std::unordered_map<std::string, std::vector<std::uint8_t>> resourceMapBootloader;
     std::vector<std::uint8_t> getDeviceFwp(const std::string& fwPath, const std::string& envPath) const;
+    // Main firmware patched to the given OpenVINO version, read from the firmware cache if available
+    std::vector<std::uint8_t> getPatchedDeviceFirmware(OpenVINO::Version version) const;
 
    public:
     static Resources& getInstance();
@@ -0,0 +1,303 @@
+#include "SpatialLocationCalculatorImpl.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dai {
+namespace impl {
+
+namespace {
+
+// Side of the tiles of the min/max sparse table, in subsampling grid cells
+constexpr unsigned tileSize = 8;
+
+unsigned getStepSize(const SpatialLocationCalculatorConfigData& config) {
+    if(config.stepSize != SpatialLocationCalculatorConfigData::AUTO && config.stepSize > 0) return static_cast<unsigned>(config.stepSize);
+    switch(config.calculationAlgorithm) {
+        case SpatialLocationCalculatorAlgorithm::MODE:
+        case SpatialLocationCalculatorAlgorithm::MEDIAN:
+            return 2;
+        case SpatialLocationCalculatorAlgorithm::AVERAGE:
+        case SpatialLocationCalculatorAlgorithm::MIN:
+        case SpatialLocationCalculatorAlgorithm::MAX:
+            return 1;
+    }
+    return 1;
+}
+
+bool needsValues(SpatialLocationCalculatorAlgorithm algorithm) {
+    return algorithm == SpatialLocationCalculatorAlgorithm::MEDIAN || algorithm == SpatialLocationCalculatorAlgorithm::MODE;
+}
+
+unsigned log2Floor(unsigned value) {
+    unsigned log = 0;
+    while(value >>= 1) log++;
+    return log;
+}
+
+unsigned clampToSize(float value, unsigned size) {
+    return static_cast<unsigned>(std::clamp(std::lround(value), 0L, static_cast<long>(size)));
+}
+
+// Most frequent value, the smallest one on ties
+uint16_t getMode(std::vector<uint16_t>& values) {
+    std::sort(values.begin(), values.end());
+    uint16_t mode = values[0];
+    size_t modeCount = 0;
+    for(size_t begin = 0; begin < values.size();) {
+        size_t end = begin;
+        while(end < values.size() && values[end] == values[begin]) end++;
+        if(end - begin > modeCount) {
+            mode = values[begin];
+            modeCount = end - begin;
+        }
+        begin = end;
+    }
+    return mode;
+}
+
+}  // namespace
+
+void RoiDepthCalculator::setFrame(const uint8_t* data, unsigned width, unsigned height, unsigned stride, const std::optional<Intrinsics>& intrinsics) {
+    this->data = data;
+    this->width = width;
+    this->height = height;
+    this->stride = stride;
+    this->intrinsics = intrinsics;
+    for(auto& table : tables) table.valid = false;
+}
+
+std::vector<SpatialLocations> RoiDepthCalculator::calculate(const std::vector<SpatialLocationCalculatorConfigData>& configs) {
+    // Grid cells covered by the ROIs which could use the lookup tables of each key
+    std::vector<std::pair<Key, uint64_t>> areas;
+    for(const auto& config : configs) {
+        if(needsValues(config.calculationAlgorithm)) continue;
+        const Key key{config.depthThresholds.lowerThreshold, config.depthThresholds.upperThreshold, getStepSize(config)};
+        const auto region = getGridRegion(config, key.step);
+        const uint64_t area = static_cast<uint64_t>(region.x1 - region.x0) * (region.y1 - region.y0);
+        auto it = std::find_if(areas.begin(), areas.end(), [&key](const auto& entry) { return entry.first == key; });
+        if(it == areas.end()) {
+            areas.emplace_back(key, area);
+        } else {
+            it->second += area;
+        }
+    }
+
+    std::vector<SpatialLocations> locations(configs.size());
+    for(size_t i = 0; i < configs.size(); i++) {
+        const auto& config = configs[i];
+        const Key key{config.depthThresholds.lowerThreshold, config.depthThresholds.upperThreshold, getStepSize(config)};
+        const auto region = getGridRegion(config, key.step);
+        auto& location = locations[i];
+        location.config = config;
+
+        Stats stats;
+        if(needsValues(config.calculationAlgorithm)) {
+            values.clear();
+            scan(key, region, stats, &values);
+            if(!values.empty()) {
+                if(config.calculationAlgorithm == SpatialLocationCalculatorAlgorithm::MODE) {
+                    location.depthMode = getMode(values);
+                } else {
+                    std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+                    location.depthMedian = values[values.size() / 2];
+                }
+            }
+        } else {
+            const auto area = std::find_if(areas.begin(), areas.end(), [&key](const auto& entry) { return entry.first == key; })->second;
+            const uint64_t gridCells = static_cast<uint64_t>((width + key.step - 1) / key.step) * ((height + key.step - 1) / key.step);
+            // The tables cost about one pass over the frame, rescanning is cheaper for a few small ROIs
+            if(area > gridCells) {
+                stats = query(getTables(key), region);
+            } else {
+                scan(key, region, stats, nullptr);
+            }
+        }
+        if(stats.count == 0) continue;
+
+        location.depthAverage = static_cast<float>(static_cast<double>(stats.sum) / stats.count);
+        location.depthAveragePixelCount = stats.count;
+        location.depthMin = stats.min;
+        location.depthMax = stats.max;
+
+        float z = 0.0f;
+        switch(config.calculationAlgorithm) {
+            case SpatialLocationCalculatorAlgorithm::AVERAGE:
+                z = location.depthAverage;
+                break;
+            case SpatialLocationCalculatorAlgorithm::MIN:
+                z = location.depthMin;
+                break;
+            case SpatialLocationCalculatorAlgorithm::MAX:
+                z = location.depthMax;
+                break;
+            case SpatialLocationCalculatorAlgorithm::MODE:
+                z = location.depthMode;
+                break;
+            case SpatialLocationCalculatorAlgorithm::MEDIAN:
+                z = location.depthMedian;
+                break;
+        }
+        location.spatialCoordinates.z = z;
+        if(intrinsics) {
+            // Center of the ROI, Y pointing up
+            const auto rect = config.roi.denormalize(width, height);
+            const float u = rect.x + rect.width / 2.0f;
+            const float v = rect.y + rect.height / 2.0f;
+            location.spatialCoordinates.x = z * (u - intrinsics->cx) / intrinsics->fx;
+            location.spatialCoordinates.y = -z * (v - intrinsics->cy) / intrinsics->fy;
+        }
+    }
+    return locations;
+}
+
+RoiDepthCalculator::GridRegion RoiDepthCalculator::getGridRegion(const SpatialLocationCalculatorConfigData& config, unsigned step) const {
+    const auto rect = config.roi.denormalize(width, height);
+    const unsigned x0 = clampToSize(rect.x, width);
+    const unsigned y0 = clampToSize(rect.y, height);
+    const unsigned x1 = std::max(x0, clampToSize(rect.x + rect.width, width));
+    const unsigned y1 = std::max(y0, clampToSize(rect.y + rect.height, height));
+    // Grid cell g samples pixel g * step
+    return {(x0 + step - 1) / step, (y0 + step - 1) / step, (x1 + step - 1) / step, (y1 + step - 1) / step};
+}
+
+RoiDepthCalculator::Tables& RoiDepthCalculator::getTables(const Key& key) {
+    for(auto& table : tables) {
+        if(table.valid && table.key == key) return table;
+    }
+    auto it = std::find_if(tables.begin(), tables.end(), [](const Tables& table) { return !table.valid; });
+    if(it == tables.end()) it = tables.insert(tables.end(), Tables{});
+    it->key = key;
+    buildTables(*it);
+    it->valid = true;
+    return *it;
+}
+
+void RoiDepthCalculator::buildTables(Tables& t) const {
+    const auto& key = t.key;
+    t.gridWidth = (width + key.step - 1) / key.step;
+    t.gridHeight = (height + key.step - 1) / key.step;
+    t.tilesX = (t.gridWidth + tileSize - 1) / tileSize;
+    t.tilesY = (t.gridHeight + tileSize - 1) / tileSize;
+    t.levelsX = t.tilesX > 0 ? log2Floor(t.tilesX) + 1 : 0;
+    t.levelsY = t.tilesY > 0 ? log2Floor(t.tilesY) + 1 : 0;
+
+    const size_t satWidth = t.gridWidth + 1;
+    t.count.assign(satWidth * (t.gridHeight + 1), 0);
+    t.sum.assign(satWidth * (t.gridHeight + 1), 0);
+    t.min.resize(static_cast<size_t>(t.levelsX) * t.levelsY);
+    t.max.resize(t.min.size());
+    if(t.min.empty()) return;
+    auto& tileMin = t.min[0];
+    auto& tileMax = t.max[0];
+    tileMin.assign(static_cast<size_t>(t.tilesX) * t.tilesY, UINT16_MAX);
+    tileMax.assign(tileMin.size(), 0);
+
+    for(unsigned gy = 0; gy < t.gridHeight; gy++) {
+        const uint16_t* depth = row(gy * key.step);
+        const uint32_t* countAbove = t.count.data() + gy * satWidth;
+        const uint64_t* sumAbove = t.sum.data() + gy * satWidth;
+        uint32_t* countRow = t.count.data() + (gy + 1) * satWidth;
+        uint64_t* sumRow = t.sum.data() + (gy + 1) * satWidth;
+        uint16_t* minRow = tileMin.data() + static_cast<size_t>(gy / tileSize) * t.tilesX;
+        uint16_t* maxRow = tileMax.data() + static_cast<size_t>(gy / tileSize) * t.tilesX;
+        uint32_t rowCount = 0;
+        uint64_t rowSum = 0;
+        for(unsigned gx = 0; gx < t.gridWidth; gx++) {
+            const uint16_t value = depth[gx * key.step];
+            if(value > key.lowerThreshold && value < key.upperThreshold) {
+                rowCount++;
+                rowSum += value;
+                auto& min = minRow[gx / tileSize];
+                auto& max = maxRow[gx / tileSize];
+                min = std::min(min, value);
+                max = std::max(max, value);
+            }
+            countRow[gx + 1] = countAbove[gx + 1] + rowCount;
+            sumRow[gx + 1] = sumAbove[gx + 1] + rowSum;
+        }
+    }
+
+    // Each level combines two halves of the previous level along one axis
+    const auto build = [&t](std::vector<std::vector<uint16_t>>& levels, auto combine) {
+        for(unsigned ly = 0; ly < t.levelsY; ly++) {
+            for(unsigned lx = 0; lx < t.levelsX; lx++) {
+                if(lx == 0 && ly == 0) continue;
+                const bool alongX = lx > 0;
+                const auto& prev = levels[alongX ? ly * t.levelsX + lx - 1 : (ly - 1) * t.levelsX + lx];
+                auto& level = levels[ly * t.levelsX + lx];
+                level.resize(prev.size());
+                const unsigned half = 1u << ((alongX ? lx : ly) - 1);
+                const unsigned spanX = 1u << lx;
+                const unsigned spanY = 1u << ly;
+                for(unsigned ty = 0; ty + spanY <= t.tilesY; ty++) {
+                    for(unsigned tx = 0; tx + spanX <= t.tilesX; tx++) {
+                        const size_t index = static_cast<size_t>(ty) * t.tilesX + tx;
+                        const size_t other = alongX ? index + half : index + static_cast<size_t>(half) * t.tilesX;
+                        level[index] = combine(prev[index], prev[other]);
+                    }
+                }
+            }
+        }
+    };
+    build(t.min, [](uint16_t a, uint16_t b) { return std::min(a, b); });
+    build(t.max, [](uint16_t a, uint16_t b) { return std::max(a, b); });
+}
+
+RoiDepthCalculator::Stats RoiDepthCalculator::query(const Tables& t, const GridRegion& region) const {
+    Stats stats;
+    const size_t satWidth = t.gridWidth + 1;
+    const auto rectSum = [&](const auto& sat) {
+        return sat[region.y1 * satWidth + region.x1] - sat[region.y0 * satWidth + region.x1] - sat[region.y1 * satWidth + region.x0]
+               + sat[region.y0 * satWidth + region.x0];
+    };
+    stats.count = rectSum(t.count);
+    stats.sum = rectSum(t.sum);
+    if(stats.count == 0) return stats;
+
+    // Whole tiles inside the region
+    const unsigned tx0 = (region.x0 + tileSize - 1) / tileSize, tx1 = region.x1 / tileSize;
+    const unsigned ty0 = (region.y0 + tileSize - 1) / tileSize, ty1 = region.y1 / tileSize;
+    Stats border;
+    if(tx0 >= tx1 || ty0 >= ty1) {
+        scan(t.key, region, border, nullptr);
+    } else {
+        const unsigned lx = log2Floor(tx1 - tx0), ly = log2Floor(ty1 - ty0);
+        const size_t level = static_cast<size_t>(ly) * t.levelsX + lx;
+        const size_t corners[] = {static_cast<size_t>(ty0) * t.tilesX + tx0,
+                                  static_cast<size_t>(ty0) * t.tilesX + tx1 - (1u << lx),
+                                  static_cast<size_t>(ty1 - (1u << ly)) * t.tilesX + tx0,
+                                  static_cast<size_t>(ty1 - (1u << ly)) * t.tilesX + tx1 - (1u << lx)};
+        for(const auto corner : corners) {
+            stats.min = std::min(stats.min, t.min[level][corner]);
+            stats.max = std::max(stats.max, t.max[level][corner]);
+        }
+        // Cells along the border which don't fill a whole tile
+        const unsigned x0 = tx0 * tileSize, x1 = tx1 * tileSize, y0 = ty0 * tileSize, y1 = ty1 * tileSize;
+        scan(t.key, {region.x0, region.y0, region.x1, y0}, border, nullptr);
+        scan(t.key, {region.x0, y1, region.x1, region.y1}, border, nullptr);
+        scan(t.key, {region.x0, y0, x0, y1}, border, nullptr);
+        scan(t.key, {x1, y0, region.x1, y1}, border, nullptr);
+    }
+    stats.min = std::min(stats.min, border.min);
+    stats.max = std::max(stats.max, border.max);
+    return stats;
+}
+
+void RoiDepthCalculator::scan(const Key& key, const GridRegion& region, Stats& stats, std::vector<uint16_t>* values) const {
+    for(unsigned gy = region.y0; gy < region.y1; gy++) {
+        const uint16_t* depth = row(gy * key.step);
+        for(unsigned gx = region.x0; gx < region.x1; gx++) {
+            const uint16_t value = depth[gx * key.step];
+            if(value <= key.lowerThreshold || value >= key.upperThreshold) continue;
+            stats.sum += value;
+            stats.count++;
+            stats.min = std::min(stats.min, value);
+            stats.max = std::max(stats.max, value);
+            if(values) values->push_back(value);
+        }
+    }
+}
+
+}  // namespace impl
+}  // namespace dai
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "depthai/pipeline/datatype/SpatialLocationCalculatorData.hpp"
+
+namespace dai {
+namespace impl {
+
+/**
+ * Host implementation of the SpatialLocationCalculator. Computes depth statistics and spatial coordinates of ROIs on a RAW16 depth frame.
+ *
+ * ROIs with the same thresholds and step size share lookup tables, built once per frame when they cover more pixels than the frame:
+ * summed area tables of valid pixel counts and depth sums give the average in O(1), and a sparse table over tiles of the frame
+ * gives the min and max from four lookups plus the pixels along the ROI border that don't fill a whole tile.
+ * Median and mode depend on all depth values of the ROI, so they are computed from its (subsampled) pixels.
+ * Subsampling with a step size larger than 1 takes the pixels on a grid aligned to the frame.
+ */
+class RoiDepthCalculator {
+   public:
+    struct Intrinsics {
+        float fx, fy, cx, cy;
+    };
+
+    /**
+     * Set the depth frame of the following calculations. The data is not copied and has to stay valid until then
+     * @param data RAW16 depth data
+     * @param stride Row stride in bytes
+     * @param intrinsics Camera intrinsics of the depth frame, spatial X and Y are left at 0 without them
+     */
+    void setFrame(const uint8_t* data, unsigned width, unsigned height, unsigned stride, const std::optional<Intrinsics>& intrinsics);
+
+    /**
+     * Calculate the spatial locations of all ROIs, in the order of the configs
+     */
+    std::vector<SpatialLocations> calculate(const std::vector<SpatialLocationCalculatorConfigData>& configs);
+
+   private:
+    struct Key {
+        uint32_t lowerThreshold;
+        uint32_t upperThreshold;
+        unsigned step;
+        bool operator==(const Key& other) const {
+            return lowerThreshold == other.lowerThreshold && upperThreshold == other.upperThreshold && step == other.step;
+        }
+    };
+
+    // Region on the subsampling grid, end exclusive
+    struct GridRegion {
+        unsigned x0, y0, x1, y1;
+    };
+
+    struct Stats {
+        uint64_t sum = 0;
+        uint32_t count = 0;
+        uint16_t min = UINT16_MAX;
+        uint16_t max = 0;
+    };
+
+    struct Tables {
+        Key key;
+        bool valid = false;
+        unsigned gridWidth = 0, gridHeight = 0;
+        unsigned tilesX = 0, tilesY = 0, levelsX = 0, levelsY = 0;
+        // Summed area tables with a leading row and column of zeros
+        std::vector<uint32_t> count;
+        std::vector<uint64_t> sum;
+        // Sparse table levels of tile minimums and maximums, level (ly, lx) covers 2^ly x 2^lx tiles
+        std::vector<std::vector<uint16_t>> min;
+        std::vector<std::vector<uint16_t>> max;
+    };
+
+    const uint16_t* row(unsigned y) const {
+        return reinterpret_cast<const uint16_t*>(data + static_cast<size_t>(y) * stride);
+    }
+    GridRegion getGridRegion(const SpatialLocationCalculatorConfigData& config, unsigned step) const;
+    Tables& getTables(const Key& key);
+    void buildTables(Tables& tables) const;
+    Stats query(const Tables& tables, const GridRegion& region) const;
+    void scan(const Key& key, const GridRegion& region, Stats& stats, std::vector<uint16_t>* values) const;
+
+    const uint8_t* data = nullptr;
+    unsigned width = 0, height = 0, stride = 0;
+    std::optional<Intrinsics> intrinsics;
+
+    // Reused between frames
+    std::vector<Tables> tables;
+    std::vector<uint16_t> values;
+};
+
+}  // namespace impl
+}  // namespace dai
@@ -0,0 +1,117 @@
+#include "SyncEngine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+
+namespace dai {
+namespace impl {
+
+SyncEngine::SyncEngine(std::size_t numInputs, std::int64_t thresholdNs, int syncAttempts, std::size_t capacity)
+    : buffers(numInputs),
+      lastSent(numInputs, std::numeric_limits<std::int64_t>::min()),
+      thresholdNs(thresholdNs),
+      syncAttempts(syncAttempts),
+      capacity(std::max<std::size_t>(capacity, 1)),
+      picks(numInputs),
+      bestPicks(numInputs) {}
+
+void SyncEngine::add(std::size_t input, std::shared_ptr<Buffer> msg) {
+    const auto ts = std::chrono::duration_cast<std::chrono::nanoseconds>(msg->getTimestamp().time_since_epoch()).count();
+    if(ts <= lastSent[input]) {
+        stats.late++;
+        return;
+    }
+    // Messages of a single input mostly arrive in order, so search from the back
+    auto& buffer = buffers[input];
+    auto it = buffer.end();
+    while(it != buffer.begin() && std::prev(it)->ts > ts) --it;
+    buffer.insert(it, {ts, std::move(msg)});
+    if(buffer.size() > capacity) dropFront(input);
+}
+
+void SyncEngine::dropFront(std::size_t input) {
+    buffers[input].pop_front();
+    stats.dropped++;
+    attempts++;
+}
+
+bool SyncEngine::isDead(std::size_t input, std::int64_t ts) const {
+    for(std::size_t k = 0; k < buffers.size(); k++) {
+        if(k == input) continue;
+        const auto& buffer = buffers[k];
+        // Future messages of the input are newer than anything it sent or holds
+        const auto newest = buffer.empty() ? lastSent[k] : buffer.back().ts;
+        if(newest == std::numeric_limits<std::int64_t>::min() || newest - ts < thresholdNs) continue;
+        const bool match = std::any_of(buffer.begin(), buffer.end(), [this, ts](const Entry& e) { return std::abs(e.ts - ts) < thresholdNs; });
+        if(!match) return true;
+    }
+    return false;
+}
+
+void SyncEngine::take(const std::vector<std::size_t>& picks, std::vector<std::shared_ptr<Buffer>>& group) {
+    group.resize(buffers.size());
+    for(std::size_t k = 0; k < buffers.size(); k++) {
+        auto& buffer = buffers[k];
+        // Anything older than the picked message can't be sent anymore
+        stats.dropped += picks[k];
+        buffer.erase(buffer.begin(), buffer.begin() + picks[k]);
+        group[k] = std::move(buffer.front().msg);
+        lastSent[k] = buffer.front().ts;
+        buffer.pop_front();
+    }
+    stats.groups++;
+    stats.matched += buffers.size();
+    attempts = 0;
+}
+
+bool SyncEngine::next(std::vector<std::shared_ptr<Buffer>>& group) {
+    // Past the allowed attempts the oldest messages are kept, to be sent out unsynced
+    const auto givenUp = [this]() { return syncAttempts >= 0 && attempts > static_cast<std::uint64_t>(syncAttempts); };
+    for(std::size_t i = 0; i < buffers.size(); i++) {
+        while(!buffers[i].empty() && !givenUp() && isDead(i, buffers[i].front().ts)) dropFront(i);
+    }
+    for(const auto& buffer : buffers) {
+        if(buffer.empty()) return false;
+    }
+
+    // Earliest window [anchor, anchor + threshold) holding a message of every input,
+    // each input contributes its first message within the window
+    bool found = false;
+    std::int64_t bestAnchor = 0;
+    for(const auto& anchorBuffer : buffers) {
+        for(const auto& anchor : anchorBuffer) {
+            if(found && anchor.ts >= bestAnchor) break;
+            bool complete = true;
+            for(std::size_t k = 0; k < buffers.size() && complete; k++) {
+                const auto& buffer = buffers[k];
+                auto it = std::lower_bound(buffer.begin(), buffer.end(), anchor.ts, [](const Entry& e, std::int64_t ts) { return e.ts < ts; });
+                complete = it != buffer.end() && it->ts - anchor.ts < thresholdNs;
+                if(complete) picks[k] = static_cast<std::size_t>(it - buffer.begin());
+            }
+            if(complete) {
+                found = true;
+                bestAnchor = anchor.ts;
+                bestPicks.swap(picks);
+                // Later anchors of this input are only newer
+                break;
+            }
+        }
+    }
+    if(found) {
+        take(bestPicks, group);
+        return true;
+    }
+
+    if(givenUp()) {
+        std::fill(picks.begin(), picks.end(), 0);
+        take(picks, group);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace impl
+}  // namespace dai
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "depthai/pipeline/datatype/Buffer.hpp"
+#include "depthai/pipeline/node/Sync.hpp"
+
+namespace dai {
+namespace impl {
+
+/**
+ * Groups messages of several inputs by timestamp.
+ * Each input keeps a small timestamp sorted buffer, a group is emitted as soon as every input has a message
+ * within the threshold of the others, without waiting on the inputs in a fixed order
+ */
+class SyncEngine {
+   public:
+    using Stats = node::Sync::SyncStats;
+
+    /**
+     * @param numInputs Number of inputs
+     * @param thresholdNs Maximal interval between the oldest and newest message of a group
+     * @param syncAttempts Once more messages than this were discarded, the oldest messages are sent out unsynced, -1 to never do so
+     * @param capacity Number of messages buffered per input
+     */
+    SyncEngine(std::size_t numInputs, std::int64_t thresholdNs, int syncAttempts, std::size_t capacity);
+
+    /**
+     * Add a message received on the input
+     */
+    void add(std::size_t input, std::shared_ptr<Buffer> msg);
+
+    /**
+     * Take the next group out of the buffers, one message per input, in input order
+     * @returns False if no group can be formed yet
+     */
+    bool next(std::vector<std::shared_ptr<Buffer>>& group);
+
+    const Stats& getStats() const {
+        return stats;
+    }
+
+   private:
+    struct Entry {
+        std::int64_t ts;
+        std::shared_ptr<Buffer> msg;
+    };
+
+    bool isDead(std::size_t input, std::int64_t ts) const;
+    void dropFront(std::size_t input);
+    void take(const std::vector<std::size_t>& picks, std::vector<std::shared_ptr<Buffer>>& group);
+
+    std::vector<std::deque<Entry>> buffers;
+    // Timestamp of the last message sent out per input, anything older arrived too late
+    std::vector<std::int64_t> lastSent;
+    std::int64_t thresholdNs;
+    int syncAttempts;
+    std::size_t capacity;
+    // Messages discarded since the last group
+    std::uint64_t attempts = 0;
+    Stats stats;
+    // Scratch space for the group search
+    std::vector<std::size_t> picks, bestPicks;
+};
+
+}  // namespace impl
+}  // namespace dai
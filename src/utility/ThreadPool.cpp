@@ -0,0 +1,107 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace dai {
+namespace utility {
+
+ThreadPool::ThreadPool(size_t numThreads) {
+    workers.reserve(numThreads);
+    for(size_t i = 0; i < numThreads; i++) {
+        workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    cv.notify_all();
+    for(auto& worker : workers) {
+        if(worker.joinable()) worker.join();
+    }
+}
+
+void ThreadPool::workerLoop() {
+    while(true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this]() { return stopping || !jobs.empty(); });
+            if(jobs.empty()) return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        job();
+    }
+}
+
+void ThreadPool::parallelFor(size_t numTasks, const std::function<void(size_t)>& fn, size_t maxConcurrency) {
+    if(numTasks == 0) return;
+
+    // Shared with helper jobs, which may only get scheduled after the caller already returned
+    struct State {
+        std::function<void(size_t)> fn;
+        std::atomic<size_t> next{0};
+        size_t numTasks = 0;
+        size_t finished = 0;
+        std::exception_ptr error;
+        std::mutex mtx;
+        std::condition_variable cv;
+    };
+    auto state = std::make_shared<State>();
+    state->fn = fn;
+    state->numTasks = numTasks;
+
+    auto work = [](State& s) {
+        size_t done = 0;
+        std::exception_ptr error;
+        for(size_t i = s.next++; i < s.numTasks; i = s.next++) {
+            try {
+                s.fn(i);
+            } catch(...) {
+                if(!error) error = std::current_exception();
+            }
+            done++;
+        }
+        if(done == 0) return;
+        std::unique_lock<std::mutex> lock(s.mtx);
+        if(error && !s.error) s.error = error;
+        s.finished += done;
+        if(s.finished == s.numTasks) s.cv.notify_all();
+    };
+
+    size_t numHelpers = std::min(numTasks - 1, workers.size());
+    if(maxConcurrency > 0) numHelpers = std::min(numHelpers, maxConcurrency - 1);
+    if(numHelpers > 0) {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            for(size_t i = 0; i < numHelpers; i++) {
+                jobs.emplace_back([state, work]() { work(*state); });
+            }
+        }
+        if(numHelpers == 1) {
+            cv.notify_one();
+        } else {
+            cv.notify_all();
+        }
+    }
+
+    work(*state);
+
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->cv.wait(lock, [&]() { return state->finished == state->numTasks; });
+    if(state->error) std::rethrow_exception(state->error);
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+}  // namespace utility
+}  // namespace dai
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dai {
+namespace utility {
+
+/**
+ * Fixed size pool of worker threads for splitting CPU bound work (eg. image bands) across cores
+ */
+class ThreadPool {
+   public:
+    /**
+     * @param numThreads Number of worker threads. 0 creates a pool without workers, where all work runs on the calling thread
+     */
+    explicit ThreadPool(size_t numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Run fn(i) for every i in [0, numTasks) and wait for all of them to finish.
+     * The calling thread takes part in the work, so nested calls from a worker can not deadlock.
+     * At most maxConcurrency tasks run at once (0 means no limit besides the pool size).
+     * The first exception thrown by a task is rethrown once all started tasks finish.
+     */
+    void parallelFor(size_t numTasks, const std::function<void(size_t)>& fn, size_t maxConcurrency = 0);
+
+    size_t getNumThreads() const {
+        return workers.size();
+    }
+
+    /**
+     * Process wide pool with one worker less than the number of hardware threads (the caller is the last one)
+     */
+    static ThreadPool& shared();
+
+   private:
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stopping = false;
+};
+
+}  // namespace utility
+}  // namespace dai
@@ -0,0 +1,96 @@
+#include "WorkStealingExecutor.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include "Logging.hpp"
+
+namespace dai {
+namespace utility {
+
+namespace {
+// Executor and queue index of the current thread, if it is a worker
+thread_local const WorkStealingExecutor* currentExecutor = nullptr;
+thread_local size_t currentIndex = 0;
+}  // namespace
+
+WorkStealingExecutor::WorkStealingExecutor(size_t numThreads) {
+    numThreads = std::max<size_t>(numThreads, 1);
+    for(size_t i = 0; i < numThreads; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    workers.reserve(numThreads);
+    for(size_t i = 0; i < numThreads; i++) {
+        workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    cv.notify_all();
+    for(auto& worker : workers) {
+        if(worker.joinable()) worker.join();
+    }
+}
+
+void WorkStealingExecutor::submit(std::function<void()> task) {
+    // Keep follow up work of a task on the same worker, its data is likely still in cache
+    const size_t index = currentExecutor == this ? currentIndex : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mtx);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        pending++;
+    }
+    cv.notify_one();
+}
+
+bool WorkStealingExecutor::tryPop(size_t index, std::function<void()>& task) {
+    {
+        auto& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if(!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+    for(size_t i = 1; i < queues.size(); i++) {
+        auto& victim = *queues[(index + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mtx);
+        if(!victim.tasks.empty()) {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingExecutor::workerLoop(size_t index) {
+    currentExecutor = this;
+    currentIndex = index;
+    while(true) {
+        std::function<void()> task;
+        if(tryPop(index, task)) {
+            pending--;
+            try {
+                task();
+            } catch(const std::exception& ex) {
+                logger::error("Executor task threw an exception: {}", ex.what());
+            }
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]() { return stopping || pending > 0; });
+        if(stopping && pending == 0) return;
+    }
+}
+
+}  // namespace utility
+}  // namespace dai
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dai {
+namespace utility {
+
+/**
+ * Pool of worker threads running independent tasks (eg. processing of host node messages).
+ * Every worker has its own task deque. Tasks submitted from a worker go to its own deque, others are spread round robin.
+ * Idle workers steal from the back of the other deques
+ */
+class WorkStealingExecutor {
+   public:
+    /**
+     * @param numThreads Number of worker threads, at least one is created
+     */
+    explicit WorkStealingExecutor(size_t numThreads);
+
+    /**
+     * Runs the tasks already submitted, then joins the workers
+     */
+    ~WorkStealingExecutor();
+
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    /**
+     * Queue a task. Tasks should not throw, an escaping exception is logged and discarded
+     */
+    void submit(std::function<void()> task);
+
+    size_t getNumThreads() const {
+        return workers.size();
+    }
+
+   private:
+    struct Queue {
+        std::mutex mtx;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    bool tryPop(size_t index, std::function<void()>& task);
+    void workerLoop(size_t index);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextQueue{0};
+    // Tasks queued but not taken yet, only incremented under mtx so sleeping workers don't miss one
+    std::atomic<size_t> pending{0};
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stopping = false;
+};
+
+}  // namespace utility
+}  // namespace dai
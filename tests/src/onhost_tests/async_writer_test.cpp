@@ -0,0 +1,140 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../../src/utility/AsyncWriter.hpp"
+#include "../../src/utility/WorkStealingExecutor.hpp"
+
+using dai::utility::AsyncWriter;
+using dai::utility::WorkStealingExecutor;
+
+TEST_CASE("AsyncWriter writes in order while preparing in parallel", "[AsyncWriter]") {
+    const int numWrites = 200;
+    AsyncWriter writer(1024 * 1024, false, std::make_shared<WorkStealingExecutor>(4));
+    std::vector<int> written;
+    std::atomic<int> preparing{0};
+    std::atomic<int> maxPreparing{0};
+    std::mt19937 gen(3);
+    for(int i = 0; i < numWrites; i++) {
+        const int delayUs = std::uniform_int_distribution<int>(0, 500)(gen);
+        auto result = std::make_shared<int>(-1);
+        writer.push(
+            100,
+            [&, result, i, delayUs]() {
+                const int now = ++preparing;
+                int expected = maxPreparing;
+                while(now > expected && !maxPreparing.compare_exchange_weak(expected, now)) {
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(delayUs));
+                *result = i;
+                preparing--;
+                return size_t(100);
+            },
+            [&written, result]() { written.push_back(*result); });
+    }
+    writer.flush();
+    REQUIRE(written.size() == numWrites);
+    for(int i = 0; i < numWrites; i++) REQUIRE(written[i] == i);
+    REQUIRE(maxPreparing > 1);
+
+    const auto stats = writer.getStats();
+    REQUIRE(stats.queuedBytes == 0);
+    REQUIRE(stats.writtenMessages == numWrites);
+    REQUIRE(stats.writtenBytes == numWrites * 100);
+    REQUIRE(stats.droppedMessages == 0);
+}
+
+TEST_CASE("AsyncWriter bounds the queued bytes", "[AsyncWriter]") {
+    for(bool dropWhenFull : {false, true}) {
+        AsyncWriter writer(1000, dropWhenFull, std::make_shared<WorkStealingExecutor>(1));
+        int written = 0;
+        int accepted = 0;
+        for(int i = 0; i < 50; i++) {
+            // Slow storage
+            if(writer.push(300, {}, [&written]() {
+                   std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                   written++;
+               })) {
+                accepted++;
+            }
+            REQUIRE(writer.getStats().queuedBytes <= 1000);
+        }
+        writer.flush();
+        const auto stats = writer.getStats();
+        REQUIRE(written == accepted);
+        REQUIRE(stats.maxQueuedBytes <= 1000);
+        REQUIRE(stats.writtenMessages + stats.droppedMessages == 50);
+        REQUIRE(stats.droppedBytes == stats.droppedMessages * 300);
+        if(dropWhenFull) {
+            REQUIRE(stats.droppedMessages > 0);
+        } else {
+            REQUIRE(stats.droppedMessages == 0);
+        }
+    }
+}
+
+TEST_CASE("AsyncWriter reports failed writes", "[AsyncWriter]") {
+    AsyncWriter writer(1000, false, std::make_shared<WorkStealingExecutor>(2));
+    int written = 0;
+    // Hold the writer until everything is queued
+    std::promise<void> queued;
+    auto queuedFuture = queued.get_future().share();
+    writer.push(10, {}, [&written, queuedFuture]() {
+        queuedFuture.wait();
+        written++;
+    });
+    writer.push(10, {}, []() { throw std::runtime_error("disk full"); });
+    writer.push(10, {}, [&written]() { written++; });
+    queued.set_value();
+    REQUIRE_THROWS_AS(writer.flush(), std::runtime_error);
+    REQUIRE_THROWS_AS(writer.push(10, {}, [&written]() { written++; }), std::runtime_error);
+    REQUIRE(written == 1);
+    REQUIRE(writer.getStats().droppedMessages == 2);
+    REQUIRE_THROWS_AS(writer.close(), std::runtime_error);
+}
+
+TEST_CASE("AsyncWriter counts the prepared size", "[AsyncWriter]") {
+    for(bool onExecutor : {false, true}) {
+        // One executor shared by several writers
+        auto executor = onExecutor ? std::make_shared<WorkStealingExecutor>(2) : nullptr;
+        AsyncWriter first(10000, false, executor);
+        AsyncWriter second(10000, false, executor);
+        std::promise<void> prepared;
+        auto preparedFuture = prepared.get_future().share();
+        // Hold the writers until the sizes were checked
+        std::promise<void> checked;
+        auto checkedFuture = checked.get_future().share();
+        for(auto* writer : {&first, &second}) {
+            writer->push(
+                100,
+                [preparedFuture]() {
+                    preparedFuture.wait();
+                    // Eg. a converted frame, larger than the message
+                    return size_t(3000);
+                },
+                [checkedFuture]() { checkedFuture.wait(); });
+            REQUIRE(writer->getStats().queuedBytes == 100);
+        }
+        prepared.set_value();
+        if(onExecutor) {
+            // Prepares run on the executor and update the count right away
+            for(auto* writer : {&first, &second}) {
+                while(writer->getStats().queuedBytes != 3000) std::this_thread::yield();
+            }
+        }
+        checked.set_value();
+        for(auto* writer : {&first, &second}) {
+            writer->flush();
+            const auto stats = writer->getStats();
+            REQUIRE(stats.queuedBytes == 0);
+            REQUIRE(stats.maxQueuedBytes == 3000);
+            REQUIRE(stats.writtenBytes == 3000);
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+#include "xtensor/containers/xadapt.hpp"
+
+using namespace dai;
+
+namespace {
+
+constexpr unsigned inputSize = 640;
+constexpr unsigned numClasses = 80;
+
+std::shared_ptr<NNData> makeNNData(const std::vector<float>& values,
+                                   const std::vector<size_t>& shape,
+                                   TensorInfo::DataType dataType = TensorInfo::DataType::FP32) {
+    auto nnData = std::make_shared<NNData>();
+    xt::xarray<float> tensor = xt::adapt(values, shape);
+    nnData->addTensor<float>("output", tensor, dataType, TensorInfo::StorageOrder::CHW);
+    return nnData;
+}
+
+// Candidate major [N, 4 + classes] YOLO output, boxes in input pixels
+std::vector<float> makeCandidates(size_t count, bool objectness, unsigned seed) {
+    const size_t channels = 4 + (objectness ? 1 : 0) + numClasses;
+    std::vector<float> values(count * channels);
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for(size_t i = 0; i < count; i++) {
+        float* candidate = values.data() + i * channels;
+        candidate[0] = dist(gen) * inputSize;
+        candidate[1] = dist(gen) * inputSize;
+        candidate[2] = 8.0f + dist(gen) * 120.0f;
+        candidate[3] = 8.0f + dist(gen) * 120.0f;
+        // Few confident candidates, like a real output
+        const bool confident = dist(gen) < 0.03f;
+        float* scores = candidate + 4;
+        if(objectness) *scores++ = confident ? 0.8f + 0.2f * dist(gen) : 0.2f * dist(gen);
+        for(unsigned c = 0; c < numClasses; c++) scores[c] = 0.05f * dist(gen);
+        if(confident) scores[static_cast<unsigned>(dist(gen) * numClasses) % numClasses] = 0.7f + 0.3f * dist(gen);
+    }
+    return values;
+}
+
+std::vector<float> transpose(const std::vector<float>& values, size_t rows, size_t cols) {
+    std::vector<float> transposed(values.size());
+    for(size_t r = 0; r < rows; r++) {
+        for(size_t c = 0; c < cols; c++) transposed[c * rows + r] = values[r * cols + c];
+    }
+    return transposed;
+}
+
+struct HostParser {
+    Pipeline pipeline{false};
+    std::shared_ptr<node::DetectionParser> parser;
+    std::shared_ptr<InputQueue> input;
+    std::shared_ptr<MessageQueue> output;
+
+    explicit HostParser(const std::string& subtype) {
+        parser = pipeline.create<node::DetectionParser>();
+        parser->setRunOnHost(true);
+        parser->setNNFamily(DetectionNetworkType::YOLO);
+        parser->setSubtype(subtype);
+        parser->setNumClasses(numClasses);
+        parser->setConfidenceThreshold(0.5f);
+        parser->setIouThreshold(0.5f);
+        parser->setInputImageSize(inputSize, inputSize);
+        input = parser->input.createInputQueue();
+        output = parser->out.createOutputQueue();
+    }
+
+    std::vector<ImgDetection> parse(const std::shared_ptr<NNData>& nnData) {
+        input->send(nnData);
+        auto detections = output->get<ImgDetections>();
+        REQUIRE(detections != nullptr);
+        return detections->detections;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("DetectionParser host benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    constexpr int iterations = 200;
+    constexpr size_t count = 8400;
+
+    const auto measure = [&](const std::string& name, const std::string& subtype, const std::shared_ptr<NNData>& nnData) {
+        HostParser host(subtype);
+        host.pipeline.start();
+        size_t detections = 0;
+        const auto start = Clock::now();
+        for(int i = 0; i < iterations; i++) detections = host.parse(nnData).size();
+        std::cout << name << ": " << std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations << " ms/message, " << detections
+                  << " detections" << std::endl;
+        host.pipeline.stop();
+    };
+
+    const auto withObjectness = makeCandidates(count, true, 1);
+    measure("8400x85 FP32", "yolov5", makeNNData(withObjectness, {1, count, 5 + numClasses}));
+    measure("8400x85 FP16", "yolov5", makeNNData(withObjectness, {1, count, 5 + numClasses}, TensorInfo::DataType::FP16));
+    const auto anchorFree = makeCandidates(count, false, 2);
+    measure("84x8400 FP32", "yolov8n", makeNNData(transpose(anchorFree, count, 4 + numClasses), {1, 4 + numClasses, count}));
+    measure("84x8400 FP16", "yolov8n", makeNNData(transpose(anchorFree, count, 4 + numClasses), {1, 4 + numClasses, count}, TensorInfo::DataType::FP16));
+}
@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "depthai/depthai.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Fresh folder for the cache, so the first request of each version is cold
+class TestFolder {
+   public:
+    TestFolder() : path(fs::temp_directory_path() / ("depthai_firmware_cache_benchmark_" + std::to_string(std::random_device{}()))) {}
+
+    ~TestFolder() {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+
+    fs::path path;
+};
+
+}  // namespace
+
+TEST_CASE("Firmware cache benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    TestFolder folder;
+#ifdef _WIN32
+    _putenv_s("DEPTHAI_FIRMWARE_CACHE_PATH", folder.path.string().c_str());
+#else
+    setenv("DEPTHAI_FIRMWARE_CACHE_PATH", folder.path.string().c_str(), 1);
+#endif
+    const auto measure = [](const std::string& name, dai::OpenVINO::Version version) {
+        dai::Device::Config config;
+        config.version = version;
+        const auto start = Clock::now();
+        REQUIRE_FALSE(dai::DeviceBase::getEmbeddedDeviceBinary(config).empty());
+        std::cout << name << ": " << std::chrono::duration<double, std::milli>(Clock::now() - start).count() << " ms" << std::endl;
+    };
+
+    // The first request also waits for the firmware package to be decompressed
+    measure("Universal firmware, cold", dai::OpenVINO::VERSION_UNIVERSAL);
+    measure("Universal firmware, warm", dai::OpenVINO::VERSION_UNIVERSAL);
+    measure("Patched 2021.2 firmware, cold", dai::OpenVINO::VERSION_2021_2);
+    measure("Patched 2021.2 firmware, warm", dai::OpenVINO::VERSION_2021_2);
+}
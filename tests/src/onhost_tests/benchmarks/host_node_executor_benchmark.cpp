@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+#include "depthai/pipeline/node/host/HostNode.hpp"
+
+#ifndef _WIN32
+    #include <sys/resource.h>
+#endif
+
+namespace {
+
+// Burns a fixed amount of CPU per group
+class Work : public dai::node::CustomNode<Work> {
+   public:
+    std::shared_ptr<dai::Buffer> processGroup(std::shared_ptr<dai::MessageGroup> in) override {
+        volatile std::uint64_t acc = 0;
+        for(int i = 0; i < 20000; i++) acc = acc + i * i;
+        return in->get<dai::Buffer>("in");
+    }
+};
+
+long contextSwitches() {
+#ifndef _WIN32
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_nvcsw + usage.ru_nivcsw;
+#else
+    return 0;
+#endif
+}
+
+}  // namespace
+
+TEST_CASE("HostNode executor benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    const int numNodes = 24;
+    const int numMessages = 500;
+    for(bool executor : {false, true}) {
+        dai::Pipeline p(false);
+        std::vector<std::shared_ptr<dai::InputQueue>> inputs;
+        std::vector<std::shared_ptr<dai::MessageQueue>> outputs;
+        for(int n = 0; n < numNodes; n++) {
+            auto node = p.create<Work>();
+            if(executor) node->runOnExecutor(2);
+            // Every group has to come out, don't drop any
+            node->inputs["in"].setBlocking(true);
+            node->inputs["in"].setMaxSize(numMessages);
+            inputs.push_back(node->inputs["in"].createInputQueue());
+            outputs.push_back(node->out.createOutputQueue(numMessages, true));
+        }
+        p.start();
+
+        const long switchesStart = contextSwitches();
+        const auto start = Clock::now();
+        for(int i = 0; i < numMessages; i++) {
+            for(auto& in : inputs) {
+                auto buffer = std::make_shared<dai::Buffer>();
+                buffer->setTimestamp(Clock::now());
+                in->send(buffer);
+            }
+        }
+        for(auto& out : outputs) {
+            for(int i = 0; i < numMessages; i++) REQUIRE(out->get<dai::Buffer>() != nullptr);
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const long switches = contextSwitches() - switchesStart;
+        std::cout << (executor ? "executor" : "thread per node") << ": " << numNodes * numMessages / seconds << " groups/s, " << switches
+                  << " context switches" << std::endl;
+        p.stop();
+        p.wait();
+    }
+}
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+#include "depthai/pipeline/node/ImageFilters.hpp"
+
+namespace {
+
+// Smooth random walk with invalid (0) pixels sprinkled in, similar to what a ToF / stereo sensor outputs
+std::shared_ptr<dai::ImgFrame> makeDepthFrame(unsigned width, unsigned height, std::mt19937& gen) {
+    std::vector<uint16_t> depth(width * height);
+    std::uniform_int_distribution<int> hole(0, 99), step(-4, 4);
+    int value = 1000;
+    for(auto& d : depth) {
+        value = std::min(std::max(value + step(gen) * 3, 1), 65535);
+        d = hole(gen) < 10 ? 0 : static_cast<uint16_t>(value);
+    }
+    auto frame = std::make_shared<dai::ImgFrame>();
+    std::vector<uint8_t> data(depth.size() * sizeof(uint16_t));
+    std::memcpy(data.data(), depth.data(), data.size());
+    frame->setData(std::move(data));
+    frame->setType(dai::ImgFrame::Type::RAW16);
+    frame->setSize(width, height);
+    frame->setStride(width * sizeof(uint16_t));
+    return frame;
+}
+
+}  // namespace
+
+TEST_CASE("Host ImageFilters benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    const unsigned width = 1280, height = 800;
+    const int iterations = 50;
+
+    dai::filters::params::SpatialFilter spatial;
+    spatial.enable = true;
+    dai::filters::params::SpeckleFilter speckle;
+    speckle.enable = true;
+    dai::filters::params::TemporalFilter temporal;
+    temporal.enable = true;
+    const std::vector<std::pair<std::string, dai::FilterParams>> cases = {
+        {"median 5x5", dai::filters::params::MedianFilter::KERNEL_5x5}, {"spatial", spatial}, {"speckle", speckle}, {"temporal", temporal}};
+
+    std::mt19937 gen(3);
+    const auto frame = makeDepthFrame(width, height, gen);
+    for(const auto& [name, params] : cases) {
+        dai::Pipeline p(false);
+        auto filters = p.create<dai::node::ImageFilters>();
+        filters->setRunOnHost(true);
+        filters->initialConfig->filterParams = {params};
+        auto in = filters->input.createInputQueue();
+        auto out = filters->output.createOutputQueue();
+        p.start();
+
+        const auto start = Clock::now();
+        for(int i = 0; i < iterations; i++) {
+            in->send(frame);
+            REQUIRE(out->get<dai::ImgFrame>() != nullptr);
+        }
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+        std::cout << name << ": " << ms << " ms/frame (" << width << "x" << height << ", incl. queueing)" << std::endl;
+        p.stop();
+    }
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <depthai/utility/ImageManipImpl.hpp>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace dai;
+using namespace dai::impl;
+
+namespace {
+
+struct Frame {
+    FrameSpecs specs;
+    std::vector<uint8_t> data;
+};
+
+// Tightly packed frame filled with random bytes
+Frame makeRandomFrame(ImgFrame::Type type, uint32_t width, uint32_t height) {
+    Frame frame{};
+    auto& s = frame.specs;
+    s.width = width;
+    s.height = height;
+    switch(type) {
+        case ImgFrame::Type::RGB888p:
+        case ImgFrame::Type::BGR888p:
+            s.p1Stride = s.p2Stride = s.p3Stride = width;
+            s.p2Offset = width * height;
+            s.p3Offset = 2 * s.p2Offset;
+            frame.data.resize(3 * s.p2Offset);
+            break;
+        case ImgFrame::Type::RGB888i:
+        case ImgFrame::Type::BGR888i:
+            s.p1Stride = s.p2Stride = s.p3Stride = 3 * width;
+            frame.data.resize(s.p1Stride * height);
+            break;
+        case ImgFrame::Type::NV12:
+            s.p1Stride = s.p2Stride = s.p3Stride = width;
+            s.p2Offset = s.p3Offset = width * height;
+            frame.data.resize(s.p2Offset + s.p2Stride * ((height + 1) / 2));
+            break;
+        case ImgFrame::Type::YUV420p:
+            s.p1Stride = width;
+            s.p2Stride = s.p3Stride = (width + 1) / 2;
+            s.p2Offset = width * height;
+            s.p3Offset = s.p2Offset + s.p2Stride * ((height + 1) / 2);
+            frame.data.resize(s.p3Offset + s.p3Stride * ((height + 1) / 2));
+            break;
+        default:
+            s.p1Stride = s.p2Stride = s.p3Stride = width;
+            frame.data.resize(s.p1Stride * height);
+            break;
+    }
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for(auto& v : frame.data) v = static_cast<uint8_t>(dist(gen));
+    return frame;
+}
+
+std::vector<ColorConvertIsa> getSupportedIsas() {
+    std::vector<ColorConvertIsa> isas = {ColorConvertIsa::SCALAR};
+    switch(getColorConvertIsa()) {
+        case ColorConvertIsa::AVX2:
+            isas.push_back(ColorConvertIsa::SSE41);
+            isas.push_back(ColorConvertIsa::AVX2);
+            break;
+        case ColorConvertIsa::SSE41:
+        case ColorConvertIsa::NEON:
+            isas.push_back(getColorConvertIsa());
+            break;
+        case ColorConvertIsa::SCALAR:
+            break;
+    }
+    return isas;
+}
+
+}  // namespace
+
+TEST_CASE("ColorConvert benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t width = 1920, height = 1080;
+    const int iterations = 50;
+    const std::vector<std::pair<ImgFrame::Type, ImgFrame::Type>> conversions = {{ImgFrame::Type::NV12, ImgFrame::Type::BGR888p},
+                                                                                {ImgFrame::Type::NV12, ImgFrame::Type::RGB888i},
+                                                                                {ImgFrame::Type::YUV420p, ImgFrame::Type::RGB888p},
+                                                                                {ImgFrame::Type::BGR888i, ImgFrame::Type::NV12},
+                                                                                {ImgFrame::Type::RGB888p, ImgFrame::Type::GRAY8}};
+    const char* isaNames[] = {"SCALAR", "SSE41", "AVX2", "NEON"};
+    for(auto [from, to] : conversions) {
+        const auto src = makeRandomFrame(from, width, height);
+        auto dst = makeRandomFrame(to, width, height);
+        std::cout << (int)from << " -> " << (int)to << ":";
+        for(auto isa : getSupportedIsas()) {
+            const auto start = Clock::now();
+            for(int i = 0; i < iterations; i++) {
+                REQUIRE(colorConvertFixedPoint(src.data.data(), src.specs, from, dst.data.data(), dst.specs, to, isa));
+            }
+            const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            std::cout << " " << isaNames[static_cast<int>(isa)] << " " << (double)width * height * iterations / seconds / 1e6 << " Mpix/s";
+        }
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+
+#include "depthai/pipeline/datatype/ImageManipConfig.hpp"
+#include "depthai/utility/ImageManipImpl.hpp"
+
+using namespace dai;
+
+namespace {
+
+using TiledOperations = impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, impl::WarpTiled>;
+
+std::shared_ptr<impl::_ImageManipMemory> makeRandomFrame(ImgFrame::Type type, uint32_t width, uint32_t height) {
+    auto frame = std::make_shared<impl::_ImageManipMemory>(impl::getAlignedOutputFrameSize(type, width, height));
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for(auto& v : frame->getData()) v = static_cast<uint8_t>(dist(gen));
+    return frame;
+}
+
+}  // namespace
+
+TEST_CASE("Tiled warp benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t width = 3840, height = 2160;
+    const int iterations = 10;
+    ImageManipConfig config;
+    config.addCrop(200, 100, 3200, 1800).addRotateDeg(10.0f).setOutputSize(1920, 1080);
+    for(auto type : {ImgFrame::Type::NV12, ImgFrame::Type::RGB888i}) {
+        auto src = makeRandomFrame(type, width, height);
+        for(uint32_t numThreads : {1u, 2u, 4u, 0u}) {
+            TiledOperations manip(ImageManipProperties{});
+            manip.setNumThreads(numThreads);
+            manip.build(config.base, config.outputFrameType, impl::getDstFrameSpecs(width, height, type), type);
+            auto dst = std::make_shared<impl::_ImageManipMemory>(manip.getOutputSize());
+            const auto start = Clock::now();
+            for(int i = 0; i < iterations; i++) REQUIRE(manip.apply(src, dst));
+            const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+            std::cout << "type " << (int)type << ", threads " << numThreads << ": " << ms << " ms/frame" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <depthai/utility/LockFreeQueue.hpp>
+#include <depthai/utility/LockingQueue.hpp>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace dai;
+
+namespace {
+
+struct HandoffStats {
+    double messagesPerSecond;
+    double p99LatencyUs;
+};
+
+// Single producer, single consumer, measured on the consumer's side
+template <typename Queue>
+HandoffStats measureHandoff(Queue& queue, int numMessages) {
+    using Clock = std::chrono::steady_clock;
+    std::vector<Clock::time_point> sent(numMessages);
+    std::vector<double> latencies(numMessages);
+
+    const auto start = Clock::now();
+    std::thread producer([&]() {
+        for(int i = 0; i < numMessages; i++) {
+            sent[i] = Clock::now();
+            queue.push(i);
+        }
+    });
+    for(int i = 0; i < numMessages; i++) {
+        int value = 0;
+        queue.waitAndPop(value);
+        latencies[value] = std::chrono::duration<double, std::micro>(Clock::now() - sent[value]).count();
+    }
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    producer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    return {numMessages / elapsed, latencies[static_cast<size_t>(numMessages * 0.99)]};
+}
+
+}  // namespace
+
+TEST_CASE("Queue handoff benchmark", "[benchmark]") {
+    constexpr int NUM_MESSAGES = 1000000;
+    for(unsigned maxSize : {1u, 8u, 64u}) {
+        LockingQueue<int> locking(maxSize, true);
+        LockFreeQueue<int> lockFree(maxSize, true);
+        const auto lockingStats = measureHandoff(locking, NUM_MESSAGES);
+        const auto lockFreeStats = measureHandoff(lockFree, NUM_MESSAGES);
+        std::cout << "maxSize " << maxSize << " - LockingQueue: " << lockingStats.messagesPerSecond << " msg/s, p99 " << lockingStats.p99LatencyUs
+                  << " us | LockFreeQueue: " << lockFreeStats.messagesPerSecond << " msg/s, p99 " << lockFreeStats.p99LatencyUs << " us" << std::endl;
+        REQUIRE(lockFreeStats.messagesPerSecond > 0);
+    }
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <depthai/nn_archive/NNArchive.hpp>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+
+#ifdef __linux__
+    #include <sys/resource.h>
+#endif
+
+namespace {
+
+// Fresh folder to unpack into, so the first load of each archive is cold
+class TestFolder {
+   public:
+    TestFolder() : path(std::filesystem::temp_directory_path() / ("depthai_nn_archive_benchmark_" + std::to_string(std::random_device{}()))) {}
+
+    ~TestFolder() {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    std::filesystem::path path;
+};
+
+// Peak resident memory of the process in KiB, 0 if unknown
+long getPeakRss() {
+#ifdef __linux__
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return 0;
+#endif
+}
+
+}  // namespace
+
+TEST_CASE("NNArchive load benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    TestFolder folder;
+    const auto options = dai::NNArchiveOptions().extractFolder(folder.path.string());
+    const auto measure = [](const std::string& name, const std::function<void()>& fn) {
+        const auto start = Clock::now();
+        fn();
+        const auto ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << name << ": " << ms << " ms, peak RSS " << getPeakRss() / 1024 << " MiB" << std::endl;
+    };
+
+    for(const std::string path : {BLOB_ARCHIVE_PATH, SUPERBLOB_ARCHIVE_PATH, ONNX_ARCHIVE_PATH}) {
+        const auto name = std::filesystem::path(path).filename().string();
+        measure(name + " cold load", [&]() { dai::NNArchive archive(path, options); });
+        measure(name + " warm load", [&]() { dai::NNArchive archive(path, options); });
+    }
+    measure("Superblob to blob with 8 shaves", [&]() {
+        dai::NNArchive archive(SUPERBLOB_ARCHIVE_PATH, options);
+        archive.getSuperBlob()->getBlobWithNumShaves(8);
+    });
+}
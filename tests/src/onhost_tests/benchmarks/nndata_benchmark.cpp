@@ -0,0 +1,37 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <depthai/pipeline/datatype/NNData.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "depthai/common/TensorInfo.hpp"
+#include "xtensor/generators/xbuilder.hpp"
+
+TEST_CASE("NNData tensor conversion benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    // Output of a YOLO style detection head
+    const std::vector<size_t> shape = {1, 80, 80, 85};
+    xt::xarray<float> values = xt::ones<float>(shape) * 0.5f;
+    xt::xarray<int> bytes = xt::ones<int>(shape) * 100;
+
+    dai::NNData nndata;
+    nndata.addTensor<float>("fp16", values, dai::TensorInfo::DataType::FP16);
+    nndata.addTensor<float>("fp32", values, dai::TensorInfo::DataType::FP32);
+    nndata.addTensor<int>("u8", bytes, dai::TensorInfo::DataType::U8F);
+    nndata.tensors.back().quantization = true;
+    nndata.tensors.back().qpScale = 0.01f;
+    nndata.tensors.back().qpZp = 5.0f;
+
+    constexpr int iterations = 50;
+    const auto measure = [](const std::string& name, auto&& convert) {
+        const auto start = Clock::now();
+        for(int i = 0; i < iterations; i++) REQUIRE(convert().size() == 80u * 80u * 85u);
+        std::cout << name << ": " << std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations << " ms" << std::endl;
+    };
+    measure("FP16 -> FP32 getTensor", [&]() { return nndata.getTensor<float>("fp16"); });
+    measure("U8 dequantize getTensor", [&]() { return nndata.getTensor<float>("u8", true); });
+    measure("FP32 getTensor", [&]() { return nndata.getTensor<float>("fp32"); });
+    measure("FP32 getTensorView", [&]() { return nndata.getTensorView<float>("fp32"); });
+}
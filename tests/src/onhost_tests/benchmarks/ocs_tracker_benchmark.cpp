@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../../../src/utility/ObjectTrackerImpl.hpp"
+#include "depthai/utility/MultiStreamTracker.hpp"
+
+using namespace dai;
+
+namespace {
+
+struct MovingObject {
+    float x, y, w, h, vx, vy;
+};
+
+std::vector<MovingObject> makeObjects(int count, std::mt19937& gen) {
+    std::uniform_real_distribution<float> pos(0.05f, 0.85f), size(0.02f, 0.06f), speed(-0.004f, 0.004f);
+    std::vector<MovingObject> objects;
+    for(int i = 0; i < count; i++) objects.push_back({pos(gen), pos(gen), size(gen), size(gen), speed(gen), speed(gen)});
+    return objects;
+}
+
+std::vector<ImgDetection> step(std::vector<MovingObject>& objects, float missRate, std::mt19937& gen) {
+    std::uniform_real_distribution<float> uniform(0.f, 1.f), confidence(0.5f, 1.f);
+    std::vector<ImgDetection> detections;
+    for(auto& o : objects) {
+        o.x += o.vx;
+        o.y += o.vy;
+        if(uniform(gen) < missRate) continue;
+        ImgDetection det;
+        det.label = 0;
+        det.confidence = confidence(gen);
+        det.xmin = o.x;
+        det.ymin = o.y;
+        det.xmax = o.x + o.w;
+        det.ymax = o.y + o.h;
+        detections.push_back(det);
+    }
+    std::shuffle(detections.begin(), detections.end(), gen);
+    return detections;
+}
+
+}  // namespace
+
+TEST_CASE("MultiStreamTracker benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    const int frames = 100;
+    for(size_t numStreams : {4, 8, 16}) {
+        for(int count : {20, 100}) {
+            std::vector<std::vector<std::vector<ImgDetection>>> sequences(numStreams);
+            for(size_t s = 0; s < numStreams; s++) {
+                std::mt19937 gen(s);
+                auto objects = makeObjects(count, gen);
+                for(int i = 0; i < frames; i++) sequences[s].push_back(step(objects, 0.1f, gen));
+            }
+            ObjectTrackerProperties properties;
+            properties.maxObjectsToTrack = count * 2;
+            properties.trackletBirthThreshold = 3;
+            properties.trackletMaxLifespan = 30;
+            ImgFrame frame;
+
+            // One tracker and thread per stream, like one host ObjectTracker node per camera
+            std::vector<std::thread> threads;
+            const auto threadStart = Clock::now();
+            for(size_t s = 0; s < numStreams; s++) {
+                threads.emplace_back([&, s]() {
+                    impl::OCSTracker tracker(properties);
+                    tracker.init(frame, sequences[s][0], {});
+                    for(int i = 1; i < frames; i++) tracker.update(frame, sequences[s][i], {});
+                });
+            }
+            for(auto& t : threads) t.join();
+            const double threadMs = std::chrono::duration<double, std::milli>(Clock::now() - threadStart).count() / frames;
+
+            MultiStreamTracker engine(properties, numStreams);
+            std::vector<MultiStreamTracker::StreamInput> inputs(numStreams);
+            const auto engineStart = Clock::now();
+            for(int i = 0; i < frames; i++) {
+                for(size_t s = 0; s < numStreams; s++) inputs[s] = {&frame, &sequences[s][i], nullptr, nullptr};
+                engine.process(inputs);
+            }
+            const double engineMs = std::chrono::duration<double, std::milli>(Clock::now() - engineStart).count() / frames;
+            std::cout << numStreams << " streams x " << count << " objects: thread per stream " << threadMs << " ms/step, engine " << engineMs << " ms/step"
+                      << std::endl;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+
+namespace {
+
+std::vector<std::uint8_t> makeData(std::size_t size) {
+    std::vector<std::uint8_t> data(size);
+    std::iota(data.begin(), data.end(), std::uint8_t(0));
+    return data;
+}
+
+std::shared_ptr<dai::ImgFrame> makeImgFrame(unsigned width, unsigned height) {
+    auto frame = std::make_shared<dai::ImgFrame>();
+    frame->setWidth(width);
+    frame->setHeight(height);
+    frame->setType(dai::ImgFrame::Type::NV12);
+    frame->setData(makeData(width * height * 3 / 2));
+    return frame;
+}
+
+std::shared_ptr<dai::EncodedFrame> makeEncodedFrame(std::size_t size) {
+    auto frame = std::make_shared<dai::EncodedFrame>();
+    frame->setWidth(3840);
+    frame->setHeight(2160);
+    frame->setProfile(dai::EncodedFrame::Profile::AVC);
+    frame->setData(makeData(size));
+    return frame;
+}
+
+std::shared_ptr<dai::PointCloudData> makePointCloud(unsigned width, unsigned height) {
+    auto pcl = std::make_shared<dai::PointCloudData>();
+    pcl->setSize(width, height);
+    pcl->setData(makeData(width * height * 3 * sizeof(float)));
+    return pcl;
+}
+
+}  // namespace
+
+TEST_CASE("Proto serialization benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    const auto run = [](const std::string& name, const dai::ProtoSerializable& msg) {
+        const int iterations = 50;
+        std::size_t bytes = 0;
+        auto start = Clock::now();
+        for(int i = 0; i < iterations; i++) bytes += msg.serializeProto().size();
+        const double joined = bytes / std::chrono::duration<double>(Clock::now() - start).count();
+
+        bytes = 0;
+        start = Clock::now();
+        for(int i = 0; i < iterations; i++) bytes += msg.serializeProtoParts().size();
+        const double parts = bytes / std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::cout << name << ": serializeProto " << joined / 1e9 << " GB/s, serializeProtoParts " << parts / 1e9 << " GB/s" << std::endl;
+    };
+    run("ImgFrame 4K NV12", *makeImgFrame(3840, 2160));
+    run("EncodedFrame 2MB", *makeEncodedFrame(2 * 1024 * 1024));
+    run("PointCloudData 1280x800", *makePointCloud(1280, 800));
+}
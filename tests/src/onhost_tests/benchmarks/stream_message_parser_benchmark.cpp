@@ -0,0 +1,76 @@
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <iostream>
+
+// Include depthai library
+#include <depthai/depthai.hpp>
+#include <depthai/pipeline/datatype/StreamMessageParser.hpp>
+#include <depthai/xlink/XLinkStream.hpp>
+
+#include "XLink/XLinkPlatform.h"
+
+namespace {
+
+std::vector<uint8_t> toPacket(const dai::StreamMessageParser::FramedGroup& framed) {
+    std::vector<uint8_t> packet(framed.largestPayload.begin(), framed.largestPayload.end());
+    packet.insert(packet.end(), framed.rest.begin(), framed.rest.end());
+    return packet;
+}
+
+std::shared_ptr<dai::MessageGroup> createGroup(size_t members, size_t frameSize) {
+    auto group = std::make_shared<dai::MessageGroup>();
+    group->setSequenceNum(42);
+    for(size_t i = 0; i < members; i++) {
+        auto frame = std::make_shared<dai::ImgFrame>();
+        frame->setSequenceNum(i);
+        frame->setData(std::vector<uint8_t>(frameSize + i, static_cast<uint8_t>(i + 1)));
+        group->add("frame" + std::to_string(i), frame);
+    }
+    return group;
+}
+
+}  // namespace
+
+TEST_CASE("Framed group message benchmark", "[benchmark]") {
+    using Clock = std::chrono::steady_clock;
+    constexpr int iterations = 200;
+    auto group = createGroup(5, 1280 * 800);
+
+    // Group metadata followed by one packet per member, each parsed separately
+    const auto start = Clock::now();
+    size_t parsedMembers = 0;
+    for(int i = 0; i < iterations; i++) {
+        std::vector<std::vector<uint8_t>> packets;
+        packets.push_back(dai::StreamMessageParser::serializeMetadata(group));
+        for(auto& member : *group) {
+            auto packet = dai::StreamMessageParser::serializeMetadata(member.second);
+            auto data = member.second->data->getData();
+            packet.insert(packet.begin(), data.begin(), data.end());
+            packets.push_back(std::move(packet));
+        }
+        for(auto& ser : packets) {
+            streamPacketDesc_t packet;
+            packet.data = ser.data();
+            packet.length = ser.size();
+            packet.fd = -1;
+            dai::StreamMessageParser::parseMessage(&packet);
+            parsedMembers++;
+        }
+    }
+    const auto perMember = Clock::now() - start;
+
+    const auto framedStart = Clock::now();
+    for(int i = 0; i < iterations; i++) {
+        auto ser = toPacket(dai::StreamMessageParser::serializeFramedGroup(*group));
+        streamPacketDesc_t packet;
+        packet.data = ser.data();
+        packet.length = ser.size();
+        packet.fd = -1;
+        dai::StreamMessageParser::parseMessage(&packet);
+    }
+    const auto framed = Clock::now() - framedStart;
+
+    REQUIRE(parsedMembers == iterations * 6);
+    std::cout << "Per member packets: " << std::chrono::duration<double, std::micro>(perMember).count() / iterations << " us/group, 6 packets" << std::endl;
+    std::cout << "Framed packet: " << std::chrono::duration<double, std::micro>(framed).count() / iterations << " us/group, 1 packet" << std::endl;
+}
@@ -0,0 +1,196 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+#include "xtensor/containers/xadapt.hpp"
+
+using namespace dai;
+using Catch::Approx;
+
+namespace {
+
+constexpr unsigned inputSize = 640;
+constexpr unsigned numClasses = 80;
+
+std::shared_ptr<NNData> makeNNData(const std::vector<float>& values,
+                                   const std::vector<size_t>& shape,
+                                   TensorInfo::DataType dataType = TensorInfo::DataType::FP32,
+                                   TensorInfo::StorageOrder order = TensorInfo::StorageOrder::CHW) {
+    auto nnData = std::make_shared<NNData>();
+    xt::xarray<float> tensor = xt::adapt(values, shape);
+    nnData->addTensor<float>("output", tensor, dataType, order);
+    return nnData;
+}
+
+// Candidate major [N, 4 + classes] YOLO output, boxes in input pixels
+std::vector<float> makeCandidates(size_t count, bool objectness, unsigned seed) {
+    const size_t channels = 4 + (objectness ? 1 : 0) + numClasses;
+    std::vector<float> values(count * channels);
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for(size_t i = 0; i < count; i++) {
+        float* candidate = values.data() + i * channels;
+        candidate[0] = dist(gen) * inputSize;
+        candidate[1] = dist(gen) * inputSize;
+        candidate[2] = 8.0f + dist(gen) * 120.0f;
+        candidate[3] = 8.0f + dist(gen) * 120.0f;
+        // Few confident candidates, like a real output
+        const bool confident = dist(gen) < 0.03f;
+        float* scores = candidate + 4;
+        if(objectness) *scores++ = confident ? 0.8f + 0.2f * dist(gen) : 0.2f * dist(gen);
+        for(unsigned c = 0; c < numClasses; c++) scores[c] = 0.05f * dist(gen);
+        if(confident) scores[static_cast<unsigned>(dist(gen) * numClasses) % numClasses] = 0.7f + 0.3f * dist(gen);
+    }
+    return values;
+}
+
+std::vector<float> transpose(const std::vector<float>& values, size_t rows, size_t cols) {
+    std::vector<float> transposed(values.size());
+    for(size_t r = 0; r < rows; r++) {
+        for(size_t c = 0; c < cols; c++) transposed[c * rows + r] = values[r * cols + c];
+    }
+    return transposed;
+}
+
+struct HostParser {
+    Pipeline pipeline{false};
+    std::shared_ptr<node::DetectionParser> parser;
+    std::shared_ptr<InputQueue> input;
+    std::shared_ptr<MessageQueue> output;
+
+    explicit HostParser(const std::string& subtype, unsigned imageSize = inputSize, DetectionNetworkType family = DetectionNetworkType::YOLO) {
+        parser = pipeline.create<node::DetectionParser>();
+        parser->setRunOnHost(true);
+        parser->setNNFamily(family);
+        parser->setSubtype(subtype);
+        parser->setNumClasses(numClasses);
+        parser->setConfidenceThreshold(0.5f);
+        parser->setIouThreshold(0.5f);
+        parser->setInputImageSize(imageSize, imageSize);
+        input = parser->input.createInputQueue();
+        output = parser->out.createOutputQueue();
+    }
+
+    std::vector<ImgDetection> parse(const std::shared_ptr<NNData>& nnData) {
+        input->send(nnData);
+        auto detections = output->get<ImgDetections>();
+        REQUIRE(detections != nullptr);
+        return detections->detections;
+    }
+};
+
+void requireSame(const std::vector<ImgDetection>& a, const std::vector<ImgDetection>& b) {
+    REQUIRE(a.size() == b.size());
+    for(size_t i = 0; i < a.size(); i++) {
+        REQUIRE(a[i].label == b[i].label);
+        REQUIRE(a[i].confidence == Approx(b[i].confidence).margin(2e-3));
+        REQUIRE(a[i].xmin == Approx(b[i].xmin).margin(2e-3));
+        REQUIRE(a[i].ymin == Approx(b[i].ymin).margin(2e-3));
+        REQUIRE(a[i].xmax == Approx(b[i].xmax).margin(2e-3));
+        REQUIRE(a[i].ymax == Approx(b[i].ymax).margin(2e-3));
+    }
+}
+
+}  // namespace
+
+TEST_CASE("DetectionParser on host decodes anchor free YOLO outputs", "[DetectionParser]") {
+    HostParser host("yolov8n");
+    host.pipeline.start();
+
+    // Two overlapping boxes of class 1, the same box as class 2 and one below the threshold
+    const size_t channels = 4 + numClasses;
+    std::vector<float> values(4 * channels, 0.0f);
+    const auto setCandidate = [&](size_t i, float cx, float cy, float size, unsigned label, float score) {
+        float* candidate = values.data() + i * channels;
+        candidate[0] = cx;
+        candidate[1] = cy;
+        candidate[2] = size;
+        candidate[3] = size;
+        candidate[4 + label] = score;
+    };
+    setCandidate(0, 320, 320, 64, 1, 0.9f);
+    setCandidate(1, 324, 320, 64, 1, 0.8f);
+    setCandidate(2, 320, 320, 64, 2, 0.7f);
+    setCandidate(3, 100, 100, 32, 3, 0.4f);
+
+    const auto detections = host.parse(makeNNData(values, {1, 4, channels}));
+    REQUIRE(detections.size() == 2);
+    REQUIRE(detections[0].label == 1);
+    REQUIRE(detections[0].confidence == Approx(0.9f));
+    REQUIRE(detections[0].xmin == Approx(0.45f));
+    REQUIRE(detections[0].ymin == Approx(0.45f));
+    REQUIRE(detections[0].xmax == Approx(0.55f));
+    REQUIRE(detections[0].ymax == Approx(0.55f));
+    REQUIRE(detections[1].label == 2);
+
+    // Channel major and FP16 outputs decode to the same detections
+    requireSame(host.parse(makeNNData(transpose(values, 4, channels), {1, channels, 4})), detections);
+    requireSame(host.parse(makeNNData(values, {1, 4, channels}, TensorInfo::DataType::FP16)), detections);
+    host.pipeline.stop();
+}
+
+TEST_CASE("DetectionParser on host matches for both YOLO layouts", "[DetectionParser]") {
+    HostParser host("yolov5");
+    host.pipeline.start();
+    const size_t count = 2000;
+    const size_t channels = 5 + numClasses;
+    const auto values = makeCandidates(count, true, 7);
+    const auto candidateMajor = host.parse(makeNNData(values, {1, count, channels}));
+    const auto channelMajor = host.parse(makeNNData(transpose(values, count, channels), {1, channels, count}));
+    REQUIRE(!candidateMajor.empty());
+    requireSame(candidateMajor, channelMajor);
+    for(const auto& detection : candidateMajor) REQUIRE(detection.confidence >= 0.5f);
+    host.pipeline.stop();
+}
+
+TEST_CASE("DetectionParser on host decodes YOLO grid outputs with anchors", "[DetectionParser]") {
+    HostParser host("yolov5", 64);
+    host.parser->setNumClasses(2);
+    host.parser->setAnchors(std::vector<float>{16, 16, 32, 32});
+    host.parser->setAnchorMasks({{"side2", {0, 1}}});
+    host.pipeline.start();
+
+    // 2 anchors of [x, y, w, h, objectness, class 0, class 1] on a 2x2 grid, planar
+    const size_t cells = 4;
+    std::vector<float> values(2 * 7 * cells, 0.0f);
+    const size_t cell = 2;  // row 1, col 0
+    const float candidate[] = {0.5f, 0.5f, 0.5f, 0.5f, 0.9f, 0.1f, 0.8f};
+    for(size_t c = 0; c < 7; c++) values[c * cells + cell] = candidate[c];
+
+    const auto detections = host.parse(makeNNData(values, {1, 14, 2, 2}, TensorInfo::DataType::FP32, TensorInfo::StorageOrder::NCHW));
+    REQUIRE(detections.size() == 1);
+    REQUIRE(detections[0].label == 1);
+    REQUIRE(detections[0].confidence == Approx(0.72f));
+    REQUIRE(detections[0].xmin == Approx(0.125f));
+    REQUIRE(detections[0].ymin == Approx(0.625f));
+    REQUIRE(detections[0].xmax == Approx(0.375f));
+    REQUIRE(detections[0].ymax == Approx(0.875f));
+
+    // Interleaved output of the same grid
+    std::vector<float> interleaved(values.size());
+    for(size_t c = 0; c < 14; c++) {
+        for(size_t i = 0; i < cells; i++) interleaved[i * 14 + c] = values[c * cells + i];
+    }
+    requireSame(host.parse(makeNNData(interleaved, {1, 2, 2, 14}, TensorInfo::DataType::FP32, TensorInfo::StorageOrder::NHWC)), detections);
+    host.pipeline.stop();
+}
+
+TEST_CASE("DetectionParser on host decodes SSD outputs", "[DetectionParser]") {
+    HostParser host("", inputSize, DetectionNetworkType::MOBILENET);
+    host.pipeline.start();
+    // Rows of [image_id, label, confidence, xmin, ymin, xmax, ymax], ended by a negative image id
+    const std::vector<float> values = {0, 1, 0.9f, 0.1f, 0.1f, 0.2f, 0.2f,  //
+                                       0, 2, 0.3f, 0.0f, 0.0f, 1.0f, 1.0f,  //
+                                       0, 3, 0.7f, 0.5f, 0.5f, 0.6f, 0.6f,  //
+                                       -1, 0, 0, 0, 0, 0, 0,                //
+                                       0, 5, 0.99f, 0, 0, 1, 1};
+    const auto detections = host.parse(makeNNData(values, {1, 1, 5, 7}, TensorInfo::DataType::FP32, TensorInfo::StorageOrder::NCHW));
+    REQUIRE(detections.size() == 2);
+    REQUIRE(detections[0].label == 1);
+    REQUIRE(detections[0].xmax == Approx(0.2f));
+    REQUIRE(detections[1].label == 3);
+    host.pipeline.stop();
+}
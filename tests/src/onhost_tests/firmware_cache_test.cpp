@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <string>
+
+#include "depthai/depthai.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+void setEnv(const char* name, const std::string& value) {
+#ifdef _WIN32
+    _putenv_s(name, value.c_str());
+#else
+    setenv(name, value.c_str(), 1);
+#endif
+}
+
+void unsetEnv(const char* name) {
+#ifdef _WIN32
+    _putenv_s(name, "");
+#else
+    unsetenv(name);
+#endif
+}
+
+// Fresh folder for the cache, removed after the test
+class TestFolder {
+   public:
+    TestFolder() : path(fs::temp_directory_path() / ("depthai_firmware_cache_test_" + std::to_string(std::random_device{}()))) {}
+
+    ~TestFolder() {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+
+    fs::path path;
+};
+
+std::optional<fs::path> findCached(const fs::path& cacheDirectory, const std::string& versionName) {
+    if(!fs::exists(cacheDirectory)) return std::nullopt;
+    for(const auto& entry : fs::directory_iterator(cacheDirectory)) {
+        const auto name = entry.path().filename().string();
+        if(name.find(versionName) != std::string::npos && entry.path().extension() == ".cmd") return entry.path();
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+TEST_CASE("Firmware cache stores patched firmware", "[FirmwareCache]") {
+    TestFolder folder;
+    setEnv("DEPTHAI_FIRMWARE_CACHE_PATH", folder.path.string());
+    dai::Device::Config config;
+    config.version = dai::OpenVINO::VERSION_2021_3;
+
+    const auto cold = dai::DeviceBase::getEmbeddedDeviceBinary(config);
+    const auto cached = findCached(folder.path, dai::OpenVINO::getVersionName(config.version));
+    REQUIRE(cached.has_value());
+
+    const auto warm = dai::DeviceBase::getEmbeddedDeviceBinary(config);
+    REQUIRE(cold == warm);
+
+    // A truncated image isn't used, it's rebuilt and replaced
+    const auto size = fs::file_size(cached.value());
+    fs::resize_file(cached.value(), size / 2);
+    REQUIRE(dai::DeviceBase::getEmbeddedDeviceBinary(config) == cold);
+    REQUIRE(fs::file_size(cached.value()) == size);
+}
+
+TEST_CASE("Firmware cache defaults to the user cache folder", "[FirmwareCache]") {
+    TestFolder folder;
+    unsetEnv("DEPTHAI_FIRMWARE_CACHE_PATH");
+#ifdef _WIN32
+    setEnv("LOCALAPPDATA", folder.path.string());
+#else
+    setEnv("XDG_CACHE_HOME", folder.path.string());
+#endif
+    dai::Device::Config config;
+    config.version = dai::OpenVINO::VERSION_2021_2;
+
+    const auto cold = dai::DeviceBase::getEmbeddedDeviceBinary(config);
+    const auto cacheDirectory = folder.path / "depthai";
+    REQUIRE(findCached(cacheDirectory / "firmware", dai::OpenVINO::getVersionName(config.version)).has_value());
+#ifndef _WIN32
+    // Only the user has access to the cached firmware
+    REQUIRE(fs::status(cacheDirectory).permissions() == fs::perms::owner_all);
+#endif
+    REQUIRE(dai::DeviceBase::getEmbeddedDeviceBinary(config) == cold);
+}
@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+#include "depthai/pipeline/node/host/HostNode.hpp"
+
+namespace {
+
+// Passes the message through after a random delay, tracking how many groups are processed at once
+class Delay : public dai::node::CustomNode<Delay> {
+   public:
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+
+    std::shared_ptr<dai::Buffer> processGroup(std::shared_ptr<dai::MessageGroup> in) override {
+        const int now = ++running;
+        int expected = maxRunning;
+        while(now > expected && !maxRunning.compare_exchange_weak(expected, now)) {
+        }
+        thread_local std::mt19937 gen(std::hash<std::thread::id>()(std::this_thread::get_id()));
+        std::this_thread::sleep_for(std::chrono::microseconds(std::uniform_int_distribution<int>(0, 2000)(gen)));
+        running--;
+        return in->get<dai::Buffer>("in");
+    }
+};
+
+// Passes the message through, throwing a non runtime_error on the given sequence number
+class Throwing : public dai::node::CustomNode<Throwing> {
+   public:
+    std::int64_t throwOn = 0;
+
+    std::shared_ptr<dai::Buffer> processGroup(std::shared_ptr<dai::MessageGroup> in) override {
+        auto buffer = in->get<dai::Buffer>("in");
+        if(buffer->getSequenceNum() == throwOn) throw std::logic_error("Test failure");
+        return buffer;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("HostNode on the executor keeps the output order", "[HostNode]") {
+    const int numMessages = 200;
+    for(unsigned maxInFlight : {1u, 4u}) {
+        dai::Pipeline p(false);
+        p.setHostExecutorThreads(4);
+        auto node = p.create<Delay>();
+        node->runOnExecutor(maxInFlight);
+        auto in = node->inputs["in"].createInputQueue();
+        auto out = node->out.createOutputQueue(numMessages, true);
+        p.start();
+
+        for(int i = 0; i < numMessages; i++) {
+            auto buffer = std::make_shared<dai::Buffer>();
+            buffer->setSequenceNum(i);
+            buffer->setTimestamp(std::chrono::steady_clock::now());
+            in->send(buffer);
+        }
+        for(int i = 0; i < numMessages; i++) {
+            auto buffer = out->get<dai::Buffer>();
+            REQUIRE(buffer != nullptr);
+            REQUIRE(buffer->getSequenceNum() == i);
+        }
+        REQUIRE(node->maxRunning <= static_cast<int>(maxInFlight));
+        if(maxInFlight > 1) REQUIRE(node->maxRunning > 1);
+        p.stop();
+        p.wait();
+    }
+}
+
+TEST_CASE("Chained HostNodes on the executor don't block its threads", "[HostNode]") {
+    const int numMessages = 200;
+    const int numNodes = 6;
+    dai::Pipeline p(false);
+    // Fewer threads than nodes, a thread waiting on a full downstream queue would stall the chain
+    p.setHostExecutorThreads(2);
+    std::vector<std::shared_ptr<Delay>> nodes;
+    for(int n = 0; n < numNodes; n++) {
+        auto node = p.create<Delay>();
+        node->runOnExecutor(2);
+        // Block the sender instead of dropping when the node falls behind
+        node->inputs["in"].setBlocking(true);
+        node->inputs["in"].setMaxSize(1);
+        if(!nodes.empty()) nodes.back()->out.link(node->inputs["in"]);
+        nodes.push_back(node);
+    }
+    auto in = nodes.front()->inputs["in"].createInputQueue();
+    auto out = nodes.back()->out.createOutputQueue(1, true);
+    p.start();
+
+    std::thread producer([&]() {
+        try {
+            for(int i = 0; i < numMessages; i++) {
+                auto buffer = std::make_shared<dai::Buffer>();
+                buffer->setSequenceNum(i);
+                buffer->setTimestamp(std::chrono::steady_clock::now());
+                in->send(buffer);
+            }
+        } catch(const dai::MessageQueue::QueueException&) {
+            // Pipeline stopped after a failure below
+        }
+    });
+    std::vector<std::int64_t> received;
+    for(int i = 0; i < numMessages; i++) {
+        bool timedOut = false;
+        auto buffer = out->get<dai::Buffer>(std::chrono::seconds(10), timedOut);
+        if(timedOut || buffer == nullptr) break;
+        received.push_back(buffer->getSequenceNum());
+    }
+    p.stop();
+    producer.join();
+    p.wait();
+
+    REQUIRE(received.size() == static_cast<size_t>(numMessages));
+    for(int i = 0; i < numMessages; i++) REQUIRE(received[i] == i);
+}
+
+TEST_CASE("HostNode on the executor stops the pipeline on any exception", "[HostNode]") {
+    const int numMessages = 20;
+    dai::Pipeline p(false);
+    p.setHostExecutorThreads(2);
+    auto node = p.create<Throwing>();
+    node->throwOn = 5;
+    node->runOnExecutor(4);
+    // Don't drop the failing group
+    node->inputs["in"].setBlocking(true);
+    node->inputs["in"].setMaxSize(numMessages);
+    auto in = node->inputs["in"].createInputQueue();
+    auto out = node->out.createOutputQueue(numMessages, false);
+    p.start();
+
+    try {
+        for(int i = 0; i < numMessages; i++) {
+            auto buffer = std::make_shared<dai::Buffer>();
+            buffer->setSequenceNum(i);
+            buffer->setTimestamp(std::chrono::steady_clock::now());
+            in->send(buffer);
+        }
+    } catch(const dai::MessageQueue::QueueException&) {
+        // Pipeline already stopped by the failure
+    }
+
+    // The failing group still frees its slot, so waiting for the pipeline returns
+    p.wait();
+    REQUIRE_FALSE(p.isRunning());
+}
@@ -0,0 +1,176 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+#include "depthai/pipeline/node/ImageFilters.hpp"
+
+namespace {
+
+std::vector<uint16_t> makeDepth(unsigned width, unsigned height, std::mt19937& gen) {
+    // Smooth random walk with invalid (0) pixels sprinkled in, similar to what a ToF / stereo sensor outputs
+    std::vector<uint16_t> depth(width * height);
+    std::uniform_int_distribution<int> hole(0, 99), step(-4, 4);
+    int value = 1000;
+    for(auto& d : depth) {
+        value = std::min(std::max(value + step(gen) * 3, 1), 65535);
+        d = hole(gen) < 10 ? 0 : static_cast<uint16_t>(value);
+    }
+    return depth;
+}
+
+std::shared_ptr<dai::ImgFrame> makeFrame(const std::vector<uint16_t>& depth, unsigned width, unsigned height) {
+    auto frame = std::make_shared<dai::ImgFrame>();
+    std::vector<uint8_t> data(depth.size() * sizeof(uint16_t));
+    std::memcpy(data.data(), depth.data(), data.size());
+    frame->setData(std::move(data));
+    frame->setType(dai::ImgFrame::Type::RAW16);
+    frame->setSize(width, height);
+    frame->setStride(width * sizeof(uint16_t));
+    return frame;
+}
+
+std::vector<uint16_t> toDepth(const std::shared_ptr<dai::ImgFrame>& frame) {
+    auto data = frame->getData();
+    std::vector<uint16_t> depth(data.size() / sizeof(uint16_t));
+    std::memcpy(depth.data(), data.data(), data.size());
+    return depth;
+}
+
+// Straightforward scalar versions of the host filters, the node has to match them bit for bit
+void referenceSpatial(std::vector<uint16_t>& img, int w, int h, const dai::filters::params::SpatialFilter& p) {
+    const auto radius = static_cast<size_t>(p.holeFillingRadius);
+    const auto deltaZ = static_cast<uint16_t>(static_cast<uint8_t>(p.delta));
+    const float alpha = p.alpha;
+    auto blend = [alpha](int a, int b) { return static_cast<uint16_t>(a * alpha + b * (1.0f - alpha) + 0.5f); };
+    for(int it = 0; it < p.numIterations; it++) {
+        for(int v = 0; v < h; v++) {
+            uint16_t* row = img.data() + v * w;
+            uint16_t val0 = row[0];
+            size_t fill = 0;
+            for(int u = 1; u < w - 1; u++) {
+                uint16_t val1 = row[u];
+                if(val0 >= 1) {
+                    if(val1 >= 1) {
+                        fill = 0;
+                        const int diff = std::abs(val1 - val0);
+                        if(diff >= 1 && diff <= deltaZ) row[u] = val1 = blend(val1, val0);
+                    } else if(radius && ++fill < radius) {
+                        row[u] = val1 = val0;
+                    }
+                }
+                val0 = val1;
+            }
+            uint16_t val1 = row[w - 1];
+            fill = 0;
+            for(int u = w - 2; u >= 0; u--) {
+                uint16_t v0 = row[u];
+                if(val1 >= 1) {
+                    if(v0 > 1) {
+                        fill = 0;
+                        if(std::abs(val1 - v0) <= deltaZ) row[u] = v0 = blend(v0, val1);
+                    } else if(radius && ++fill < radius) {
+                        row[u] = v0 = val1;
+                    }
+                }
+                val1 = v0;
+            }
+        }
+        for(int v = 1; v < h; v++) {
+            for(int u = 0; u < w; u++) {
+                const uint16_t im0 = img[(v - 1) * w + u];
+                uint16_t& imw = img[v * w + u];
+                if(std::abs(im0 - imw) < deltaZ) imw = blend(imw, im0);
+            }
+        }
+        for(int v = h - 1; v > 0; v--) {
+            for(int u = 0; u < w; u++) {
+                const uint16_t im0 = img[v * w + u];
+                uint16_t& imw = img[(v - 1) * w + u];
+                if(im0 && imw && std::abs(im0 - imw) < deltaZ) imw = blend(imw, im0);
+            }
+        }
+    }
+}
+
+// PERSISTENCY_OFF, so holes are never filled from history
+void referenceTemporal(std::vector<uint16_t>& img, std::vector<uint16_t>& last, const dai::filters::params::TemporalFilter& p) {
+    const auto deltaZ = static_cast<uint16_t>(static_cast<uint8_t>(p.delta));
+    for(size_t i = 0; i < img.size(); i++) {
+        const uint16_t cur = img[i];
+        const uint16_t prev = last[i];
+        if(!cur) continue;
+        if(prev && std::abs(cur - prev) < deltaZ) {
+            img[i] = last[i] = static_cast<uint16_t>(p.alpha * cur + (1 - p.alpha) * prev);
+        } else {
+            last[i] = cur;
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Host spatial filter matches the scalar reference", "[ImageFilters]") {
+    std::mt19937 gen(7);
+    for(auto size : {std::make_pair(1280u, 800u), std::make_pair(37u, 21u), std::make_pair(1u, 5u)}) {
+        for(uint8_t radius : {0, 2, 6}) {
+            dai::filters::params::SpatialFilter params;
+            params.enable = true;
+            params.holeFillingRadius = radius;
+            params.alpha = 0.37f;
+            params.delta = 20;
+            params.numIterations = 2;
+
+            dai::Pipeline p(false);
+            auto filters = p.create<dai::node::ImageFilters>();
+            filters->setRunOnHost(true);
+            filters->initialConfig->filterParams = {params};
+            auto in = filters->input.createInputQueue();
+            auto out = filters->output.createOutputQueue();
+            p.start();
+
+            const auto [width, height] = size;
+            auto depth = makeDepth(width, height, gen);
+            in->send(makeFrame(depth, width, height));
+            auto result = out->get<dai::ImgFrame>();
+            REQUIRE(result != nullptr);
+
+            referenceSpatial(depth, width, height, params);
+            REQUIRE(toDepth(result) == depth);
+            p.stop();
+        }
+    }
+}
+
+TEST_CASE("Host temporal filter matches the scalar reference", "[ImageFilters]") {
+    const unsigned width = 1280, height = 800;
+    dai::filters::params::TemporalFilter params;
+    params.enable = true;
+    params.persistencyMode = dai::filters::params::TemporalFilter::PersistencyMode::PERSISTENCY_OFF;
+    params.alpha = 0.4f;
+    params.delta = 20;
+
+    dai::Pipeline p(false);
+    auto filters = p.create<dai::node::ImageFilters>();
+    filters->setRunOnHost(true);
+    filters->initialConfig->filterParams = {params};
+    auto in = filters->input.createInputQueue();
+    auto out = filters->output.createOutputQueue();
+    p.start();
+
+    std::mt19937 gen(11);
+    std::vector<uint16_t> last(width * height, 0);
+    for(int i = 0; i < 10; i++) {
+        auto depth = makeDepth(width, height, gen);
+        in->send(makeFrame(depth, width, height));
+        auto result = out->get<dai::ImgFrame>();
+        REQUIRE(result != nullptr);
+
+        referenceTemporal(depth, last, params);
+        REQUIRE(toDepth(result) == depth);
+    }
+    p.stop();
+}
@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+#include "depthai/pipeline/node/host/ImageManipBatch.hpp"
+#include "depthai/utility/ImageManipImpl.hpp"
+
+using namespace dai;
+
+namespace {
+
+using TiledOperations = impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, impl::WarpTiled>;
+
+std::shared_ptr<ImgFrame> makeFrame(ImgFrame::Type type, uint32_t width, uint32_t height, int64_t sequenceNum) {
+    std::vector<uint8_t> data(impl::getAlignedOutputFrameSize(type, width, height));
+    std::mt19937 gen(static_cast<unsigned>(sequenceNum));
+    std::uniform_int_distribution<int> dist(0, 255);
+    for(auto& v : data) v = static_cast<uint8_t>(dist(gen));
+
+    auto frame = std::make_shared<ImgFrame>();
+    const auto specs = impl::getDstFrameSpecs(width, height, type);
+    frame->setData(std::move(data));
+    frame->setType(type);
+    frame->setSize(width, height);
+    frame->setStride(specs.p1Stride);
+    frame->fb.p1Offset = specs.p1Offset;
+    frame->fb.p2Offset = specs.p2Offset;
+    frame->fb.p3Offset = specs.p3Offset;
+    frame->transformation = ImgTransformation(width, height);
+    frame->setSequenceNum(sequenceNum);
+    return frame;
+}
+
+std::shared_ptr<MessageGroup> makeCrops(size_t count, uint32_t outWidth, uint32_t outHeight, ImgFrame::Type outType) {
+    auto group = std::make_shared<MessageGroup>();
+    for(size_t i = 0; i < count; i++) {
+        auto config = std::make_shared<ImageManipConfig>();
+        config->addCrop(20 + 37 * i, 10 + 23 * i, 90 + 3 * i, 70 + 2 * i).setOutputSize(outWidth, outHeight).setFrameType(outType);
+        group->add("crop" + std::to_string(i), config);
+    }
+    return group;
+}
+
+std::vector<uint8_t> runManip(const ImageManipConfig& config, ImgFrame& frame) {
+    TiledOperations manip(ImageManipProperties{});
+    manip.build(config.base, config.outputFrameType, impl::getSrcFrameSpecs(frame.fb), frame.getType());
+    auto src = std::make_shared<impl::_ImageManipMemory>(frame.getData());
+    auto dst = std::make_shared<impl::_ImageManipMemory>(manip.getOutputSize());
+    REQUIRE(manip.apply(src, dst));
+    auto data = dst->getData();
+    return std::vector<uint8_t>(data.begin(), data.end());
+}
+
+}  // namespace
+
+TEST_CASE("ImageManipBatch matches ImageManip per output", "[ImageManipBatch]") {
+    for(auto type : {ImgFrame::Type::RGB888i, ImgFrame::Type::NV12}) {
+        Pipeline p(false);
+        auto batch = p.create<node::ImageManipBatch>();
+        batch->setNumFramesPool(2);
+        auto inConfig = batch->inputConfig.createInputQueue();
+        auto inImage = batch->inputImage.createInputQueue();
+        auto out = batch->out.createOutputQueue();
+        auto outTensor = batch->outTensor.createOutputQueue();
+        p.start();
+
+        for(int64_t seq = 0; seq < 3; seq++) {
+            auto frame = makeFrame(type, 640, 480, seq);
+            auto crops = makeCrops(5, 64, 48, ImgFrame::Type::BGR888p);
+            inConfig->send(crops);
+            inImage->send(frame);
+
+            auto group = out->get<MessageGroup>();
+            REQUIRE(group != nullptr);
+            REQUIRE(group->getSequenceNum() == seq);
+            REQUIRE(group->getNumMessages() == 5);
+            auto tensor = outTensor->get<NNData>();
+            REQUIRE(tensor != nullptr);
+            REQUIRE(tensor->getSequenceNum() == seq);
+            const auto info = tensor->getTensorInfo("batch");
+            REQUIRE(info.has_value());
+            REQUIRE(info->order == TensorInfo::StorageOrder::NCHW);
+            REQUIRE(info->dims == std::vector<unsigned>{5, 3, 48, 64});
+            const auto tensorData = tensor->getData();
+
+            size_t offset = 0;
+            for(auto& entry : *crops) {
+                auto output = group->get<ImgFrame>(entry.first);
+                REQUIRE(output != nullptr);
+                REQUIRE(output->getType() == ImgFrame::Type::BGR888p);
+                REQUIRE(output->getWidth() == 64);
+                REQUIRE(output->getHeight() == 48);
+                const auto expected = runManip(*std::static_pointer_cast<ImageManipConfig>(entry.second), *frame);
+                const auto data = output->getData();
+                REQUIRE(std::vector<uint8_t>(data.begin(), data.end()) == expected);
+                REQUIRE(std::vector<uint8_t>(tensorData.begin() + offset, tensorData.begin() + offset + expected.size()) == expected);
+                offset += expected.size();
+            }
+            REQUIRE(offset == tensorData.size());
+        }
+        p.stop();
+    }
+}
+
+TEST_CASE("ImageManipBatch sends a tensor only for equally sized outputs", "[ImageManipBatch]") {
+    Pipeline p(false);
+    auto batch = p.create<node::ImageManipBatch>();
+    auto inConfig = batch->inputConfig.createInputQueue();
+    auto inImage = batch->inputImage.createInputQueue();
+    auto out = batch->out.createOutputQueue();
+    auto outTensor = batch->outTensor.createOutputQueue();
+    p.start();
+
+    auto crops = makeCrops(3, 64, 48, ImgFrame::Type::RGB888i);
+    auto larger = std::make_shared<ImageManipConfig>();
+    larger->addCrop(0, 0, 200, 200).setOutputSize(96, 96).setFrameType(ImgFrame::Type::RGB888i);
+    crops->add("larger", larger);
+    inConfig->send(crops);
+    inImage->send(makeFrame(ImgFrame::Type::RGB888i, 640, 480, 0));
+    auto group = out->get<MessageGroup>();
+    REQUIRE(group->getNumMessages() == 4);
+    REQUIRE(group->get<ImgFrame>("larger")->getWidth() == 96);
+
+    inConfig->send(makeCrops(3, 64, 48, ImgFrame::Type::RGB888i));
+    inImage->send(makeFrame(ImgFrame::Type::RGB888i, 640, 480, 1));
+    out->get<MessageGroup>();
+    auto tensor = outTensor->get<NNData>();
+    REQUIRE(tensor->getSequenceNum() == 1);
+    REQUIRE(tensor->getTensorInfo("batch")->order == TensorInfo::StorageOrder::NHWC);
+    REQUIRE(tensor->getTensorInfo("batch")->dims == std::vector<unsigned>{3, 48, 64, 3});
+    p.stop();
+}
@@ -0,0 +1,273 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <depthai/utility/ImageManipImpl.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace dai;
+using namespace dai::impl;
+
+namespace {
+
+struct Frame {
+    FrameSpecs specs;
+    std::vector<uint8_t> data;
+};
+
+// Tightly packed frame with a padded stride, to make sure strides are honored
+Frame makeFrame(ImgFrame::Type type, uint32_t width, uint32_t height) {
+    const uint32_t pad = 5;
+    Frame frame{};
+    auto& s = frame.specs;
+    s.width = width;
+    s.height = height;
+    switch(type) {
+        case ImgFrame::Type::RGB888p:
+        case ImgFrame::Type::BGR888p:
+            s.p1Stride = s.p2Stride = s.p3Stride = width + pad;
+            s.p2Offset = s.p1Stride * height;
+            s.p3Offset = 2 * s.p2Offset;
+            frame.data.resize(3 * s.p2Offset);
+            break;
+        case ImgFrame::Type::RGB888i:
+        case ImgFrame::Type::BGR888i:
+            s.p1Stride = s.p2Stride = s.p3Stride = 3 * width + pad;
+            frame.data.resize(s.p1Stride * height);
+            break;
+        case ImgFrame::Type::NV12:
+            s.p1Stride = s.p2Stride = s.p3Stride = width + pad;
+            s.p2Offset = s.p3Offset = s.p1Stride * height;
+            frame.data.resize(s.p2Offset + s.p2Stride * ((height + 1) / 2));
+            break;
+        case ImgFrame::Type::YUV420p:
+            s.p1Stride = width + pad;
+            s.p2Stride = s.p3Stride = (width + 1) / 2 + pad;
+            s.p2Offset = s.p1Stride * height;
+            s.p3Offset = s.p2Offset + s.p2Stride * ((height + 1) / 2);
+            frame.data.resize(s.p3Offset + s.p3Stride * ((height + 1) / 2));
+            break;
+        default:
+            s.p1Stride = s.p2Stride = s.p3Stride = width + pad;
+            frame.data.resize(s.p1Stride * height);
+            break;
+    }
+    return frame;
+}
+
+Frame makeRandomFrame(ImgFrame::Type type, uint32_t width, uint32_t height, uint32_t seed = 42) {
+    auto frame = makeFrame(type, width, height);
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for(auto& v : frame.data) v = static_cast<uint8_t>(dist(gen));
+    return frame;
+}
+
+// Pixel accessors
+struct Rgb {
+    int r, g, b;
+};
+Rgb getRgb(const Frame& f, ImgFrame::Type type, uint32_t i, uint32_t j) {
+    const auto& s = f.specs;
+    const uint8_t* d = f.data.data();
+    switch(type) {
+        case ImgFrame::Type::RGB888p:
+            return {d[s.p1Offset + i * s.p1Stride + j], d[s.p2Offset + i * s.p2Stride + j], d[s.p3Offset + i * s.p3Stride + j]};
+        case ImgFrame::Type::BGR888p:
+            return {d[s.p3Offset + i * s.p3Stride + j], d[s.p2Offset + i * s.p2Stride + j], d[s.p1Offset + i * s.p1Stride + j]};
+        case ImgFrame::Type::RGB888i: {
+            const uint8_t* p = d + s.p1Offset + i * s.p1Stride + 3 * j;
+            return {p[0], p[1], p[2]};
+        }
+        case ImgFrame::Type::BGR888i: {
+            const uint8_t* p = d + s.p1Offset + i * s.p1Stride + 3 * j;
+            return {p[2], p[1], p[0]};
+        }
+        default:
+            return {0, 0, 0};
+    }
+}
+void getYuv(const Frame& f, ImgFrame::Type type, uint32_t i, uint32_t j, int& y, int& u, int& v) {
+    const auto& s = f.specs;
+    const uint8_t* d = f.data.data();
+    y = d[s.p1Offset + i * s.p1Stride + j];
+    if(type == ImgFrame::Type::NV12) {
+        u = d[s.p2Offset + (i / 2) * s.p2Stride + (j / 2) * 2];
+        v = d[s.p2Offset + (i / 2) * s.p2Stride + (j / 2) * 2 + 1];
+    } else {
+        u = d[s.p2Offset + (i / 2) * s.p2Stride + j / 2];
+        v = d[s.p3Offset + (i / 2) * s.p3Stride + j / 2];
+    }
+}
+
+int toU8(float v) {
+    return std::clamp(static_cast<int>(std::lround(v)), 0, 255);
+}
+
+// Compares only pixel data, padding is left untouched
+bool samePixels(const Frame& a, const Frame& b, ImgFrame::Type type) {
+    const auto& s = a.specs;
+    for(uint32_t i = 0; i < s.height; i++) {
+        for(uint32_t j = 0; j < s.width; j++) {
+            if(type == ImgFrame::Type::NV12 || type == ImgFrame::Type::YUV420p) {
+                int y1, u1, v1, y2, u2, v2;
+                getYuv(a, type, i, j, y1, u1, v1);
+                getYuv(b, type, i, j, y2, u2, v2);
+                if(y1 != y2 || u1 != u2 || v1 != v2) return false;
+            } else if(type == ImgFrame::Type::GRAY8) {
+                if(a.data[s.p1Offset + i * s.p1Stride + j] != b.data[s.p1Offset + i * s.p1Stride + j]) return false;
+            } else {
+                auto p1 = getRgb(a, type, i, j);
+                auto p2 = getRgb(b, type, i, j);
+                if(p1.r != p2.r || p1.g != p2.g || p1.b != p2.b) return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<ColorConvertIsa> getSupportedIsas() {
+    std::vector<ColorConvertIsa> isas = {ColorConvertIsa::SCALAR};
+    switch(getColorConvertIsa()) {
+        case ColorConvertIsa::AVX2:
+            isas.push_back(ColorConvertIsa::SSE41);
+            isas.push_back(ColorConvertIsa::AVX2);
+            break;
+        case ColorConvertIsa::SSE41:
+        case ColorConvertIsa::NEON:
+            isas.push_back(getColorConvertIsa());
+            break;
+        case ColorConvertIsa::SCALAR:
+            break;
+    }
+    return isas;
+}
+
+const std::vector<ImgFrame::Type> RGB_TYPES = {ImgFrame::Type::RGB888p, ImgFrame::Type::BGR888p, ImgFrame::Type::RGB888i, ImgFrame::Type::BGR888i};
+const std::vector<ImgFrame::Type> YUV_TYPES = {ImgFrame::Type::NV12, ImgFrame::Type::YUV420p};
+
+}  // namespace
+
+TEST_CASE("ColorConvert - YUV to RGB within tolerance of float conversion", "[ColorConvert]") {
+    // Odd width exercises the vector tail
+    const uint32_t width = 70, height = 6;
+    for(auto from : YUV_TYPES) {
+        auto src = makeRandomFrame(from, width, height);
+        for(auto to : RGB_TYPES) {
+            for(auto isa : getSupportedIsas()) {
+                auto dst = makeFrame(to, width, height);
+                REQUIRE(colorConvertFixedPoint(src.data.data(), src.specs, from, dst.data.data(), dst.specs, to, isa));
+                int maxDiff = 0;
+                for(uint32_t i = 0; i < height; i++) {
+                    for(uint32_t j = 0; j < width; j++) {
+                        int y, u, v;
+                        getYuv(src, from, i, j, y, u, v);
+                        float r, g, b;
+                        RGBfromYUV(r, g, b, y, u, v);
+                        auto px = getRgb(dst, to, i, j);
+                        maxDiff = std::max({maxDiff, std::abs(px.r - toU8(r)), std::abs(px.g - toU8(g)), std::abs(px.b - toU8(b))});
+                    }
+                }
+                REQUIRE(maxDiff <= 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("ColorConvert - RGB to YUV within tolerance of float conversion", "[ColorConvert]") {
+    const uint32_t width = 70, height = 7;
+    for(auto from : RGB_TYPES) {
+        auto src = makeRandomFrame(from, width, height);
+        for(auto to : YUV_TYPES) {
+            for(auto isa : getSupportedIsas()) {
+                auto dst = makeFrame(to, width, height);
+                REQUIRE(colorConvertFixedPoint(src.data.data(), src.specs, from, dst.data.data(), dst.specs, to, isa));
+                int maxDiffY = 0, maxDiffUV = 0;
+                for(uint32_t i = 0; i < height; i++) {
+                    for(uint32_t j = 0; j < width; j++) {
+                        auto px = getRgb(src, from, i, j);
+                        float y, u, v;
+                        YUVfromRGB(y, u, v, px.r, px.g, px.b);
+                        int outY, outU, outV;
+                        getYuv(dst, to, i, j, outY, outU, outV);
+                        maxDiffY = std::max(maxDiffY, std::abs(outY - toU8(y)));
+                        if(i % 2 == 0 && j % 2 == 0) {
+                            // Chroma of the 2x2 block average
+                            float r = 0, g = 0, b = 0;
+                            const uint32_t i1 = std::min(i + 1, height - 1), j1 = std::min(j + 1, width - 1);
+                            for(auto [ii, jj] : {std::pair{i, j}, std::pair{i, j1}, std::pair{i1, j}, std::pair{i1, j1}}) {
+                                auto p = getRgb(src, from, ii, jj);
+                                r += p.r / 4.0f;
+                                g += p.g / 4.0f;
+                                b += p.b / 4.0f;
+                            }
+                            YUVfromRGB(y, u, v, r, g, b);
+                            maxDiffUV = std::max({maxDiffUV, std::abs(outU - toU8(u)), std::abs(outV - toU8(v))});
+                        }
+                    }
+                }
+                REQUIRE(maxDiffY <= 1);
+                REQUIRE(maxDiffUV <= 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("ColorConvert - GRAY8 within tolerance of float conversion", "[ColorConvert]") {
+    const uint32_t width = 37, height = 4;
+    for(auto from : RGB_TYPES) {
+        auto src = makeRandomFrame(from, width, height);
+        auto dst = makeFrame(ImgFrame::Type::GRAY8, width, height);
+        REQUIRE(colorConvertFixedPoint(src.data.data(), src.specs, from, dst.data.data(), dst.specs, ImgFrame::Type::GRAY8));
+        for(uint32_t i = 0; i < height; i++) {
+            for(uint32_t j = 0; j < width; j++) {
+                auto px = getRgb(src, from, i, j);
+                const int expected = toU8(0.299f * px.r + 0.587f * px.g + 0.114f * px.b);
+                REQUIRE(std::abs(dst.data[i * dst.specs.p1Stride + j] - expected) <= 1);
+            }
+        }
+    }
+    for(auto from : YUV_TYPES) {
+        auto src = makeRandomFrame(from, width, height);
+        auto dst = makeFrame(ImgFrame::Type::GRAY8, width, height);
+        REQUIRE(colorConvertFixedPoint(src.data.data(), src.specs, from, dst.data.data(), dst.specs, ImgFrame::Type::GRAY8));
+        for(uint32_t i = 0; i < height; i++) {
+            for(uint32_t j = 0; j < width; j++) {
+                const int y = src.data[i * src.specs.p1Stride + j];
+                REQUIRE(std::abs(dst.data[i * dst.specs.p1Stride + j] - toU8(1.164f * (y - 16))) <= 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("ColorConvert - Vectorized paths are bit-exact with scalar", "[ColorConvert]") {
+    const uint32_t width = 333, height = 17;
+    std::vector<std::pair<ImgFrame::Type, ImgFrame::Type>> conversions;
+    for(auto yuv : YUV_TYPES) {
+        for(auto rgb : RGB_TYPES) {
+            conversions.emplace_back(yuv, rgb);
+            conversions.emplace_back(rgb, yuv);
+            conversions.emplace_back(rgb, ImgFrame::Type::GRAY8);
+        }
+        conversions.emplace_back(yuv, ImgFrame::Type::GRAY8);
+    }
+    for(auto [from, to] : conversions) {
+        auto src = makeRandomFrame(from, width, height, 7);
+        auto reference = makeFrame(to, width, height);
+        REQUIRE(colorConvertFixedPoint(src.data.data(), src.specs, from, reference.data.data(), reference.specs, to, ColorConvertIsa::SCALAR));
+        for(auto isa : getSupportedIsas()) {
+            auto dst = makeFrame(to, width, height);
+            REQUIRE(colorConvertFixedPoint(src.data.data(), src.specs, from, dst.data.data(), dst.specs, to, isa));
+            REQUIRE(samePixels(reference, dst, to));
+        }
+    }
+}
+
+TEST_CASE("ColorConvert - Unsupported conversions are rejected", "[ColorConvert]") {
+    auto src = makeRandomFrame(ImgFrame::Type::RGB888p, 16, 2);
+    auto dst = makeFrame(ImgFrame::Type::BGR888p, 16, 2);
+    REQUIRE_FALSE(colorConvertFixedPoint(src.data.data(), src.specs, ImgFrame::Type::RGB888p, dst.data.data(), dst.specs, ImgFrame::Type::BGR888p));
+    REQUIRE_FALSE(colorConvertFixedPoint(src.data.data(), src.specs, ImgFrame::Type::RAW16, dst.data.data(), dst.specs, ImgFrame::Type::NV12));
+}
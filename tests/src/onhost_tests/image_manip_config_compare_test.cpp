@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "depthai/pipeline/datatype/ImageManipConfig.hpp"
+#include "depthai/utility/ImageManipImpl.hpp"
+
+using namespace dai;
+
+namespace {
+
+// Counts the warp builds, which only happen when ImageManipOperations rebuilds
+template <template <typename T> typename ImageManipBuffer, typename ImageManipData>
+class CountingWarp : public impl::WarpH<ImageManipBuffer, ImageManipData> {
+   public:
+    static inline int builds = 0;
+
+    void build(const impl::FrameSpecs srcFrameSpecs,
+               const impl::FrameSpecs dstFrameSpecs,
+               const ImgFrame::Type type,
+               const std::array<std::array<float, 3>, 3> matrix,
+               std::vector<std::array<std::array<float, 2>, 4>> srcCorners) override {
+        builds++;
+        impl::WarpH<ImageManipBuffer, ImageManipData>::build(srcFrameSpecs, dstFrameSpecs, type, matrix, srcCorners);
+    }
+};
+
+using CountingOperations = impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, CountingWarp>;
+using Counter = CountingWarp<impl::_ImageManipBuffer, impl::_ImageManipMemory>;
+
+std::shared_ptr<impl::_ImageManipMemory> makeRandomFrame(ImgFrame::Type type, uint32_t width, uint32_t height) {
+    auto frame = std::make_shared<impl::_ImageManipMemory>(impl::getAlignedOutputFrameSize(type, width, height));
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for(auto& v : frame->getData()) v = static_cast<uint8_t>(dist(gen));
+    return frame;
+}
+
+std::vector<ImageManipConfig> getConfigs() {
+    std::vector<ImageManipConfig> configs(4);
+    // Crop + resize + rotate chain
+    configs[0].addCrop(100, 50, 1600, 900).addRotateDeg(17.5f).setOutputSize(1280, 720, ImageManipConfig::ResizeMode::LETTERBOX);
+    // Plain downscale
+    configs[1].setOutputSize(640, 360);
+    // Perspective
+    configs[2].addTransformPerspective({1.0f, 0.05f, 10.0f, -0.02f, 0.9f, 5.0f, 0.0001f, 0.00005f, 1.0f}).setOutputSize(957, 533);
+    // Crop only
+    configs[3].addCrop(64, 32, 800, 600);
+    return configs;
+}
+
+}  // namespace
+
+TEST_CASE("ImageManip configs compare structurally", "[ImageManip]") {
+    const auto configs = getConfigs();
+    for(size_t i = 0; i < configs.size(); i++) {
+        for(size_t j = 0; j < configs.size(); j++) {
+            REQUIRE((configs[i].base == configs[j].base) == (i == j));
+        }
+    }
+    auto copy = configs[0];
+    REQUIRE(copy.base == configs[0].base);
+    copy.setBackgroundColor(1, 2, 3);
+    REQUIRE(copy.base != configs[0].base);
+
+    ImageManipConfig fourPoints;
+    fourPoints.base.transformFourPoints({Point2f(0, 0), Point2f(1, 0), Point2f(1, 1), Point2f(0, 1)}, {Point2f(0, 0), Point2f(1, 0), Point2f(1, 1), Point2f(0, 1)});
+    auto moved = fourPoints;
+    REQUIRE(moved.base == fourPoints.base);
+    moved.base.operations[0] = FourPoints({Point2f(0, 0), Point2f(1, 0), Point2f(1, 1), Point2f(0, 1)}, {Point2f(0, 0), Point2f(1, 0), Point2f(1, 1), Point2f(0, 0.5f)});
+    REQUIRE(moved.base != fourPoints.base);
+}
+
+TEST_CASE("ImageManip rebuilds only when the config changes", "[ImageManip]") {
+    const uint32_t width = 1920, height = 1080;
+    const auto type = ImgFrame::Type::RGB888i;
+    const auto srcSpecs = impl::getDstFrameSpecs(width, height, type);
+    const auto src = makeRandomFrame(type, width, height);
+
+    // Same output size, different operations
+    ImageManipConfig plain;
+    plain.setOutputSize(640, 360);
+    ImageManipConfig flipped;
+    flipped.addFlipHorizontal().setOutputSize(640, 360);
+
+    CountingOperations manip(ImageManipProperties{});
+    const auto run = [&](const ImageManipConfig& config, impl::FrameSpecs specs) {
+        manip.build(config.base, config.outputFrameType, specs, type);
+        auto dst = std::make_shared<impl::_ImageManipMemory>(manip.getOutputSize());
+        REQUIRE(manip.apply(src, dst));
+        auto data = dst->getData();
+        return std::vector<uint8_t>(data.begin(), data.end());
+    };
+
+    Counter::builds = 0;
+    const auto plainOutput = run(plain, srcSpecs);
+    REQUIRE(Counter::builds == 1);
+
+    // An equal config, also a separate copy of it, reuses the build
+    REQUIRE(run(plain, srcSpecs) == plainOutput);
+    REQUIRE(run(ImageManipConfig(plain), srcSpecs) == plainOutput);
+    REQUIRE(Counter::builds == 1);
+
+    const auto flippedOutput = run(flipped, srcSpecs);
+    REQUIRE(Counter::builds == 2);
+    REQUIRE(flippedOutput.size() == plainOutput.size());
+    REQUIRE(flippedOutput != plainOutput);
+    run(flipped, srcSpecs);
+    REQUIRE(Counter::builds == 2);
+
+    REQUIRE(run(plain, srcSpecs) == plainOutput);
+    REQUIRE(Counter::builds == 3);
+
+    // A different input rebuilds with the same config
+    run(plain, impl::getDstFrameSpecs(1280, 720, type));
+    REQUIRE(Counter::builds == 4);
+}
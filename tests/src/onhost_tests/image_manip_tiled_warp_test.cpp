@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "depthai/pipeline/datatype/ImageManipConfig.hpp"
+#include "depthai/utility/ImageManipImpl.hpp"
+
+using namespace dai;
+
+namespace {
+
+using TiledOperations = impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, impl::WarpTiled>;
+using WarpHOperations = impl::ImageManipOperations<impl::_ImageManipBuffer, impl::_ImageManipMemory, impl::WarpH>;
+
+std::shared_ptr<impl::_ImageManipMemory> makeRandomFrame(ImgFrame::Type type, uint32_t width, uint32_t height) {
+    auto frame = std::make_shared<impl::_ImageManipMemory>(impl::getAlignedOutputFrameSize(type, width, height));
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for(auto& v : frame->getData()) v = static_cast<uint8_t>(dist(gen));
+    return frame;
+}
+
+template <typename Operations = TiledOperations>
+std::vector<uint8_t> runManip(const ImageManipConfig& config,
+                              const std::shared_ptr<impl::_ImageManipMemory>& src,
+                              ImgFrame::Type type,
+                              uint32_t width,
+                              uint32_t height,
+                              uint32_t numThreads) {
+    Operations manip(ImageManipProperties{});
+    manip.setNumThreads(numThreads);
+    manip.build(config.base, config.outputFrameType, impl::getDstFrameSpecs(width, height, type), type);
+    auto dst = std::make_shared<impl::_ImageManipMemory>(manip.getOutputSize());
+    REQUIRE(manip.apply(src, dst));
+    auto data = dst->getData();
+    return std::vector<uint8_t>(data.begin(), data.end());
+}
+
+std::vector<ImageManipConfig> getConfigs() {
+    std::vector<ImageManipConfig> configs(6);
+    // Crop + resize + rotate chain
+    configs[0].addCrop(100, 50, 1600, 900).addRotateDeg(17.5f).setOutputSize(1280, 720, ImageManipConfig::ResizeMode::LETTERBOX);
+    // Plain downscale
+    configs[1].setOutputSize(640, 360);
+    // Perspective
+    configs[2].addTransformPerspective({1.0f, 0.05f, 10.0f, -0.02f, 0.9f, 5.0f, 0.0001f, 0.00005f, 1.0f}).setOutputSize(957, 533);
+    // Crop only
+    configs[3].addCrop(64, 32, 800, 600);
+    // Rotate only
+    configs[4].addRotateDeg(-33.0f);
+    // Affine with shear
+    configs[5].addTransformAffine({0.8f, 0.15f, -0.1f, 1.1f}).setOutputSize(1111, 777);
+    return configs;
+}
+
+}  // namespace
+
+TEST_CASE("Tiled warp with a single thread matches WarpH", "[ImageManip]") {
+    const uint32_t width = 1920, height = 1080;
+    for(auto type : {ImgFrame::Type::RGB888i, ImgFrame::Type::BGR888p, ImgFrame::Type::NV12, ImgFrame::Type::GRAY8}) {
+        auto src = makeRandomFrame(type, width, height);
+        for(const auto& config : getConfigs()) {
+            REQUIRE(runManip(config, src, type, width, height, 1) == runManip<WarpHOperations>(config, src, type, width, height, 1));
+        }
+    }
+}
+
+TEST_CASE("Tiled warp output is identical for any number of threads", "[ImageManip]") {
+    const uint32_t width = 1920, height = 1080;
+    for(auto type : {ImgFrame::Type::RGB888i, ImgFrame::Type::BGR888p, ImgFrame::Type::NV12, ImgFrame::Type::GRAY8}) {
+        auto src = makeRandomFrame(type, width, height);
+        for(const auto& config : getConfigs()) {
+            const auto reference = runManip(config, src, type, width, height, 1);
+            for(uint32_t numThreads : {2u, 3u, 8u}) {
+                REQUIRE(runManip(config, src, type, width, height, numThreads) == reference);
+            }
+        }
+    }
+}
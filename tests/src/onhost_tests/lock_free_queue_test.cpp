@@ -0,0 +1,164 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <depthai/pipeline/MessageQueue.hpp>
+#include <depthai/pipeline/datatype/ADatatype.hpp>
+#include <depthai/utility/LockFreeQueue.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace dai;
+
+TEST_CASE("LockFreeQueue - Basic operations", "[LockFreeQueue]") {
+    LockFreeQueue<int> queue(4);
+    int value = 0;
+
+    REQUIRE(queue.empty());
+    REQUIRE_FALSE(queue.tryPop(value));
+
+    REQUIRE(queue.push(1));
+    REQUIRE(queue.push(2));
+    REQUIRE(queue.getSize() == 2);
+    REQUIRE(queue.front(value));
+    REQUIRE(value == 1);
+    REQUIRE(queue.tryPop(value));
+    REQUIRE(value == 1);
+    REQUIRE(queue.waitAndPop(value));
+    REQUIRE(value == 2);
+    REQUIRE_FALSE(queue.tryWaitAndPop(value, std::chrono::milliseconds(10)));
+}
+
+TEST_CASE("LockFreeQueue - maxSize smaller than capacity", "[LockFreeQueue]") {
+    // Ring is rounded up to 8 slots, maxSize must still be respected
+    LockFreeQueue<int> queue(5);
+    for(int i = 0; i < 5; i++) REQUIRE(queue.push(i));
+    REQUIRE(queue.isFull());
+    REQUIRE_FALSE(queue.tryWaitAndPush(5, std::chrono::milliseconds(10)));
+    REQUIRE(queue.getSize() == 5);
+}
+
+TEST_CASE("LockFreeQueue - Non-blocking overwrites oldest", "[LockFreeQueue]") {
+    LockFreeQueue<int> queue(2, false);
+    for(int i = 0; i < 10; i++) REQUIRE(queue.push(i));
+    int value = 0;
+    REQUIRE(queue.tryPop(value));
+    REQUIRE(value == 8);
+    REQUIRE(queue.tryPop(value));
+    REQUIRE(value == 9);
+}
+
+TEST_CASE("LockFreeQueue - Growing maxSize keeps elements", "[LockFreeQueue]") {
+    LockFreeQueue<int> queue(2);
+    queue.push(1);
+    queue.push(2);
+    queue.setMaxSize(100);
+    for(int i = 3; i <= 100; i++) REQUIRE(queue.push(i));
+    std::vector<int> values;
+    queue.consumeAll([&values](int& v) { values.push_back(v); });
+    REQUIRE(values.size() == 100);
+    REQUIRE(std::is_sorted(values.begin(), values.end()));
+}
+
+TEST_CASE("LockFreeQueue - Destruct unblocks waiters", "[LockFreeQueue]") {
+    LockFreeQueue<int> queue(1);
+    std::thread closer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        queue.destruct();
+    });
+    int value = 0;
+    REQUIRE_FALSE(queue.waitAndPop(value));
+    closer.join();
+    REQUIRE(queue.isDestroyed());
+}
+
+TEST_CASE("LockFreeQueue - Multiple producers keep per-producer order", "[LockFreeQueue]") {
+    constexpr int NUM_PRODUCERS = 3;
+    constexpr int NUM_MESSAGES = 100000;
+    LockFreeQueue<std::pair<int, int>> queue(8);
+
+    std::vector<std::thread> producers;
+    for(int p = 0; p < NUM_PRODUCERS; p++) {
+        producers.emplace_back([&queue, p]() {
+            for(int i = 0; i < NUM_MESSAGES; i++) queue.push({p, i});
+        });
+    }
+
+    std::vector<int> last(NUM_PRODUCERS, -1);
+    bool ordered = true;
+    for(int i = 0; i < NUM_PRODUCERS * NUM_MESSAGES; i++) {
+        std::pair<int, int> value;
+        REQUIRE(queue.waitAndPop(value));
+        ordered &= value.second == last[value.first] + 1;
+        last[value.first] = value.second;
+    }
+    for(auto& producer : producers) producer.join();
+    REQUIRE(ordered);
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("LockFreeQueue - Concurrent producers never exceed maxSize", "[LockFreeQueue]") {
+    constexpr int NUM_PRODUCERS = 8;
+    constexpr unsigned MAX_SIZE = 3;
+    for(int round = 0; round < 50; round++) {
+        LockFreeQueue<int> queue(MAX_SIZE);
+        std::atomic<bool> start{false};
+        std::atomic<int> pushed{0};
+        std::vector<std::thread> producers;
+        for(int p = 0; p < NUM_PRODUCERS; p++) {
+            producers.emplace_back([&]() {
+                while(!start) std::this_thread::yield();
+                // Nobody consumes, so only maxSize pushes can succeed
+                if(queue.tryWaitAndPush(1, std::chrono::milliseconds(20))) pushed++;
+            });
+        }
+        start = true;
+        for(auto& producer : producers) producer.join();
+        REQUIRE(pushed == static_cast<int>(MAX_SIZE));
+        REQUIRE(queue.getSize() == MAX_SIZE);
+    }
+}
+
+TEST_CASE("LockFreeQueue - Shrinking maxSize blocks pushes", "[LockFreeQueue]") {
+    LockFreeQueue<int> queue(4);
+    for(int i = 0; i < 4; i++) REQUIRE(queue.push(i));
+    queue.setMaxSize(2);
+    REQUIRE(queue.isFull());
+    REQUIRE_FALSE(queue.tryWaitAndPush(4, std::chrono::milliseconds(10)));
+
+    int value = 0;
+    REQUIRE(queue.tryPop(value));
+    REQUIRE(queue.tryPop(value));
+    REQUIRE_FALSE(queue.tryWaitAndPush(4, std::chrono::milliseconds(10)));
+    REQUIRE(queue.tryPop(value));
+    REQUIRE(value == 2);
+    REQUIRE(queue.tryWaitAndPush(4, std::chrono::milliseconds(10)));
+    REQUIRE(queue.getSize() == 2);
+}
+
+TEST_CASE("MessageQueue - Lock-free queue type", "[MessageQueue]") {
+    MessageQueue queue(2, true);
+    REQUIRE(queue.getQueueType() == MessageQueue::QueueType::LOCKING);
+
+    auto msg1 = std::make_shared<ADatatype>();
+    auto msg2 = std::make_shared<ADatatype>();
+    queue.send(msg1);
+
+    // Pending messages are carried over
+    queue.setQueueType(MessageQueue::QueueType::LOCK_FREE);
+    REQUIRE(queue.getQueueType() == MessageQueue::QueueType::LOCK_FREE);
+    REQUIRE(queue.getMaxSize() == 2);
+    queue.send(msg2);
+    REQUIRE(queue.isFull());
+    REQUIRE(queue.get() == msg1);
+    REQUIRE(queue.get() == msg2);
+
+    // Too large for the ring buffer
+    queue.setMaxSize(LockFreeQueue<int>::MAX_CAPACITY + 1);
+    REQUIRE(queue.getQueueType() == MessageQueue::QueueType::LOCKING);
+
+    queue.setMaxSize(4);
+    queue.setQueueType(MessageQueue::QueueType::LOCK_FREE);
+    queue.close();
+    REQUIRE_THROWS_AS(queue.get(), MessageQueue::QueueException);
+}
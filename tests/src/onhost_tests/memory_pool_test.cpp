@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+#include <depthai/pipeline/datatype/ImgFrame.hpp>
+#include <depthai/utility/ImageManipImpl.hpp>
+#include <depthai/utility/MemoryPool.hpp>
+#include <memory>
+#include <vector>
+
+using namespace dai;
+
+TEST_CASE("MemoryPool - Blocks are reused once released", "[MemoryPool]") {
+    auto pool = MemoryPool::create(2);
+    const uint8_t* first = nullptr;
+    {
+        auto block = pool->acquire(1024);
+        REQUIRE(block->getSize() == 1024);
+        first = block->data();
+        REQUIRE(pool->getStats().inUse == 1);
+    }
+    REQUIRE(pool->getStats().inUse == 0);
+
+    auto block = pool->acquire(512);
+    REQUIRE(block->data() == first);
+    REQUIRE(block->getSize() == 512);
+    REQUIRE(block->getMaxSize() >= 1024);
+}
+
+TEST_CASE("MemoryPool - Exhausted pool overflows", "[MemoryPool]") {
+    auto pool = MemoryPool::create(2, 64);
+    std::vector<std::shared_ptr<VectorMemory>> blocks;
+    for(int i = 0; i < 3; i++) blocks.push_back(pool->acquire(64));
+
+    auto stats = pool->getStats();
+    REQUIRE(stats.capacity == 2);
+    REQUIRE(stats.inUse == 3);
+    REQUIRE(stats.highWaterMark == 3);
+    REQUIRE(stats.overflows == 1);
+
+    // Only capacity blocks are kept after release
+    blocks.clear();
+    stats = pool->getStats();
+    REQUIRE(stats.inUse == 0);
+    REQUIRE(stats.highWaterMark == 3);
+}
+
+TEST_CASE("MemoryPool - Blocks outlive the pool", "[MemoryPool]") {
+    auto pool = MemoryPool::create(1);
+    auto block = pool->acquire(16);
+    pool.reset();
+    block->getData()[0] = 42;
+    REQUIRE(block->getData()[0] == 42);
+}
+
+TEST_CASE("MemoryPool - Pooled block as ImgFrame data", "[MemoryPool]") {
+    auto pool = MemoryPool::create(1);
+    const uint8_t* pooled = nullptr;
+    {
+        ImgFrame frame;
+        frame.data = pool->acquire(6);
+        pooled = frame.getData().data();
+        const std::vector<uint8_t> values{1, 2, 3, 4, 5, 6};
+        frame.setData(values);
+        REQUIRE(frame.getData().data() == pooled);
+    }
+    REQUIRE(pool->acquire(6)->data() == pooled);
+}
+
+#ifdef DEPTHAI_HAVE_OPENCV_SUPPORT
+TEST_CASE("MemoryPool - setCvFrame converts into the pooled block", "[MemoryPool]") {
+    constexpr int width = 4, height = 2;
+    cv::Mat bgr(height, width, CV_8UC3, cv::Scalar(10, 20, 30));
+    auto pool = MemoryPool::create(1);
+    for(const auto type : {ImgFrame::Type::BGR888i, ImgFrame::Type::RGB888i, ImgFrame::Type::BGR888p, ImgFrame::Type::RGB888p, ImgFrame::Type::YUV420p}) {
+        ImgFrame frame;
+        frame.data = pool->acquire(width * height * 3);
+        const uint8_t* pooled = frame.getData().data();
+        frame.setCvFrame(bgr, type);
+        REQUIRE(frame.getData().data() == pooled);
+        const auto data = frame.getData();
+        const size_t planeSize = width * height;
+        if(type == ImgFrame::Type::BGR888i) {
+            REQUIRE(data.size() == planeSize * 3);
+            REQUIRE((data[0] == 10 && data[1] == 20 && data[2] == 30));
+        } else if(type == ImgFrame::Type::RGB888i) {
+            REQUIRE((data[0] == 30 && data[1] == 20 && data[2] == 10));
+        } else if(type == ImgFrame::Type::BGR888p) {
+            REQUIRE((data[0] == 10 && data[planeSize] == 20 && data[2 * planeSize] == 30));
+        } else if(type == ImgFrame::Type::RGB888p) {
+            REQUIRE((data[0] == 30 && data[planeSize] == 20 && data[2 * planeSize] == 10));
+        } else {
+            REQUIRE(data.size() == planeSize * 3 / 2);
+        }
+    }
+    REQUIRE(pool->getStats().overflows == 0);
+}
+#endif
+
+TEST_CASE("ImageManipMemory - Grows back after shrinking", "[MemoryPool]") {
+    impl::_ImageManipMemory mem(100);
+    const auto* base = mem.data();
+    mem.setSize(10);
+    REQUIRE(mem.size() == 10);
+    mem.setSize(100);
+    REQUIRE(mem.size() == 100);
+    REQUIRE(mem.data() == base);
+    mem.setSize(200);
+    REQUIRE(mem.size() == 200);
+}
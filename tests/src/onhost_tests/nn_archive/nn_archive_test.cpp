@@ -5,6 +5,8 @@
 #include <memory>
 #include <string>
 
+#include "../../../src/utility/Platform.hpp"
+
 namespace {
 class TestHelper {
    public:
@@ -102,3 +104,40 @@ TEST_CASE("NNArchive loads other formats properly") {
     REQUIRE_THROWS(nnArchive.getInputHeight(1));
     REQUIRE(nnArchive.getSupportedPlatforms().empty());
 }
+
+TEST_CASE("NNArchive reuses the unpacked archive") {
+    auto helper = std::make_unique<TestHelper>();
+    const auto options = dai::NNArchiveOptions().extractFolder(helper->extractFolder);
+
+    dai::NNArchive first(ONNX_ARCHIVE_PATH, options);
+    const std::filesystem::path modelPath = first.getModelPath().value();
+    const auto writeTime = std::filesystem::last_write_time(modelPath);
+
+    // Not unpacked again
+    dai::NNArchive second(ONNX_ARCHIVE_PATH, options);
+    REQUIRE(second.getModelPath().value() == modelPath);
+    REQUIRE(std::filesystem::last_write_time(modelPath) == writeTime);
+
+    // Other archives are unpacked to their own folder
+    dai::NNArchive other(SUPERBLOB_ARCHIVE_PATH, options);
+    const auto folder = [&](const std::filesystem::path& path) { return *std::filesystem::relative(path, helper->extractFolder).begin(); };
+    REQUIRE(folder(other.getModelPath().value()) != folder(modelPath));
+    REQUIRE(other.getSuperBlob().has_value());
+}
+
+TEST_CASE("NNArchive with default options reuses the unpacked archive") {
+    // The default folder is the same for every load and process of the user
+    const auto extractFolder = dai::NNArchiveOptions().extractFolder();
+    REQUIRE(dai::NNArchiveOptions().extractFolder() == extractFolder);
+    REQUIRE(extractFolder.parent_path() == dai::platform::getCachePath());
+
+    dai::NNArchive first(ONNX_ARCHIVE_PATH);
+    const std::filesystem::path modelPath = first.getModelPath().value();
+    REQUIRE(std::filesystem::relative(modelPath, extractFolder).begin()->string() != "..");
+    const auto writeTime = std::filesystem::last_write_time(modelPath);
+
+    // Not unpacked again
+    dai::NNArchive second(ONNX_ARCHIVE_PATH);
+    REQUIRE(second.getModelPath().value() == modelPath);
+    REQUIRE(std::filesystem::last_write_time(modelPath) == writeTime);
+}
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../../src/utility/ObjectTrackerImpl.hpp"
+#include "depthai/utility/MultiStreamTracker.hpp"
+
+using namespace dai;
+
+namespace {
+
+struct MovingObject {
+    float x, y, w, h, vx, vy;
+    uint32_t label;
+};
+
+std::vector<MovingObject> makeObjects(int count, uint32_t numClasses, std::mt19937& gen) {
+    std::uniform_real_distribution<float> pos(0.05f, 0.85f), size(0.02f, 0.06f), speed(-0.004f, 0.004f);
+    std::vector<MovingObject> objects;
+    for(int i = 0; i < count; i++) {
+        objects.push_back({pos(gen), pos(gen), size(gen), size(gen), speed(gen), speed(gen), static_cast<uint32_t>(i % numClasses)});
+    }
+    return objects;
+}
+
+std::vector<ImgDetection> step(std::vector<MovingObject>& objects, float missRate, std::mt19937& gen) {
+    std::uniform_real_distribution<float> uniform(0.f, 1.f), confidence(0.5f, 1.f);
+    std::vector<ImgDetection> detections;
+    for(auto& o : objects) {
+        o.x += o.vx;
+        o.y += o.vy;
+        if(uniform(gen) < missRate) continue;
+        ImgDetection det;
+        det.label = o.label;
+        det.confidence = confidence(gen);
+        det.xmin = o.x;
+        det.ymin = o.y;
+        det.xmax = o.x + o.w;
+        det.ymax = o.y + o.h;
+        detections.push_back(det);
+    }
+    std::shuffle(detections.begin(), detections.end(), gen);
+    return detections;
+}
+
+ObjectTrackerProperties makeProperties(int32_t maxObjects, bool perClass) {
+    ObjectTrackerProperties properties;
+    properties.maxObjectsToTrack = maxObjects;
+    properties.trackingPerClass = perClass;
+    properties.trackletBirthThreshold = 3;
+    properties.trackletMaxLifespan = 30;
+    return properties;
+}
+
+}  // namespace
+
+TEST_CASE("OCSTracker keeps ids of steadily moving objects", "[ObjectTracker]") {
+    for(bool perClass : {false, true}) {
+        std::mt19937 gen(5);
+        auto objects = makeObjects(40, 3, gen);
+        impl::OCSTracker tracker(makeProperties(100, perClass));
+        ImgFrame frame;
+
+        auto detections = step(objects, 0.f, gen);
+        tracker.init(frame, detections, std::vector<Point3f>(detections.size()));
+        auto first = tracker.getTracklets();
+        REQUIRE(first.size() == objects.size());
+
+        for(int i = 0; i < 50; i++) {
+            // Occasional misses once the tracklets are confirmed exercise the lost / re-found path of the Kalman filter
+            detections = step(objects, i < 5 ? 0.f : 0.1f, gen);
+            tracker.update(frame, detections, std::vector<Point3f>(detections.size()));
+        }
+        detections = step(objects, 0.f, gen);
+        tracker.update(frame, detections, std::vector<Point3f>(detections.size()));
+
+        auto tracklets = tracker.getTracklets();
+        REQUIRE(tracklets.size() == objects.size());
+        std::vector<int32_t> firstIds, ids;
+        for(const auto& t : first) firstIds.push_back(t.id);
+        for(const auto& t : tracklets) {
+            CHECK(t.status == Tracklet::TrackingStatus::TRACKED);
+            if(perClass) CHECK(t.label == static_cast<int32_t>(t.srcImgDetection.label));
+            ids.push_back(t.id);
+        }
+        std::sort(firstIds.begin(), firstIds.end());
+        std::sort(ids.begin(), ids.end());
+        REQUIRE(ids == firstIds);
+    }
+}
+
+TEST_CASE("OCSTracker loses and removes unobserved objects", "[ObjectTracker]") {
+    std::mt19937 gen(9);
+    auto objects = makeObjects(10, 1, gen);
+    impl::OCSTracker tracker(makeProperties(100, false));
+    ImgFrame frame;
+
+    auto detections = step(objects, 0.f, gen);
+    tracker.init(frame, detections, std::vector<Point3f>(detections.size()));
+    for(int i = 0; i < 10; i++) {
+        detections = step(objects, 0.f, gen);
+        tracker.update(frame, detections, std::vector<Point3f>(detections.size()));
+    }
+    for(const auto& t : tracker.getTracklets()) REQUIRE(t.status == Tracklet::TrackingStatus::TRACKED);
+
+    tracker.update(frame, {}, {});
+    for(const auto& t : tracker.getTracklets()) REQUIRE(t.status == Tracklet::TrackingStatus::LOST);
+
+    // Removed once trackletMaxLifespan frames passed without a match, then dropped on the next update
+    for(int i = 0; i < 40; i++) tracker.update(frame, {}, {});
+    REQUIRE(tracker.getTracklets().empty());
+}
+
+TEST_CASE("MultiStreamTracker streams match independent trackers", "[ObjectTracker]") {
+    const size_t numStreams = 6;
+    const int frames = 40;
+    const auto properties = makeProperties(100, true);
+
+    // Different scenes per stream, some frames without detections and one stream that starts late
+    std::vector<std::vector<std::vector<ImgDetection>>> sequences(numStreams);
+    for(size_t s = 0; s < numStreams; s++) {
+        std::mt19937 gen(100 + s);
+        auto objects = makeObjects(10 + 5 * s, 2, gen);
+        for(int i = 0; i < frames; i++) {
+            auto detections = step(objects, i < 5 ? 0.f : 0.1f, gen);
+            if(s == 1 && i < 10) detections.clear();
+            sequences[s].push_back(detections);
+        }
+    }
+
+    ImgFrame frame;
+    MultiStreamTracker engine(properties, numStreams);
+    std::vector<std::unique_ptr<impl::OCSTracker>> reference;
+    for(size_t s = 0; s < numStreams; s++) reference.push_back(std::make_unique<impl::OCSTracker>(properties));
+
+    ObjectTrackerConfig config;
+    for(int i = 0; i < frames; i++) {
+        std::vector<MultiStreamTracker::StreamInput> inputs(numStreams);
+        for(size_t s = 0; s < numStreams; s++) {
+            auto& input = inputs[s];
+            auto& tracker = *reference[s];
+            input.frame = &frame;
+            // Every 7th frame stream 2 only predicts
+            const bool trackOnly = s == 2 && i % 7 == 6;
+            if(!trackOnly) input.detections = &sequences[s][i];
+            // Removing a tracklet on stream 3 must not touch the others
+            if(s == 3 && i == 20) {
+                config.trackletIdsToRemove = {tracker.getTracklets().front().id};
+                input.config = &config;
+                tracker.configure(config);
+            }
+            if(trackOnly) {
+                tracker.track(frame);
+            } else if(!tracker.isInitialized()) {
+                if(!sequences[s][i].empty()) tracker.init(frame, sequences[s][i], {});
+            } else {
+                tracker.update(frame, sequences[s][i], {});
+            }
+        }
+        engine.process(inputs);
+
+        for(size_t s = 0; s < numStreams; s++) {
+            auto expected = reference[s]->isInitialized() ? reference[s]->getTracklets() : std::vector<Tracklet>();
+            auto tracklets = engine.getTracklets(s);
+            REQUIRE(tracklets.size() == expected.size());
+            for(size_t t = 0; t < tracklets.size(); t++) {
+                REQUIRE(tracklets[t].id == expected[t].id);
+                REQUIRE(tracklets[t].status == expected[t].status);
+                REQUIRE(tracklets[t].roi.x == expected[t].roi.x);
+                REQUIRE(tracklets[t].roi.y == expected[t].roi.y);
+            }
+        }
+    }
+}
+
+TEST_CASE("MultiStreamTracker skips streams without a frame", "[ObjectTracker]") {
+    MultiStreamTracker engine(makeProperties(100, false), 2);
+    REQUIRE(engine.getNumStreams() == 2);
+    REQUIRE_THROWS(engine.process({}));
+
+    std::mt19937 gen(7);
+    auto objects = makeObjects(5, 1, gen);
+    ImgFrame frame;
+    for(int i = 0; i < 5; i++) {
+        const auto detections = step(objects, 0.f, gen);
+        std::vector<MultiStreamTracker::StreamInput> inputs(2);
+        inputs[0] = {&frame, &detections, nullptr, nullptr};
+        inputs[1] = {nullptr, &detections, nullptr, nullptr};
+        engine.process(inputs);
+    }
+    REQUIRE(!engine.getTracklets(0).empty());
+    REQUIRE(engine.getTracklets(1).empty());
+    REQUIRE_THROWS(engine.getTracklets(2));
+}
@@ -1,8 +1,10 @@
 #include <catch2/catch_all.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
 #include <depthai/pipeline/datatype/NNData.hpp>
 
 #include "depthai/common/TensorInfo.hpp"
+#include "xtensor/generators/xbuilder.hpp"
 #include "xtensor/misc/xmanipulation.hpp"
 
 TEST_CASE("a") {
@@ -129,4 +131,51 @@ TEST_CASE("addTensor overloads") {
 
     std::vector<std::string> thr = {"abc", "asdf", "jkl;"};
     REQUIRE_THROWS(nndata.addTensor("STR", thr));
-}
\ No newline at end of file
+}
+TEST_CASE("NNData fp16 and quantized tensor conversions") {
+    dai::NNData nndata;
+    // Odd sizes also exercise the tails of the vectorized conversions
+    xt::xarray<float> values = xt::arange<float>(-50.0f, 53.0f) * 0.25f;
+    xt::xarray<int> bytes = xt::arange<int>(0, 103) * 2;
+    xt::xarray<int> signedBytes = xt::arange<int>(-51, 52);
+
+    nndata.addTensor<float>("fp16", values, dai::TensorInfo::DataType::FP16);
+    nndata.addTensor<int>("u8", bytes, dai::TensorInfo::DataType::U8F);
+    nndata.addTensor<int>("i8", signedBytes, dai::TensorInfo::DataType::I8);
+    for(auto& tensor : nndata.tensors) {
+        if(tensor.name == "fp16") continue;
+        tensor.quantization = true;
+        tensor.qpScale = 0.5f;
+        tensor.qpZp = 3.0f;
+    }
+
+    // Values are exactly representable in fp16
+    REQUIRE(nndata.getTensor<float>("fp16") == values);
+    REQUIRE(nndata.getTensor<double>("fp16") == xt::cast<double>(values));
+
+    const xt::xarray<float> u8 = nndata.getTensor<float>("u8", true);
+    const xt::xarray<float> i8 = nndata.getTensor<float>("i8", true);
+    for(size_t i = 0; i < bytes.size(); i++) {
+        REQUIRE(u8(i) == (static_cast<float>(bytes(i)) - 3.0f) * 0.5f);
+        REQUIRE(i8(i) == (static_cast<float>(signedBytes(i)) - 3.0f) * 0.5f);
+    }
+    REQUIRE(nndata.getTensor<double>("u8", true) == xt::cast<double>(u8));
+    REQUIRE(nndata.getTensor<int>("i8") == signedBytes);
+}
+
+TEST_CASE("NNData tensor views") {
+    dai::NNData nndata;
+    xt::xarray<float> values = {{1.5f, 2.0f}, {-3.0f, 4.25f}};
+    nndata.addTensor<float>("fp32", values, dai::TensorInfo::DataType::FP32);
+    nndata.addTensor<float>("fp16", values, dai::TensorInfo::DataType::FP16);
+
+    const auto view = nndata.getTensorView<float>("fp32");
+    REQUIRE(view.size() == 4);
+    REQUIRE(std::equal(view.begin(), view.end(), values.begin()));
+    REQUIRE(nndata.getTensorView<uint16_t>("fp16").size() == 4);
+
+    // Views never convert
+    REQUIRE_THROWS(nndata.getTensorView<float>("fp16"));
+    REQUIRE_THROWS(nndata.getTensorView<double>("fp32"));
+    REQUIRE_THROWS(nndata.getTensorView<float>("missing"));
+}
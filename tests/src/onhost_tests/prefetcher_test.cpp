@@ -0,0 +1,43 @@
+#include <catch2/catch_test_macros.hpp>
+#include <optional>
+#include <stdexcept>
+
+#include "../../src/utility/Prefetcher.hpp"
+
+using dai::utility::Prefetcher;
+
+TEST_CASE("Prefetcher reads ahead and repositions", "[Prefetcher]") {
+    for(size_t capacity : {0, 1, 4}) {
+        int position = 0;
+        Prefetcher<int> prefetcher(capacity, [&position]() -> std::optional<int> {
+            if(position >= 10) return std::nullopt;
+            return position++;
+        });
+        for(int i = 0; i < 5; i++) REQUIRE(prefetcher.next() == i);
+
+        // Items read ahead before the seek are dropped
+        prefetcher.reposition([&position]() { position = 8; });
+        REQUIRE(prefetcher.next() == 8);
+        REQUIRE(prefetcher.next() == 9);
+        REQUIRE_FALSE(prefetcher.next().has_value());
+        REQUIRE_FALSE(prefetcher.next().has_value());
+
+        // Restart after the end
+        prefetcher.reposition([&position]() { position = 0; });
+        REQUIRE(prefetcher.next() == 0);
+    }
+}
+
+TEST_CASE("Prefetcher rethrows errors", "[Prefetcher]") {
+    for(size_t capacity : {0, 3}) {
+        int calls = 0;
+        Prefetcher<int> prefetcher(capacity, [&calls]() -> std::optional<int> {
+            if(calls == 2) throw std::runtime_error("decode failed");
+            return calls++;
+        });
+        REQUIRE(prefetcher.next() == 0);
+        REQUIRE(prefetcher.next() == 1);
+        REQUIRE_THROWS_AS(prefetcher.next(), std::runtime_error);
+        REQUIRE_THROWS_AS(prefetcher.reposition([]() { throw std::runtime_error("seek failed"); }), std::runtime_error);
+    }
+}
@@ -0,0 +1,104 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+
+namespace {
+
+std::vector<std::uint8_t> makeData(std::size_t size) {
+    std::vector<std::uint8_t> data(size);
+    std::iota(data.begin(), data.end(), std::uint8_t(0));
+    return data;
+}
+
+std::shared_ptr<dai::ImgFrame> makeImgFrame(unsigned width, unsigned height) {
+    auto frame = std::make_shared<dai::ImgFrame>();
+    frame->setWidth(width);
+    frame->setHeight(height);
+    frame->setType(dai::ImgFrame::Type::NV12);
+    frame->setSequenceNum(7);
+    frame->setData(makeData(width * height * 3 / 2));
+    return frame;
+}
+
+std::shared_ptr<dai::EncodedFrame> makeEncodedFrame(std::size_t size) {
+    auto frame = std::make_shared<dai::EncodedFrame>();
+    frame->setWidth(3840);
+    frame->setHeight(2160);
+    frame->setProfile(dai::EncodedFrame::Profile::AVC);
+    frame->setSequenceNum(7);
+    frame->setData(makeData(size));
+    return frame;
+}
+
+std::shared_ptr<dai::PointCloudData> makePointCloud(unsigned width, unsigned height) {
+    auto pcl = std::make_shared<dai::PointCloudData>();
+    pcl->setSize(width, height);
+    pcl->setSequenceNum(7);
+    pcl->setData(makeData(width * height * 3 * sizeof(float)));
+    return pcl;
+}
+
+std::vector<std::uint8_t> join(const dai::ProtoSerializable::SerializedProto& parts) {
+    std::vector<std::uint8_t> joined(parts.header);
+    joined.insert(joined.end(), parts.payload.begin(), parts.payload.end());
+    return joined;
+}
+
+std::vector<std::uint8_t> varint(std::uint64_t value) {
+    std::vector<std::uint8_t> bytes;
+    while(value >= 0x80) {
+        bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<std::uint8_t>(value));
+    return bytes;
+}
+
+// The header is the metadata, followed by the key and length of the payload field
+void checkParts(const dai::ProtoSerializable& msg, const dai::Buffer& buffer, int payloadFieldNumber) {
+    const auto parts = msg.serializeProtoParts();
+    const auto data = buffer.getData();
+    REQUIRE(parts.payload.data() == data.data());
+    REQUIRE(parts.payload.size() == data.size());
+    REQUIRE(parts.size() == parts.header.size() + data.size());
+
+    auto expectedHeader = msg.serializeProto(true);
+    const auto key = varint((static_cast<std::uint64_t>(payloadFieldNumber) << 3) | 2);
+    const auto length = varint(data.size());
+    expectedHeader.insert(expectedHeader.end(), key.begin(), key.end());
+    expectedHeader.insert(expectedHeader.end(), length.begin(), length.end());
+    REQUIRE(parts.header == expectedHeader);
+
+    REQUIRE(join(parts) == msg.serializeProto());
+}
+
+}  // namespace
+
+TEST_CASE("serializeProtoParts leaves the payload in place", "[ProtoSerialize]") {
+    auto imgFrame = makeImgFrame(64, 48);
+    checkParts(*imgFrame, *imgFrame, 11);
+
+    auto encodedFrame = makeEncodedFrame(1000);
+    checkParts(*encodedFrame, *encodedFrame, 16);
+
+    auto pcl = makePointCloud(32, 16);
+    checkParts(*pcl, *pcl, 15);
+}
+
+TEST_CASE("serializeProtoParts without payload", "[ProtoSerialize]") {
+    auto frame = std::make_shared<dai::ImgFrame>();
+    const auto parts = frame->serializeProtoParts();
+    REQUIRE(parts.payload.empty());
+    REQUIRE(parts.header == frame->serializeProto(true));
+
+    // Planar point clouds are interleaved while serializing, the payload is part of the header
+    auto pcl = makePointCloud(32, 16);
+    pcl->setPlanar(true);
+    const auto planarParts = pcl->serializeProtoParts();
+    REQUIRE(planarParts.payload.empty());
+    REQUIRE(planarParts.header == pcl->serializeProto());
+}
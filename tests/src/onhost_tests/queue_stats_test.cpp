@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+
+using namespace dai;
+
+namespace {
+
+class Passthrough : public NodeCRTP<node::ThreadedHostNode, Passthrough> {
+   public:
+    constexpr static const char* NAME = "Passthrough";
+
+    Input input{*this, {"in", DEFAULT_GROUP, DEFAULT_BLOCKING, DEFAULT_QUEUE_SIZE, {{{DatatypeEnum::Buffer, true}}}, DEFAULT_WAIT_FOR_MESSAGE}};
+    Output out{*this, {"out", DEFAULT_GROUP, {{{DatatypeEnum::Buffer, true}}}}};
+
+    void run() override {
+        while(isRunning()) {
+            auto msg = input.get<Buffer>();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            out.send(msg);
+        }
+    }
+};
+
+const QueueStats* findStats(const std::vector<QueueStats>& stats, const std::string& name) {
+    auto it = std::find_if(stats.begin(), stats.end(), [&name](const QueueStats& s) { return s.name == name; });
+    return it == stats.end() ? nullptr : &*it;
+}
+
+}  // namespace
+
+TEST_CASE("MessageQueue instrumentation is off by default", "[MessageQueue]") {
+    MessageQueue queue(4);
+    queue.send(std::make_shared<ADatatype>());
+    queue.get();
+    REQUIRE_FALSE(queue.getInstrumentation());
+    REQUIRE(queue.getStats().enqueued == 0);
+    REQUIRE(queue.getTraceEvents().empty());
+}
+
+TEST_CASE("MessageQueue instrumentation counts sends, drops and latency", "[MessageQueue]") {
+    for(auto type : {MessageQueue::QueueType::LOCKING, MessageQueue::QueueType::LOCK_FREE}) {
+        MessageQueue queue("stats", 2, false);
+        queue.setQueueType(type);
+        queue.setInstrumentation(true);
+        int callbacks = 0;
+        queue.addCallback([&callbacks]() { callbacks++; });
+
+        std::vector<std::shared_ptr<ADatatype>> msgs;
+        for(int i = 0; i < 5; i++) {
+            msgs.push_back(std::make_shared<ADatatype>());
+            queue.send(msgs.back());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        // Non-blocking queue of 2 keeps the newest messages
+        REQUIRE(queue.get() == msgs[3]);
+        REQUIRE(queue.tryGetAll().size() == 1);
+
+        const auto stats = queue.getStats();
+        REQUIRE(stats.name == "stats");
+        REQUIRE(stats.enqueued == 5);
+        REQUIRE(stats.dequeued == 2);
+        REQUIRE(stats.dropped == 3);
+        REQUIRE(stats.failed == 0);
+        REQUIRE(stats.callbackCalls == 5);
+        REQUIRE(callbacks == 5);
+        REQUIRE(stats.depthHistogram[1] == 1);
+        REQUIRE(stats.depthHistogram[2] == 4);
+        REQUIRE(stats.maxLatency >= std::chrono::milliseconds(2));
+        REQUIRE(stats.getAverageLatency() <= stats.maxLatency);
+
+        // Every message is either received or dropped
+        size_t sends = 0, received = 0, dropped = 0;
+        for(const auto& event : queue.getTraceEvents()) {
+            if(event.event == TraceEvent::SEND && event.status == TraceEvent::Status::END) sends++;
+            if(event.event == TraceEvent::RECEIVE) received++;
+            if(event.event == TraceEvent::DROP) dropped++;
+        }
+        REQUIRE(sends == 5);
+        REQUIRE(received == 2);
+        REQUIRE(dropped == 3);
+    }
+}
+
+TEST_CASE("MessageQueue instrumentation measures blocked producers", "[MessageQueue]") {
+    MessageQueue queue(1, true);
+    queue.setInstrumentation(true);
+    queue.send(std::make_shared<ADatatype>());
+    REQUIRE_FALSE(queue.send(std::make_shared<ADatatype>(), std::chrono::milliseconds(20)));
+    std::thread consumer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.get();
+    });
+    queue.send(std::make_shared<ADatatype>());
+    consumer.join();
+
+    const auto stats = queue.getStats();
+    REQUIRE(stats.enqueued == 2);
+    REQUIRE(stats.failed == 1);
+    REQUIRE(stats.maxBlockedTime >= std::chrono::milliseconds(15));
+    REQUIRE(stats.blockedTime >= std::chrono::milliseconds(30));
+}
+
+TEST_CASE("Pipeline queue stats and trace export", "[MessageQueue]") {
+    Pipeline p(false);
+    auto node = p.create<Passthrough>();
+    auto in = node->input.createInputQueue();
+    auto out = node->out.createOutputQueue(32);
+    p.enableQueueStats();
+    p.start();
+    REQUIRE_THROWS(p.enableQueueStats(false));
+
+    const int numMessages = 20;
+    for(int i = 0; i < numMessages; i++) in->send(std::make_shared<Buffer>());
+    for(int i = 0; i < numMessages; i++) REQUIRE(out->get<Buffer>() != nullptr);
+
+    const auto stats = p.getQueueStats();
+    const auto prefix = std::string("Passthrough(") + std::to_string(node->id) + ")";
+    const auto* input = findStats(stats, prefix + ".in");
+    const auto* output = findStats(stats, prefix + ".out.queue");
+    REQUIRE(input != nullptr);
+    REQUIRE(output != nullptr);
+    REQUIRE(input->enqueued == numMessages);
+    REQUIRE(input->dequeued == numMessages);
+    REQUIRE(output->enqueued == numMessages);
+    REQUIRE(output->dequeued == numMessages);
+    REQUIRE(input->maxLatency > std::chrono::nanoseconds(0));
+
+    const auto trace = p.getQueueTrace();
+    REQUIRE(trace["traceEvents"].is_array());
+    size_t tracks = 0, begins = 0, ends = 0;
+    for(const auto& event : trace["traceEvents"]) {
+        if(event["ph"] == "M") tracks++;
+        if(event["ph"] == "b") begins++;
+        if(event["ph"] == "e") ends++;
+    }
+    REQUIRE(tracks == stats.size());
+    REQUIRE(begins == ends);
+    REQUIRE(begins >= 2 * numMessages);
+    p.stop();
+
+    // Statistics of the last run stay readable until the instrumentation is disabled for the next run
+    REQUIRE(p.getQueueStats().size() == stats.size());
+    p.enableQueueStats(false);
+    REQUIRE(p.getQueueStats().empty());
+    REQUIRE_FALSE(node->input.getInstrumentation());
+}
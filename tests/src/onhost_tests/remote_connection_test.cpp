@@ -1,10 +1,13 @@
 #include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
 
 #include "depthai/pipeline/MessageQueue.hpp"
 #include "depthai/remote_connection/RemoteConnection.hpp"
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch_all.hpp>
 
+#include "../../src/remote_connection/PreviewTransform.hpp"
 #include "depthai/depthai.hpp"
 
 TEST_CASE("Basic remote connection test") {
@@ -22,3 +25,71 @@ TEST_CASE("Basic remote connection test with topic removal") {
         REQUIRE_THROWS_AS(inputQueue->send(imgFrame), dai::MessageQueue::QueueException);
     }
 }
+
+TEST_CASE("Remote connection drains topics without clients") {
+    dai::RemoteConnection remoteConnection;
+    // A blocking queue of one would stall the sender if the messages weren't taken out right away
+    auto inputQueue = remoteConnection.addTopic("input", "group", 1, true);
+    remoteConnection.setTopicMaxRate("input", 5.0f);
+    constexpr int numMessages = 100;
+    for(int i = 0; i < numMessages; i++) {
+        REQUIRE(inputQueue->send(std::make_shared<dai::ImgFrame>(), std::chrono::seconds(1)));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    auto stats = remoteConnection.getTopicStats("input");
+    while(stats.receivedMessages < numMessages && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        stats = remoteConnection.getTopicStats("input");
+    }
+    REQUIRE(stats.receivedMessages == numMessages);
+    // Nobody is subscribed, so nothing gets serialized
+    REQUIRE(stats.publishedMessages == 0);
+    REQUIRE(stats.publishedBytes == 0);
+
+    REQUIRE_THROWS(remoteConnection.setTopicMaxRate("input", -1.0f));
+    REQUIRE_THROWS(remoteConnection.getTopicStats("missing"));
+}
+
+#ifdef DEPTHAI_HAVE_OPENCV_SUPPORT
+TEST_CASE("Remote connection preview downscales and encodes frames") {
+    auto frame = std::make_shared<dai::ImgFrame>();
+    frame->setType(dai::ImgFrame::Type::BGR888i);
+    frame->setSize(1920, 1080);
+    frame->setStride(1920 * 3);
+    frame->setData(std::vector<uint8_t>(1920 * 1080 * 3, 128));
+    frame->setSequenceNum(42);
+
+    dai::RemoteConnection::PreviewConfig config;
+    config.maxWidth = 640;
+    config.maxHeight = 640;
+    dai::PreviewTransform downscale(config);
+    auto preview = std::dynamic_pointer_cast<dai::ImgFrame>(downscale.apply(frame));
+    REQUIRE(preview != nullptr);
+    REQUIRE(preview->getWidth() == 640);
+    REQUIRE(preview->getHeight() == 360);
+    REQUIRE(preview->getSequenceNum() == 42);
+
+    // Small frames are left as they are
+    config.maxWidth = 4000;
+    config.maxHeight = 4000;
+    dai::PreviewTransform passthrough(config);
+    REQUIRE(passthrough.apply(frame) == frame);
+
+    config.maxWidth = 640;
+    config.maxHeight = 0;
+    config.encodeJpeg = true;
+    dai::PreviewTransform jpeg(config);
+    auto encoded = std::dynamic_pointer_cast<dai::EncodedFrame>(jpeg.apply(frame));
+    REQUIRE(encoded != nullptr);
+    REQUIRE(encoded->getProfile() == dai::EncodedFrame::Profile::JPEG);
+    REQUIRE(encoded->getWidth() == 640);
+    REQUIRE(encoded->getHeight() == 360);
+    REQUIRE(encoded->getData().size() > 0);
+    REQUIRE(encoded->getData().size() < 640 * 360 * 3);
+
+    REQUIRE_FALSE(dai::PreviewTransform::isSupported(dai::ImgFrame::Type::RAW16));
+    config.jpegQuality = 0;
+    REQUIRE_THROWS(dai::PreviewTransform(config));
+}
+#endif
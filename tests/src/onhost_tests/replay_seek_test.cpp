@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "../../src/utility/Platform.hpp"
+#include "../../src/utility/RecordReplayImpl.hpp"
+#include "depthai/schemas/ImgFrame.pb.h"
+
+using Clock = std::chrono::system_clock;
+
+namespace {
+
+constexpr int NUM_MSGS = 50;
+// Sequence numbers don't have to be contiguous, only growing
+constexpr std::int64_t SEQUENCE_STEP = 3;
+
+std::int64_t parseSequenceNum(const mcap::Message& message) {
+    dai::proto::img_frame::ImgFrame proto;
+    REQUIRE(proto.ParseFromArray(reinterpret_cast<const char*>(message.data), static_cast<int>(message.dataSize)));
+    return proto.sequencenum();
+}
+
+// Index of the next message in the player, std::nullopt at the end
+std::optional<int> nextIndex(dai::utility::BytePlayer& player) {
+    auto msg = player.next<dai::proto::img_frame::ImgFrame>();
+    if(!msg.has_value()) return std::nullopt;
+    REQUIRE(msg->sequencenum() % SEQUENCE_STEP == 0);
+    return static_cast<int>(msg->sequencenum() / SEQUENCE_STEP);
+}
+
+// Writes a few ImgFrame messages with ByteRecorder, keeping the bounds of each message's log time
+class TestRecording {
+   public:
+    TestRecording() {
+        testFolder = std::filesystem::path(dai::platform::getTempPath()).append("replay_seek_test");
+        std::filesystem::create_directories(testFolder);
+        file = std::filesystem::path(testFolder).append("frames.mcap");
+
+        dai::utility::ByteRecorder recorder;
+        recorder.init<dai::proto::img_frame::ImgFrame>(file.string(), dai::RecordConfig::CompressionLevel::FASTEST, "frames");
+        for(int i = 0; i < NUM_MSGS; i++) {
+            dai::proto::img_frame::ImgFrame proto;
+            proto.set_sequencenum(i * SEQUENCE_STEP);
+            std::vector<uint8_t> data(proto.ByteSizeLong());
+            proto.SerializeToArray(data.data(), static_cast<int>(data.size()));
+
+            before.push_back(Clock::now());
+            recorder.write(data);
+            after.push_back(Clock::now());
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        recorder.close();
+    }
+
+    ~TestRecording() {
+        std::error_code ec;
+        std::filesystem::remove_all(testFolder, ec);
+    }
+
+    std::filesystem::path testFolder;
+    std::filesystem::path file;
+    std::vector<Clock::time_point> before;
+    std::vector<Clock::time_point> after;
+};
+
+}  // namespace
+
+TEST_CASE("BytePlayer seeks by time", "[Replay]") {
+    TestRecording recording;
+    dai::utility::BytePlayer player;
+    player.init(recording.file.string());
+
+    // Seeking before the first message starts from the beginning
+    for(auto offset : {std::chrono::nanoseconds(0), std::chrono::nanoseconds(-1000000)}) {
+        player.seek(offset);
+        REQUIRE(player.position() == 0u);
+        REQUIRE(nextIndex(player) == 0);
+    }
+
+    for(int target : {1, 10, 25, NUM_MSGS - 1}) {
+        // Only the bounds of the log times are known, check the found message against them
+        const auto offset = recording.after[target] - recording.before[0];
+        player.seek(offset);
+        const auto position = player.position();
+        REQUIRE(position.has_value());
+        const auto found = nextIndex(player);
+        REQUIRE(found.has_value());
+        REQUIRE(static_cast<std::uint32_t>(found.value()) == position.value());
+        REQUIRE(recording.after[found.value()] - recording.before[0] >= offset);
+        if(found.value() > 0) REQUIRE(recording.before[found.value() - 1] - recording.after[0] < offset);
+
+        // Reading continues from the found message
+        if(found.value() + 1 < NUM_MSGS) REQUIRE(nextIndex(player) == found.value() + 1);
+    }
+
+    // Past the last message there is nothing to read
+    player.seek(recording.after.back() - recording.before.front() + std::chrono::seconds(1));
+    REQUIRE_FALSE(player.position().has_value());
+    REQUIRE_FALSE(nextIndex(player).has_value());
+}
+
+TEST_CASE("BytePlayer seeks by sequence number", "[Replay]") {
+    TestRecording recording;
+    dai::utility::BytePlayer player;
+    player.init(recording.file.string());
+
+    const std::int64_t last = (NUM_MSGS - 1) * SEQUENCE_STEP;
+    for(std::int64_t sequenceNum : {std::int64_t(30), std::int64_t(0), std::int64_t(-5), std::int64_t(1), std::int64_t(31), last - 1, last, std::int64_t(7)}) {
+        // First message with a sequence number at or after the requested one
+        const int expected = sequenceNum <= 0 ? 0 : static_cast<int>((sequenceNum + SEQUENCE_STEP - 1) / SEQUENCE_STEP);
+        player.seekToSequenceNum(sequenceNum, parseSequenceNum);
+        REQUIRE(player.position() == static_cast<std::uint32_t>(expected));
+        REQUIRE(nextIndex(player) == expected);
+        if(expected + 1 < NUM_MSGS) REQUIRE(nextIndex(player) == expected + 1);
+    }
+
+    player.seekToSequenceNum(last + 1, parseSequenceNum);
+    REQUIRE_FALSE(player.position().has_value());
+    REQUIRE_FALSE(nextIndex(player).has_value());
+}
+
+TEST_CASE("BytePlayer restarts from the beginning after a seek", "[Replay]") {
+    TestRecording recording;
+    dai::utility::BytePlayer player;
+    player.init(recording.file.string());
+
+    player.seek(recording.after[25] - recording.before[0]);
+    REQUIRE(nextIndex(player) > 0);
+    player.restart();
+    REQUIRE(player.position() == 0u);
+    REQUIRE(nextIndex(player) == 0);
+
+    player.seekToSequenceNum(30, parseSequenceNum);
+    REQUIRE(nextIndex(player) == 10);
+    player.restart();
+    REQUIRE(nextIndex(player) == 0);
+
+    // Looping reads every message again
+    int count = 0;
+    while(nextIndex(player).has_value()) count++;
+    REQUIRE(count == NUM_MSGS - 1);
+}
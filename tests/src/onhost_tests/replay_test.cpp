@@ -112,3 +112,36 @@ TEST_CASE("ReplayVideo no metadata") {
         p.stop();
     }
 }
+
+TEST_CASE("ReplayVideo seek to sequence number") {
+    TestHelper helper;
+    const auto extracted = std::filesystem::path(helper.testFolder).append("extracted");
+    constexpr std::int64_t target = 20;
+
+    for(const bool withMetadata : {true, false}) {
+        dai::Pipeline p(false);
+
+        auto replayNode = p.create<dai::node::ReplayVideo>();
+        if(withMetadata) replayNode->setReplayMetadataFile(std::filesystem::path(extracted).append("CameraCAM_A.mcap"));
+        replayNode->setReplayVideoFile(std::filesystem::path(extracted).append("CameraCAM_A.mp4"));
+        replayNode->setOutFrameType(dai::ImgFrame::Type::NV12);
+        replayNode->setMaxSpeed(true);
+        replayNode->seekToSequenceNum(target);
+
+        auto q = replayNode->out.createOutputQueue();
+
+        p.start();
+        auto first = q->get<dai::ImgFrame>();
+        REQUIRE(first != nullptr);
+        if(withMetadata) {
+            REQUIRE(first->getSequenceNum() >= target);
+        } else {
+            // Without metadata the sequence numbers are the frame indices
+            REQUIRE(first->getSequenceNum() == target);
+            auto second = q->get<dai::ImgFrame>();
+            REQUIRE(second != nullptr);
+            REQUIRE(second->getSequenceNum() == target + 1);
+        }
+        p.stop();
+    }
+}
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+#include "depthai/pipeline/datatype/StreamMessageParser.hpp"
+#include "depthai/pipeline/node/host/RGBD.hpp"
+#include "depthai/xlink/XLinkStream.hpp"
+
+namespace {
+
+constexpr float fx = 451.3f, fy = 449.8f;
+
+struct Frames {
+    std::shared_ptr<dai::ImgFrame> color;
+    std::shared_ptr<dai::ImgFrame> depth;
+};
+
+Frames makeFrames(unsigned width, unsigned height, std::mt19937& gen) {
+    std::uniform_int_distribution<int> hole(0, 99), depthValue(200, 8000), colorValue(0, 255);
+    const std::array<std::array<float, 3>, 3> intrinsics = {{{fx, 0.f, width / 2.f - 0.5f}, {0.f, fy, height / 2.f + 0.25f}, {0.f, 0.f, 1.f}}};
+    const auto now = std::chrono::steady_clock::now();
+
+    // Depth with 20% invalid pixels
+    std::vector<uint8_t> depth(width * height * sizeof(uint16_t));
+    for(size_t i = 0; i < width * height; i++) {
+        const uint16_t d = hole(gen) < 20 ? 0 : static_cast<uint16_t>(depthValue(gen));
+        std::memcpy(depth.data() + i * sizeof(uint16_t), &d, sizeof(d));
+    }
+    std::vector<uint8_t> color(width * height * 3);
+    for(auto& c : color) c = static_cast<uint8_t>(colorValue(gen));
+
+    Frames frames;
+    frames.color = std::make_shared<dai::ImgFrame>();
+    frames.color->setData(std::move(color));
+    frames.color->setType(dai::ImgFrame::Type::RGB888i);
+    frames.color->setSize(width, height);
+    frames.color->setStride(width * 3);
+    frames.color->transformation = dai::ImgTransformation(width, height, intrinsics);
+    frames.color->setTimestamp(now);
+    frames.depth = std::make_shared<dai::ImgFrame>();
+    frames.depth->setData(std::move(depth));
+    frames.depth->setType(dai::ImgFrame::Type::RAW16);
+    frames.depth->setSize(width, height);
+    frames.depth->setStride(width * sizeof(uint16_t));
+    frames.depth->transformation = dai::ImgTransformation(width, height, intrinsics);
+    frames.depth->setTimestamp(now);
+    return frames;
+}
+
+// Straightforward scalar version of the point cloud, the node has to match it bit for bit
+std::vector<dai::Point3fRGBA> referencePoints(const Frames& frames, bool dropInvalid, std::array<float, 6>& bounds) {
+    const auto width = frames.color->getWidth();
+    const auto height = frames.color->getHeight();
+    const auto intrinsics = frames.color->transformation.getIntrinsicMatrix();
+    const float cx = intrinsics[0][2], cy = intrinsics[1][2];
+    const auto* color = frames.color->getData().data();
+    const auto* depth = frames.depth->getData().data();
+    bounds = {};
+    std::vector<dai::Point3fRGBA> points;
+    for(unsigned row = 0; row < height; row++) {
+        for(unsigned col = 0; col < width; col++) {
+            const size_t i = row * width + col;
+            uint16_t d;
+            std::memcpy(&d, depth + i * sizeof(uint16_t), sizeof(d));
+            const float z = static_cast<float>(d);
+            const float x = z * ((static_cast<float>(col) - cx) / fx);
+            const float y = z * ((static_cast<float>(row) - cy) / fy);
+            bounds = {std::min(bounds[0], x), std::min(bounds[1], y), std::min(bounds[2], z), std::max(bounds[3], x), std::max(bounds[4], y), std::max(bounds[5], z)};
+            if(dropInvalid && d == 0) continue;
+            points.emplace_back(x, y, z, color[i * 3], color[i * 3 + 1], color[i * 3 + 2]);
+        }
+    }
+    return points;
+}
+
+bool samePoints(const std::vector<dai::Point3fRGBA>& a, const std::vector<dai::Point3fRGBA>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(dai::Point3fRGBA)) == 0;
+}
+
+}  // namespace
+
+TEST_CASE("Host RGBD point cloud matches the scalar reference", "[RGBD]") {
+    std::mt19937 gen(3);
+    for(auto size : {std::make_pair(640u, 400u), std::make_pair(37u, 13u)}) {
+        for(bool multiThreaded : {false, true}) {
+            for(bool planar : {false, true}) {
+                for(bool dropInvalid : {false, true}) {
+                    dai::Pipeline p(false);
+                    auto rgbd = p.create<dai::node::RGBD>()->build();
+                    rgbd->sync->setRunOnHost(true);
+                    if(multiThreaded) rgbd->useCPUMT(3);
+                    rgbd->setPlanarOutput(planar);
+                    rgbd->setDropInvalidPoints(dropInvalid);
+                    rgbd->setNumFramesPool(2);
+                    auto inColor = rgbd->inColor.createInputQueue();
+                    auto inDepth = rgbd->inDepth.createInputQueue();
+                    auto out = rgbd->pcl.createOutputQueue();
+                    p.start();
+
+                    const auto [width, height] = size;
+                    // A few frames, so pooled buffers (shrunk for sparse clouds) get reused
+                    for(int i = 0; i < 3; i++) {
+                        auto frames = makeFrames(width, height, gen);
+                        inColor->send(frames.color);
+                        inDepth->send(frames.depth);
+                        auto pcl = out->get<dai::PointCloudData>();
+                        REQUIRE(pcl != nullptr);
+
+                        std::array<float, 6> bounds;
+                        const auto expected = referencePoints(frames, dropInvalid, bounds);
+                        REQUIRE(pcl->isColor());
+                        REQUIRE(pcl->isPlanar() == planar);
+                        REQUIRE(pcl->isSparse() == dropInvalid);
+                        REQUIRE(samePoints(pcl->getPointsRGB(), expected));
+                        REQUIRE(pcl->getPoints().size() == expected.size());
+                        REQUIRE(pcl->getMinX() == bounds[0]);
+                        REQUIRE(pcl->getMinY() == bounds[1]);
+                        REQUIRE(pcl->getMinZ() == bounds[2]);
+                        REQUIRE(pcl->getMaxX() == bounds[3]);
+                        REQUIRE(pcl->getMaxY() == bounds[4]);
+                        REQUIRE(pcl->getMaxZ() == bounds[5]);
+                    }
+                    p.stop();
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Planar PointCloudData is sent interleaved", "[RGBD]") {
+    const std::vector<dai::Point3fRGBA> points = {{1.f, 2.f, 3.f, 10, 20, 30}, {4.f, 5.f, 6.f, 40, 50, 60}, {7.f, 8.f, 9.f, 70, 80, 90, 128}};
+    std::vector<uint8_t> interleaved(points.size() * sizeof(dai::Point3fRGBA));
+    std::memcpy(interleaved.data(), points.data(), interleaved.size());
+
+    // x, y and z planes, followed by the colors
+    std::vector<uint8_t> planes(interleaved.size());
+    auto* coordinates = reinterpret_cast<float*>(planes.data());
+    for(size_t i = 0; i < points.size(); i++) {
+        coordinates[i] = points[i].x;
+        coordinates[points.size() + i] = points[i].y;
+        coordinates[2 * points.size() + i] = points[i].z;
+        std::memcpy(planes.data() + (3 * points.size() + i) * sizeof(float), &points[i].r, 4);
+    }
+    auto pcl = std::make_shared<dai::PointCloudData>();
+    pcl->setSize(3, 1);
+    pcl->setData(planes);
+    pcl->setColor(true);
+    pcl->setPlanar(true);
+
+    // As sent by XLinkOutHost, the message itself is left planar
+    const auto sent = pcl->getInterleaved();
+    REQUIRE(pcl->isPlanar());
+    REQUIRE_FALSE(sent->isPlanar());
+    REQUIRE(sent->getPointsRGB().size() == points.size());
+
+    auto packetData = interleaved;
+    const auto metadata = dai::StreamMessageParser::serializeMetadata(*sent);
+    auto sentData = sent->getData();
+    REQUIRE(std::vector<uint8_t>(sentData.begin(), sentData.end()) == interleaved);
+    packetData.insert(packetData.end(), metadata.begin(), metadata.end());
+    streamPacketDesc_t packet;
+    packet.data = packetData.data();
+    packet.length = static_cast<uint32_t>(packetData.size());
+    packet.fd = -1;
+
+    const auto received = std::dynamic_pointer_cast<dai::PointCloudData>(dai::StreamMessageParser::parseMessage(&packet));
+    REQUIRE(received != nullptr);
+    REQUIRE_FALSE(received->isPlanar());
+    REQUIRE(received->getWidth() == 3);
+    auto receivedData = received->getData();
+    REQUIRE(std::vector<uint8_t>(receivedData.begin(), receivedData.end()) == interleaved);
+}
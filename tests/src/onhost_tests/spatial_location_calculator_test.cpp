@@ -0,0 +1,175 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "depthai/depthai.hpp"
+
+using namespace dai;
+using Catch::Approx;
+
+namespace {
+
+constexpr unsigned width = 640;
+constexpr unsigned height = 400;
+
+std::vector<uint16_t> makeDepth(unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> depth(300, 5000);
+    std::uniform_int_distribution<int> hole(0, 99);
+    std::vector<uint16_t> values(width * height);
+    for(auto& value : values) value = hole(gen) < 10 ? 0 : static_cast<uint16_t>(depth(gen));
+    return values;
+}
+
+std::shared_ptr<ImgFrame> makeFrame(const std::vector<uint16_t>& depth) {
+    auto frame = std::make_shared<ImgFrame>();
+    std::vector<uint8_t> data(depth.size() * sizeof(uint16_t));
+    std::memcpy(data.data(), depth.data(), data.size());
+    frame->setData(std::move(data));
+    frame->setType(ImgFrame::Type::RAW16);
+    frame->setSize(width, height);
+    frame->setStride(width * sizeof(uint16_t));
+    return frame;
+}
+
+std::vector<SpatialLocationCalculatorConfigData> makeRois(size_t count, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<SpatialLocationCalculatorConfigData> rois(count);
+    for(size_t i = 0; i < count; i++) {
+        auto& roi = rois[i];
+        const float x = dist(gen) * 0.9f, y = dist(gen) * 0.9f;
+        roi.roi = Rect(x, y, 0.02f + dist(gen) * (0.98f - x), 0.02f + dist(gen) * (0.98f - y), true);
+        roi.calculationAlgorithm = static_cast<SpatialLocationCalculatorAlgorithm>(i % 5);
+        roi.depthThresholds.lowerThreshold = i % 3 == 0 ? 1000 : 100;
+        roi.depthThresholds.upperThreshold = 4500;
+        if(i % 4 == 0) roi.stepSize = 3;
+    }
+    return rois;
+}
+
+// Straightforward version of the host calculation, rescanning each ROI
+SpatialLocations reference(const std::vector<uint16_t>& depth, const SpatialLocationCalculatorConfigData& config) {
+    SpatialLocations location;
+    const bool valuesBased = config.calculationAlgorithm == SpatialLocationCalculatorAlgorithm::MODE
+                             || config.calculationAlgorithm == SpatialLocationCalculatorAlgorithm::MEDIAN;
+    const int step = config.stepSize > 0 ? config.stepSize : (valuesBased ? 2 : 1);
+    const auto rect = config.roi.denormalize(width, height);
+    const long x0 = std::clamp(std::lround(rect.x), 0L, static_cast<long>(width));
+    const long y0 = std::clamp(std::lround(rect.y), 0L, static_cast<long>(height));
+    const long x1 = std::max(x0, std::clamp(std::lround(rect.x + rect.width), 0L, static_cast<long>(width)));
+    const long y1 = std::max(y0, std::clamp(std::lround(rect.y + rect.height), 0L, static_cast<long>(height)));
+    std::vector<uint16_t> values;
+    uint64_t sum = 0;
+    for(long y = y0; y < y1; y++) {
+        if(y % step != 0) continue;
+        for(long x = x0; x < x1; x++) {
+            const uint16_t value = depth[y * width + x];
+            if(x % step != 0 || value <= config.depthThresholds.lowerThreshold || value >= config.depthThresholds.upperThreshold) continue;
+            values.push_back(value);
+            sum += value;
+        }
+    }
+    if(values.empty()) return location;
+    std::sort(values.begin(), values.end());
+    location.depthAveragePixelCount = static_cast<uint32_t>(values.size());
+    location.depthAverage = static_cast<float>(static_cast<double>(sum) / values.size());
+    location.depthMin = values.front();
+    location.depthMax = values.back();
+    location.depthMedian = values[values.size() / 2];
+    size_t best = 0;
+    for(size_t begin = 0, end = 0; begin < values.size(); begin = end) {
+        while(end < values.size() && values[end] == values[begin]) end++;
+        if(end - begin > best) {
+            best = end - begin;
+            location.depthMode = values[begin];
+        }
+    }
+    return location;
+}
+
+struct HostCalculator {
+    Pipeline pipeline{false};
+    std::shared_ptr<node::SpatialLocationCalculator> calculator;
+    std::shared_ptr<InputQueue> input;
+    std::shared_ptr<MessageQueue> output;
+
+    explicit HostCalculator(const std::vector<SpatialLocationCalculatorConfigData>& rois) {
+        calculator = pipeline.create<node::SpatialLocationCalculator>();
+        calculator->setRunOnHost(true);
+        calculator->initialConfig->setROIs(rois);
+        input = calculator->inputDepth.createInputQueue();
+        output = calculator->out.createOutputQueue();
+    }
+
+    std::vector<SpatialLocations> calculate(const std::shared_ptr<ImgFrame>& frame) {
+        input->send(frame);
+        auto data = output->get<SpatialLocationCalculatorData>();
+        REQUIRE(data != nullptr);
+        return data->getSpatialLocations();
+    }
+};
+
+}  // namespace
+
+TEST_CASE("SpatialLocationCalculator on host matches a rescan of each ROI", "[SpatialLocationCalculator]") {
+    // Enough ROIs to use the lookup tables, and a few which are scanned directly
+    for(const size_t count : {300, 5}) {
+        const auto rois = makeRois(count, static_cast<unsigned>(count));
+        HostCalculator host(rois);
+        host.pipeline.start();
+        for(unsigned seed = 0; seed < 2; seed++) {
+            const auto depth = makeDepth(seed);
+            const auto locations = host.calculate(makeFrame(depth));
+            REQUIRE(locations.size() == rois.size());
+            for(size_t i = 0; i < rois.size(); i++) {
+                const auto expected = reference(depth, rois[i]);
+                const auto& location = locations[i];
+                REQUIRE(location.depthAveragePixelCount == expected.depthAveragePixelCount);
+                REQUIRE(location.depthAverage == Approx(expected.depthAverage));
+                switch(rois[i].calculationAlgorithm) {
+                    case SpatialLocationCalculatorAlgorithm::AVERAGE:
+                        REQUIRE(location.spatialCoordinates.z == Approx(expected.depthAverage));
+                        break;
+                    case SpatialLocationCalculatorAlgorithm::MIN:
+                        REQUIRE(location.depthMin == expected.depthMin);
+                        REQUIRE(location.spatialCoordinates.z == expected.depthMin);
+                        break;
+                    case SpatialLocationCalculatorAlgorithm::MAX:
+                        REQUIRE(location.depthMax == expected.depthMax);
+                        REQUIRE(location.spatialCoordinates.z == expected.depthMax);
+                        break;
+                    case SpatialLocationCalculatorAlgorithm::MODE:
+                        REQUIRE(location.depthMode == expected.depthMode);
+                        break;
+                    case SpatialLocationCalculatorAlgorithm::MEDIAN:
+                        REQUIRE(location.depthMedian == expected.depthMedian);
+                        break;
+                }
+            }
+        }
+        host.pipeline.stop();
+    }
+}
+
+TEST_CASE("SpatialLocationCalculator on host projects ROIs with the frame intrinsics", "[SpatialLocationCalculator]") {
+    SpatialLocationCalculatorConfigData roi;
+    roi.roi = Rect(Point2f(400, 100), Point2f(440, 140));
+    roi.calculationAlgorithm = SpatialLocationCalculatorAlgorithm::AVERAGE;
+    HostCalculator host({roi});
+    host.pipeline.start();
+
+    auto frame = makeFrame(std::vector<uint16_t>(width * height, 2000));
+    frame->transformation = ImgTransformation(width, height, {{{500.0f, 0.0f, 320.0f}, {0.0f, 500.0f, 200.0f}, {0.0f, 0.0f, 1.0f}}});
+    const auto locations = host.calculate(frame);
+    REQUIRE(locations.size() == 1);
+    REQUIRE(locations[0].depthAverage == Approx(2000.0f));
+    REQUIRE(locations[0].spatialCoordinates.x == Approx(2000.0f * (420.0f - 320.0f) / 500.0f));
+    REQUIRE(locations[0].spatialCoordinates.y == Approx(-2000.0f * (120.0f - 200.0f) / 500.0f));
+    REQUIRE(locations[0].spatialCoordinates.z == Approx(2000.0f));
+    host.pipeline.stop();
+}
@@ -3,6 +3,9 @@
 // Include depthai library
 #include <depthai/depthai.hpp>
 #include <depthai/pipeline/datatype/StreamMessageParser.hpp>
+#include <depthai/xlink/XLinkStream.hpp>
+
+#include "XLink/XLinkPlatform.h"
 
 // TODO(themarpe) - fuzz me instead
 
@@ -130,4 +133,145 @@ TEST_CASE("Raw - Incorrect message too small size 2") {
     packet.length = ser.size();
 
     REQUIRE_THROWS(dai::StreamMessageParser::parseMessage(&packet));
-}
\ No newline at end of file
+}
+
+TEST_CASE("Raw - Message data is copied") {
+    dai::ImgFrame frm;
+    auto ser = dai::StreamMessageParser::serializeMetadata(frm);
+    std::vector<uint8_t> payload = {1, 2, 3, 4, 5, 6, 7, 8};
+    ser.insert(ser.begin(), payload.begin(), payload.end());
+
+    streamPacketDesc_t packet;
+    packet.data = ser.data();
+    packet.length = ser.size();
+    packet.fd = -1;
+
+    auto des = dai::StreamMessageParser::parseMessage(&packet);
+    // packet is borrowed, clobbering it must not affect the parsed message
+    std::fill(ser.begin(), ser.end(), 0);
+
+    auto data = des->data->getData();
+    REQUIRE(std::vector<uint8_t>(data.begin(), data.end()) == payload);
+}
+
+TEST_CASE("Owned packet data is not copied") {
+    dai::ImgFrame frm;
+    auto ser = dai::StreamMessageParser::serializeMetadata(frm);
+    std::vector<uint8_t> payload = {1, 2, 3, 4, 5, 6, 7, 8};
+    ser.insert(ser.begin(), payload.begin(), payload.end());
+
+    // Allocated like XLink does for moved packets, it is released with XLinkDeallocateMoveData
+    const uint32_t alignment = 64;
+    const auto allocationSize = static_cast<uint32_t>((ser.size() + alignment - 1) / alignment * alignment);
+    auto* buffer = static_cast<uint8_t*>(XLinkPlatformAllocateData(allocationSize, alignment));
+    REQUIRE(buffer != nullptr);
+    std::copy(ser.begin(), ser.end(), buffer);
+
+    dai::StreamPacketDesc packet;
+    packet.data = buffer;
+    packet.length = static_cast<uint32_t>(ser.size());
+    packet.fd = -1;
+
+    auto des = dai::StreamMessageParser::parseMessage(std::move(packet));
+
+    // Data aliases the packet buffer, trimmed to the data part
+    auto data = des->data->getData();
+    REQUIRE(data.data() == buffer);
+    REQUIRE(std::vector<uint8_t>(data.begin(), data.end()) == payload);
+
+    // Buffer is released when the last reference to the data drops
+    std::weak_ptr<dai::Memory> memory = des->data;
+    auto keep = des->data;
+    des.reset();
+    REQUIRE_FALSE(memory.expired());
+    keep.reset();
+    REQUIRE(memory.expired());
+}
+
+namespace {
+
+// Concatenates the packet as XLink would on the receiving side
+std::vector<uint8_t> toPacket(const dai::StreamMessageParser::FramedGroup& framed) {
+    std::vector<uint8_t> packet(framed.largestPayload.begin(), framed.largestPayload.end());
+    packet.insert(packet.end(), framed.rest.begin(), framed.rest.end());
+    return packet;
+}
+
+std::shared_ptr<dai::MessageGroup> createGroup(size_t members, size_t frameSize) {
+    auto group = std::make_shared<dai::MessageGroup>();
+    group->setSequenceNum(42);
+    for(size_t i = 0; i < members; i++) {
+        auto frame = std::make_shared<dai::ImgFrame>();
+        frame->setSequenceNum(i);
+        frame->setData(std::vector<uint8_t>(frameSize + i, static_cast<uint8_t>(i + 1)));
+        group->add("frame" + std::to_string(i), frame);
+    }
+    return group;
+}
+
+}  // namespace
+
+TEST_CASE("Framed group message") {
+    auto group = createGroup(4, 1000);
+    auto detections = std::make_shared<dai::ImgDetections>();
+    detections->detections.resize(3);
+    detections->detections[1].label = 7;
+    group->add("detections", detections);
+
+    const auto framed = dai::StreamMessageParser::serializeFramedGroup(*group);
+    // Largest payload is referenced, not copied
+    REQUIRE(framed.largestPayload.data() == group->get<dai::ImgFrame>("frame3")->getData().data());
+    auto ser = toPacket(framed);
+
+    streamPacketDesc_t packet;
+    packet.data = ser.data();
+    packet.length = ser.size();
+    packet.fd = -1;
+
+    auto des = std::dynamic_pointer_cast<dai::MessageGroup>(dai::StreamMessageParser::parseMessage(&packet));
+    std::fill(ser.begin(), ser.end(), 0);
+    REQUIRE(des != nullptr);
+    REQUIRE(des->getSequenceNum() == 42);
+    REQUIRE(des->getMessageNames() == group->getMessageNames());
+    for(size_t i = 0; i < 4; i++) {
+        auto frame = des->get<dai::ImgFrame>("frame" + std::to_string(i));
+        REQUIRE(frame != nullptr);
+        REQUIRE(frame->getSequenceNum() == static_cast<int64_t>(i));
+        auto data = frame->getData();
+        REQUIRE(std::vector<uint8_t>(data.begin(), data.end()) == std::vector<uint8_t>(1000 + i, static_cast<uint8_t>(i + 1)));
+        REQUIRE(reinterpret_cast<uintptr_t>(data.data()) % 16 == 0);
+    }
+    auto desDetections = des->get<dai::ImgDetections>("detections");
+    REQUIRE(desDetections != nullptr);
+    REQUIRE(desDetections->detections.size() == 3);
+    REQUIRE(desDetections->detections[1].label == 7);
+    REQUIRE(desDetections->getData().empty());
+}
+
+TEST_CASE("Framed group message without members") {
+    dai::MessageGroup group;
+    auto ser = toPacket(dai::StreamMessageParser::serializeFramedGroup(group));
+
+    streamPacketDesc_t packet;
+    packet.data = ser.data();
+    packet.length = ser.size();
+    packet.fd = -1;
+
+    auto des = std::dynamic_pointer_cast<dai::MessageGroup>(dai::StreamMessageParser::parseMessage(&packet));
+    REQUIRE(des != nullptr);
+    REQUIRE(des->getNumMessages() == 0);
+}
+
+TEST_CASE("Incorrect framed group message bad member count") {
+    auto ser = toPacket(dai::StreamMessageParser::serializeFramedGroup(*createGroup(2, 100)));
+
+    // wreak havoc on the member count
+    ser[ser.size() - 8 - MARKER_SIZE - 4] = 100;
+
+    streamPacketDesc_t packet;
+    packet.data = ser.data();
+    packet.length = ser.size();
+    packet.fd = -1;
+
+    REQUIRE_THROWS(dai::StreamMessageParser::parseMessage(&packet));
+}
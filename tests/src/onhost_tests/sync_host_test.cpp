@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../src/utility/SyncEngine.hpp"
+#include "depthai/depthai.hpp"
+
+using namespace dai;
+
+namespace {
+
+constexpr std::int64_t framePeriodNs = 33333333;
+constexpr std::int64_t thresholdNs = 10000000;
+
+std::shared_ptr<Buffer> makeBuffer(std::int64_t ns) {
+    auto buffer = std::make_shared<Buffer>();
+    buffer->setTimestamp(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(ns)));
+    return buffer;
+}
+
+std::int64_t toNs(const std::shared_ptr<Buffer>& buffer) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(buffer->getTimestamp().time_since_epoch()).count();
+}
+
+struct Arrival {
+    std::int64_t time;
+    std::size_t input;
+    std::int64_t ts;
+};
+
+// Cameras with capture jitter, delivered with transport jitter, so inputs arrive interleaved in any order
+std::vector<Arrival> makeArrivals(std::size_t numInputs, int frames, std::mt19937& gen) {
+    std::uniform_int_distribution<std::int64_t> captureJitter(-3000000, 3000000), transportJitter(0, 15000000);
+    std::vector<Arrival> arrivals;
+    for(int f = 0; f < frames; f++) {
+        for(std::size_t i = 0; i < numInputs; i++) {
+            const std::int64_t ts = 1000000000 + f * framePeriodNs + captureJitter(gen);
+            arrivals.push_back({ts + transportJitter(gen), i, ts});
+        }
+    }
+    std::stable_sort(arrivals.begin(), arrivals.end(), [](const Arrival& a, const Arrival& b) { return a.time < b.time; });
+    return arrivals;
+}
+
+}  // namespace
+
+TEST_CASE("SyncEngine matches jittered inputs without dropping", "[Sync]") {
+    std::mt19937 gen(4);
+    const std::size_t numInputs = 6;
+    const int frames = 300;
+    impl::SyncEngine engine(numInputs, thresholdNs, -1, 10);
+    std::vector<std::shared_ptr<Buffer>> group;
+    int groups = 0;
+    for(const auto& arrival : makeArrivals(numInputs, frames, gen)) {
+        engine.add(arrival.input, makeBuffer(arrival.ts));
+        while(engine.next(group)) {
+            REQUIRE(group.size() == numInputs);
+            const auto [minIt, maxIt] = std::minmax_element(group.begin(), group.end(), [](const auto& a, const auto& b) { return toNs(a) < toNs(b); });
+            REQUIRE(toNs(*maxIt) - toNs(*minIt) < thresholdNs);
+            // Groups come out in frame order
+            REQUIRE((toNs(*minIt) - 1000000000 + framePeriodNs / 2) / framePeriodNs == groups);
+            groups++;
+        }
+    }
+    REQUIRE(groups == frames);
+    REQUIRE(engine.getStats().groups == frames);
+    REQUIRE(engine.getStats().matched == frames * numInputs);
+    REQUIRE(engine.getStats().dropped == 0);
+    REQUIRE(engine.getStats().late == 0);
+}
+
+TEST_CASE("SyncEngine drops unmatched and late messages", "[Sync]") {
+    impl::SyncEngine engine(2, thresholdNs, -1, 10);
+    std::vector<std::shared_ptr<Buffer>> group;
+
+    // Input 1 lost its first frame, the first frame of input 0 can't be matched anymore
+    engine.add(0, makeBuffer(0));
+    engine.add(0, makeBuffer(framePeriodNs));
+    engine.add(1, makeBuffer(framePeriodNs + 1000));
+    REQUIRE(engine.next(group));
+    REQUIRE(toNs(group[0]) == framePeriodNs);
+    REQUIRE(toNs(group[1]) == framePeriodNs + 1000);
+    REQUIRE_FALSE(engine.next(group));
+
+    // Older than what was already sent out
+    engine.add(1, makeBuffer(framePeriodNs / 2));
+    const auto stats = engine.getStats();
+    REQUIRE(stats.groups == 1);
+    REQUIRE(stats.dropped == 1);
+    REQUIRE(stats.late == 1);
+}
+
+TEST_CASE("SyncEngine sends unsynced groups after the allowed attempts", "[Sync]") {
+    for(int syncAttempts : {-1, 0, 3}) {
+        impl::SyncEngine engine(2, thresholdNs, syncAttempts, 10);
+        std::vector<std::shared_ptr<Buffer>> group;
+        int groups = 0;
+        // Inputs half a frame apart never get within the threshold
+        for(int f = 0; f < 20; f++) {
+            engine.add(0, makeBuffer(f * framePeriodNs));
+            engine.add(1, makeBuffer(f * framePeriodNs + framePeriodNs / 2));
+            while(engine.next(group)) groups++;
+        }
+        if(syncAttempts == -1) REQUIRE(groups == 0);
+        // One discarded message, then the next pair goes out unsynced
+        if(syncAttempts == 0) REQUIRE(groups == 10);
+        if(syncAttempts == 3) REQUIRE(groups > 0);
+        REQUIRE(engine.getStats().groups == static_cast<std::uint64_t>(groups));
+    }
+}
+
+TEST_CASE("Host Sync groups messages arriving in any order", "[Sync]") {
+    const std::vector<std::string> names = {"a", "b", "c", "d"};
+    Pipeline p(false);
+    auto sync = p.create<node::Sync>();
+    sync->setRunOnHost(true);
+    sync->setSyncThreshold(std::chrono::nanoseconds(thresholdNs));
+    std::vector<std::shared_ptr<InputQueue>> queues;
+    for(const auto& name : names) queues.push_back(sync->inputs[name].createInputQueue());
+    auto out = sync->out.createOutputQueue();
+    p.start();
+
+    std::mt19937 gen(8);
+    const int frames = 30;
+    auto arrivals = makeArrivals(names.size(), frames, gen);
+    size_t next = 0;
+    for(int f = 0; f < frames; f++) {
+        // Send everything needed to complete this frame, which may include parts of the next ones
+        std::vector<bool> done(names.size(), false);
+        while(std::count(done.begin(), done.end(), true) < static_cast<long>(names.size())) {
+            const auto& arrival = arrivals[next++];
+            queues[arrival.input]->send(makeBuffer(arrival.ts));
+            if((arrival.ts - 1000000000 + framePeriodNs / 2) / framePeriodNs == f) done[arrival.input] = true;
+        }
+        auto group = out->get<MessageGroup>();
+        REQUIRE(group != nullptr);
+        REQUIRE(static_cast<size_t>(group->getNumMessages()) == names.size());
+        std::int64_t newest = 0;
+        for(const auto& name : names) newest = std::max(newest, toNs(group->get<Buffer>(name)));
+        REQUIRE(toNs(group) == newest);
+    }
+    const auto stats = sync->getStats();
+    REQUIRE(stats.groups == frames);
+    REQUIRE(stats.dropped == 0);
+    p.stop();
+}
@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "depthai/utility/MappedFileMemory.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+fs::path writeFile(const fs::path& path, const std::vector<std::uint8_t>& data) {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return path;
+}
+
+std::vector<std::uint8_t> readFile(const fs::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), {}};
+}
+
+}  // namespace
+
+TEST_CASE("MappedFileMemory maps the file", "[MappedFileMemory]") {
+    std::vector<std::uint8_t> data(100000);
+    std::iota(data.begin(), data.end(), std::uint8_t(0));
+    const auto path = writeFile(fs::temp_directory_path() / "mapped_file_memory_test.bin", data);
+    {
+        dai::MappedFileMemory memory(path);
+        REQUIRE(memory.getSize() == data.size());
+        REQUIRE(memory.getMaxSize() == data.size());
+        REQUIRE(memory.getOffset() == 0);
+        const auto mapped = memory.getData();
+        REQUIRE(std::vector<std::uint8_t>(mapped.begin(), mapped.end()) == data);
+
+        // Writes stay private to the mapping
+        memory.getData()[0] = 42;
+        REQUIRE(memory.getData()[0] == 42);
+        REQUIRE(readFile(path) == data);
+
+        memory.setSize(10);
+        REQUIRE(memory.getSize() == 10);
+        REQUIRE_THROWS_AS(memory.setSize(data.size() + 1), std::invalid_argument);
+    }
+    fs::remove(path);
+}
+
+TEST_CASE("MappedFileMemory of an empty file", "[MappedFileMemory]") {
+    const auto path = writeFile(fs::temp_directory_path() / "mapped_file_memory_empty_test.bin", {});
+    {
+        dai::MappedFileMemory memory(path);
+        REQUIRE(memory.getSize() == 0);
+    }
+    fs::remove(path);
+    REQUIRE_THROWS(dai::MappedFileMemory(path));
+}